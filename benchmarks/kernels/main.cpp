@@ -0,0 +1,963 @@
+// Filename: main.cpp
+// Created on 11 Dec 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for C++ standard library
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyDataOpsManager.h>
+#include <HierarchyDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <LocationIndexRobinBcCoefs.h>
+#include <PoissonSpecifications.h>
+#include <SAMRAIVectorReal.h>
+#include <SideData.h>
+#include <SideGeometry.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/StaggeredStokesOperator.h>
+#include <ibamr/StaggeredStokesPhysicalBoundaryHelper.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonPointRelaxationFACOperator.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/SCPoissonPointRelaxationFACOperator.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Function prototypes
+void write_structure_files(const std::string& base_filename,
+                           int num_rings,
+                           int nodes_per_ring,
+                           double spring_stiffness,
+                           double beam_stiffness,
+                           const double* x_lo,
+                           const double* x_up);
+
+double count_data_values(Pointer<PatchHierarchy<NDIM> > hierarchy, int data_idx, bool count_ghosts);
+
+void report_result(std::ofstream& results_stream,
+                   const std::string& label,
+                   const std::string& benchmark,
+                   const std::string& variant,
+                   const std::string& units,
+                   double num_items,
+                   double bytes_per_item,
+                   int num_reps,
+                   double elapsed_time);
+
+/*******************************************************************************
+ * Microbenchmarks for the performance-critical kernels of IBTK and IBAMR.     *
+ *                                                                             *
+ * A synthetic patch hierarchy is refined about a synthetic Lagrangian         *
+ * structure that is generated in-process, and the following operations are   *
+ * timed:                                                                      *
+ *                                                                             *
+ *    - LEInteractor::spread() and LEInteractor::interpolate() for each kernel *
+ *    - the cell- and side-centered Poisson point relaxation smoothers         *
+ *    - StaggeredStokesOperator::apply()                                       *
+ *    - HierarchyGhostCellInterpolation::fillData()                            *
+ *    - IBStandardForceGen::computeLagrangianForce()                           *
+ *    - LDataManager::spread() for one and for several quantities per call     *
+ *    - LDataManager data redistribution                                       *
+ *                                                                             *
+ * The throughput of each operation is printed and is also appended to a JSON  *
+ * Lines results file.  For each run, the input filename must be given on the  *
+ * command line:                                                               *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "kernels.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const int num_reps = input_db->getIntegerWithDefault("num_reps", 10);
+        const int num_sweeps = input_db->getIntegerWithDefault("num_sweeps", 4);
+        const int markers_per_cell = input_db->getIntegerWithDefault("markers_per_cell", 4);
+        const int num_rings = input_db->getIntegerWithDefault("num_rings", 8);
+        const int nodes_per_ring = input_db->getIntegerWithDefault("nodes_per_ring", 512);
+        const double spring_stiffness = input_db->getDoubleWithDefault("spring_stiffness", 1.0);
+        const double beam_stiffness = input_db->getDoubleWithDefault("beam_stiffness", 1.0e-3);
+        const double displacement = input_db->getDoubleWithDefault("displacement", 0.5);
+        const std::string results_file_name = input_db->getStringWithDefault("results_file_name", "kernels.jsonl");
+        const std::string label = input_db->getStringWithDefault("label", "");
+
+        std::vector<std::string> kernel_fcns;
+        if (input_db->keyExists("kernel_fcns"))
+        {
+            kernel_fcns.resize(input_db->getArraySize("kernel_fcns"));
+            input_db->getStringArray("kernel_fcns", &kernel_fcns[0], static_cast<int>(kernel_fcns.size()));
+        }
+        else
+        {
+            static const char* const all_kernel_fcns[] = { "PIECEWISE_CONSTANT",
+                                                           "DISCONTINUOUS_LINEAR",
+                                                           "PIECEWISE_LINEAR",
+                                                           "PIECEWISE_CUBIC",
+                                                           "IB_3",
+                                                           "IB_4",
+                                                           "IB_4_W8",
+                                                           "IB_5",
+                                                           "IB_6",
+                                                           "BSPLINE_3",
+                                                           "BSPLINE_4",
+                                                           "BSPLINE_5",
+                                                           "BSPLINE_6" };
+            kernel_fcns.assign(all_kernel_fcns, all_kernel_fcns + sizeof(all_kernel_fcns) / sizeof(const char*));
+        }
+
+        std::vector<std::string> smoother_types;
+        if (input_db->keyExists("smoother_types"))
+        {
+            smoother_types.resize(input_db->getArraySize("smoother_types"));
+            input_db->getStringArray("smoother_types", &smoother_types[0], static_cast<int>(smoother_types.size()));
+        }
+        else
+        {
+            smoother_types.push_back("PATCH_GAUSS_SEIDEL");
+            smoother_types.push_back("PROCESSOR_GAUSS_SEIDEL");
+            smoother_types.push_back("RED_BLACK_GAUSS_SEIDEL");
+        }
+
+        // Results are appended to the results file so that the output of
+        // several runs (e.g. of different versions of the library on the same
+        // machine) can be collected in a single file.
+        std::ofstream results_stream;
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            results_stream.open(results_file_name.c_str(), std::ios::app);
+            if (!results_stream.is_open())
+            {
+                TBOX_ERROR("main(): unable to open results file " << results_file_name << "\n");
+            }
+        }
+
+        // Generate the synthetic structure.  The structure files must be
+        // written before the Lagrangian initializer is constructed, because
+        // the initializer reads them in its constructor.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<Database> ib_initializer_db = app_initializer->getComponentDatabase("IBStandardInitializer");
+        const std::string structure_name = ib_initializer_db->getStringArray("structure_names")[0];
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            write_structure_files(structure_name,
+                                  num_rings,
+                                  nodes_per_ring,
+                                  spring_stiffness,
+                                  beam_stiffness,
+                                  grid_geometry->getXLower(),
+                                  grid_geometry->getXUpper());
+        }
+        SAMRAI_MPI::barrier();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        // The patch hierarchy is refined about the Lagrangian structure.
+        Pointer<IBMethod> ib_method_ops =
+            new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"), /*register_for_restart*/ false);
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               ib_method_ops,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        Pointer<IBStandardInitializer> ib_initializer =
+            new IBStandardInitializer("IBStandardInitializer", ib_initializer_db);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        int le_gcw = 0;
+        for (unsigned int k = 0; k < kernel_fcns.size(); ++k)
+        {
+            le_gcw = std::max(le_gcw, LEInteractor::getMinimumGhostWidth(kernel_fcns[k]));
+        }
+        Pointer<SideVariable<NDIM, double> > u_le_var = new SideVariable<NDIM, double>("u_le");
+        const int u_le_idx = var_db->registerVariableAndContext(u_le_var, ctx, IntVector<NDIM>(le_gcw));
+        Pointer<CellVariable<NDIM, double> > q_cc_var = new CellVariable<NDIM, double>("q_cc");
+        const int e_cc_idx = var_db->registerVariableAndContext(q_cc_var, var_db->getContext("e"), IntVector<NDIM>(1));
+        const int r_cc_idx = var_db->registerVariableAndContext(q_cc_var, var_db->getContext("r"), IntVector<NDIM>(1));
+        Pointer<SideVariable<NDIM, double> > q_sc_var = new SideVariable<NDIM, double>("q_sc");
+        const int e_sc_idx = var_db->registerVariableAndContext(q_sc_var, var_db->getContext("e"), IntVector<NDIM>(1));
+        const int r_sc_idx = var_db->registerVariableAndContext(q_sc_var, var_db->getContext("r"), IntVector<NDIM>(1));
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        const int u_x_idx = var_db->registerVariableAndContext(u_var, var_db->getContext("x"), IntVector<NDIM>(1));
+        const int u_y_idx = var_db->registerVariableAndContext(u_var, var_db->getContext("y"), IntVector<NDIM>(1));
+        Pointer<CellVariable<NDIM, double> > p_var = new CellVariable<NDIM, double>("p");
+        const int p_x_idx = var_db->registerVariableAndContext(p_var, var_db->getContext("x"), IntVector<NDIM>(1));
+        const int p_y_idx = var_db->registerVariableAndContext(p_var, var_db->getContext("y"), IntVector<NDIM>(1));
+        const int ghost_cell_width = input_db->getIntegerWithDefault("ghost_cell_width", 2);
+        Pointer<CellVariable<NDIM, double> > q_gc_cc_var = new CellVariable<NDIM, double>("q_gc_cc");
+        const int q_gc_cc_idx =
+            var_db->registerVariableAndContext(q_gc_cc_var, ctx, IntVector<NDIM>(ghost_cell_width));
+        Pointer<SideVariable<NDIM, double> > q_gc_sc_var = new SideVariable<NDIM, double>("q_gc_sc");
+        const int q_gc_sc_idx =
+            var_db->registerVariableAndContext(q_gc_sc_var, ctx, IntVector<NDIM>(ghost_cell_width));
+
+        // Initialize the AMR patch hierarchy and the Lagrangian data.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int coarsest_ln = 0;
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int wgt_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int wgt_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+
+        pout << "\n"
+             << "number of levels:       " << finest_ln + 1 << "\n"
+             << "number of repetitions:  " << num_reps << "\n"
+             << "number of processors:   " << SAMRAI_MPI::getNodes() << "\n"
+             << "results file:           " << results_file_name << "\n\n";
+
+        // Time LEInteractor::spread() and LEInteractor::interpolate() on the
+        // finest level of the patch hierarchy.  The markers are placed in the
+        // patch interiors because these routines do not support periodic
+        // offsets.
+        {
+            std::srand(1 + SAMRAI_MPI::getRank());
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(finest_ln);
+            level->allocatePatchData(u_le_idx);
+            std::vector<Pointer<Patch<NDIM> > > patches;
+            std::vector<std::vector<double> > X_data, Q_data;
+            double num_markers = 0.0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<SideData<NDIM, double> > u_le_data = patch->getPatchData(u_le_idx);
+                u_le_data->fillAll(0.0);
+                Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                const double* const patch_x_lo = pgeom->getXLower();
+                const double* const patch_x_up = pgeom->getXUpper();
+                const int n_markers = markers_per_cell * patch->getBox().size();
+                std::vector<double> X(NDIM * n_markers), Q(NDIM * n_markers);
+                for (int k = 0; k < n_markers; ++k)
+                {
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        const double r = static_cast<double>(std::rand()) / static_cast<double>(RAND_MAX);
+                        X[NDIM * k + d] = patch_x_lo[d] + r * (patch_x_up[d] - patch_x_lo[d]);
+                        Q[NDIM * k + d] = static_cast<double>(std::rand()) / static_cast<double>(RAND_MAX);
+                    }
+                }
+                patches.push_back(patch);
+                X_data.push_back(X);
+                Q_data.push_back(Q);
+                num_markers += n_markers;
+            }
+            num_markers = SAMRAI_MPI::sumReduction(num_markers);
+
+            for (unsigned int k = 0; k < kernel_fcns.size(); ++k)
+            {
+                const std::string& kernel_fcn = kernel_fcns[k];
+                const double stencil_size = LEInteractor::getStencilSize(kernel_fcn);
+                const double stencil_pts = std::pow(stencil_size, NDIM);
+                const double marker_bytes = 2.0 * NDIM * sizeof(double);
+
+                SAMRAI_MPI::barrier();
+                double t_start = MPI_Wtime();
+                for (int rep = 0; rep < num_reps; ++rep)
+                {
+                    for (unsigned int i = 0; i < patches.size(); ++i)
+                    {
+                        Pointer<SideData<NDIM, double> > u_le_data = patches[i]->getPatchData(u_le_idx);
+                        LEInteractor::spread(u_le_data,
+                                             Q_data[i],
+                                             NDIM,
+                                             X_data[i],
+                                             NDIM,
+                                             patches[i],
+                                             u_le_data->getGhostBox(),
+                                             kernel_fcn);
+                    }
+                }
+                SAMRAI_MPI::barrier();
+                report_result(results_stream,
+                              label,
+                              "LEInteractor::spread",
+                              kernel_fcn,
+                              "markers",
+                              num_markers,
+                              NDIM * 2.0 * stencil_pts * sizeof(double) + marker_bytes,
+                              num_reps,
+                              MPI_Wtime() - t_start);
+
+                SAMRAI_MPI::barrier();
+                t_start = MPI_Wtime();
+                for (int rep = 0; rep < num_reps; ++rep)
+                {
+                    for (unsigned int i = 0; i < patches.size(); ++i)
+                    {
+                        Pointer<SideData<NDIM, double> > u_le_data = patches[i]->getPatchData(u_le_idx);
+                        LEInteractor::interpolate(Q_data[i],
+                                                  NDIM,
+                                                  X_data[i],
+                                                  NDIM,
+                                                  u_le_data,
+                                                  patches[i],
+                                                  patches[i]->getBox(),
+                                                  kernel_fcn);
+                    }
+                }
+                SAMRAI_MPI::barrier();
+                report_result(results_stream,
+                              label,
+                              "LEInteractor::interpolate",
+                              kernel_fcn,
+                              "markers",
+                              num_markers,
+                              NDIM * stencil_pts * sizeof(double) + marker_bytes,
+                              num_reps,
+                              MPI_Wtime() - t_start);
+            }
+            patches.clear();
+            level->deallocatePatchData(u_le_idx);
+        }
+
+        // Time the Poisson point relaxation smoothers.  Each repetition
+        // performs num_sweeps sweeps on each level of the patch hierarchy.
+        // The error vector must have a ghost cell width of at least one, and
+        // each sweep reads the error and residual and writes the error.
+        {
+            PoissonSpecifications poisson_spec("poisson_spec");
+            poisson_spec.setCZero();
+            poisson_spec.setDConstant(-1.0);
+            Pointer<Database> fac_op_db = app_initializer->getComponentDatabase("PoissonFACOperator");
+            for (int cc = 1; cc >= 0; --cc)
+            {
+                const bool use_cell_data = (cc == 1);
+                Pointer<Variable<NDIM> > q_var;
+                if (use_cell_data)
+                {
+                    q_var = q_cc_var;
+                }
+                else
+                {
+                    q_var = q_sc_var;
+                }
+                const int e_idx = use_cell_data ? e_cc_idx : e_sc_idx;
+                const int r_idx = use_cell_data ? r_cc_idx : r_sc_idx;
+                const int wgt_idx = use_cell_data ? wgt_cc_idx : wgt_sc_idx;
+                SAMRAIVectorReal<NDIM, double> e_vec("e", patch_hierarchy, coarsest_ln, finest_ln);
+                e_vec.addComponent(q_var, e_idx, wgt_idx);
+                e_vec.allocateVectorData();
+                e_vec.setRandomValues(1.0, 0.0);
+                SAMRAIVectorReal<NDIM, double> r_vec("r", patch_hierarchy, coarsest_ln, finest_ln);
+                r_vec.addComponent(q_var, r_idx, wgt_idx);
+                r_vec.allocateVectorData();
+                r_vec.setRandomValues(1.0, 0.0);
+                const double num_dofs = count_data_values(patch_hierarchy, e_idx, /*count_ghosts*/ false);
+                const std::string benchmark = use_cell_data ? "CCPoissonPointRelaxationFACOperator::smoothError" :
+                                                              "SCPoissonPointRelaxationFACOperator::smoothError";
+
+                for (unsigned int k = 0; k < smoother_types.size(); ++k)
+                {
+                    Pointer<PoissonFACPreconditionerStrategy> fac_op;
+                    if (use_cell_data)
+                    {
+                        Pointer<CCPoissonPointRelaxationFACOperator> cc_fac_op =
+                            new CCPoissonPointRelaxationFACOperator("cc_fac_op", fac_op_db, "bench_");
+                        cc_fac_op->setSmootherType(smoother_types[k]);
+                        fac_op = cc_fac_op;
+                    }
+                    else
+                    {
+                        Pointer<SCPoissonPointRelaxationFACOperator> sc_fac_op =
+                            new SCPoissonPointRelaxationFACOperator("sc_fac_op", fac_op_db, "bench_");
+                        sc_fac_op->setSmootherType(smoother_types[k]);
+                        fac_op = sc_fac_op;
+                    }
+                    fac_op->setPoissonSpecifications(poisson_spec);
+                    fac_op->initializeOperatorState(e_vec, r_vec);
+
+                    SAMRAI_MPI::barrier();
+                    const double t_start = MPI_Wtime();
+                    for (int rep = 0; rep < num_reps; ++rep)
+                    {
+                        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+                        {
+                            fac_op->smoothError(e_vec, r_vec, ln, num_sweeps, false, false);
+                        }
+                    }
+                    SAMRAI_MPI::barrier();
+                    report_result(results_stream,
+                                  label,
+                                  benchmark,
+                                  smoother_types[k],
+                                  "DOFs",
+                                  num_sweeps * num_dofs,
+                                  3.0 * sizeof(double),
+                                  num_reps,
+                                  MPI_Wtime() - t_start);
+                    fac_op->deallocateOperatorState();
+                }
+                e_vec.deallocateVectorData();
+                r_vec.deallocateVectorData();
+            }
+        }
+
+        // Setup homogeneous Dirichlet boundary conditions for the velocity.
+        // These are only used at non-periodic physical boundaries.
+        LocationIndexRobinBcCoefs<NDIM> u_bc_coef("u_bc_coef", Pointer<Database>(NULL));
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            u_bc_coef.setBoundaryValue(2 * d, 0.0);
+            u_bc_coef.setBoundaryValue(2 * d + 1, 0.0);
+        }
+        const std::vector<RobinBcCoefStrategy<NDIM>*> u_bc_coefs(NDIM, &u_bc_coef);
+
+        // Time StaggeredStokesOperator::apply().  Each application reads the
+        // velocity and pressure and writes the velocity and pressure.
+        {
+            SAMRAIVectorReal<NDIM, double> x_vec("x", patch_hierarchy, coarsest_ln, finest_ln);
+            x_vec.addComponent(u_var, u_x_idx, wgt_sc_idx);
+            x_vec.addComponent(p_var, p_x_idx, wgt_cc_idx);
+            x_vec.allocateVectorData();
+            x_vec.setRandomValues(1.0, 0.0);
+            SAMRAIVectorReal<NDIM, double> y_vec("y", patch_hierarchy, coarsest_ln, finest_ln);
+            y_vec.addComponent(u_var, u_y_idx, wgt_sc_idx);
+            y_vec.addComponent(p_var, p_y_idx, wgt_cc_idx);
+            y_vec.allocateVectorData();
+            const double num_dofs = count_data_values(patch_hierarchy, u_x_idx, /*count_ghosts*/ false) +
+                                    count_data_values(patch_hierarchy, p_x_idx, /*count_ghosts*/ false);
+
+            PoissonSpecifications U_problem_coefs("U_problem_coefs");
+            U_problem_coefs.setCConstant(input_db->getDoubleWithDefault("rho", 1.0));
+            U_problem_coefs.setDConstant(-input_db->getDoubleWithDefault("mu", 1.0e-2));
+            Pointer<StaggeredStokesPhysicalBoundaryHelper> bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
+            bc_helper->cacheBcCoefData(u_bc_coefs, 0.0, patch_hierarchy);
+            StaggeredStokesOperator stokes_op("stokes_op");
+            stokes_op.setVelocityPoissonSpecifications(U_problem_coefs);
+            stokes_op.setPhysicalBoundaryHelper(bc_helper);
+            stokes_op.initializeOperatorState(x_vec, y_vec);
+
+            SAMRAI_MPI::barrier();
+            const double t_start = MPI_Wtime();
+            for (int rep = 0; rep < num_reps; ++rep)
+            {
+                stokes_op.apply(x_vec, y_vec);
+            }
+            SAMRAI_MPI::barrier();
+            report_result(results_stream,
+                          label,
+                          "StaggeredStokesOperator::apply",
+                          "",
+                          "DOFs",
+                          num_dofs,
+                          2.0 * sizeof(double),
+                          num_reps,
+                          MPI_Wtime() - t_start);
+            stokes_op.deallocateOperatorState();
+            bc_helper->clearBcCoefData();
+            x_vec.deallocateVectorData();
+            y_vec.deallocateVectorData();
+        }
+
+        // Time HierarchyGhostCellInterpolation::fillData() for cell- and
+        // side-centered data.  Each ghost value is read from a source and
+        // written to the destination.
+        {
+            for (int cc = 1; cc >= 0; --cc)
+            {
+                const bool use_cell_data = (cc == 1);
+                Pointer<Variable<NDIM> > q_var;
+                if (use_cell_data)
+                {
+                    q_var = q_gc_cc_var;
+                }
+                else
+                {
+                    q_var = q_gc_sc_var;
+                }
+                const int q_idx = use_cell_data ? q_gc_cc_idx : q_gc_sc_idx;
+                const int wgt_idx = use_cell_data ? wgt_cc_idx : wgt_sc_idx;
+                SAMRAIVectorReal<NDIM, double> q_vec("q", patch_hierarchy, coarsest_ln, finest_ln);
+                q_vec.addComponent(q_var, q_idx, wgt_idx);
+                q_vec.allocateVectorData();
+                q_vec.setRandomValues(1.0, 0.0);
+                const double num_ghosts = count_data_values(patch_hierarchy, q_idx, /*count_ghosts*/ true);
+
+                const std::vector<RobinBcCoefStrategy<NDIM>*> q_bc_coefs =
+                    use_cell_data ? std::vector<RobinBcCoefStrategy<NDIM>*>() : u_bc_coefs;
+                HierarchyGhostCellInterpolation::InterpolationTransactionComponent q_component(
+                    q_idx, "CONSERVATIVE_LINEAR_REFINE", false, "CONSERVATIVE_COARSEN", "LINEAR", false, q_bc_coefs);
+                HierarchyGhostCellInterpolation ghost_fill_op;
+                ghost_fill_op.initializeOperatorState(q_component, patch_hierarchy);
+
+                SAMRAI_MPI::barrier();
+                const double t_start = MPI_Wtime();
+                for (int rep = 0; rep < num_reps; ++rep)
+                {
+                    ghost_fill_op.fillData(0.0);
+                }
+                SAMRAI_MPI::barrier();
+                report_result(results_stream,
+                              label,
+                              "HierarchyGhostCellInterpolation::fillData",
+                              use_cell_data ? "cell" : "side",
+                              "ghost values",
+                              num_ghosts,
+                              2.0 * sizeof(double),
+                              num_reps,
+                              MPI_Wtime() - t_start);
+                ghost_fill_op.deallocateOperatorState();
+                q_vec.deallocateVectorData();
+            }
+        }
+
+        // Time IBStandardForceGen::computeLagrangianForce() on each level that
+        // contains Lagrangian data.  Each node position is read (from each of
+        // the force specifications that uses it) and each nodal force is
+        // written.
+        {
+            Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+            for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+            {
+                if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+                ib_force_fcn->initializeLevelData(patch_hierarchy, ln, 0.0, /*initial_time*/ true, l_data_manager);
+                Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+                Pointer<LData> U_data = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, ln);
+                Pointer<LData> F_data = l_data_manager->createLData("F_bench", ln, NDIM);
+                const double num_nodes = l_data_manager->getNumberOfNodes(ln);
+                std::ostringstream variant;
+                variant << "level_" << ln;
+
+                SAMRAI_MPI::barrier();
+                const double t_start = MPI_Wtime();
+                for (int rep = 0; rep < num_reps; ++rep)
+                {
+                    ib_force_fcn->computeLagrangianForce(
+                        F_data, X_data, U_data, patch_hierarchy, ln, 0.0, l_data_manager);
+                }
+                SAMRAI_MPI::barrier();
+                report_result(results_stream,
+                              label,
+                              "IBStandardForceGen::computeLagrangianForce",
+                              variant.str(),
+                              "markers",
+                              num_nodes,
+                              3.0 * NDIM * sizeof(double),
+                              num_reps,
+                              MPI_Wtime() - t_start);
+            }
+        }
+
+        // Time LDataManager::spread() for several side-centered quantities,
+        // both one at a time and with a single call to the multi-quantity
+        // version of spread().  The maximum difference between the two results
+        // is also reported.
+        {
+            static const int num_fields = 2;
+            Pointer<SideVariable<NDIM, double> > f_var = new SideVariable<NDIM, double>("f_spread");
+            std::vector<int> f_single_idxs(num_fields), f_multi_idxs(num_fields);
+            std::vector<std::vector<Pointer<LData> > > F_data(num_fields,
+                                                             std::vector<Pointer<LData> >(finest_ln + 1));
+            std::vector<Pointer<LData> > X_data(finest_ln + 1);
+            for (int k = 0; k < num_fields; ++k)
+            {
+                std::ostringstream k_str;
+                k_str << k;
+                f_single_idxs[k] = var_db->registerVariableAndContext(
+                    f_var, var_db->getContext("single_" + k_str.str()), IntVector<NDIM>(le_gcw));
+                f_multi_idxs[k] = var_db->registerVariableAndContext(
+                    f_var, var_db->getContext("multi_" + k_str.str()), IntVector<NDIM>(le_gcw));
+            }
+            double num_nodes = 0.0;
+            for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+                for (int k = 0; k < num_fields; ++k)
+                {
+                    level->allocatePatchData(f_single_idxs[k]);
+                    level->allocatePatchData(f_multi_idxs[k]);
+                }
+                if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+                X_data[ln] = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+                for (int k = 0; k < num_fields; ++k)
+                {
+                    F_data[k][ln] = l_data_manager->createLData("F_spread_bench", ln, NDIM);
+                    VecSet(F_data[k][ln]->getVec(), static_cast<double>(k + 1));
+                }
+                num_nodes += l_data_manager->getNumberOfNodes(ln);
+            }
+            Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops =
+                HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, patch_hierarchy, true);
+            for (int k = 0; k < num_fields; ++k)
+            {
+                f_data_ops->setToScalar(f_single_idxs[k], 0.0, /*interior_only*/ false);
+                f_data_ops->setToScalar(f_multi_idxs[k], 0.0, /*interior_only*/ false);
+            }
+            const double marker_bytes = num_fields * NDIM * sizeof(double) + NDIM * sizeof(double);
+
+            SAMRAI_MPI::barrier();
+            double t_start = MPI_Wtime();
+            for (int rep = 0; rep < num_reps; ++rep)
+            {
+                for (int k = 0; k < num_fields; ++k)
+                {
+                    l_data_manager->spread(f_single_idxs[k],
+                                           F_data[k],
+                                           X_data,
+                                           static_cast<RobinPhysBdryPatchStrategy*>(NULL),
+                                           std::vector<Pointer<RefineSchedule<NDIM> > >(),
+                                           0.0,
+                                           /*F_data_ghost_node_update*/ true,
+                                           /*X_data_ghost_node_update*/ true);
+                }
+            }
+            SAMRAI_MPI::barrier();
+            report_result(results_stream,
+                          label,
+                          "LDataManager::spread",
+                          "per_quantity",
+                          "markers",
+                          num_nodes,
+                          marker_bytes,
+                          num_reps,
+                          MPI_Wtime() - t_start);
+
+            SAMRAI_MPI::barrier();
+            t_start = MPI_Wtime();
+            for (int rep = 0; rep < num_reps; ++rep)
+            {
+                l_data_manager->spread(f_multi_idxs,
+                                       F_data,
+                                       X_data,
+                                       std::vector<RobinPhysBdryPatchStrategy*>(),
+                                       std::vector<std::vector<Pointer<RefineSchedule<NDIM> > > >(),
+                                       0.0,
+                                       std::vector<bool>(num_fields, true));
+            }
+            SAMRAI_MPI::barrier();
+            report_result(results_stream,
+                          label,
+                          "LDataManager::spread",
+                          "multi_quantity",
+                          "markers",
+                          num_nodes,
+                          marker_bytes,
+                          num_reps,
+                          MPI_Wtime() - t_start);
+
+            double max_diff = 0.0;
+            for (int k = 0; k < num_fields; ++k)
+            {
+                f_data_ops->subtract(f_multi_idxs[k], f_multi_idxs[k], f_single_idxs[k]);
+                max_diff = std::max(max_diff, f_data_ops->maxNorm(f_multi_idxs[k]));
+            }
+            pout << "LDataManager::spread maximum difference between per_quantity and multi_quantity: " << max_diff
+                 << "\n";
+
+            for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+                for (int k = 0; k < num_fields; ++k)
+                {
+                    level->deallocatePatchData(f_single_idxs[k]);
+                    level->deallocatePatchData(f_multi_idxs[k]);
+                }
+            }
+        }
+
+        // Time LDataManager data redistribution.  Between redistributions, the
+        // structure is translated back and forth by a fraction of a grid cell,
+        // so that nodes move between cells and between patches.  The
+        // translation itself is not timed.
+        {
+            double shift = displacement;
+            const double* const dx_coarsest = grid_geometry->getDx();
+            const IntVector<NDIM>& ratio = patch_hierarchy->getPatchLevel(finest_ln)->getRatio();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                shift = std::min(shift, displacement * dx_coarsest[d] / static_cast<double>(ratio(d)));
+            }
+            double num_nodes = 0.0;
+            for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+            {
+                if (l_data_manager->levelContainsLagrangianData(ln)) num_nodes += l_data_manager->getNumberOfNodes(ln);
+            }
+
+            double elapsed_time = 0.0;
+            for (int rep = 0; rep < num_reps; ++rep)
+            {
+                const double rep_shift = (rep % 2 == 0) ? shift : -shift;
+                for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+                {
+                    if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+                    Vec X_vec = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln)->getVec();
+                    VecShift(X_vec, rep_shift);
+                }
+
+                SAMRAI_MPI::barrier();
+                const double t_start = MPI_Wtime();
+                l_data_manager->beginDataRedistribution();
+                l_data_manager->endDataRedistribution();
+                SAMRAI_MPI::barrier();
+                elapsed_time += MPI_Wtime() - t_start;
+            }
+            report_result(results_stream,
+                          label,
+                          "LDataManager::beginDataRedistribution",
+                          "begin+end",
+                          "markers",
+                          num_nodes,
+                          0.0,
+                          num_reps,
+                          elapsed_time);
+        }
+
+        pout << "\n";
+        if (SAMRAI_MPI::getRank() == 0) results_stream.close();
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return 0;
+} // main
+
+void
+write_structure_files(const std::string& base_filename,
+                      const int num_rings,
+                      const int nodes_per_ring,
+                      const double spring_stiffness,
+                      const double beam_stiffness,
+                      const double* const x_lo,
+                      const double* const x_up)
+{
+    // The structure consists of closed rings of nodes connected by springs and
+    // beams.  In 2D, the rings are concentric circles.  In 3D, the rings are
+    // the lines of latitude of a sphere, and adjacent rings are also connected
+    // by springs.
+    double X_center[NDIM];
+    double radius = 0.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        X_center[d] = 0.5 * (x_lo[d] + x_up[d]);
+        radius = (d == 0 ? 0.25 * (x_up[d] - x_lo[d]) : std::min(radius, 0.25 * (x_up[d] - x_lo[d])));
+    }
+    const int num_nodes = num_rings * nodes_per_ring;
+
+    std::ofstream vertex_stream((base_filename + ".vertex").c_str());
+    vertex_stream << num_nodes << "\n" << std::scientific << std::setprecision(16);
+    for (int k = 0; k < num_rings; ++k)
+    {
+        for (int l = 0; l < nodes_per_ring; ++l)
+        {
+            const double theta = 2.0 * M_PI * static_cast<double>(l) / static_cast<double>(nodes_per_ring);
+#if (NDIM == 2)
+            const double r = radius * static_cast<double>(k + 1) / static_cast<double>(num_rings);
+            vertex_stream << X_center[0] + r * std::cos(theta) << " " << X_center[1] + r * std::sin(theta) << "\n";
+#endif
+#if (NDIM == 3)
+            const double phi = M_PI * (static_cast<double>(k) + 0.5) / static_cast<double>(num_rings);
+            const double r = radius * std::sin(phi);
+            vertex_stream << X_center[0] + r * std::cos(theta) << " " << X_center[1] + r * std::sin(theta) << " "
+                          << X_center[2] + radius * std::cos(phi) << "\n";
+#endif
+        }
+    }
+
+    const int num_springs = (NDIM == 2 ? num_rings : 2 * num_rings - 1) * nodes_per_ring;
+    std::ofstream spring_stream((base_filename + ".spring").c_str());
+    spring_stream << num_springs << "\n" << std::scientific << std::setprecision(16);
+    for (int k = 0; k < num_rings; ++k)
+    {
+        for (int l = 0; l < nodes_per_ring; ++l)
+        {
+            const int idx = k * nodes_per_ring + l;
+            spring_stream << idx << " " << k * nodes_per_ring + (l + 1) % nodes_per_ring << " " << spring_stiffness
+                          << " " << 0.0 << "\n";
+            if (NDIM == 3 && k + 1 < num_rings)
+            {
+                spring_stream << idx << " " << idx + nodes_per_ring << " " << spring_stiffness << " " << 0.0 << "\n";
+            }
+        }
+    }
+
+    std::ofstream beam_stream((base_filename + ".beam").c_str());
+    beam_stream << num_nodes << "\n" << std::scientific << std::setprecision(16);
+    for (int k = 0; k < num_rings; ++k)
+    {
+        for (int l = 0; l < nodes_per_ring; ++l)
+        {
+            beam_stream << k * nodes_per_ring + (l + nodes_per_ring - 1) % nodes_per_ring << " "
+                        << k * nodes_per_ring + l << " " << k * nodes_per_ring + (l + 1) % nodes_per_ring << " "
+                        << beam_stiffness << "\n";
+        }
+    }
+    return;
+} // write_structure_files
+
+double
+count_data_values(Pointer<PatchHierarchy<NDIM> > hierarchy, const int data_idx, const bool count_ghosts)
+{
+    double num_values = 0.0;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > cc_data = patch->getPatchData(data_idx);
+            Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(data_idx);
+            if (cc_data)
+            {
+                const double num_interior = cc_data->getBox().size();
+                const double num_total = cc_data->getGhostBox().size();
+                num_values += cc_data->getDepth() * (count_ghosts ? num_total - num_interior : num_interior);
+            }
+            else if (sc_data)
+            {
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    const double num_interior = SideGeometry<NDIM>::toSideBox(sc_data->getBox(), axis).size();
+                    const double num_total = SideGeometry<NDIM>::toSideBox(sc_data->getGhostBox(), axis).size();
+                    num_values += sc_data->getDepth() * (count_ghosts ? num_total - num_interior : num_interior);
+                }
+            }
+            else
+            {
+                TBOX_ERROR("count_data_values(): unsupported patch data type\n");
+            }
+        }
+    }
+    return SAMRAI_MPI::sumReduction(num_values);
+} // count_data_values
+
+void
+report_result(std::ofstream& results_stream,
+              const std::string& label,
+              const std::string& benchmark,
+              const std::string& variant,
+              const std::string& units,
+              const double num_items,
+              const double bytes_per_item,
+              const int num_reps,
+              const double elapsed_time)
+{
+    const double time_per_rep = elapsed_time / static_cast<double>(num_reps);
+    const double throughput = num_items / time_per_rep;
+    const double bandwidth = bytes_per_item * throughput / 1.0e9;
+    const std::string name = variant.empty() ? benchmark : benchmark + " (" + variant + ")";
+    pout << std::left << std::setw(72) << name << std::right << std::setw(14) << std::setprecision(6) << throughput
+         << " " << units << "/s";
+    if (bytes_per_item > 0.0) pout << std::setw(12) << bandwidth << " GB/s";
+    pout << "\n";
+
+    // Each result is written as a single JSON object per line.  The nominal
+    // bandwidth is computed from a simple model of the data each item reads
+    // and writes, and it is null when no such model is used.
+    if (SAMRAI_MPI::getRank() != 0) return;
+    results_stream << std::setprecision(10) << "{\"label\": \"" << label << "\", \"benchmark\": \"" << benchmark
+                   << "\", \"variant\": \"" << variant << "\", \"ndim\": " << NDIM
+                   << ", \"nprocs\": " << SAMRAI_MPI::getNodes() << ", \"num_items\": " << num_items
+                   << ", \"units\": \"" << units << "\", \"num_reps\": " << num_reps
+                   << ", \"time_per_rep\": " << time_per_rep << ", \"throughput\": " << throughput
+                   << ", \"bandwidth_GBps\": ";
+    if (bytes_per_item > 0.0)
+    {
+        results_stream << bandwidth;
+    }
+    else
+    {
+        results_stream << "null";
+    }
+    results_stream << "}\n";
+    results_stream.flush();
+    return;
+} // report_result
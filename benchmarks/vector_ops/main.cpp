@@ -0,0 +1,281 @@
+// Filename: main.cpp
+// Created on 13 Nov 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for C++ standard library
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SAMRAIVectorReal.h>
+#include <SideGeometry.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/PETScSAMRAIVectorReal.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+/*******************************************************************************
+ * Microbenchmark for the multi-vector operations of PETScSAMRAIVectorReal.    *
+ *                                                                             *
+ * The fused VecMDot() and VecMAXPY() implementations are compared to the      *
+ * equivalent sequences of single-vector SAMRAIVectorReal operations, using    *
+ * either SAMRAI patch data or packed storage for the PETSc vectors.  For      *
+ * each run, the input filename must be given on the command line:             *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "vector_ops.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const int num_vecs = input_db->getIntegerWithDefault("num_vecs", 30);
+        const int num_reps = input_db->getIntegerWithDefault("num_reps", 20);
+        const bool use_cell_data = input_db->getBoolWithDefault("use_cell_data", false);
+        const bool use_packed_storage = input_db->getBoolWithDefault("use_packed_storage", false);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<Variable<NDIM> > u_var;
+        if (use_cell_data)
+        {
+            u_var = new CellVariable<NDIM, double>("u");
+        }
+        else
+        {
+            u_var = new SideVariable<NDIM, double>("u");
+        }
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int coarsest_ln = 0;
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        // Setup the wrapped vectors.  The Krylov basis vectors are created via
+        // VecDuplicateVecs(), as in the PETSc Krylov solvers, and the vector u
+        // is duplicated so that it uses the same storage as the basis vectors.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int wgt_idx = use_cell_data ? hier_math_ops.getCellWeightPatchDescriptorIndex() :
+                                            hier_math_ops.getSideWeightPatchDescriptorIndex();
+        Pointer<SAMRAIVectorReal<NDIM, double> > u_vec =
+            new SAMRAIVectorReal<NDIM, double>("u", patch_hierarchy, coarsest_ln, finest_ln);
+        u_vec->addComponent(u_var, u_idx, wgt_idx);
+        u_vec->allocateVectorData();
+        u_vec->setRandomValues(1.0, 0.0);
+        Vec u_wrapper = PETScSAMRAIVectorReal::createPETScVector(u_vec, PETSC_COMM_WORLD, use_packed_storage);
+        Vec u;
+        VecDuplicate(u_wrapper, &u);
+        VecCopy(u_wrapper, u);
+        Vec* V;
+        VecDuplicateVecs(u_wrapper, num_vecs, &V);
+        std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > > v_vecs(num_vecs);
+        for (int k = 0; k < num_vecs; ++k)
+        {
+            Pointer<SAMRAIVectorReal<NDIM, double> > v_vec;
+            PETScSAMRAIVectorReal::getSAMRAIVector(V[k], &v_vec);
+            v_vec->setRandomValues(1.0, 0.0);
+            v_vecs[k] = v_vec;
+            PETScSAMRAIVectorReal::restoreSAMRAIVector(V[k], &v_vec);
+        }
+        std::vector<double> alpha(num_vecs);
+        for (int k = 0; k < num_vecs; ++k) alpha[k] = 1.0e-3 / static_cast<double>(k + 1);
+
+        // Count the number of degrees of freedom, so that we can report
+        // effective memory bandwidths.
+        double num_dofs = 0.0;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                if (use_cell_data)
+                {
+                    num_dofs += patch_box.size();
+                }
+                else
+                {
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        num_dofs += SideGeometry<NDIM>::toSideBox(patch_box, axis).size();
+                    }
+                }
+            }
+        }
+        num_dofs = SAMRAI_MPI::sumReduction(num_dofs);
+
+        // Time the dot products.
+        std::vector<double> dots_ref(num_vecs), dots_fused(num_vecs);
+        SAMRAI_MPI::barrier();
+        double t_start = MPI_Wtime();
+        for (int rep = 0; rep < num_reps; ++rep)
+        {
+            static const bool local_only = true;
+            for (int k = 0; k < num_vecs; ++k) dots_ref[k] = u_vec->dot(v_vecs[k], local_only);
+            SAMRAI_MPI::sumReduction(&dots_ref[0], num_vecs);
+        }
+        const double t_mdot_ref = (MPI_Wtime() - t_start) / static_cast<double>(num_reps);
+
+        SAMRAI_MPI::barrier();
+        t_start = MPI_Wtime();
+        for (int rep = 0; rep < num_reps; ++rep)
+        {
+            VecMDot(u, num_vecs, V, &dots_fused[0]);
+        }
+        const double t_mdot_fused = (MPI_Wtime() - t_start) / static_cast<double>(num_reps);
+
+        double mdot_err = 0.0;
+        for (int k = 0; k < num_vecs; ++k)
+        {
+            const double err = std::abs(dots_fused[k] - dots_ref[k]) / std::max(std::abs(dots_ref[k]), 1.0);
+            mdot_err = std::max(mdot_err, err);
+        }
+
+        // Time the vector updates.  Because the two implementations perform
+        // the same number of updates of u, the final values of u agree on the
+        // patch interiors.
+        Pointer<SAMRAIVectorReal<NDIM, double> > u_ref_vec = u_vec->cloneVector("u_ref");
+        u_ref_vec->allocateVectorData();
+        u_ref_vec->copyVector(u_vec);
+        SAMRAI_MPI::barrier();
+        t_start = MPI_Wtime();
+        for (int rep = 0; rep < num_reps; ++rep)
+        {
+            static const bool interior_only = false;
+            for (int k = 0; k < num_vecs; ++k) u_ref_vec->axpy(alpha[k], v_vecs[k], u_ref_vec, interior_only);
+        }
+        const double t_maxpy_ref = (MPI_Wtime() - t_start) / static_cast<double>(num_reps);
+
+        SAMRAI_MPI::barrier();
+        t_start = MPI_Wtime();
+        for (int rep = 0; rep < num_reps; ++rep)
+        {
+            VecMAXPY(u, num_vecs, &alpha[0], V);
+        }
+        const double t_maxpy_fused = (MPI_Wtime() - t_start) / static_cast<double>(num_reps);
+
+        Pointer<SAMRAIVectorReal<NDIM, double> > u_out_vec;
+        PETScSAMRAIVectorReal::getSAMRAIVectorRead(u, &u_out_vec);
+        u_ref_vec->subtract(u_ref_vec, u_out_vec);
+        const double maxpy_err = u_ref_vec->maxNorm() / std::max(u_out_vec->maxNorm(), 1.0);
+        PETScSAMRAIVectorReal::restoreSAMRAIVectorRead(u, &u_out_vec);
+
+        // Report the results.
+        const double mdot_bytes = static_cast<double>(num_vecs + 1) * num_dofs * sizeof(double);
+        const double maxpy_bytes = static_cast<double>(num_vecs + 2) * num_dofs * sizeof(double);
+        pout << "\n"
+             << "number of degrees of freedom: " << num_dofs << "\n"
+             << "number of vectors:            " << num_vecs << "\n"
+             << "number of repetitions:        " << num_reps << "\n"
+             << "vector storage:               " << (use_packed_storage ? "packed" : "patch data") << "\n"
+             << "\n"
+             << "VecMDot:  unfused " << t_mdot_ref << " s, fused " << t_mdot_fused << " s, speedup "
+             << t_mdot_ref / t_mdot_fused << ", fused bandwidth " << mdot_bytes / t_mdot_fused / 1.0e9
+             << " GB/s, relative difference " << mdot_err << "\n"
+             << "VecMAXPY: unfused " << t_maxpy_ref << " s, fused " << t_maxpy_fused << " s, speedup "
+             << t_maxpy_ref / t_maxpy_fused << ", fused bandwidth " << maxpy_bytes / t_maxpy_fused / 1.0e9
+             << " GB/s, relative difference " << maxpy_err << "\n";
+
+        // Cleanup PETSc and SAMRAI objects.
+        v_vecs.clear();
+        VecDestroyVecs(num_vecs, &V);
+        VecDestroy(&u);
+        PETScSAMRAIVectorReal::destroyPETScVector(u_wrapper);
+        u_ref_vec->deallocateVectorData();
+        u_vec->deallocateVectorData();
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return 0;
+} // main
@@ -306,6 +306,7 @@ run_example(int argc, char* argv[])
         // Main time step loop.
         double loop_time_end = time_integrator->getEndTime();
         double dt = 0.0;
+        int total_saddle_point_iterations = 0;
 
         while (!MathUtilities<double>::equalEps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
         {
@@ -330,6 +331,13 @@ run_example(int argc, char* argv[])
             time_integrator->advanceHierarchy(dt);
             loop_time += dt;
 
+            // Report the number of outer saddle-point solver iterations, which
+            // is used to compare runs with and without the initial guess
+            // projection (see README).
+            const int saddle_point_iterations = CIBSolver->getSaddlePointSolver()->getNumIterations();
+            total_saddle_point_iterations += saddle_point_iterations;
+            pout << "\nSaddle-point solver iterations : " << saddle_point_iterations << "\n";
+
             RigidDOFVector U0;
             ib_method_ops->getNewRigidBodyVelocity(0, U0);
             pout << "\nRigid body velocity of the structure is : \n" << U0 << "\n";
@@ -372,6 +380,8 @@ run_example(int argc, char* argv[])
             }
         }
 
+        pout << "\nTotal saddle-point solver iterations : " << total_saddle_point_iterations << "\n";
+
         // Cleanup boundary condition specification objects (when necessary).
         for (unsigned int d = 0; d < NDIM; ++d) delete u_bc_coefs[d];
 
@@ -51,6 +51,7 @@
 #include <ibtk/AppInitializer.h>
 #include <ibtk/LData.h>
 #include <ibtk/LDataManager.h>
+#include <ibtk/StagedRestartManager.h>
 #include <ibtk/muParserCartGridFunction.h>
 #include <ibtk/muParserRobinBcCoefs.h>
 
@@ -216,6 +217,13 @@ bool run_example(int argc, char* argv[],  std::vector<double>& u_err,  std::vect
             time_integrator->registerBodyForceFunction(f_fcn);
         }
 
+        // Set up staged (possibly asynchronous) restart file writing.
+        if (input_db->keyExists("StagedRestartManager"))
+        {
+            StagedRestartManager::getManager()->initialize(
+                app_initializer->getComponentDatabase("StagedRestartManager"));
+        }
+
         // Set up visualization plot file writers.
         Pointer<VisItDataWriter<NDIM> > visit_data_writer = app_initializer->getVisItDataWriter();
         Pointer<LSiloDataWriter> silo_data_writer = app_initializer->getLSiloDataWriter();
@@ -304,6 +312,7 @@ bool run_example(int argc, char* argv[],  std::vector<double>& u_err,  std::vect
             if (dump_viz_data && uses_visit && (iteration_num % viz_dump_interval == 0 || last_step))
             {
                 pout << "\nWriting visualization files...\n\n";
+                StagedRestartManager::getManager()->waitForCompletion();
                 time_integrator->setupPlotData();
                 visit_data_writer->writePlotData(patch_hierarchy, iteration_num, loop_time);
                 silo_data_writer->writePlotData(iteration_num, loop_time);
@@ -311,7 +320,7 @@ bool run_example(int argc, char* argv[],  std::vector<double>& u_err,  std::vect
             if (dump_restart_data && (iteration_num % restart_dump_interval == 0 || last_step))
             {
                 pout << "\nWriting restart files...\n\n";
-                RestartManager::getManager()->writeRestartFile(restart_dump_dirname, iteration_num);
+                StagedRestartManager::getManager()->writeRestartFile(restart_dump_dirname, iteration_num);
             }
             if (dump_timer_data && (iteration_num % timer_dump_interval == 0 || last_step))
             {
@@ -320,6 +329,7 @@ bool run_example(int argc, char* argv[],  std::vector<double>& u_err,  std::vect
             }
             if (dump_postproc_data && (iteration_num % postproc_data_dump_interval == 0 || last_step))
             {
+                StagedRestartManager::getManager()->waitForCompletion();
                 output_data(patch_hierarchy,
                             navier_stokes_integrator,
                             ib_method_ops->getLDataManager(),
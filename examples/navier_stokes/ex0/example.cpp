@@ -94,6 +94,7 @@ run_example(int argc, char* argv[], std::vector<double>& u_err, std::vector<doub
         const bool dump_viz_data = app_initializer->dumpVizData();
         const int viz_dump_interval = app_initializer->getVizDumpInterval();
         const bool uses_visit = dump_viz_data && app_initializer->getVisItDataWriter();
+        const bool uses_reduced = dump_viz_data && app_initializer->getReducedDataWriter();
 
         const bool dump_restart_data = app_initializer->dumpRestartData();
         const int restart_dump_interval = app_initializer->getRestartDumpInterval();
@@ -196,6 +197,11 @@ run_example(int argc, char* argv[], std::vector<double>& u_err, std::vector<doub
         {
             time_integrator->registerVisItDataWriter(visit_data_writer);
         }
+        Pointer<ReducedDataWriter> reduced_data_writer = app_initializer->getReducedDataWriter();
+        if (uses_reduced)
+        {
+            time_integrator->registerReducedDataWriter(reduced_data_writer);
+        }
 
         // Initialize hierarchy configuration and data on all patches.
         time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
@@ -210,11 +216,12 @@ run_example(int argc, char* argv[], std::vector<double>& u_err, std::vector<doub
         // Write out initial visualization data.
         int iteration_num = time_integrator->getIntegratorStep();
         double loop_time = time_integrator->getIntegratorTime();
-        if (dump_viz_data && uses_visit)
+        if (dump_viz_data && (uses_visit || uses_reduced))
         {
             pout << "\n\nWriting visualization files...\n\n";
             time_integrator->setupPlotData();
-            visit_data_writer->writePlotData(patch_hierarchy, iteration_num, loop_time);
+            if (uses_visit) visit_data_writer->writePlotData(patch_hierarchy, iteration_num, loop_time);
+            if (uses_reduced) reduced_data_writer->writePlotData(patch_hierarchy, iteration_num, loop_time);
         }
 
         // Main time step loop.
@@ -245,11 +252,12 @@ run_example(int argc, char* argv[], std::vector<double>& u_err, std::vector<doub
             // processing.
             iteration_num += 1;
             const bool last_step = !time_integrator->stepsRemaining();
-            if (dump_viz_data && uses_visit && (iteration_num % viz_dump_interval == 0 || last_step))
+            if (dump_viz_data && (uses_visit || uses_reduced) && (iteration_num % viz_dump_interval == 0 || last_step))
             {
                 pout << "\nWriting visualization files...\n\n";
                 time_integrator->setupPlotData();
-                visit_data_writer->writePlotData(patch_hierarchy, iteration_num, loop_time);
+                if (uses_visit) visit_data_writer->writePlotData(patch_hierarchy, iteration_num, loop_time);
+                if (uses_reduced) reduced_data_writer->writePlotData(patch_hierarchy, iteration_num, loop_time);
             }
             if (dump_restart_data && (iteration_num % restart_dump_interval == 0 || last_step))
             {
@@ -349,10 +357,11 @@ run_example(int argc, char* argv[], std::vector<double>& u_err, std::vector<doub
             p_err[1]  = hier_cc_data_ops.L2Norm(p_idx, wgt_cc_idx);
             p_err[2]  = hier_cc_data_ops.maxNorm(p_idx, wgt_cc_idx);
         
-        if (dump_viz_data && uses_visit)
+        if (dump_viz_data && (uses_visit || uses_reduced))
         {
             time_integrator->setupPlotData();
-            visit_data_writer->writePlotData(patch_hierarchy, iteration_num + 1, loop_time);
+            if (uses_visit) visit_data_writer->writePlotData(patch_hierarchy, iteration_num + 1, loop_time);
+            if (uses_reduced) reduced_data_writer->writePlotData(patch_hierarchy, iteration_num + 1, loop_time);
         }
 
         // Cleanup boundary condition specification objects (when necessary).
@@ -40,6 +40,7 @@
 
 #include "VisItDataWriter.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/ReducedDataWriter.h"
 #include "tbox/Database.h"
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
@@ -144,6 +145,15 @@ public:
      */
     SAMRAI::tbox::Pointer<LSiloDataWriter> getLSiloDataWriter() const;
 
+    /*!
+     * Return a reduced data writer object to be used to output subsampled and
+     * compressed Cartesian grid data.
+     *
+     * If the application is not configured to use reduced output, a NULL
+     * pointer will be returned.
+     */
+    SAMRAI::tbox::Pointer<ReducedDataWriter> getReducedDataWriter() const;
+
     /*!
      * Return the ExodusII visualization file name.
      *
@@ -241,6 +251,7 @@ private:
     std::vector<std::string> d_viz_writers;
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > d_visit_data_writer;
     SAMRAI::tbox::Pointer<LSiloDataWriter> d_silo_data_writer;
+    SAMRAI::tbox::Pointer<ReducedDataWriter> d_reduced_data_writer;
     std::string d_exodus_filename, d_gmv_filename;
 
     /*!
@@ -249,6 +249,23 @@ public:
      */
     void deallocateSolverState();
 
+    /*!
+     * \brief Recompute the matrix coefficients from the current Poisson
+     * specifications, boundary conditions, and solution time, and redo the
+     * hypre solver setup.
+     *
+     * Unlike initializeSolverState(), this method reuses the hypre grid,
+     * stencil, matrix, and vector data structures, so it may be used to update
+     * the operator (e.g., when the time step size changes) on an unchanged
+     * patch level.
+     *
+     * \return \p true if the solver state was updated, \p false if the
+     * solver state is not initialized
+     *
+     * \see initializeSolverState
+     */
+    bool updateCoefficients();
+
     //\}
 
 private:
@@ -109,6 +109,7 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ use_single_precision_smoother = FALSE        // see below
  coarse_solver_db {                           // SAMRAI::tbox::Database for initializing coarse
  level solver
     solver_type = "PFMG"
@@ -116,6 +117,19 @@ namespace IBTK
     num_post_relax_steps = 2
  }
  \endverbatim
+ *
+ * When \p use_single_precision_smoother is \p TRUE, the Gauss-Seidel smoothing
+ * sweeps are performed using single precision copies of the error and
+ * residual.  The error is converted on entry to and exit from smoothError(),
+ * along with a thin layer of cells adjacent to the patch boundaries that is
+ * needed to refill ghost cell values between sweeps.  The residual is converted
+ * for the pre-smoothing sweeps on each level and is reused by the following
+ * post-smoothing sweeps on that level, which assumes (as in class
+ * FACPreconditioner) that the residual is not modified in between.  Because the
+ * operator is used only as a preconditioner, the outer Krylov method retains
+ * its accuracy.  The sweeps themselves move half as many bytes, but the
+ * conversions are not free, so this option only pays off when several sweeps
+ * are performed per call to smoothError().
 */
 class CCPoissonPointRelaxationFACOperator : public PoissonFACPreconditionerStrategy
 {
@@ -236,6 +250,11 @@ protected:
      */
     void deallocateOperatorStateSpecialized(int coarsest_reset_ln, int finest_reset_ln);
 
+    /*!
+     * \brief Update implementation-specific coefficient-dependent data.
+     */
+    bool updateOperatorCoefficientsSpecialized();
+
 private:
     /*!
      * \brief Default constructor.
@@ -275,6 +294,20 @@ private:
      */
     std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_bc_box_overlap;
     std::vector<std::vector<std::map<int, SAMRAI::hier::Box<NDIM> > > > d_patch_neighbor_overlap;
+
+    /*
+     * Single precision smoother data.
+     */
+    bool d_use_single_precision_smoother;
+    int d_sp_error_idx, d_sp_residual_idx;
+    std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_sp_sync_boxes;
+
+    /*
+     * For each level, the residual patch data index that was converted to
+     * single precision for the most recent pre-smoothing sweeps, or -1 if the
+     * single precision residual must be recomputed.
+     */
+    std::vector<int> d_sp_residual_src_idx;
 };
 } // namespace IBTK
 
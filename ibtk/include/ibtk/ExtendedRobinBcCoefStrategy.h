@@ -82,6 +82,25 @@ public:
      */
     virtual void setHomogeneousBc(bool homogeneous_bc);
 
+    /*!
+     * \brief Indicate whether the boundary condition coefficients set by this
+     * object depend only on position and time (and not, e.g., on the values of
+     * the patch data being filled), so that they may be cached by the physical
+     * boundary operators.
+     *
+     * \note The default implementation returns false.
+     */
+    virtual bool hasCacheableBcCoefs() const;
+
+    /*!
+     * \brief Indicate whether the boundary condition coefficients set by this
+     * object depend on time.  Cached coefficients for time-dependent boundary
+     * conditions are recomputed whenever the fill time changes.
+     *
+     * \note The default implementation returns true.
+     */
+    virtual bool isTimeDependent() const;
+
     //\}
 
 protected:
@@ -217,6 +217,15 @@ public:
      */
     void deallocateSolverState();
 
+    /*!
+     * \brief Update the solver state to account for changes in the problem
+     * coefficients via FACPreconditionerStrategy::updateOperatorCoefficients().
+     *
+     * \return \p true if the solver state was updated, \p false if the solver
+     * state must instead be reinitialized by initializeSolverState()
+     */
+    bool updateCoefficients();
+
     //\}
 
     /*!
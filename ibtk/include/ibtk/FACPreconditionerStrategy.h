@@ -220,6 +220,18 @@ public:
      */
     virtual void deallocateOperatorState();
 
+    /*!
+     * \brief Update any coefficient-dependent data initialized by
+     * initializeOperatorState() without reallocating the remaining
+     * hierarchy-dependent data.
+     *
+     * \note The default implementation does nothing and returns \p false.
+     *
+     * \return \p true if the operator state was updated, \p false if the
+     * operator state must instead be reinitialized by initializeOperatorState()
+     */
+    virtual bool updateOperatorCoefficients();
+
     /*!
      * \brief Allocate scratch data.
      */
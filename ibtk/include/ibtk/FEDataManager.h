@@ -54,6 +54,7 @@
 #include "VariableContext.h"
 #include "boost/multi_array.hpp"
 #include "boost/unordered_map.hpp"
+#include "ibtk/WorkloadCalibrator.h"
 #include "ibtk/ibtk_utilities.h"
 #include "libmesh/dof_map.h"
 #include "libmesh/elem.h"
@@ -258,6 +259,39 @@ public:
     void registerLoadBalancer(SAMRAI::tbox::Pointer<SAMRAI::mesh::LoadBalancer<NDIM> > load_balancer,
                               int workload_data_idx);
 
+    /*!
+     * \brief Enable the online calibration of the workload model.
+     *
+     * When calibration is enabled, the time spent spreading and interpolating
+     * data is measured, and the relative cost of a quadrature point used by
+     * updateWorkloadEstimates() is determined by a least-squares fit of the
+     * measured cost of the most recent num_samples timesteps.  A report
+     * comparing the predicted and measured load imbalance is written to plog
+     * each time the element mappings are reinitialized.
+     *
+     * \note While calibration is enabled, all MPI processes are synchronized
+     * before and after each timed Lagrangian operation so that time spent
+     * waiting for other processes is not counted as work.
+     *
+     * \see recordWorkloadSample
+     */
+    void enableWorkloadCalibration(int num_samples);
+
+    /*!
+     * \brief Get the object used to calibrate the workload model.
+     *
+     * \return A null pointer if workload calibration is not enabled.
+     */
+    SAMRAI::tbox::Pointer<WorkloadCalibrator> getWorkloadCalibrator() const;
+
+    /*!
+     * \brief Record the timings accumulated since the previous call as a sample
+     * for the workload calibration.  This method should be called once per
+     * timestep.  If workload calibration is not enabled, this method does
+     * nothing.
+     */
+    void recordWorkloadSample();
+
     /*!
      * \name Methods to set and get the patch hierarchy and range of patch
      * levels associated with this manager class.
@@ -544,6 +578,17 @@ public:
 
     /*!
      * \brief Update the cell workload estimate.
+     *
+     * The workload per cell is defined by
+     *
+     *    workload(i) = 1 + beta_work*qp_count(i)
+     *
+     * in which beta_work defaults to the value 1.  If workload calibration is
+     * enabled and samples have been recorded since the element mappings were
+     * last reinitialized, beta_work is determined from the measured cost of the
+     * recorded timesteps.
+     *
+     * \see enableWorkloadCalibration
      */
     void updateWorkloadEstimates(int coarsest_ln = -1, int finest_ln = -1);
 
@@ -682,6 +727,12 @@ private:
      */
     void updateQuadPointCountData(int coarsest_ln, int finest_ln);
 
+    /*!
+     * Determine the number of local Cartesian grid cells in the levels managed
+     * by this object.
+     */
+    double computeNumberOfLocalCells() const;
+
     /*!
      * Compute the bounding boxes of all active elements.
      *
@@ -776,6 +827,15 @@ private:
      */
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_workload_var;
     int d_workload_idx;
+    double d_beta_work;
+
+    /*
+     * Object used to determine the value of beta_work from measured timings,
+     * and the number of local quadrature points determined by the most recent
+     * call to updateQuadPointCountData().
+     */
+    SAMRAI::tbox::Pointer<WorkloadCalibrator> d_workload_calibrator;
+    double d_num_local_qps;
 
     /*
      * The default kernel functions and quadrature rule used to mediate
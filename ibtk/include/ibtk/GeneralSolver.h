@@ -239,6 +239,25 @@ public:
      */
     virtual void deallocateSolverState();
 
+    /*!
+     * \brief Update the solver state to account for changes in the problem
+     * coefficients (e.g., Poisson specifications, boundary condition
+     * coefficients, or the solution time) when the hierarchy configuration is
+     * unchanged.
+     *
+     * Subclasses that support this operation should reuse the hierarchy
+     * dependent data allocated by initializeSolverState() (e.g., communication
+     * schedules, matrix sparsity patterns, and subdomain index sets) and
+     * recompute only those data that depend on the values of the problem
+     * coefficients.
+     *
+     * \note The default implementation does nothing and returns \p false.
+     *
+     * \return \p true if the solver state was updated, \p false if the solver
+     * state must instead be reinitialized by initializeSolverState()
+     */
+    virtual bool updateCoefficients();
+
     //\}
 
     /*!
@@ -60,6 +60,7 @@
 #include "VisItDataWriter.h"
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/ReducedDataWriter.h"
 #include "ibtk/ibtk_enums.h"
 #include "tbox/Array.h"
 #include "tbox/Pointer.h"
@@ -160,6 +161,10 @@ public:
     /*!
      * Integrate data on all patches on all levels of the patch hierarchy over
      * the specified time increment.
+     *
+     * \note If the input database provided to the integrator contains a
+     * "telemetry" sub-database, per-timestep performance data for the outermost
+     * integrator are collected by the TelemetryManager.
      */
     virtual void advanceHierarchy(double dt);
 
@@ -283,6 +288,20 @@ public:
      */
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > getVisItDataWriter() const;
 
+    /*!
+     * Register a reduced data writer so the integrator can output subsampled
+     * and compressed copies of its plot quantities.
+     *
+     * \note The writer must be registered before the integrator is initialized
+     * in order for it to receive the integrator's plot quantities.
+     */
+    void registerReducedDataWriter(SAMRAI::tbox::Pointer<ReducedDataWriter> reduced_writer);
+
+    /*!
+     * Get a pointer to the reduced data writer registered with the solver.
+     */
+    SAMRAI::tbox::Pointer<ReducedDataWriter> getReducedDataWriter() const;
+
     /*!
      * Prepare variables for plotting.
      *
@@ -746,6 +765,16 @@ protected:
                                              bool initial_time,
                                              bool uses_richardson_extrapolation_too);
 
+    /*!
+     * Register a plot quantity with the registered VisIt data writer and
+     * reduced data writer, if any.
+     */
+    void registerPlotQuantity(const std::string& variable_name,
+                              const std::string& variable_type,
+                              int patch_data_index,
+                              int start_depth_id = 0,
+                              double scale_factor = 1.0);
+
     /*!
      * Register a ghost cell-filling refine algorithm.
      */
@@ -886,6 +915,11 @@ protected:
      */
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > d_visit_writer;
 
+    /*
+     * The object used to write out reduced copies of plot quantities.
+     */
+    SAMRAI::tbox::Pointer<ReducedDataWriter> d_reduced_writer;
+
     /*
      * Time and time step size data read from input or set at initialization.
      */
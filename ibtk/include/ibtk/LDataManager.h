@@ -61,6 +61,8 @@
 #include "ibtk/LNodeSetVariable.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/ParallelSet.h"
+#include "ibtk/ReducedDataWriter.h"
+#include "ibtk/WorkloadCalibrator.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscao.h"
 #include "petscvec.h"
@@ -413,6 +415,61 @@ public:
                 int coarsest_ln = -1,
                 int finest_ln = -1);
 
+    /*!
+     * \brief Spread several quantities from the Lagrangian mesh to the
+     * Eulerian grid using the default spreading kernel function.
+     *
+     * The quantities F_data[k] are spread to the patch data indices
+     * f_data_idxs[k] in a single traversal of the Lagrangian mesh, so that the
+     * kernel weights are evaluated once per marker rather than once per
+     * quantity.  All Eulerian quantities must share the same data centering.
+     * The optional physical boundary operators and prolongation schedules are
+     * specified separately for each quantity; empty vectors indicate that
+     * none are used.
+     *
+     * The quantities are first spread to scratch patch data whose depth is the
+     * total depth of the quantities, and are then added to the individual
+     * quantities.  The scratch data are allocated on each level that contains
+     * Lagrangian data the first time that they are needed and are retained
+     * until the level is regridded.
+     *
+     * \note This spreading operation does NOT include the scale factor
+     * corresponding to the curvilinear volume element (dq dr ds), i.e., it
+     * spreads values, \em NOT densities.
+     */
+    void spread(const std::vector<int>& f_data_idxs,
+                const std::vector<std::vector<SAMRAI::tbox::Pointer<LData> > >& F_data,
+                std::vector<SAMRAI::tbox::Pointer<LData> >& X_data,
+                const std::vector<RobinPhysBdryPatchStrategy*>& f_phys_bdry_ops,
+                const std::vector<std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > >&
+                    f_prolongation_scheds,
+                double fill_data_time,
+                const std::vector<bool>& F_data_ghost_node_update,
+                bool X_data_ghost_node_update = true,
+                int coarsest_ln = -1,
+                int finest_ln = -1);
+
+    /*!
+     * \brief Spread several quantities from the Lagrangian mesh to the
+     * Eulerian grid using the specified spreading kernel function.
+     *
+     * \note This spreading operation does NOT include the scale factor
+     * corresponding to the curvilinear volume element (dq dr ds), i.e., it
+     * spreads values, \em NOT densities.
+     */
+    void spread(const std::vector<int>& f_data_idxs,
+                const std::vector<std::vector<SAMRAI::tbox::Pointer<LData> > >& F_data,
+                std::vector<SAMRAI::tbox::Pointer<LData> >& X_data,
+                const std::string& spread_kernel_fcn,
+                const std::vector<RobinPhysBdryPatchStrategy*>& f_phys_bdry_ops,
+                const std::vector<std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > >&
+                    f_prolongation_scheds,
+                double fill_data_time,
+                const std::vector<bool>& F_data_ghost_node_update,
+                bool X_data_ghost_node_update = true,
+                int coarsest_ln = -1,
+                int finest_ln = -1);
+
     /*!
      * \brief Interpolate a quantity from the Eulerian grid to the Lagrangian
      * mesh using the default interpolation kernel function.
@@ -492,6 +549,11 @@ public:
      */
     void registerVisItDataWriter(SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > visit_writer);
 
+    /*!
+     * \brief Register a reduced data writer with the manager.
+     */
+    void registerReducedDataWriter(SAMRAI::tbox::Pointer<ReducedDataWriter> reduced_writer);
+
     /*!
      * \brief Register a Silo data writer with the manager.
      */
@@ -503,6 +565,39 @@ public:
     void registerLoadBalancer(SAMRAI::tbox::Pointer<SAMRAI::mesh::LoadBalancer<NDIM> > load_balancer,
                               int workload_data_idx);
 
+    /*!
+     * \brief Enable the online calibration of the workload model.
+     *
+     * When calibration is enabled, the time spent spreading and interpolating
+     * Lagrangian data is measured, and the value of beta_work used by
+     * updateWorkloadEstimates() is determined by a least-squares fit of the
+     * measured cost of the most recent num_samples timesteps.  A report
+     * comparing the predicted and measured load imbalance is written to plog
+     * after each redistribution of the Lagrangian data.
+     *
+     * \note While calibration is enabled, all MPI processes are synchronized
+     * before and after each timed Lagrangian operation so that time spent
+     * waiting for other processes is not counted as work.
+     *
+     * \see recordWorkloadSample
+     */
+    void enableWorkloadCalibration(int num_samples);
+
+    /*!
+     * \brief Get the object used to calibrate the workload model.
+     *
+     * \return A null pointer if workload calibration is not enabled.
+     */
+    SAMRAI::tbox::Pointer<WorkloadCalibrator> getWorkloadCalibrator() const;
+
+    /*!
+     * \brief Record the timings accumulated since the previous call as a sample
+     * for the workload calibration.  This method should be called once per
+     * timestep.  If workload calibration is not enabled, this method does
+     * nothing.
+     */
+    void recordWorkloadSample();
+
     /*!
      * \brief Indicates whether there is Lagrangian data on the given patch
      * hierarchy level.
@@ -743,17 +838,51 @@ public:
     /*!
      * \brief Scatter data from a distributed PETSc vector to all processors.
      *
-     * \todo Optimize the implementation of this method.
+     * If \a sequential_vec is NULL, a new sequential vector is created, and the
+     * caller is responsible for destroying it.
+     *
+     * \note The scatter context is cached for each parallel vector layout and
+     * is reused until the next call to endDataRedistribution().
      */
     void scatterToAll(Vec& parallel_vec, Vec& sequential_vec) const;
 
     /*!
      * \brief Scatter data from a distributed PETSc vector to processor zero.
      *
-     * \todo Optimize the implementation of this method.
+     * If \a sequential_vec is NULL, a new sequential vector is created, and the
+     * caller is responsible for destroying it.
+     *
+     * \note The scatter context is cached for each parallel vector layout and
+     * is reused until the next call to endDataRedistribution().
      */
     void scatterToZero(Vec& parallel_vec, Vec& sequential_vec) const;
 
+    /*!
+     * \brief Scatter the data associated with the specified Lagrangian
+     * structures from a distributed PETSc vector in the Lagrangian ordering
+     * (see scatterPETScToLagrangian()) to processor zero.
+     *
+     * The values for the structures are stored in \a sequential_vec in the
+     * order in which the structure IDs are listed in \a structure_ids.  On all
+     * other processors, \a sequential_vec has length zero.  If \a
+     * sequential_vec is NULL, a new sequential vector is created, and the
+     * caller is responsible for destroying it.
+     *
+     * \note The scatter context is cached for each parallel vector layout and
+     * collection of structures and is reused until the next call to
+     * endDataRedistribution().
+     */
+    void scatterStructuresToZero(Vec& lagrangian_vec,
+                                 Vec& sequential_vec,
+                                 const std::vector<int>& structure_ids,
+                                 int level_number) const;
+
+    /*!
+     * \brief Destroy all cached scatter contexts used by scatterToAll(),
+     * scatterToZero(), and scatterStructuresToZero().
+     */
+    void clearScatterCache();
+
     /*!
      * \brief Start the process of redistributing the Lagrangian data.
      *
@@ -797,7 +926,12 @@ public:
      *
      *    workload(i) = 1 + beta_work*node_count(i)
      *
-     * in which alpha and beta are parameters that each default to the value 1.
+     * in which beta_work is a parameter that defaults to the value 1.  If
+     * workload calibration is enabled and samples have been recorded since the
+     * last redistribution of the Lagrangian data, beta_work is determined from
+     * the measured cost of the recorded timesteps.
+     *
+     * \see enableWorkloadCalibration
      */
     void updateWorkloadEstimates(int coarsest_ln = -1, int finest_ln = -1);
 
@@ -947,6 +1081,19 @@ private:
      */
     void scatterData(Vec& lagrangian_vec, Vec& petsc_vec, int level_number, ScatterMode mode) const;
 
+    /*!
+     * \brief Common implementation of scatterToAll(), scatterToZero(), and
+     * scatterStructuresToZero().
+     *
+     * The cached scatter context is reused only if it can be reused on all
+     * processors.
+     */
+    void scatterToSequential(Vec& parallel_vec,
+                             Vec& sequential_vec,
+                             int scatter_type,
+                             const std::vector<int>& structure_ids,
+                             int level_number) const;
+
     /*!
      * \brief Begin the process of refilling nonlocal Lagrangian quantities over
      * the specified range of levels in the patch hierarchy.
@@ -1002,6 +1149,12 @@ private:
      */
     static void computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_offset, unsigned int num_local_nodes);
 
+    /*!
+     * Determine the number of local Cartesian grid cells and local Lagrangian
+     * nodes in the levels managed by this object.
+     */
+    void computeLocalWorkloadSize(double& num_local_cells, double& num_local_nodes) const;
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.  The database from which the restart data is read is determined
@@ -1045,6 +1198,7 @@ private:
      * variables.
      */
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > d_visit_writer;
+    SAMRAI::tbox::Pointer<ReducedDataWriter> d_reduced_writer;
     SAMRAI::tbox::Pointer<LSiloDataWriter> d_silo_writer;
 
     /*
@@ -1077,6 +1231,11 @@ private:
     int d_workload_idx;
     bool d_output_workload;
 
+    /*
+     * Object used to determine the value of beta_work from measured timings.
+     */
+    SAMRAI::tbox::Pointer<WorkloadCalibrator> d_workload_calibrator;
+
     /*
      * SAMRAI::hier::Variable pointer and patch data descriptor indices for the
      * cell variable used to keep track of the count of the nodes in each cell
@@ -1137,6 +1296,13 @@ private:
     std::vector<std::map<int, std::string> > d_strct_id_to_strct_name_map;
     std::vector<std::map<int, std::pair<int, int> > > d_strct_id_to_lag_idx_range_map;
     std::vector<std::map<int, int> > d_last_lag_idx_to_strct_id_map;
+
+    /*!
+     * The inactivated structures on each level.  These sets are replicated on
+     * all processes: every process queries them in
+     * getLagrangianStructureIsActivated() and filters its own PETSc entries in
+     * zeroInactivatedComponents() without further communication.
+     */
     std::vector<ParallelSet> d_inactive_strcts;
     std::vector<std::vector<int> > d_displaced_strct_ids;
     std::vector<std::vector<std::pair<Point, Point> > > d_displaced_strct_bounding_boxes;
@@ -1165,6 +1331,16 @@ private:
     std::vector<AO> d_ao;
     static std::vector<int> s_ao_dummy;
 
+    /*!
+     * Cached scatter contexts and sequential vectors used to gather data from
+     * distributed vectors.  The cache is keyed by the scatter type, the layout
+     * of the parallel vector, and (where applicable) the level number and the
+     * IDs of the gathered structures.  The cache does not affect the
+     * observable state of this object, so that it may be updated by the const
+     * scatter methods.
+     */
+    mutable std::map<std::vector<int>, std::pair<VecScatter, Vec> > d_scatter_cache;
+
     /*!
      * The total number of nodes for all processors.
      */
@@ -830,6 +830,12 @@ public:
      *
      * Unlike the standard regularized delta function spreading operation, the
      * implemented operations spreads values, NOT densities.
+     *
+     * \note Side-centered data of depth d may be spread by providing
+     * Lagrangian data of depth NDIM*d, in which the NDIM components associated
+     * with each depth of the Eulerian data are stored contiguously.  This
+     * allows several vector-valued quantities to be spread in a single
+     * traversal of the Lagrangian mesh.
      */
     template <class T>
     static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
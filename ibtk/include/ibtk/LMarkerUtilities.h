@@ -160,6 +160,9 @@ public:
                                      int finest_ln = -1);
 
 private:
+    // LTracerParticles applies the same boundary treatment to its particles.
+    friend class LTracerParticles;
+
     /*!
      * \brief Default constructor.
      *
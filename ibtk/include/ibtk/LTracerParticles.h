@@ -0,0 +1,366 @@
+// Filename: LTracerParticles.h
+// Created on 15 Nov 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_LTracerParticles
+#define included_IBTK_LTracerParticles
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Box.h"
+#include "IntVector.h"
+#include "PatchHierarchy.h"
+#include "ibtk/ibtk_utilities.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/Serializable.h"
+
+namespace SAMRAI
+{
+namespace geom
+{
+template <int DIM>
+class CartesianGridGeometry;
+} // namespace geom
+namespace hier
+{
+template <int DIM>
+class Patch;
+} // namespace hier
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LTracerParticles is a container for large numbers of passive
+ * tracer particles that are advected by an Eulerian velocity field defined on
+ * a locally refined patch hierarchy.
+ *
+ * Unlike the LMarker-based tracking provided by class LMarkerUtilities, which
+ * stores each marker as a reference-counted object in cell-centered index
+ * data, this class stores the particle positions, velocities, and IDs in flat
+ * per-patch arrays.  Positions and velocities are stored with NDIM values per
+ * particle, which is the layout expected by LEInteractor, and the particles in
+ * each patch are kept sorted by cell index so that consecutive particles
+ * access nearby Eulerian data.
+ *
+ * Each particle is assigned to the finest patch level whose boxes contain it.
+ * After each time step, particles are wrapped across periodic boundaries and
+ * re-binned.  Particles that have left their patches are packed into compact
+ * messages and sent only to the MPI processes that own their new patches.
+ *
+ * \note Patch data are not used to store the particles, and the particles are
+ * not automatically moved when the patch hierarchy is regridded.  Method
+ * redistributeParticles() must be called after each regridding operation.
+ *
+ * \note When the object is registered for restart, each MPI process writes the
+ * particles that it stores to the restart database.  When restarting, the
+ * particles are read by the constructor and are assigned to patches by the
+ * first call to redistributeParticles(), which must be made after the patch
+ * hierarchy has been initialized.
+ *
+ * \note The time step sizes must be chosen so that the particles do not move
+ * farther than the ghost cell width of the velocity data (less the support of
+ * the interpolation kernel) during a single time step.
+ */
+class LTracerParticles : public SAMRAI::tbox::Serializable
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    LTracerParticles(const std::string& object_name,
+                     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                     const std::string& interp_fcn = "IB_4",
+                     bool register_for_restart = true);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~LTracerParticles();
+
+    /*!
+     * \brief Add particles with the specified IDs and positions.  The
+     * particles may be provided on any MPI process and are sent to the
+     * processes that own them.
+     *
+     * \note This method is collective.
+     */
+    void addParticles(const std::vector<int>& ids, const std::vector<double>& X);
+
+    /*!
+     * \brief Initialize the particles from a list of positions that is
+     * replicated on all MPI processes, e.g., as read by
+     * LMarkerUtilities::readMarkerPositions().  Each process only inserts a
+     * contiguous fraction of the list.  Particle IDs are set to the indices of
+     * the positions in the list.
+     *
+     * \note This method is collective.
+     */
+    void initializeParticles(const std::vector<Point>& X_init);
+
+    /*!
+     * \brief Reassign the particles to the patches of the current patch
+     * hierarchy.  This method must be called after each regridding operation.
+     *
+     * \note This method is collective.
+     */
+    void redistributeParticles();
+
+    /*!
+     * \brief Advance the particle positions using the forward Euler method.
+     */
+    void eulerStep(int u_current_idx, double dt);
+
+    /*!
+     * \brief Advance the particle positions using the explicit midpoint rule.
+     * The velocity field must be available at the beginning of the time step
+     * and at the midpoint of the time step.
+     */
+    void midpointStep(int u_current_idx, int u_half_idx, double dt);
+
+    /*!
+     * \brief Advance the particle positions using the explicit trapezoidal rule
+     * (Heun's method).  The velocity field must be available at the beginning
+     * and end of the time step.
+     */
+    void trapezoidalStep(int u_current_idx, int u_new_idx, double dt);
+
+    /*!
+     * \brief Advance the particle positions using the three stage, third order
+     * strong stability preserving Runge-Kutta method.  The velocity field must
+     * be available at the beginning, midpoint, and end of the time step.
+     */
+    void rk3Step(int u_current_idx, int u_half_idx, int u_new_idx, double dt);
+
+    /*!
+     * \brief Return the number of particles stored on this MPI process.
+     */
+    unsigned int getNumberOfLocalParticles() const;
+
+    /*!
+     * \brief Return the total number of particles.
+     *
+     * \note This method is collective.  The count is accumulated in 64-bit
+     * arithmetic, so it does not overflow for more than 2^31 particles.
+     */
+    unsigned long getNumberOfParticles() const;
+
+    /*!
+     * \brief Return the positions of the particles assigned to the specified
+     * local patch.
+     */
+    const std::vector<double>& getPositions(int level_number, int patch_num) const;
+
+    /*!
+     * \brief Return the velocities of the particles assigned to the specified
+     * local patch.  The velocity of each particle is the average velocity
+     * over the most recent time step.
+     */
+    const std::vector<double>& getVelocities(int level_number, int patch_num) const;
+
+    /*!
+     * \brief Return the IDs of the particles assigned to the specified local
+     * patch.
+     */
+    const std::vector<int>& getIDs(int level_number, int patch_num) const;
+
+    /*!
+     * \brief Collect the IDs, positions, and velocities of all particles stored
+     * on this MPI process.
+     */
+    void collectLocalParticles(std::vector<int>& ids, std::vector<double>& X, std::vector<double>& U) const;
+
+    /*!
+     * Write out object state to the given database.
+     *
+     * When assertion checking is active, database pointer must be non-null.
+     */
+    void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    LTracerParticles();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LTracerParticles(const LTracerParticles& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LTracerParticles& operator=(const LTracerParticles& that);
+
+    /*!
+     * \brief The particles assigned to a single patch.
+     */
+    struct PatchParticles
+    {
+        std::vector<int> ids;
+        std::vector<double> X, U;
+    };
+
+    /*!
+     * \brief A sparse binning of the boxes of a patch level.  The index space
+     * of the level is divided into bins that are at least as large as the
+     * largest box of the level, so that each box overlaps at most 2^NDIM bins
+     * and the box containing a cell index is found by searching only the
+     * boxes that overlap the bin of that index.
+     */
+    struct LevelBoxBins
+    {
+        SAMRAI::hier::IntVector<NDIM> bin_size;
+        SAMRAI::hier::Box<NDIM> bin_box;
+        std::map<int, std::vector<int> > bins;
+    };
+
+    /*!
+     * \brief Advance the particle positions using an explicit Runge-Kutta
+     * method with the specified Butcher tableau.  The velocity at stage s is
+     * interpolated from the patch data index u_idx[s].
+     */
+    void advanceParticles(const int* u_idx, const double* a, const double* b, int num_stages, double dt);
+
+    /*!
+     * \brief Advance the particles assigned to a single patch.
+     */
+    void advancePatchParticles(PatchParticles& particles,
+                               SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                               const int* u_idx,
+                               const double* a,
+                               const double* b,
+                               int num_stages,
+                               double dt);
+
+    /*!
+     * \brief Setup the particle storage and the cached box data for the
+     * current configuration of the patch hierarchy.
+     */
+    void resetHierarchyConfiguration();
+
+    /*!
+     * \brief Wrap particles across periodic boundaries, remove particles that
+     * have left their patches, and send them to their new patches.
+     */
+    void binParticles();
+
+    /*!
+     * \brief Assign the particles in the specified pool to patches, sending
+     * particles to other MPI processes as needed, and sort the particles on
+     * each local patch by cell index.
+     */
+    void migrateParticles(const PatchParticles& pool);
+
+    /*!
+     * \brief Find the patch level, patch, and MPI process that own the
+     * specified (periodically wrapped) position.
+     */
+    bool findOwner(const double* X, int& level_number, int& patch_num, int& rank) const;
+
+    /*!
+     * \brief Sort the particles of a patch by cell index.
+     */
+    void sortPatchParticles(PatchParticles& particles, int level_number, const SAMRAI::hier::Box<NDIM>& patch_box);
+
+    /*!
+     * \brief Wrap a position across periodic boundaries.
+     */
+    void applyPeriodicShift(double* X) const;
+
+    /*!
+     * Read object state from the restart file and initialize class data
+     * members.  The database from which the restart data is read is determined
+     * by the object_name specified in the constructor.
+     *
+     * Unrecoverable Errors:
+     *
+     *    -   The database corresponding to object_name is not found in the
+     *        restart file.
+     *
+     *    -   The class version number and restart version number do not match.
+     *
+     */
+    void getFromRestart();
+
+    // The object name and whether the object is registered for restart.
+    std::string d_object_name;
+    bool d_registered_for_restart;
+
+    // The patch hierarchy and the interpolation kernel.
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
+    SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > d_grid_geom;
+    std::string d_interp_fcn;
+
+    // The particles assigned to each patch, indexed by level number and patch
+    // number.  Only entries corresponding to local patches are used.
+    std::vector<std::vector<PatchParticles> > d_particles;
+
+    // For each local patch, the boxes of the next finer level (coarsened to
+    // the index space of the patch) that intersect the patch.
+    std::vector<std::vector<std::vector<SAMRAI::hier::Box<NDIM> > > > d_refined_boxes;
+
+    // For each level, the binned level boxes that are used to find the patch
+    // that owns a migrating particle.
+    std::vector<LevelBoxBins> d_box_bins;
+
+    // Particles read from the restart database that have not yet been assigned
+    // to patches.
+    PatchParticles d_restart_particles;
+
+    // Work arrays for the Runge-Kutta stages.
+    std::vector<double> d_X_stage, d_K[3];
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LTracerParticles
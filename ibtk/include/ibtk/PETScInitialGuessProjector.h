@@ -0,0 +1,181 @@
+// Filename: PETScInitialGuessProjector.h
+// Created on 27 Nov 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_PETScInitialGuessProjector
+#define included_IBTK_PETScInitialGuessProjector
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "petscksp.h"
+#include "petscvec.h"
+#include "tbox/DescribedClass.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PETScInitialGuessProjector improves the initial guess for a
+ * sequence of related linear systems solved by a <A
+ * HREF="http://www.mcs.anl.gov/petsc">PETSc</A> KSP object by projecting onto
+ * the corrections computed by previous solves.
+ *
+ * The projection space is spanned by the columns of U, and the columns of C =
+ * A U are kept orthonormal.  Before each solve, the initial guess is updated
+ * via x := x + U C^T r, which minimizes the initial residual over the affine
+ * space x + range(U).  After each solve, the correction computed by the KSP
+ * object (i.e., the difference between the solution and the projected initial
+ * guess) is added to the projection space, and the oldest direction is
+ * discarded once the maximum dimension is reached.
+ *
+ * \note This is only an initial guess projection.  The Krylov iteration
+ * itself is unmodified: range(C) is not deflated from the operator seen by
+ * the KSP object, and the stored directions are past solution corrections
+ * rather than approximate invariant subspaces, so this is not a subspace
+ * recycling method such as GCRO-DR.  It is most effective when successive
+ * right-hand sides are correlated.  Because the KSP object is unmodified, this
+ * class works with any KSP type and with any PETSc Vec implementation,
+ * including the wrappers for SAMRAI vectors provided by IBTK.
+ *
+ * \note By default, C is not recomputed before each solve.  If the operator
+ * changes between solves, the stored images are stale and the projection only
+ * approximately minimizes the initial residual; the KSP object still solves
+ * the current system.  Recomputing the images costs one operator application
+ * per stored direction per solve.
+ *
+ * \note The stored vectors are duplicates of the solution vector and must be
+ * discarded via reset() whenever the underlying vector space changes (e.g.,
+ * after regridding).
+ */
+class PETScInitialGuessProjector : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param object_name name of the object
+     * \param max_dim maximum dimension of the projection space
+     * \param recompute_images whether to recompute C = A U before each solve
+     *        (which keeps the projection exact when the operator changes
+     *        between solves)
+     */
+    PETScInitialGuessProjector(const std::string& object_name, int max_dim, bool recompute_images = false);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PETScInitialGuessProjector();
+
+    /*!
+     * \brief Project the initial guess x onto the stored corrections before
+     * solving A x = b with the provided KSP object.
+     *
+     * \note The operator A must be in the same state (e.g., with respect to
+     * the treatment of boundary conditions) as it is during the solve.
+     */
+    void preSolve(KSP petsc_ksp, Vec b, Vec x);
+
+    /*!
+     * \brief Update the projection space using the solution x computed by
+     * the provided KSP object.
+     */
+    void postSolve(KSP petsc_ksp, Vec x);
+
+    /*!
+     * \brief Discard the projection space and all cached work vectors.
+     */
+    void reset();
+
+    /*!
+     * \brief Return the current dimension of the projection space.
+     */
+    int getDimension() const;
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    PETScInitialGuessProjector();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PETScInitialGuessProjector(const PETScInitialGuessProjector& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PETScInitialGuessProjector& operator=(const PETScInitialGuessProjector& that);
+
+    /*!
+     * \brief Orthogonalize c against the columns of C, applying the same
+     * operations to u, and normalize the result.
+     *
+     * \return The norm of c after orthogonalization.
+     */
+    double orthonormalize(Vec u, Vec c, unsigned int num_cols);
+
+    std::string d_object_name;
+    int d_max_dim;
+    bool d_recompute_images;
+
+    /*
+     * The projection space and its image under the operator.
+     */
+    std::vector<Vec> d_U, d_C;
+
+    /*
+     * Work vectors and the initial guess state of the KSP object.
+     */
+    Vec d_x0, d_r;
+    PetscBool d_initial_guess_nonzero;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PETScInitialGuessProjector
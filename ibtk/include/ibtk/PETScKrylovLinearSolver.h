@@ -45,6 +45,7 @@
 #include "SAMRAIVectorReal.h"
 #include "ibtk/KrylovLinearSolver.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/PETScInitialGuessProjector.h"
 #include "mpi.h"
 #include "petscksp.h"
 #include "petscmat.h"
@@ -111,8 +112,26 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ use_packed_work_vectors = FALSE
+ guess_projection_dim = 0
+ guess_projection_recompute_images = FALSE
  \endverbatim
  *
+ * When \p use_packed_work_vectors is \p TRUE, the work vectors allocated by
+ * the PETSc KSP object use the packed storage mode provided by class
+ * PETScSAMRAIVectorReal, in which the vector operations performed by the
+ * Krylov method act on a single contiguous array of patch interior values.
+ *
+ * When \p guess_projection_dim is positive, the corrections computed by up to
+ * that many previous solves are retained and are used to project the initial
+ * guess of subsequent solves (see class PETScInitialGuessProjector).  The
+ * stored corrections are discarded whenever the solver state is deallocated
+ * (e.g., after regridding).  When \p guess_projection_recompute_images is \p
+ * TRUE, the image of the stored corrections under the operator is recomputed
+ * before each solve, which keeps the projection exact when the operator
+ * changes between solves at the cost of one operator application per stored
+ * correction.
+ *
  * PETSc is developed in the Mathematics and Computer Science (MCS) Division at
  * Argonne National Laboratory (ANL).  For more information about PETSc, see <A
  * HREF="http://www.mcs.anl.gov/petsc">http://www.mcs.anl.gov/petsc</A>.
@@ -309,6 +328,21 @@ public:
      */
     void deallocateSolverState();
 
+    /*!
+     * \brief Update the solver state to account for changes in the problem
+     * coefficients without reallocating the hierarchy dependent data allocated
+     * by initializeSolverState().
+     *
+     * The registered linear operator is matrix free and is not modified by this
+     * member function.  When a preconditioner object has been registered with
+     * this class via setPreconditioner(), its state is updated via
+     * GeneralSolver::updateCoefficients().
+     *
+     * \return \p true if the solver state was updated, \p false if the solver
+     * state must instead be reinitialized by initializeSolverState()
+     */
+    bool updateCoefficients();
+
     //\}
 
 private:
@@ -403,6 +437,12 @@ private:
 
     bool d_reinitializing_solver;
 
+    bool d_use_packed_work_vectors;
+
+    int d_guess_projection_dim;
+    bool d_guess_projection_recompute_images;
+    SAMRAI::tbox::Pointer<PETScInitialGuessProjector> d_guess_projector;
+
     Vec d_petsc_x, d_petsc_b;
 
     std::string d_options_prefix;
@@ -230,6 +230,26 @@ public:
      */
     void deallocateSolverState();
 
+    /*!
+     * \brief Update the solver state to account for changes in the problem
+     * coefficients without reallocating the hierarchy dependent data allocated
+     * by initializeSolverState().
+     *
+     * The matrix values are recomputed in place by
+     * updateCoefficientsSpecialized(), and the preconditioner is then set up
+     * again using the existing nonzero structure.  In particular, the DOF
+     * indexing, communication schedules, subdomain index sets, and the
+     * symbolic phase of any subdomain factorizations are reused.
+     *
+     * \note Subclasses of class PETScLevelSolver should \em not override this
+     * method.  Instead, they should override the protected method
+     * updateCoefficientsSpecialized().
+     *
+     * \return \p true if the solver state was updated, \p false if the solver
+     * state must instead be reinitialized by initializeSolverState()
+     */
+    bool updateCoefficients();
+
     //\}
 
 protected:
@@ -262,6 +282,18 @@ protected:
      */
     virtual void deallocateSolverStateSpecialized() = 0;
 
+    /*!
+     * \brief Recompute the values of the matrices allocated by
+     * initializeSolverStateSpecialized() without changing their nonzero
+     * structure.
+     *
+     * \note The default implementation does nothing and returns \p false.
+     *
+     * \return \p true if the matrix values were updated, \p false if the
+     * solver state must be reinitialized
+     */
+    virtual bool updateCoefficientsSpecialized();
+
     /*!
      * \brief Copy a generic vector to the PETSc representation.
      */
@@ -35,6 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <cstddef>
 #include <math.h>
 #include <vector>
 
@@ -81,6 +82,12 @@ public:
      * \brief Construct a parallel PETSc Mat object corresponding to the
      * cell-centered Laplacian of a cell-centered variable restricted to a
      * single SAMRAI::hier::PatchLevel.
+     *
+     * If \a mat is non-NULL and \a reuse_nonzero_structure is \p true, the
+     * values of the existing matrix are overwritten in place.  This requires
+     * that the DOF indexing of the patch level is unchanged since \a mat was
+     * constructed.  Otherwise, the existing matrix is destroyed and a new
+     * matrix is created.
      */
     static void constructPatchLevelCCLaplaceOp(Mat& mat,
                                                const SAMRAI::solv::PoissonSpecifications& poisson_spec,
@@ -88,12 +95,19 @@ public:
                                                double data_time,
                                                const std::vector<int>& num_dofs_per_proc,
                                                int dof_index_idx,
-                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                                               bool reuse_nonzero_structure = false);
 
     /*!
      * \brief Construct a parallel PETSc Mat object corresponding to the
      * cell-centered Laplacian of a cell-centered variable restricted to a
      * single SAMRAI::hier::PatchLevel.
+     *
+     * If \a mat is non-NULL and \a reuse_nonzero_structure is \p true, the
+     * values of the existing matrix are overwritten in place.  This requires
+     * that the DOF indexing of the patch level is unchanged since \a mat was
+     * constructed.  Otherwise, the existing matrix is destroyed and a new
+     * matrix is created.
      */
     static void constructPatchLevelCCLaplaceOp(Mat& mat,
                                                const SAMRAI::solv::PoissonSpecifications& poisson_spec,
@@ -101,12 +115,19 @@ public:
                                                double data_time,
                                                const std::vector<int>& num_dofs_per_proc,
                                                int dof_index_idx,
-                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                                               bool reuse_nonzero_structure = false);
 
     /*!
      * \brief Construct a parallel PETSc Mat object corresponding to the
      * side-centered Laplacian of a side-centered variable restricted to a
      * single SAMRAI::hier::PatchLevel.
+     *
+     * If \a mat is non-NULL and \a reuse_nonzero_structure is \p true, the
+     * values of the existing matrix are overwritten in place.  This requires
+     * that the DOF indexing of the patch level is unchanged since \a mat was
+     * constructed.  Otherwise, the existing matrix is destroyed and a new
+     * matrix is created.
      */
     static void constructPatchLevelSCLaplaceOp(Mat& mat,
                                                const SAMRAI::solv::PoissonSpecifications& poisson_spec,
@@ -114,12 +135,18 @@ public:
                                                double data_time,
                                                const std::vector<int>& num_dofs_per_proc,
                                                int dof_index_idx,
-                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                                               bool reuse_nonzero_structure = false);
 
     /*!
      * \brief Construct a parallel PETSc Mat object corresponding to the
      * side-centered IB interpolation operator for the provided kernel function.
      *
+     * If \a mat is non-NULL and the nonzero structure of the interpolation
+     * operator is unchanged, only the values of the existing matrix are
+     * updated.  Otherwise, the existing matrix is destroyed and a new matrix is
+     * created.
+     *
      * \warning This routine does not properly handle delta functions for which
      * interp_stencil is odd, nor does it properly handle physical boundary
      * conditions.
@@ -204,6 +231,25 @@ public:
 
     //\}
 
+    /*!
+     * \name Methods acting on PETSc Mat objects.
+     */
+    //\{
+
+    /*!
+     * \brief Compute a signature of the dimensions and the nonzero structure of
+     * the locally owned rows of an assembled AIJ matrix.
+     *
+     * Signatures computed on a particular processor can be compared to
+     * determine whether the nonzero structure of a matrix has changed, e.g., to
+     * decide whether symbolic matrix-matrix products can be reused.  Because
+     * signatures are local to each processor, the result of such a comparison
+     * generally must be reduced over all processors.
+     */
+    static std::size_t computeNonzeroStructureSignature(const Mat& mat);
+
+    //\}
+
 protected:
 private:
     /*!
@@ -66,6 +66,22 @@ namespace IBTK
  * through the static member functions that create and destroy PETSc vector
  * objects.
  *
+ * Vectors created within PETSc via a duplicate operation (e.g., the work
+ * vectors of a Krylov method) may optionally use packed storage.  In this mode,
+ * the patch interior values of all components on all levels are stored in a
+ * single contiguous native PETSc vector, so that vector operations such as dot
+ * products, norms, and AXPYs are evaluated by single loops over that buffer
+ * rather than by patch-by-patch SAMRAI operations.  SAMRAI patch data (which
+ * include ghost cells) are allocated only when the vector is first checked out
+ * via getSAMRAIVector() or getSAMRAIVectorRead(), e.g., when a linear operator
+ * or preconditioner is applied to the vector, and values are copied between
+ * the two representations only when the other representation has been
+ * modified.  Packed storage is supported for vectors whose components are all
+ * cell- or side-centered double precision quantities; duplicates of other
+ * vectors use SAMRAI patch data.  Notice that vector operations on packed data
+ * do not modify ghost cell values, which must be filled by the operator that
+ * requires them.
+ *
  * Finally, we remark that PETSc allows vectors with complex-valued entries.
  * This class and the class SAMRAI::solv::SAMRAIVectorReal assume real-values
  * vectors, i.e., data of type \p double or \p float.  The (currently
@@ -83,11 +99,17 @@ public:
      * the vector data.  Data must be allocated through the SAMRAI vector object
      * directly.
      *
+     * When \a use_packed_duplicates is \p true, vectors that are obtained by
+     * duplicating the returned vector (and duplicates of those vectors) use
+     * packed storage whenever it is supported by the components of the SAMRAI
+     * vector.
+     *
      * \note Each call to createPETScVector() should be matched with a
      * corresponding call to destroyPETScVector().
      */
     static Vec createPETScVector(SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, PetscScalar> > samrai_vec,
-                                 MPI_Comm comm = PETSC_COMM_WORLD);
+                                 MPI_Comm comm = PETSC_COMM_WORLD,
+                                 bool use_packed_duplicates = false);
 
     /*!
      * Destroy a given PETSc vector object.  It is important to note that this
@@ -193,6 +215,51 @@ private:
      */
     PETScSAMRAIVectorReal& operator=(const PETScSAMRAIVectorReal& that);
 
+    /*
+     * Ensure that the SAMRAI patch data of a vector that uses packed storage
+     * are current, allocating the patch data if necessary.  This is a no-op
+     * for vectors that do not use packed storage.
+     */
+    void makePatchDataCurrent();
+
+    /*
+     * Indicate that the SAMRAI patch data have been modified, so that the
+     * packed data (if any) are out of date.
+     */
+    void setPatchDataModified();
+
+    /*
+     * Ensure that the packed data of a vector that uses packed storage are
+     * current.
+     */
+    void makePackedDataCurrent();
+
+    /*
+     * Get the packed data for reading, for reading and writing, or for
+     * overwriting all values without reading them.
+     */
+    Vec getPackedVecRead();
+    Vec getPackedVec();
+    Vec getPackedVecWrite();
+
+    /*
+     * Determine whether x and all of the vectors y[0],...,y[nv-1] use packed
+     * storage.
+     */
+    static bool hasPackedData(Vec x, PetscInt nv, const Vec* y);
+
+    /*
+     * Compute the local parts of the dot products val[k] = (x, y[k]) and, when
+     * x_sq is non-NULL, of the squared norm x_sq = (x, x) using packed data.
+     */
+    static void packedMDotLocal(Vec x, PetscInt nv, const Vec* y, PetscScalar* val, PetscScalar* x_sq);
+
+    /*
+     * Compute the local part of the specified norm using packed data.  Notice
+     * that squared values are returned for the (discrete) L2 norm.
+     */
+    static void packedNormLocal(Vec x, NormType type, PetscScalar* val);
+
     static PetscErrorCode VecDuplicate_SAMRAI(Vec v, Vec* newv);
 
     static PetscErrorCode VecDestroy_SAMRAI(Vec v);
@@ -270,6 +337,17 @@ private:
      */
     Vec d_petsc_vector;
     bool d_vector_created_via_duplicate, d_vector_checked_out_read_write, d_vector_checked_out_read;
+
+    /*
+     * Packed storage for the patch interior values of the vector along with
+     * the corresponding control volume weights.  The packed data vector is NULL
+     * for vectors that do not use packed storage.  The weights are shared among
+     * all duplicates of a vector, and they are NULL when the SAMRAI vector does
+     * not have control volumes.
+     */
+    bool d_use_packed_duplicates;
+    Vec d_packed_vec, d_packed_wgt;
+    bool d_packed_data_current, d_patch_data_current, d_patch_data_allocated;
 };
 } // namespace IBTK
 
@@ -38,6 +38,7 @@
 #include <map>
 #include <utility>
 
+#include "ibtk/ibtk_enums.h"
 #include "tbox/DescribedClass.h"
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
@@ -47,6 +48,12 @@ namespace IBTK
 /*!
  * \brief Class ParallelEdgeMap is a utility class for managing edge maps (i.e.,
  * maps from vertices to links between vertices) in parallel.
+ *
+ * By default, the edge map is replicated on all MPI processes.  When the edge
+ * map is constructed with data mode DISTRIBUTED_DATA, each edge is stored only
+ * on the process that owns its master index (as determined by
+ * ParallelExchangeUtilities::getOwnerRank()), and communicateData() sends
+ * pending additions and removals only to the owning processes.
  */
 class ParallelEdgeMap : public SAMRAI::tbox::DescribedClass
 {
@@ -54,7 +61,7 @@ public:
     /*!
      * \brief Default constructor.
      */
-    ParallelEdgeMap();
+    ParallelEdgeMap(ParallelDataMode data_mode = REPLICATED_DATA);
 
     /*!
      * \brief Destructor.
@@ -97,9 +104,17 @@ public:
 
     /*!
      * \brief Return a const reference to the edge map.
+     *
+     * \note With data mode DISTRIBUTED_DATA, the edge map contains only the
+     * edges whose master indices are owned by the local process.
      */
     const std::multimap<int, std::pair<int, int> >& getEdgeMap() const;
 
+    /*!
+     * \brief Return the data mode of the edge map.
+     */
+    ParallelDataMode getDataMode() const;
+
 private:
     /*!
      * \brief Copy constructor.
@@ -121,7 +136,24 @@ private:
      */
     ParallelEdgeMap& operator=(const ParallelEdgeMap& that);
 
+    /*!
+     * \brief Communicate pending additions and removals to the owning processes.
+     */
+    void communicateDistributedData();
+
+    /*!
+     * \brief Remove the specified link from the edge map, first looking for the
+     * link under the specified master index and then under the other vertex of
+     * the link.  Only master indices for which \a check_owner is false or which
+     * are owned by the local process are considered.  At most one entry is
+     * removed.
+     *
+     * \return Whether a matching entry was found and removed.
+     */
+    bool removeLink(int mastr_idx, const std::pair<int, int>& link, bool check_owner);
+
     // Member data.
+    ParallelDataMode d_data_mode;
     std::multimap<int, std::pair<int, int> > d_edge_map;
     std::multimap<int, std::pair<int, int> > d_pending_additions, d_pending_removals;
 };
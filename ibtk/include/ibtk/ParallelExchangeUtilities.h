@@ -0,0 +1,125 @@
+// Filename: ParallelExchangeUtilities.h
+// Created on 08 Nov 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef included_IBTK_ParallelExchangeUtilities
+#define included_IBTK_ParallelExchangeUtilities
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <map>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class ParallelExchangeUtilities is a utility class to organize
+ * functions for routing data between MPI processes through a distributed
+ * directory of integer keys.
+ *
+ * Keys are assigned to MPI processes by hashing, and data are exchanged only
+ * between the processes that actually communicate, using a nonblocking
+ * consensus algorithm (the NBX algorithm of Hoefler, Siebert, and Lumsdaine).
+ * The cost of an exchange is thus proportional to the number of messages sent
+ * and received by each process and not to the total number of processes.
+ *
+ * Messages are sent on a private duplicate of the SAMRAI communicator, which
+ * is created on first use and freed when SAMRAI is shut down.
+ *
+ * \note The exchange routines require an MPI-3 implementation.
+ */
+class ParallelExchangeUtilities
+{
+public:
+    /*!
+     * \brief Return the MPI process that owns the specified key in the
+     * distributed directory.
+     */
+    static int getOwnerRank(int key);
+
+    /*!
+     * \brief Send the data in \a send_data (indexed by destination process) and
+     * receive the data sent to this process into \a recv_data (indexed by
+     * source process).
+     *
+     * \note This method is collective, but processes do not need to know which
+     * processes will send data to them.  Empty messages are not sent.
+     */
+    static void exchangeData(const std::map<int, std::vector<int> >& send_data,
+                             std::map<int, std::vector<int> >& recv_data);
+
+    /*!
+     * \brief Send the data in \a send_data (indexed by destination process) and
+     * receive the data sent to this process into \a recv_data (indexed by
+     * source process).
+     *
+     * \note This method is collective, but processes do not need to know which
+     * processes will send data to them.  Empty messages are not sent.
+     */
+    static void exchangeData(const std::map<int, std::vector<char> >& send_data,
+                             std::map<int, std::vector<char> >& recv_data);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    ParallelExchangeUtilities();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    ParallelExchangeUtilities(const ParallelExchangeUtilities& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    ParallelExchangeUtilities& operator=(const ParallelExchangeUtilities& that);
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_ParallelExchangeUtilities
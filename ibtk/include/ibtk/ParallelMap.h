@@ -38,6 +38,7 @@
 #include <map>
 #include <vector>
 
+#include "ibtk/ibtk_enums.h"
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
 
@@ -53,6 +54,12 @@ namespace IBTK
 /*!
  * \brief Class ParallelMap is a utility class for associating integer keys with
  * arbitrary data items in parallel.
+ *
+ * By default, the map is replicated on all MPI processes.  When the map is
+ * constructed with data mode DISTRIBUTED_DATA, each item is stored only on the
+ * process that owns its key (as determined by
+ * ParallelExchangeUtilities::getOwnerRank()), and communicateData() sends
+ * pending additions and removals only to the owning processes.
  */
 class ParallelMap : public SAMRAI::tbox::DescribedClass
 {
@@ -60,7 +67,7 @@ public:
     /*!
      * \brief Default constructor.
      */
-    ParallelMap();
+    ParallelMap(ParallelDataMode data_mode = REPLICATED_DATA);
 
     /*!
      * \brief Copy constructor.
@@ -116,11 +123,25 @@ public:
 
     /*!
      * \brief Return a const reference to the map.
+     *
+     * \note With data mode DISTRIBUTED_DATA, the map contains only the items
+     * whose keys are owned by the local process.
      */
     const std::map<int, SAMRAI::tbox::Pointer<Streamable> >& getMap() const;
 
+    /*!
+     * \brief Return the data mode of the map.
+     */
+    ParallelDataMode getDataMode() const;
+
 private:
+    /*!
+     * \brief Communicate pending additions and removals to the owning processes.
+     */
+    void communicateDistributedData();
+
     // Member data.
+    ParallelDataMode d_data_mode;
     std::map<int, SAMRAI::tbox::Pointer<Streamable> > d_map;
     std::map<int, SAMRAI::tbox::Pointer<Streamable> > d_pending_additions;
     std::vector<int> d_pending_removals;
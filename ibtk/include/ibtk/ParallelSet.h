@@ -38,6 +38,7 @@
 #include <set>
 #include <vector>
 
+#include "ibtk/ibtk_enums.h"
 #include "tbox/DescribedClass.h"
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
@@ -47,6 +48,12 @@ namespace IBTK
 /*!
  * \brief Class ParallelSet is a utility class for storing collections of
  * integer keys in parallel.
+ *
+ * By default, the set is replicated on all MPI processes.  When the set is
+ * constructed with data mode DISTRIBUTED_DATA, each key is stored only on the
+ * process that owns it (as determined by
+ * ParallelExchangeUtilities::getOwnerRank()), and communicateData() sends
+ * pending additions and removals only to the owning processes.
  */
 class ParallelSet : public SAMRAI::tbox::DescribedClass
 {
@@ -54,7 +61,7 @@ public:
     /*!
      * \brief Default constructor.
      */
-    ParallelSet();
+    ParallelSet(ParallelDataMode data_mode = REPLICATED_DATA);
 
     /*!
      * \brief Copy constructor.
@@ -110,11 +117,25 @@ public:
 
     /*!
      * \brief Return a const reference to the set.
+     *
+     * \note With data mode DISTRIBUTED_DATA, the set contains only the keys
+     * owned by the local process.
      */
     const std::set<int>& getSet() const;
 
+    /*!
+     * \brief Return the data mode of the set.
+     */
+    ParallelDataMode getDataMode() const;
+
 private:
+    /*!
+     * \brief Communicate pending additions and removals to the owning processes.
+     */
+    void communicateDistributedData();
+
     // Member data.
+    ParallelDataMode d_data_mode;
     std::set<int> d_set;
     std::vector<int> d_pending_additions, d_pending_removals;
 };
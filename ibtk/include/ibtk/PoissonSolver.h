@@ -39,6 +39,8 @@
 
 #include "PoissonSpecifications.h"
 #include "ibtk/GeneralSolver.h"
+#include "ibtk/SolutionHistoryInitialGuess.h"
+#include "tbox/Pointer.h"
 
 namespace SAMRAI
 {
@@ -100,6 +102,21 @@ public:
      */
     virtual void setPhysicalBcCoefs(const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& bc_coefs);
 
+    /*!
+     * \brief Set the object used to compute initial guesses from the solutions
+     * of previous solves.
+     *
+     * \note This object is not used by the solver itself.  Rather, it is used
+     * by the clients of the solver that compute and store solutions.
+     */
+    virtual void setInitialGuessEngine(SAMRAI::tbox::Pointer<SolutionHistoryInitialGuess> initial_guess);
+
+    /*!
+     * \brief Get the object used to compute initial guesses from the solutions
+     * of previous solves.
+     */
+    virtual SAMRAI::tbox::Pointer<SolutionHistoryInitialGuess> getInitialGuessEngine() const;
+
 protected:
     // Specialized solver initialization.
     void initSpecialized(const std::string& object_name, bool homogeneous_bc);
@@ -109,6 +126,9 @@ protected:
     SAMRAI::solv::RobinBcCoefStrategy<NDIM>* d_default_bc_coef;
     std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> d_bc_coefs;
 
+    // Solution history used to compute initial guesses.
+    SAMRAI::tbox::Pointer<SolutionHistoryInitialGuess> d_initial_guess;
+
 private:
     /*!
      * \brief Copy constructor.
@@ -0,0 +1,218 @@
+// Filename: ReducedDataWriter.h
+// Created on 06 Dec 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_ReducedDataWriter
+#define included_IBTK_ReducedDataWriter
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "PatchHierarchy.h"
+#include "tbox/Database.h"
+#include "tbox/DescribedClass.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class ReducedDataWriter writes reduced copies of Cartesian grid plot
+ * quantities for quick-look postprocessing.
+ *
+ * Plot quantities are registered using the same interface as
+ * SAMRAI::appu::VisItDataWriter.  HierarchyIntegrator forwards all of its plot
+ * quantity registrations to a registered ReducedDataWriter.  Other objects
+ * that register their own plot quantities (e.g., LDataManager, CIBMethod,
+ * and AdvectorPredictorCorrectorHyperbolicPatchOps) provide a
+ * registerReducedDataWriter() method alongside registerVisItDataWriter(), and
+ * the same writer must be registered with those objects for their quantities
+ * to be reduced.  Before data are written, each quantity is reduced by
+ *
+ * - restricting output to a selected set of patch levels,
+ * - cropping to a physical bounding box,
+ * - subsampling with a fixed index stride,
+ * - optionally converting to single precision, and
+ * - optionally compressing the values, either losslessly or subject to a
+ *   user-specified absolute error bound.
+ *
+ * Only cell-centered double precision quantities are supported.
+ *
+ * Each MPI process appends its data to its own binary stream file in the
+ * dump directory, so no communication is required to write the data.  A
+ * stream consists of a short file header followed by one record per local
+ * patch, quantity component, and time step.  The Python module
+ * ibtk/scripts/read_reduced_data.py reads these streams into NumPy arrays.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ variables = "U", "P"      // default: all registered plot quantities
+ levels = 0, 1             // default: all levels
+ x_lo = 0.0, 0.0           // default: no cropping
+ x_up = 1.0, 1.0
+ stride = 1                // sampling stride, in cells of each level
+ precision = "DOUBLE"      // "DOUBLE" or "FLOAT"
+ compression = "NONE"      // "NONE", "LOSSLESS", or "ERROR_BOUNDED"
+ error_tolerance = 0.0     // absolute error bound for "ERROR_BOUNDED"
+
+ U {                       // per-quantity settings override the defaults
+    stride = 2
+ }
+ \endverbatim
+ *
+ * Quantities whose names contain spaces are configured using a database in
+ * which each space is replaced by an underscore (e.g., "Div_U").
+ */
+class ReducedDataWriter : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    ReducedDataWriter(const std::string& object_name,
+                      const std::string& dump_dirname,
+                      SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db = NULL);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~ReducedDataWriter();
+
+    /*!
+     * \brief Register a plot quantity.
+     *
+     * The arguments have the same meaning as those of
+     * SAMRAI::appu::VisItDataWriter::registerPlotQuantity().  Quantities that
+     * are not selected by the input database, or that are not cell-centered,
+     * are ignored.
+     */
+    void registerPlotQuantity(const std::string& variable_name,
+                              const std::string& variable_type,
+                              int patch_data_index,
+                              int start_depth_id = 0,
+                              double scale_factor = 1.0);
+
+    /*!
+     * \brief Append reduced data for all registered plot quantities to the
+     * output streams.
+     */
+    void writePlotData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                       int time_step_number,
+                       double simulation_time);
+
+    /*!
+     * \brief Compression methods.
+     */
+    enum CompressionType
+    {
+        NO_COMPRESSION = 0,
+        LOSSLESS_COMPRESSION = 1,
+        ERROR_BOUNDED_COMPRESSION = 2
+    };
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    ReducedDataWriter();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    ReducedDataWriter(const ReducedDataWriter& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    ReducedDataWriter& operator=(const ReducedDataWriter& that);
+
+    /*!
+     * \brief Reduction settings for a plot quantity.
+     */
+    struct ReductionSettings
+    {
+        std::vector<int> levels;
+        bool crop;
+        double x_lo[NDIM], x_up[NDIM];
+        int stride;
+        bool single_precision;
+        CompressionType compression;
+        double error_tol;
+    };
+
+    /*!
+     * \brief A registered plot quantity.
+     */
+    struct PlotItem
+    {
+        std::string name;
+        int patch_data_idx;
+        int start_depth, num_components;
+        double scale;
+        ReductionSettings settings;
+    };
+
+    /*!
+     * \brief Read reduction settings from the specified database, using the
+     * provided settings as defaults.
+     */
+    void getSettingsFromDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db,
+                                 ReductionSettings& settings) const;
+
+    std::string d_object_name;
+    std::string d_dump_dirname;
+    SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_input_db;
+    ReductionSettings d_default_settings;
+    std::vector<std::string> d_selected_variables;
+    std::vector<PlotItem> d_plot_items;
+    bool d_created_dump_dirname;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_ReducedDataWriter
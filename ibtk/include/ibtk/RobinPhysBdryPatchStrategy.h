@@ -35,20 +35,28 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <map>
 #include <set>
+#include <utility>
 #include <vector>
 
+#include "ArrayData.h"
 #include "Box.h"
 #include "ComponentSelector.h"
 #include "IntVector.h"
 #include "RefinePatchStrategy.h"
+#include "tbox/Pointer.h"
 
 namespace SAMRAI
 {
 namespace hier
 {
 template <int DIM>
+class BoundaryBox;
+template <int DIM>
 class Patch;
+template <int DIM>
+class Variable;
 } // namespace hier
 namespace solv
 {
@@ -126,6 +134,22 @@ public:
      */
     bool getHomogeneousBc() const;
 
+    /*!
+     * \brief Clear all cached boundary condition coefficients.
+     *
+     * Coefficients are cached only for boundary condition objects that indicate
+     * that their coefficients are cacheable via
+     * ExtendedRobinBcCoefStrategy::hasCacheableBcCoefs(), and only on patches
+     * with Cartesian patch geometry.  The cache is cleared automatically
+     * whenever the patch data indices or boundary condition objects are reset.
+     * Cache entries are keyed on the boundary box indices and the patch grid
+     * spacing and lower corner, and are never evicted otherwise, so objects
+     * that retain a physical boundary operator across regridding operations
+     * should call this function whenever the patch hierarchy configuration
+     * changes to release stale entries.
+     */
+    void clearBcCoefCache();
+
     /*!
      * \name Partial implementation of SAMRAI::xfer::RefinePatchStrategy
      * interface.
@@ -203,6 +227,28 @@ public:
                                                     const SAMRAI::hier::IntVector<NDIM>& ghost_width_to_fill);
 
 protected:
+    /*!
+     * \brief Set the boundary condition coefficients for the specified
+     * boundary condition object along a boundary box.
+     *
+     * When the boundary condition object indicates that its coefficients are
+     * cacheable, previously computed coefficients are reused for the same
+     * boundary box until the fill time changes (for time-dependent
+     * coefficients), and homogeneous fills do not evaluate the boundary
+     * condition coefficients at all once they have been cached.
+     *
+     * \param bc_coef_idx  Index of the boundary condition object in d_bc_coefs.
+     */
+    void setBcCoefs(SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >& acoef_data,
+                    SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >& bcoef_data,
+                    SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >& gcoef_data,
+                    int bc_coef_idx,
+                    int patch_data_idx,
+                    const SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> >& variable,
+                    SAMRAI::hier::Patch<NDIM>& patch,
+                    const SAMRAI::hier::BoundaryBox<NDIM>& bdry_box,
+                    double fill_time);
+
     /*
      * The patch data indices corresponding to the "scratch" patch data that
      * requires extrapolation of ghost cell values at physical boundaries.
@@ -239,6 +285,30 @@ private:
      * \return A reference to this object.
      */
     RobinPhysBdryPatchStrategy& operator=(const RobinPhysBdryPatchStrategy& that);
+
+    /*
+     * Cached boundary condition coefficients for a single boundary box.  The
+     * cached g coefficients always correspond to inhomogeneous boundary
+     * conditions.
+     */
+    struct BcCoefCacheEntry
+    {
+        double fill_time;
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> > acoef_data, bcoef_data, gcoef_data;
+    };
+
+    /*
+     * Key used to index cached boundary condition coefficients: the boundary
+     * condition object, patch data index, patch level number, boundary
+     * location index, and boundary coefficient box, together with the grid
+     * spacing and lower corner of the patch.
+     */
+    typedef std::pair<std::vector<int>, std::vector<double> > BcCoefCacheKey;
+
+    /*
+     * Cached boundary condition coefficients.
+     */
+    std::map<BcCoefCacheKey, BcCoefCacheEntry> d_bc_coef_cache;
 };
 } // namespace IBTK
 
@@ -106,9 +106,19 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ use_single_precision_smoother = FALSE        // see below
  coarse_solver_db = { ... }                   // SAMRAI::tbox::Database for initializing coarse
  level solver
  \endverbatim
+ *
+ * When \p use_single_precision_smoother is \p TRUE, the Gauss-Seidel smoothing
+ * sweeps are performed using single precision copies of the error and
+ * residual, as in class CCPoissonPointRelaxationFACOperator.  Values at
+ * Dirichlet boundaries are set before the error is converted, and only a thin
+ * layer of cells adjacent to the patch boundaries is copied back to double
+ * precision between sweeps to refill ghost cell values.  The single precision
+ * residual converted for the pre-smoothing sweeps on a level is reused by the
+ * post-smoothing sweeps on that level.
 */
 class SCPoissonPointRelaxationFACOperator : public PoissonFACPreconditionerStrategy
 {
@@ -229,6 +239,11 @@ protected:
      */
     void deallocateOperatorStateSpecialized(int coarsest_reset_ln, int finest_reset_ln);
 
+    /*!
+     * \brief Update implementation-specific coefficient-dependent data.
+     */
+    bool updateOperatorCoefficientsSpecialized();
+
 private:
     /*!
      * \brief Default constructor.
@@ -274,6 +289,14 @@ private:
      */
     SAMRAI::tbox::Pointer<StaggeredPhysicalBoundaryHelper> d_bc_helper;
     int d_mask_idx;
+
+    /*
+     * Single precision smoother data.
+     */
+    bool d_use_single_precision_smoother;
+    int d_sp_error_idx, d_sp_residual_idx;
+    std::vector<std::vector<boost::array<SAMRAI::hier::BoxList<NDIM>, NDIM> > > d_patch_sp_sync_boxes;
+    std::vector<int> d_sp_residual_src_idx;
 };
 } // namespace IBTK
 
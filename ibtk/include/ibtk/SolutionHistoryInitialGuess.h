@@ -0,0 +1,194 @@
+// Filename: SolutionHistoryInitialGuess.h
+// Created on 29 Nov 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_SolutionHistoryInitialGuess
+#define included_IBTK_SolutionHistoryInitialGuess
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "Eigen/Core"
+#include "SAMRAIVectorReal.h"
+#include "tbox/Database.h"
+#include "tbox/DescribedClass.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class SolutionHistoryInitialGuess uses the solutions of previous
+ * linear solves to construct initial guesses for subsequent solves with the
+ * same operator.
+ *
+ * The object stores pairs of vectors \f$(x_i,b_i)\f$ satisfying \f$A x_i
+ * \approx b_i\f$.  For a new right-hand side \f$b\f$, the initial guess is
+ * \f$x = \sum_i \alpha_i x_i\f$, in which the coefficients minimize \f$\|b -
+ * \sum_i \alpha_i b_i\|\f$.  Because \f$A x = \sum_i \alpha_i b_i\f$, this is
+ * the guess that minimizes the residual over the span of the stored
+ * solutions, and it is never worse (in this sense) than starting from the
+ * most recent solution.  Computing the guess requires one global reduction
+ * and does not require applying the operator.
+ *
+ * Two types of bases are supported:
+ *
+ * - <tt>"HISTORY"</tt>: the most recent <tt>history_size</tt> pairs are kept.
+ * - <tt>"POD"</tt>: when the basis is full, the stored pairs are compressed
+ *   to the dominant <tt>history_size - 1</tt> proper orthogonal decomposition
+ *   modes of the right-hand sides (discarding any with relative energy below
+ *   <tt>pod_energy_tol</tt>).  This retains the recurring structure of
+ *   periodic flows rather than only the most recent time steps.
+ *
+ * Sample input:
+ \verbatim
+ basis_type = "POD"       // type of basis (default is "HISTORY")
+ history_size = 6         // maximum number of stored pairs (default is 4)
+ pod_energy_tol = 1.0e-8  // relative energy below which POD modes are dropped
+ \endverbatim
+ *
+ * \note The stored vectors are clones of the solution vector and must be
+ * discarded via reset() whenever the patch hierarchy or the operator changes.
+ * When the solve uses inhomogeneous boundary conditions, the solution depends
+ * affinely rather than linearly upon \f$b\f$, and the guess is correspondingly
+ * approximate.
+ */
+class SolutionHistoryInitialGuess : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    SolutionHistoryInitialGuess(const std::string& object_name, SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~SolutionHistoryInitialGuess();
+
+    /*!
+     * \brief Compute an initial guess for the solution of \f$Ax=b\f$.
+     *
+     * \return Whether an initial guess was computed.  If not (i.e., if no
+     * pairs are currently stored), \a x is left unmodified.
+     */
+    bool computeInitialGuess(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                             SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Store the solution \a x of \f$Ax=b\f$.
+     */
+    void storeSolution(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                       SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Discard all stored pairs.
+     */
+    void reset();
+
+    /*!
+     * \brief Return the number of stored pairs.
+     */
+    int getBasisSize() const;
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    SolutionHistoryInitialGuess();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    SolutionHistoryInitialGuess(const SolutionHistoryInitialGuess& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    SolutionHistoryInitialGuess& operator=(const SolutionHistoryInitialGuess& that);
+
+    /*!
+     * \brief Compute the inner products of \a b with the stored right-hand
+     * sides using a single global reduction.
+     */
+    void computeInnerProducts(Eigen::VectorXd& c,
+                              SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > b) const;
+
+    /*!
+     * \brief Remove the pair with the specified index.
+     */
+    void removePair(int k);
+
+    /*!
+     * \brief Replace the stored pairs by the dominant POD modes.
+     */
+    void compressBasis();
+
+    /*!
+     * \brief Release the data associated with a stored vector.
+     */
+    static void freeVector(SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> >& v);
+
+    std::string d_object_name;
+
+    /*
+     * Basis configuration.
+     */
+    bool d_use_pod;
+    int d_history_size;
+    double d_pod_energy_tol;
+
+    /*
+     * The stored pairs, and the Gram matrix of the stored right-hand sides.
+     */
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_X, d_B;
+    Eigen::MatrixXd d_gram;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_SolutionHistoryInitialGuess
@@ -0,0 +1,199 @@
+// Filename: StagedRestartManager.h
+// Created on 04 Dec 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_StagedRestartManager
+#define included_IBTK_StagedRestartManager
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <pthread.h>
+#include <string>
+
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class StagedRestartManager is a singleton manager class that writes
+ * SAMRAI restart files in two stages so that the file system writes overlap
+ * with the computation.
+ *
+ * When a checkpoint is requested, the putToDatabase() methods of all objects
+ * registered with the SAMRAI RestartManager (hierarchy integrators, the patch
+ * hierarchy and its patch data, LDataManager, IB methods, etc.) are called
+ * with an in-memory database, which copies the restart data into staging
+ * buffers.  Because this is the same protocol that is used to write restart
+ * files directly, no changes are required of the registered objects.  The
+ * staged data are then written to the usual restart file by a background
+ * thread while the simulation continues.  The restart files are identical to
+ * those written by SAMRAI::tbox::RestartManager::writeRestartFile(), and they
+ * are read in the usual way.
+ *
+ * A completion barrier is imposed only before the next checkpoint, when the
+ * manager is freed, or when waitForCompletion() is called explicitly.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ asynchronous = FALSE   // whether to write staged data in a background thread
+                        // (TRUE when HDF5 is configured to be thread safe)
+ \endverbatim
+ *
+ * \note The staging buffers require as much memory as the restart data
+ * written by each process.
+ *
+ * \note Asynchronous writes are enabled by default only when HDF5 is
+ * configured to be thread safe (i.e., when H5_HAVE_THREADSAFE is defined).
+ * They can be enabled explicitly otherwise, but in that case the application
+ * must call waitForCompletion() before performing any other HDF5 I/O (e.g.,
+ * writing VisIt data) while a write is pending.
+ */
+class StagedRestartManager
+{
+public:
+    /*!
+     * Return a pointer to the instance of the staged restart manager.  Access
+     * to StagedRestartManager objects is mediated by the getManager()
+     * function.
+     *
+     * \return A pointer to the staged restart manager instance.
+     */
+    static StagedRestartManager* getManager();
+
+    /*!
+     * Deallocate the StagedRestartManager instance, waiting for any pending
+     * write to complete.
+     *
+     * It is not necessary to call this function at program termination since it
+     * is automatically called by the ShutdownRegistry class.
+     */
+    static void freeManager();
+
+    /*!
+     * \brief Configure the manager from an input database.
+     */
+    void initialize(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Write a restart file to the specified directory, using the same
+     * directory layout as SAMRAI::tbox::RestartManager::writeRestartFile().
+     *
+     * This method returns once the restart data have been staged.  If a
+     * previous write is still pending, this method first waits for it to
+     * complete.
+     *
+     * \note This method is collective on all MPI processes.
+     */
+    void writeRestartFile(const std::string& root_dirname, int restore_num);
+
+    /*!
+     * \brief Wait for any pending write to complete.
+     */
+    void waitForCompletion();
+
+    /*!
+     * \return Whether a write is pending.
+     */
+    bool isWritePending() const;
+
+protected:
+    /*!
+     * \brief Default constructor.
+     */
+    StagedRestartManager();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~StagedRestartManager();
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    StagedRestartManager(const StagedRestartManager& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    StagedRestartManager& operator=(const StagedRestartManager& that);
+
+    /*!
+     * \brief Write the staged data to the restart file.
+     */
+    void writeStagedData();
+
+    /*!
+     * \brief Entry point for the background thread.
+     */
+    static void* writeStagedDataThread(void* manager);
+
+    /*!
+     * Static data members used to control access to and destruction of
+     * singleton manager instance.
+     */
+    static StagedRestartManager* s_staged_restart_manager_instance;
+    static bool s_registered_callback;
+    static unsigned char s_shutdown_priority;
+
+    /*
+     * Configuration.
+     */
+    bool d_asynchronous;
+
+    /*
+     * The staged data, the file to which they are written, and the state of
+     * the background thread.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_staged_db;
+    std::string d_staged_file_name;
+    pthread_t d_thread;
+    bool d_thread_active;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_StagedRestartManager
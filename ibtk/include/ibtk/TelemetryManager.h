@@ -0,0 +1,273 @@
+// Filename: TelemetryManager.h
+// Created on 20 Nov 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef included_IBTK_TelemetryManager
+#define included_IBTK_TelemetryManager
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "mpi.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+
+/////////////////////////////// MACRO DEFINITIONS ////////////////////////////
+
+#define IBTK_TELEMETRY_INCREMENT(counter_id, value)                                                                    \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (IBTK::TelemetryManager::isEnabled())                                                                       \
+            IBTK::TelemetryManager::getManager()->incrementCounter(counter_id, value);                                 \
+    } while (0);
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class TelemetryManager is a singleton manager class that collects
+ * per-timestep performance data and writes it to disk in a machine-readable
+ * format.
+ *
+ * For each timestep taken by the outermost HierarchyIntegrator, the manager
+ * records the wall-clock time of the step, the time spent in a user-specified
+ * set of SAMRAI timers, and the values of all registered counters (e.g.,
+ * numbers of Krylov iterations or of Lagrangian markers spread).  The minimum,
+ * maximum, and average of each value over all MPI processes are computed by a
+ * single nonblocking reduction that is completed at the end of the following
+ * timestep, and the records are written by the root process either as JSON
+ * lines or as CSV.
+ *
+ * Counters are registered by name via registerCounter() and are incremented by
+ * their integer identifiers, typically via the IBTK_TELEMETRY_INCREMENT macro,
+ * which does nothing other than test a static flag when telemetry is disabled.
+ * Counters must be registered on all MPI processes.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ enable = TRUE                          // whether to collect telemetry
+ output_file = "telemetry.jsonl"        // file to which records are appended
+ format = "JSON_LINES"                  // "JSON_LINES" or "CSV"
+ timers = "IBTK::LDataManager::spread()", "IBTK::LDataManager::interp()"
+                                        // names of SAMRAI timers to record
+ flush_interval = 10                    // number of records buffered before writing
+ \endverbatim
+ *
+ * \note Only timers that are activated via the SAMRAI TimerManager accumulate
+ * time.  Inactive timers are reported as zero.
+ */
+class TelemetryManager
+{
+public:
+    /*!
+     * Return a pointer to the instance of the telemetry manager.  Access to
+     * TelemetryManager objects is mediated by the getManager() function.
+     *
+     * \return A pointer to the telemetry manager instance.
+     */
+    static TelemetryManager* getManager();
+
+    /*!
+     * Deallocate the TelemetryManager instance, writing any buffered records.
+     *
+     * It is not necessary to call this function at program termination since it
+     * is automatically called by the ShutdownRegistry class.
+     */
+    static void freeManager();
+
+    /*!
+     * \return Whether telemetry collection is enabled.
+     */
+    static inline bool isEnabled()
+    {
+        return s_enabled;
+    } // isEnabled
+
+    /*!
+     * \brief Configure the manager from an input database.
+     *
+     * \note Only the first call to this function has any effect.
+     */
+    void initialize(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Register a counter with the specified name, returning the
+     * identifier used to increment it.  Registering a name more than once
+     * returns the same identifier.
+     */
+    int registerCounter(const std::string& name);
+
+    /*!
+     * \brief Increment the value of the specified counter for the current
+     * timestep.
+     */
+    inline void incrementCounter(const int counter_id, const double value)
+    {
+        d_counter_vals[counter_id] += value;
+        return;
+    } // incrementCounter
+
+    /*!
+     * \brief Begin collecting data for a timestep.
+     */
+    void beginStep(int step_num, double current_time, double dt);
+
+    /*!
+     * \brief Finish collecting data for the current timestep and initiate the
+     * reduction of the recorded values over all MPI processes.
+     *
+     * \note This method is collective on all MPI processes.
+     */
+    void endStep();
+
+    /*!
+     * \brief Complete any outstanding reduction and write all buffered records
+     * to disk.
+     *
+     * \note This method is collective on all MPI processes.
+     */
+    void flush();
+
+protected:
+    /*!
+     * \brief Default constructor.
+     */
+    TelemetryManager();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~TelemetryManager();
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    TelemetryManager(const TelemetryManager& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    TelemetryManager& operator=(const TelemetryManager& that);
+
+    /*!
+     * \brief Wait for the outstanding reduction, if any, and format its result
+     * as a record.
+     */
+    void completeReduction();
+
+    /*!
+     * \brief Write all buffered records to disk.
+     */
+    void writeRecords();
+
+    /*!
+     * Static data members used to control access to and destruction of
+     * singleton data manager instance.
+     */
+    static TelemetryManager* s_telemetry_manager_instance;
+    static bool s_registered_callback;
+    static unsigned char s_shutdown_priority;
+    static bool s_enabled;
+
+    /*!
+     * \brief Enumerated type for the output format.
+     */
+    enum OutputFormat
+    {
+        JSON_LINES,
+        CSV
+    };
+
+    /*
+     * Configuration options.
+     */
+    bool d_is_initialized;
+    std::string d_output_file;
+    OutputFormat d_format;
+    int d_flush_interval;
+
+    /*
+     * Timers and counters.
+     */
+    std::vector<std::string> d_timer_names;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::tbox::Timer> > d_timers;
+    std::vector<double> d_timer_start_vals;
+    std::map<std::string, int> d_counter_ids;
+    std::vector<double> d_counter_vals;
+
+    /*
+     * Data for the current timestep.
+     */
+    bool d_in_step;
+    int d_step_num;
+    double d_step_time, d_step_dt, d_step_start_wtime;
+
+    /*
+     * Data for the outstanding reduction.
+     */
+    MPI_Datatype d_reduction_type;
+    MPI_Op d_reduction_op;
+    MPI_Request d_reduction_req;
+    int d_pending_step_num;
+    double d_pending_step_time, d_pending_step_dt;
+    std::vector<std::string> d_pending_field_names;
+    std::vector<int> d_pending_field_types;
+    std::vector<double> d_reduction_send_buf, d_reduction_recv_buf;
+
+    /*
+     * Formatted records that have not yet been written to disk.
+     */
+    std::vector<std::string> d_buffered_records;
+    std::string d_csv_header;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_TelemetryManager
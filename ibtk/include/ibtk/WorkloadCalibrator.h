@@ -0,0 +1,273 @@
+// Filename: WorkloadCalibrator.h
+// Created on 06 Nov 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_WorkloadCalibrator
+#define included_IBTK_WorkloadCalibrator
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <deque>
+#include <iosfwd>
+#include <string>
+
+#include "tbox/DescribedClass.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class WorkloadCalibrator is a utility class for determining the cost
+ * coefficients of the cell workload model used for non-uniform load balancing
+ * from measured timings.
+ *
+ * The workload model assumes that the cost of a timestep on each MPI process is
+ *
+ *    cost = alpha*num_cells + (beta_interaction + beta_force)*num_lag_points
+ *
+ * in which num_cells is the number of local Cartesian grid cells and
+ * num_lag_points is the number of local Lagrangian points (IB nodes or
+ * quadrature points).  The time spent in Lagrangian-Eulerian interaction and
+ * Lagrangian force evaluation is measured directly via startTimer() and
+ * stopTimer(), and the Eulerian (fluid) time is taken to be the remainder of
+ * the wall-clock time between successive calls to completeStep().  The
+ * coefficients are determined by a joint least-squares fit of the Eulerian and
+ * Lagrangian times to the numbers of cells and Lagrangian points over the most
+ * recent timesteps on all MPI processes.
+ *
+ * To keep the time that a process spends waiting for other processes out of
+ * the Eulerian time, all processes are synchronized at the beginning and end
+ * of each timed Lagrangian phase and at the end of each step, and the time
+ * spent in these barriers is excluded from the samples.  Consequently,
+ * startTimer(), stopTimer(), and completeStep() are collective on all MPI
+ * processes whenever they start or stop the outermost timer.  Time spent
+ * waiting at synchronization points within the Eulerian solver itself is not
+ * excluded, so that alpha may still overestimate the cost per cell of the
+ * processes with the least Eulerian work.
+ */
+class WorkloadCalibrator : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Enumerated type for the directly timed components of the
+     * workload.
+     */
+    enum WorkloadComponent
+    {
+        INTERACTION_WORK = 0,
+        FORCE_WORK = 1,
+        NUM_WORKLOAD_COMPONENTS = 2
+    };
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param object_name  String used for error reporting and logging.
+     * \param num_samples  Number of timesteps used to fit the cost coefficients.
+     */
+    WorkloadCalibrator(const std::string& object_name, int num_samples);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~WorkloadCalibrator();
+
+    /*!
+     * \brief Start timing the specified workload component.
+     *
+     * \note Calls may be nested; only the outermost start/stop pair is timed.
+     * When no other component is being timed, this method synchronizes all
+     * MPI processes and is therefore collective.
+     */
+    void startTimer(WorkloadComponent component);
+
+    /*!
+     * \brief Stop timing the specified workload component.
+     *
+     * \note When no other component is still being timed, this method
+     * synchronizes all MPI processes and is therefore collective.
+     */
+    void stopTimer(WorkloadComponent component);
+
+    /*!
+     * \brief Record the timings accumulated since the previous call as a single
+     * sample, along with the local problem size associated with that sample.
+     *
+     * \note The first call only initializes the step clock.  This method
+     * synchronizes all MPI processes and is therefore collective.
+     */
+    void completeStep(double num_local_cells, double num_local_lag_points);
+
+    /*!
+     * \brief Discard all recorded samples and reset the step clock.
+     *
+     * This should be called whenever the data distribution changes.
+     */
+    void clearSamples();
+
+    /*!
+     * \return The number of recorded samples.
+     */
+    int getNumberOfSamples() const;
+
+    /*!
+     * \brief Fit the cost coefficients to the recorded samples.
+     *
+     * \note This method is collective on all MPI processes.  It performs a
+     * single collective operation.
+     *
+     * \return true if the coefficients were updated; false if not all processes
+     * have recorded samples or if there is no meaningful Eulerian work.
+     */
+    bool computeCoefficients();
+
+    /*!
+     * \return The cost of a timestep per Cartesian grid cell (seconds).
+     */
+    double getEulerianCoefficient() const;
+
+    /*!
+     * \return The cost of a timestep per Lagrangian point for the specified
+     * workload component (seconds).
+     */
+    double getLagrangianCoefficient(WorkloadComponent component) const;
+
+    /*!
+     * \return The total cost of a Lagrangian point relative to the cost of a
+     * Cartesian grid cell, i.e., the value of (beta_interaction +
+     * beta_force)/alpha.
+     *
+     * \note Because the Eulerian time is also fit to the number of Lagrangian
+     * points, the total cost of a Lagrangian point may differ from the sum of
+     * the values returned by getLagrangianCoefficient().
+     */
+    double getRelativeLagrangianWorkload() const;
+
+    /*!
+     * \brief Return the ratio of the maximum to the average per-process cost
+     * predicted by the calibrated model for the specified local problem size.
+     *
+     * \note This method is collective on all MPI processes.
+     */
+    double computePredictedImbalance(double num_local_cells, double num_local_lag_points) const;
+
+    /*!
+     * \brief Return the ratio of the maximum to the average per-process cost
+     * measured over the samples that were used by the most recent call to
+     * computeCoefficients().
+     */
+    double getMeasuredImbalance() const;
+
+    /*!
+     * \brief Return the imbalance that the calibrated model predicts for the
+     * samples that were used by the most recent call to computeCoefficients().
+     */
+    double getModelImbalance() const;
+
+    /*!
+     * \brief Print the calibrated coefficients, the measured and predicted
+     * load imbalances for the recorded samples, and the specified predicted
+     * load imbalance for the new data distribution.
+     *
+     * \note This method is not collective.  The predicted load imbalance for
+     * the new data distribution should be computed on all MPI processes by
+     * computePredictedImbalance().
+     */
+    void printReport(double predicted_imbalance, std::ostream& os) const;
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    WorkloadCalibrator();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    WorkloadCalibrator(const WorkloadCalibrator& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    WorkloadCalibrator& operator=(const WorkloadCalibrator& that);
+
+    /*
+     * Per-timestep timing and problem size data.
+     */
+    struct Sample
+    {
+        double step_time;
+        double wait_time;
+        double component_time[NUM_WORKLOAD_COMPONENTS];
+        double num_cells;
+        double num_lag_points;
+    };
+
+    std::string d_object_name;
+    int d_num_samples;
+    std::deque<Sample> d_samples;
+
+    /*
+     * Timer state.
+     */
+    double d_step_start_time;
+    double d_component_start_time[NUM_WORKLOAD_COMPONENTS];
+    double d_component_time[NUM_WORKLOAD_COMPONENTS];
+    int d_component_depth[NUM_WORKLOAD_COMPONENTS];
+    int d_num_active_components;
+    double d_wait_time;
+
+    /*
+     * Calibrated coefficients and diagnostics.
+     */
+    double d_alpha;
+    double d_beta[NUM_WORKLOAD_COMPONENTS];
+    double d_beta_total;
+    double d_measured_imbalance, d_model_imbalance;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_WorkloadCalibrator
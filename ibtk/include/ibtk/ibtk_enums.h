@@ -165,6 +165,41 @@ enum_to_string<VariableContextType>(VariableContextType val)
     return "UNKNOWN_VARIABLE_CONTEXT_TYPE";
 } // enum_to_string
 
+/*!
+ * \brief Enumerated type for different modes of storing parallel data
+ * structures (e.g., ParallelMap, ParallelSet, and ParallelEdgeMap).
+ *
+ * With REPLICATED_DATA, every MPI process stores a complete copy of the data.
+ * With DISTRIBUTED_DATA, each item is stored only on the MPI process that owns
+ * its key.
+ */
+enum ParallelDataMode
+{
+    REPLICATED_DATA,
+    DISTRIBUTED_DATA,
+    UNKNOWN_PARALLEL_DATA_MODE = -1
+};
+
+template <>
+inline ParallelDataMode
+string_to_enum<ParallelDataMode>(const std::string& val)
+{
+    if (strcasecmp(val.c_str(), "REPLICATED_DATA") == 0) return REPLICATED_DATA;
+    if (strcasecmp(val.c_str(), "REPLICATED") == 0) return REPLICATED_DATA;
+    if (strcasecmp(val.c_str(), "DISTRIBUTED_DATA") == 0) return DISTRIBUTED_DATA;
+    if (strcasecmp(val.c_str(), "DISTRIBUTED") == 0) return DISTRIBUTED_DATA;
+    return UNKNOWN_PARALLEL_DATA_MODE;
+} // string_to_enum
+
+template <>
+inline std::string
+enum_to_string<ParallelDataMode>(ParallelDataMode val)
+{
+    if (val == REPLICATED_DATA) return "REPLICATED_DATA";
+    if (val == DISTRIBUTED_DATA) return "DISTRIBUTED_DATA";
+    return "UNKNOWN_PARALLEL_DATA_MODE";
+} // enum_to_string
+
 } // namespace IBTK
 
 //////////////////////////////////////////////////////////////////////////////
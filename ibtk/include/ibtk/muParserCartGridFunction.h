@@ -141,6 +141,30 @@ private:
      */
     muParserCartGridFunction& operator=(const muParserCartGridFunction& that);
 
+    /*!
+     * \brief Register the time and position arrays as the variables of the
+     * mu::Parser objects.
+     */
+    void defineParserVariables();
+
+    /*!
+     * \brief Ensure that the arrays used in bulk evaluation mode can hold the
+     * specified number of points and set the time variable for those points.
+     */
+    void setBulkTime(double data_time, int num_points);
+
+    /*!
+     * \brief Evaluate the specified function at the first num_points positions
+     * stored in the position arrays.
+     */
+    void evaluateBulk(int function_depth, int num_points);
+
+    /*!
+     * \brief Determine the function used to set the specified component of
+     * face- or side-centered data.
+     */
+    int getFunctionDepth(unsigned int axis, int data_depth, int depth) const;
+
     /*!
      * The Cartesian grid geometry object provides the extents of the
      * computational domain.
@@ -164,10 +188,13 @@ private:
     std::vector<mu::Parser> d_parsers;
 
     /*!
-     * Time and position variables.
+     * Time and position variables, along with the function values, for all of
+     * the points in a data box.  The functions are evaluated at all of the
+     * points at once using the bulk evaluation mode of muParser.
      */
-    double d_parser_time;
-    Point d_parser_posn;
+    std::vector<double> d_parser_time;
+    boost::array<std::vector<double>, NDIM> d_parser_posn;
+    std::vector<double> d_parser_vals;
 };
 } // namespace IBTK
 
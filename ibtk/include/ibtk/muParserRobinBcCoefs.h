@@ -41,8 +41,8 @@
 
 #include "CartesianGridGeometry.h"
 #include "IntVector.h"
-#include "RobinBcCoefStrategy.h"
 #include "muParser.h"
+#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/ibtk_utilities.h"
 #include "tbox/Pointer.h"
 
@@ -74,15 +74,18 @@ namespace IBTK
 {
 /*!
  * \brief Class muParserRobinBcCoefs is an implementation of the strategy class
- * SAMRAI::solv::RobinBcCoefStrategy that allows for the run-time specification
- * of (possibly spatially- and temporally-varying) Robin boundary conditions.
+ * ExtendedRobinBcCoefStrategy that allows for the run-time specification of
+ * (possibly spatially- and temporally-varying) Robin boundary conditions.
+ *
+ * Because the boundary condition coefficients depend only on position and time,
+ * the physical boundary operators may cache the values computed by this class.
  *
  * \warning Not all linear solvers in IBTK properly handle time-varying \em
  * homogeneous Robin boundary condition coefficients.  Note, however, that all
  * linear solvers in IBTK are presently designed to support spatially and
  * temporally varying \em inhomogeneous boundary coefficients.
  */
-class muParserRobinBcCoefs : public SAMRAI::solv::RobinBcCoefStrategy<NDIM>
+class muParserRobinBcCoefs : public ExtendedRobinBcCoefStrategy
 {
 public:
     /*!
@@ -97,6 +100,25 @@ public:
      */
     ~muParserRobinBcCoefs();
 
+    /*!
+     * \name Extended SAMRAI::solv::RobinBcCoefStrategy interface.
+     */
+    //\{
+
+    /*!
+     * \brief Indicate that the boundary condition coefficients may be cached.
+     */
+    bool hasCacheableBcCoefs() const;
+
+    /*!
+     * \brief Indicates whether any of the boundary condition coefficient
+     * functions depend on time (i.e., whether any of the function expressions
+     * refer to the time variable t or T).
+     */
+    bool isTimeDependent() const;
+
+    //\}
+
     /*!
      * \name Implementation of SAMRAI::solv::RobinBcCoefStrategy interface.
      */
@@ -185,6 +207,12 @@ private:
      */
     muParserRobinBcCoefs& operator=(const muParserRobinBcCoefs& that);
 
+    /*!
+     * \brief Evaluate the specified function at the first num_points positions
+     * stored in the position arrays.
+     */
+    void evaluateBulk(const mu::Parser& parser, double* vals, int num_points) const;
+
     /*!
      * The Cartesian grid geometry object provides the extents of the
      * computational domain.
@@ -212,10 +240,17 @@ private:
     std::vector<mu::Parser> d_gcoef_parsers;
 
     /*!
-     * Time and position variables.
+     * Whether any of the functions depend on time.
+     */
+    bool d_is_time_dependent;
+
+    /*!
+     * Time and position variables for a block of points.  The functions are
+     * evaluated at all of the points in the block at once using the bulk
+     * evaluation mode of muParser.
      */
     double* d_parser_time;
-    Point* d_parser_posn;
+    double* d_parser_posn;
 };
 } // namespace IBTK
 
@@ -158,6 +158,12 @@ LDataManager::getNodeCountPatchDescriptorIndex() const
     return d_node_count_idx;
 } // getNodeCountPatchDescriptorIndex
 
+inline SAMRAI::tbox::Pointer<WorkloadCalibrator>
+LDataManager::getWorkloadCalibrator() const
+{
+    return d_workload_calibrator;
+} // getWorkloadCalibrator
+
 inline std::vector<std::string>
 LDataManager::getLagrangianStructureNames(const int level_number) const
 {
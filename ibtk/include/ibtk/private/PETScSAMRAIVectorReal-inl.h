@@ -49,13 +49,15 @@ namespace IBTK
 inline Vec
 PETScSAMRAIVectorReal::createPETScVector(
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, PetscScalar> > samrai_vec,
-    MPI_Comm comm)
+    MPI_Comm comm,
+    bool use_packed_duplicates)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(samrai_vec);
 #endif
     static const bool vector_created_via_duplicate = false;
     PETScSAMRAIVectorReal* psv = new PETScSAMRAIVectorReal(samrai_vec, vector_created_via_duplicate, comm);
+    psv->d_use_packed_duplicates = use_packed_duplicates;
     return psv->d_petsc_vector;
 }
 
@@ -85,6 +87,7 @@ PETScSAMRAIVectorReal::getSAMRAIVector(
     TBOX_ASSERT(psv);
     TBOX_ASSERT(!psv->d_vector_checked_out_read);
 #endif
+    psv->makePatchDataCurrent();
     psv->d_vector_checked_out_read_write = true;
     *samrai_vec = psv->d_samrai_vector;
 }
@@ -104,6 +107,7 @@ PETScSAMRAIVectorReal::restoreSAMRAIVector(
     TBOX_ASSERT(psv->d_samrai_vector.getPointer() == *samrai_vec);
 #endif
     psv->d_vector_checked_out_read_write = false;
+    psv->setPatchDataModified();
     *samrai_vec = NULL;
     int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(petsc_vec));
     IBTK_CHKERRQ(ierr);
@@ -122,6 +126,7 @@ PETScSAMRAIVectorReal::getSAMRAIVectorRead(
     TBOX_ASSERT(psv);
     TBOX_ASSERT(!psv->d_vector_checked_out_read_write);
 #endif
+    psv->makePatchDataCurrent();
     psv->d_vector_checked_out_read = true;
     *samrai_vec = psv->d_samrai_vector;
 }
@@ -156,9 +161,18 @@ PETScSAMRAIVectorReal::replaceSAMRAIVector(
     PETScSAMRAIVectorReal* psv = static_cast<PETScSAMRAIVectorReal*>(petsc_vec->data);
 #if !defined(NDEBUG)
     TBOX_ASSERT(psv);
+    TBOX_ASSERT(!psv->d_packed_vec);
 #endif
     psv->d_samrai_vector = samrai_vec;
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(petsc_vec));
+    int ierr;
+    if (psv->d_packed_wgt)
+    {
+        // Drop the cached control volume weights, which may not be valid for
+        // the new SAMRAI vector.
+        ierr = VecDestroy(&psv->d_packed_wgt);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(petsc_vec));
     IBTK_CHKERRQ(ierr);
 }
 
@@ -0,0 +1,157 @@
+#!/usr/bin/env python
+#
+# Filename: read_reduced_data.py
+#
+# Reader for the reduced plot data streams written by IBTK::ReducedDataWriter.
+#
+# Usage:
+#
+#   import read_reduced_data as rrd
+#   for rec in rrd.read_records("viz_IB2d"):
+#       print(rec["name"], rec["time"], rec["level"], rec["data"].shape)
+#
+#   # Assemble the samples of one quantity on one level at one time step.
+#   u_x = rrd.assemble("viz_IB2d", "U", time_step=100, level=0, component=0)
+#
+# Requires NumPy.
+
+import glob
+import os
+import struct
+
+import numpy as np
+
+MAGIC = b"IBTKRED\0"
+VERSION = 1
+RECORD_MARKER = 0x52454344
+NO_COMPRESSION, LOSSLESS_COMPRESSION, ERROR_BOUNDED_COMPRESSION = 0, 1, 2
+
+
+def _read_varint(buf, pos):
+    val, shift = 0, 0
+    while True:
+        b = buf[pos]
+        pos += 1
+        val |= (b & 0x7F) << shift
+        if b < 0x80:
+            return val, pos
+        shift += 7
+
+
+def _decode_zero_runs(buf, nbytes):
+    out = np.zeros(nbytes, dtype=np.uint8)
+    src = np.frombuffer(buf, dtype=np.uint8)
+    pos, dst = 0, 0
+    while pos < len(buf):
+        nlit, pos = _read_varint(buf, pos)
+        out[dst:dst + nlit] = src[pos:pos + nlit]
+        pos += nlit
+        dst += nlit
+        nzero, pos = _read_varint(buf, pos)
+        dst += nzero
+    return out
+
+
+def _unshuffle(planes, n, word_size, dtype):
+    planes = planes.reshape(word_size, n).astype(dtype)
+    words = np.zeros(n, dtype=dtype)
+    for b in range(word_size):
+        words |= planes[b] << dtype(8 * b)
+    return words
+
+
+def _decode(payload, num_values, value_size, compression, error_tol, order):
+    real = np.dtype(order + ("f4" if value_size == 4 else "f8"))
+    if compression == NO_COMPRESSION:
+        return np.frombuffer(payload, dtype=real, count=num_values).astype(real.newbyteorder("="))
+    if compression == LOSSLESS_COMPRESSION:
+        uint = np.uint32 if value_size == 4 else np.uint64
+        planes = _decode_zero_runs(payload, num_values * value_size)
+        words = np.bitwise_xor.accumulate(_unshuffle(planes, num_values, value_size, uint))
+        return words.view(np.float32 if value_size == 4 else np.float64)
+    if compression == ERROR_BOUNDED_COMPRESSION:
+        planes = _decode_zero_runs(payload, num_values * 8)
+        z = _unshuffle(planes, num_values, 8, np.uint64)
+        delta = (z >> np.uint64(1)).astype(np.int64) ^ -(z & np.uint64(1)).astype(np.int64)
+        vals = np.cumsum(delta) * (2.0 * error_tol)
+        return vals.astype(np.float32 if value_size == 4 else np.float64)
+    raise ValueError("unknown compression type %d" % compression)
+
+
+def read_stream(file_name):
+    """Yield the records stored in a single reduced data stream file."""
+    with open(file_name, "rb") as f:
+        buf = f.read()
+    if buf[:8] != MAGIC:
+        raise IOError("%s is not a reduced data stream" % file_name)
+    order = "<" if struct.unpack("<i", buf[8:12])[0] == 0x01020304 else ">"
+    version, ndim = struct.unpack(order + "ii", buf[12:20])
+    if version != VERSION:
+        raise IOError("%s has unsupported version %d" % (file_name, version))
+    pos = 20
+
+    def unpack(fmt):
+        vals = struct.unpack_from(order + fmt, buf, pos)
+        return vals, pos + struct.calcsize(order + fmt)
+
+    while pos < len(buf):
+        (marker, name_len), pos = unpack("ii")
+        if marker != RECORD_MARKER:
+            raise IOError("%s is corrupt near byte %d" % (file_name, pos))
+        name = buf[pos:pos + name_len].decode()
+        pos += name_len
+        (time_step, time, level, component, stride), pos = unpack("idiii")
+        num, pos = unpack("%di" % ndim)
+        first, pos = unpack("%di" % ndim)
+        x_first, pos = unpack("%dd" % ndim)
+        dx, pos = unpack("%dd" % ndim)
+        (value_size, compression, error_tol, num_values, payload_size), pos = unpack("iidqq")
+        payload = buf[pos:pos + payload_size]
+        pos += payload_size
+        data = _decode(payload, num_values, value_size, compression, error_tol, order)
+        yield {
+            "name": name,
+            "time_step": time_step,
+            "time": time,
+            "level": level,
+            "component": component,
+            "stride": stride,
+            "first": first,
+            "x_first": x_first,
+            "dx": dx,
+            "data": data.reshape(num[::-1]).T,
+        }
+
+
+def read_records(dump_dirname):
+    """Yield the records stored in all reduced data streams in a directory."""
+    for file_name in sorted(glob.glob(os.path.join(dump_dirname, "reduced_data.proc_*.bin"))):
+        for rec in read_stream(file_name):
+            yield rec
+
+
+def assemble(dump_dirname, name, time_step, level=0, component=0):
+    """Assemble the samples of a quantity on a single level into one array.
+
+    Returns (data, x_first, dx), in which unsampled entries of data are NaN.
+    """
+    recs = [r for r in read_records(dump_dirname)
+            if r["name"] == name and r["time_step"] == time_step and r["level"] == level
+            and r["component"] == component]
+    if not recs:
+        raise KeyError("no data for %s at time step %d on level %d" % (name, time_step, level))
+    stride = recs[0]["stride"]
+    lo = np.min([r["first"] for r in recs], axis=0) // stride
+    hi = np.max([np.array(r["first"]) // stride + np.array(r["data"].shape) for r in recs], axis=0)
+    data = np.full(hi - lo, np.nan)
+    x_first = None
+    for r in recs:
+        offset = np.array(r["first"]) // stride - lo
+        data[tuple(slice(o, o + n) for o, n in zip(offset, r["data"].shape))] = r["data"]
+        if np.all(offset == 0):
+            x_first = r["x_first"]
+    if x_first is None:
+        r = recs[0]
+        offset = np.array(r["first"]) // stride - lo
+        x_first = tuple(np.array(r["x_first"]) - offset * np.array(r["dx"]))
+    return data, x_first, recs[0]["dx"]
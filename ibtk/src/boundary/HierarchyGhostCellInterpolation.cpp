@@ -38,6 +38,7 @@
 #include <string>
 #include <vector>
 
+#include "Box.h"
 #include "CartesianGridGeometry.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
@@ -48,6 +49,8 @@
 #include "NodeVariable.h"
 #include "Patch.h"
 #include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchGeometry.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
@@ -69,6 +72,7 @@
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/RefinePatchStrategySet.h"
+#include "ibtk/TelemetryManager.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Pointer.h"
@@ -106,6 +110,10 @@ static Timer* t_fill_data;
 static Timer* t_fill_data_coarsen;
 static Timer* t_fill_data_refine;
 static Timer* t_fill_data_set_physical_bcs;
+
+// Telemetry counters.
+static int c_num_fill_data_calls;
+static int c_num_fill_data_ghost_bytes;
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -148,6 +156,12 @@ HierarchyGhostCellInterpolation::HierarchyGhostCellInterpolation()
             TimerManager::getManager()->getTimer("IBTK::HierarchyGhostCellInterpolation::fillData()[refine]");
         t_fill_data_set_physical_bcs = TimerManager::getManager()->getTimer(
             "IBTK::HierarchyGhostCellInterpolation::fillData()[set_physical_bcs]"););
+
+    // Setup telemetry counters.
+    IBTK_DO_ONCE(c_num_fill_data_calls = TelemetryManager::getManager()->registerCounter(
+                     "IBTK::HierarchyGhostCellInterpolation::fillData()[calls]");
+                 c_num_fill_data_ghost_bytes = TelemetryManager::getManager()->registerCounter(
+                     "IBTK::HierarchyGhostCellInterpolation::fillData()[ghost_bytes]"););
     return;
 } // HierarchyGhostCellInterpolation
 
@@ -581,10 +595,36 @@ void
 HierarchyGhostCellInterpolation::fillData(double fill_time)
 {
     IBTK_TIMER_START(t_fill_data);
+    IBTK_TELEMETRY_INCREMENT(c_num_fill_data_calls, 1.0);
 
 #if !defined(NDEBUG)
     TBOX_ASSERT(d_is_initialized);
 #endif
+    // Record the size of the ghost cell data of the local patches.  SAMRAI
+    // schedules do not report the number of bytes that they move, so this is an
+    // upper bound when a fill pattern restricts the ghost cells that are filled.
+    if (TelemetryManager::isEnabled())
+    {
+        Pointer<PatchDescriptor<NDIM> > patch_descriptor = VariableDatabase<NDIM>::getDatabase()->getPatchDescriptor();
+        double num_ghost_bytes = 0.0;
+        for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+        {
+            const int dst_data_idx = d_transaction_comps[comp_idx].d_dst_data_idx;
+            Pointer<PatchDataFactory<NDIM> > pdat_factory = patch_descriptor->getPatchDataFactory(dst_data_idx);
+            Pointer<PatchDataFactory<NDIM> > interior_pdat_factory = pdat_factory->cloneFactory(IntVector<NDIM>(0));
+            for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
+                    num_ghost_bytes += static_cast<double>(pdat_factory->getSizeOfMemory(patch_box)) -
+                                       static_cast<double>(interior_pdat_factory->getSizeOfMemory(patch_box));
+                }
+            }
+        }
+        TelemetryManager::getManager()->incrementCounter(c_num_fill_data_ghost_bytes, num_ghost_bytes);
+    }
     // Ensure the boundary condition objects are in the correct state.
     for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
     {
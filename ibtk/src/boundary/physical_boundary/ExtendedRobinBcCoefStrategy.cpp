@@ -82,6 +82,18 @@ ExtendedRobinBcCoefStrategy::setHomogeneousBc(bool homogeneous_bc)
     return;
 } // setHomogeneousBc
 
+bool
+ExtendedRobinBcCoefStrategy::hasCacheableBcCoefs() const
+{
+    return false;
+} // hasCacheableBcCoefs
+
+bool
+ExtendedRobinBcCoefStrategy::isTimeDependent() const
+{
+    return true;
+} // isTimeDependent
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
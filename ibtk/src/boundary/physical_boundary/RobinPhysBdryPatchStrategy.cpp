@@ -32,31 +32,27 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <map>
 #include <ostream>
 #include <set>
+#include <utility>
 #include <vector>
 
+#include "ArrayData.h"
+#include "BoundaryBox.h"
 #include "Box.h"
+#include "CartesianPatchGeometry.h"
 #include "ComponentSelector.h"
 #include "IntVector.h"
+#include "Patch.h"
+#include "RobinBcCoefStrategy.h"
+#include "Variable.h"
+#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
-namespace SAMRAI
-{
-namespace hier
-{
-template <int DIM>
-class Patch;
-} // namespace hier
-namespace solv
-{
-template <int DIM>
-class RobinBcCoefStrategy;
-} // namespace solv
-} // namespace SAMRAI
-
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
@@ -65,7 +61,8 @@ namespace IBTK
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
-RobinPhysBdryPatchStrategy::RobinPhysBdryPatchStrategy() : d_patch_data_indices(), d_bc_coefs(), d_homogeneous_bc(false)
+RobinPhysBdryPatchStrategy::RobinPhysBdryPatchStrategy()
+    : d_patch_data_indices(), d_bc_coefs(), d_homogeneous_bc(false), d_bc_coef_cache()
 {
     // intentionally blank
     return;
@@ -91,6 +88,7 @@ RobinPhysBdryPatchStrategy::setPatchDataIndices(const std::set<int>& patch_data_
 {
     d_patch_data_indices.clear();
     d_patch_data_indices = patch_data_indices;
+    clearBcCoefCache();
     return;
 } // setPatchDataIndices
 
@@ -127,6 +125,7 @@ RobinPhysBdryPatchStrategy::setPhysicalBcCoefs(const std::vector<RobinBcCoefStra
     }
 #endif
     d_bc_coefs = bc_coefs;
+    clearBcCoefCache();
     return;
 } // setPhysicalBcCoefs
 
@@ -143,6 +142,13 @@ RobinPhysBdryPatchStrategy::getHomogeneousBc() const
     return d_homogeneous_bc;
 } // getHomogeneousBc
 
+void
+RobinPhysBdryPatchStrategy::clearBcCoefCache()
+{
+    d_bc_coef_cache.clear();
+    return;
+} // clearBcCoefCache
+
 void
 RobinPhysBdryPatchStrategy::preprocessRefine(Patch<NDIM>& /*fine*/,
                                              const Patch<NDIM>& /*coarse*/,
@@ -174,6 +180,96 @@ RobinPhysBdryPatchStrategy::accumulateFromPhysicalBoundaryData(Patch<NDIM>& /*pa
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+void
+RobinPhysBdryPatchStrategy::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
+                                       Pointer<ArrayData<NDIM, double> >& bcoef_data,
+                                       Pointer<ArrayData<NDIM, double> >& gcoef_data,
+                                       const int bc_coef_idx,
+                                       const int patch_data_idx,
+                                       const Pointer<Variable<NDIM> >& variable,
+                                       Patch<NDIM>& patch,
+                                       const BoundaryBox<NDIM>& bdry_box,
+                                       const double fill_time)
+{
+    RobinBcCoefStrategy<NDIM>* bc_coef = d_bc_coefs[bc_coef_idx];
+    ExtendedRobinBcCoefStrategy* const extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+    if (!extended_bc_coef || !extended_bc_coef->hasCacheableBcCoefs() || !pgeom)
+    {
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->setTargetPatchDataIndex(patch_data_idx);
+            extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
+        }
+        bc_coef->setBcCoefs(acoef_data, bcoef_data, gcoef_data, variable, patch, bdry_box, fill_time);
+        if (d_homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
+        if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+        return;
+    }
+
+    // Look up the cached coefficients for this boundary box.  The patch
+    // geometry is included in the key so that boxes with the same indices on
+    // differently refined or positioned levels are not confused.
+    const Box<NDIM>& bc_coef_box = acoef_data->getBox();
+    const double* const dx = pgeom->getDx();
+    const double* const x_lower = pgeom->getXLower();
+    BcCoefCacheKey key;
+    key.first.reserve(4 + 2 * NDIM);
+    key.first.push_back(bc_coef_idx);
+    key.first.push_back(patch_data_idx);
+    key.first.push_back(patch.getPatchLevelNumber());
+    key.first.push_back(bdry_box.getLocationIndex());
+    key.second.reserve(2 * NDIM);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        key.first.push_back(bc_coef_box.lower(d));
+        key.first.push_back(bc_coef_box.upper(d));
+        key.second.push_back(dx[d]);
+        key.second.push_back(x_lower[d]);
+    }
+    std::map<BcCoefCacheKey, BcCoefCacheEntry>::iterator it = d_bc_coef_cache.find(key);
+    if (it != d_bc_coef_cache.end() && extended_bc_coef->isTimeDependent() && it->second.fill_time != fill_time)
+    {
+        d_bc_coef_cache.erase(it);
+        it = d_bc_coef_cache.end();
+    }
+
+    // Compute and cache the inhomogeneous coefficients if they are not already
+    // available.
+    if (it == d_bc_coef_cache.end())
+    {
+        BcCoefCacheEntry entry;
+        entry.fill_time = fill_time;
+        entry.acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+        entry.bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+        entry.gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+        extended_bc_coef->setTargetPatchDataIndex(patch_data_idx);
+        extended_bc_coef->setHomogeneousBc(false);
+        bc_coef->setBcCoefs(
+            entry.acoef_data, entry.bcoef_data, entry.gcoef_data, variable, patch, bdry_box, fill_time);
+        extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
+        extended_bc_coef->clearTargetPatchDataIndex();
+        it = d_bc_coef_cache.insert(std::make_pair(key, entry)).first;
+    }
+
+    // Copy the cached values.
+    const BcCoefCacheEntry& entry = it->second;
+    if (acoef_data) acoef_data->copy(*entry.acoef_data);
+    if (bcoef_data) bcoef_data->copy(*entry.bcoef_data);
+    if (gcoef_data)
+    {
+        if (d_homogeneous_bc)
+        {
+            gcoef_data->fillAll(0.0);
+        }
+        else
+        {
+            gcoef_data->copy(*entry.gcoef_data);
+        }
+    }
+    return;
+} // setBcCoefs
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <map>
 #include <ostream>
 #include <string>
@@ -74,6 +75,10 @@ namespace IBTK
 namespace
 {
 static const int EXTENSIONS_FILLABLE = 128;
+
+// Maximum number of points at which the functions are evaluated at once in
+// bulk evaluation mode.
+static const int BULK_EVAL_SIZE = 256;
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -81,7 +86,8 @@ static const int EXTENSIONS_FILLABLE = 128;
 muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
                                            Pointer<Database> input_db,
                                            Pointer<CartesianGridGeometry<NDIM> > grid_geom)
-    : d_grid_geom(grid_geom),
+    : ExtendedRobinBcCoefStrategy(),
+      d_grid_geom(grid_geom),
       d_constants(),
       d_acoef_function_strings(),
       d_bcoef_function_strings(),
@@ -89,8 +95,9 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
       d_acoef_parsers(2 * NDIM),
       d_bcoef_parsers(2 * NDIM),
       d_gcoef_parsers(2 * NDIM),
-      d_parser_time(new double),
-      d_parser_posn(new Point)
+      d_is_time_dependent(false),
+      d_parser_time(new double[BULK_EVAL_SIZE]),
+      d_parser_posn(new double[NDIM * BULK_EVAL_SIZE])
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -147,7 +154,7 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         }
         catch (mu::ParserError& e)
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+            TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
                        << "  error: "
                        << e.GetMsg()
                        << "\n"
@@ -157,7 +164,7 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         }
         catch (...)
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+            TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
                        << "  unrecognized exception generated by muParser library.\n");
         }
 
@@ -183,7 +190,7 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         }
         catch (mu::ParserError& e)
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+            TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
                        << "  error: "
                        << e.GetMsg()
                        << "\n"
@@ -193,7 +200,7 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         }
         catch (...)
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+            TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
                        << "  unrecognized exception generated by muParser library.\n");
         }
 
@@ -219,7 +226,7 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         }
         catch (mu::ParserError& e)
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+            TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
                        << "  error: "
                        << e.GetMsg()
                        << "\n"
@@ -229,7 +236,7 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         }
         catch (...)
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+            TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
                        << "  unrecognized exception generated by muParser library.\n");
         }
     }
@@ -320,6 +327,9 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         }
 
         // Variables.
+        //
+        // NOTE: In bulk evaluation mode, muParser treats every variable as an
+        // array of values.
         (*cit)->DefineVar("T", d_parser_time);
         (*cit)->DefineVar("t", d_parser_time);
         for (unsigned int d = 0; d < NDIM; ++d)
@@ -327,10 +337,32 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
             std::ostringstream stream;
             stream << d;
             const std::string postfix = stream.str();
-            (*cit)->DefineVar("X" + postfix, &d_parser_posn->data()[d]);
-            (*cit)->DefineVar("x" + postfix, &d_parser_posn->data()[d]);
-            (*cit)->DefineVar("X_" + postfix, &d_parser_posn->data()[d]);
-            (*cit)->DefineVar("x_" + postfix, &d_parser_posn->data()[d]);
+            (*cit)->DefineVar("X" + postfix, &d_parser_posn[d * BULK_EVAL_SIZE]);
+            (*cit)->DefineVar("x" + postfix, &d_parser_posn[d * BULK_EVAL_SIZE]);
+            (*cit)->DefineVar("X_" + postfix, &d_parser_posn[d * BULK_EVAL_SIZE]);
+            (*cit)->DefineVar("x_" + postfix, &d_parser_posn[d * BULK_EVAL_SIZE]);
+        }
+
+        // Determine whether the function depends on time.
+        try
+        {
+            const mu::varmap_type& used_vars = (*cit)->GetUsedVar();
+            if (used_vars.count("t") || used_vars.count("T")) d_is_time_dependent = true;
+        }
+        catch (mu::ParserError& e)
+        {
+            TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                       << "  error: "
+                       << e.GetMsg()
+                       << "\n"
+                       << "  in:    "
+                       << e.GetExpr()
+                       << "\n");
+        }
+        catch (...)
+        {
+            TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                       << "  unrecognized exception generated by muParser library.\n");
         }
     }
     return;
@@ -338,11 +370,23 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
 
 muParserRobinBcCoefs::~muParserRobinBcCoefs()
 {
-    delete d_parser_time;
-    delete d_parser_posn;
+    delete[] d_parser_time;
+    delete[] d_parser_posn;
     return;
 } // ~muParserRobinBcCoefs
 
+bool
+muParserRobinBcCoefs::hasCacheableBcCoefs() const
+{
+    return true;
+} // hasCacheableBcCoefs
+
+bool
+muParserRobinBcCoefs::isTimeDependent() const
+{
+    return d_is_time_dependent;
+} // isTimeDependent
+
 void
 muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
                                  Pointer<ArrayData<NDIM, double> >& bcoef_data,
@@ -371,10 +415,21 @@ muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
     TBOX_ASSERT(!gcoef_data || bc_coef_box == gcoef_data->getBox());
 #endif
 
+    // Evaluate the functions at blocks of up to BULK_EVAL_SIZE points at once.
+    //
+    // NOTE: Box<NDIM>::Iterator traverses the box in the same order in which
+    // ArrayData stores its values, so that the results of the bulk evaluation
+    // can be written directly into the coefficient arrays.
     const mu::Parser& acoef_parser = d_acoef_parsers[location_index];
     const mu::Parser& bcoef_parser = d_bcoef_parsers[location_index];
     const mu::Parser& gcoef_parser = d_gcoef_parsers[location_index];
-    *d_parser_time = fill_time;
+    double* const acoef_vals = acoef_data ? acoef_data->getPointer(0) : NULL;
+    double* const bcoef_vals = bcoef_data ? bcoef_data->getPointer(0) : NULL;
+    double* const gcoef_vals = gcoef_data && !d_homogeneous_bc ? gcoef_data->getPointer(0) : NULL;
+    if (gcoef_data && d_homogeneous_bc) gcoef_data->fillAll(0.0);
+    std::fill(d_parser_time, d_parser_time + BULK_EVAL_SIZE, fill_time);
+    const int num_points = bc_coef_box.size();
+    int offset = 0, k = 0;
     for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
     {
         const Index<NDIM>& i = b();
@@ -382,33 +437,22 @@ muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
         {
             if (d != bdry_normal_axis)
             {
-                (*d_parser_posn)[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                d_parser_posn[d * BULK_EVAL_SIZE + k] =
+                    x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
             }
             else
             {
-                (*d_parser_posn)[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                d_parser_posn[d * BULK_EVAL_SIZE + k] =
+                    x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
             }
         }
-        try
-        {
-            if (acoef_data) (*acoef_data)(i, 0) = acoef_parser.Eval();
-            if (bcoef_data) (*bcoef_data)(i, 0) = bcoef_parser.Eval();
-            if (gcoef_data) (*gcoef_data)(i, 0) = gcoef_parser.Eval();
-        }
-        catch (mu::ParserError& e)
+        if (++k == BULK_EVAL_SIZE || offset + k == num_points)
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  error: "
-                       << e.GetMsg()
-                       << "\n"
-                       << "  in:    "
-                       << e.GetExpr()
-                       << "\n");
-        }
-        catch (...)
-        {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  unrecognized exception generated by muParser library.\n");
+            if (acoef_vals) evaluateBulk(acoef_parser, acoef_vals + offset, k);
+            if (bcoef_vals) evaluateBulk(bcoef_parser, bcoef_vals + offset, k);
+            if (gcoef_vals) evaluateBulk(gcoef_parser, gcoef_vals + offset, k);
+            offset += k;
+            k = 0;
         }
     }
     return;
@@ -424,6 +468,34 @@ muParserRobinBcCoefs::numberOfExtensionsFillable() const
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+muParserRobinBcCoefs::evaluateBulk(const mu::Parser& parser, double* const vals, const int num_points) const
+{
+    try
+    {
+        // NOTE: mu::Parser::Eval() is not a const member function in bulk mode
+        // because it updates the bytecode of the parser, but this does not
+        // change the function that is evaluated.
+        const_cast<mu::Parser&>(parser).Eval(vals, num_points);
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::setBcCoefs():\n"
+                   << "  error: "
+                   << e.GetMsg()
+                   << "\n"
+                   << "  in:    "
+                   << e.GetExpr()
+                   << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::setBcCoefs():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+    return;
+} // evaluateBulk
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
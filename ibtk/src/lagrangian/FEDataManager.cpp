@@ -85,6 +85,7 @@
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LEInteractor.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/WorkloadCalibrator.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -321,6 +322,27 @@ FEDataManager::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balancer,
     return;
 } // registerLoadBalancer
 
+void
+FEDataManager::enableWorkloadCalibration(const int num_samples)
+{
+    d_workload_calibrator = new WorkloadCalibrator(d_object_name + "::WorkloadCalibrator", num_samples);
+    return;
+} // enableWorkloadCalibration
+
+Pointer<WorkloadCalibrator>
+FEDataManager::getWorkloadCalibrator() const
+{
+    return d_workload_calibrator;
+} // getWorkloadCalibrator
+
+void
+FEDataManager::recordWorkloadSample()
+{
+    if (!d_workload_calibrator) return;
+    d_workload_calibrator->completeStep(computeNumberOfLocalCells(), d_num_local_qps);
+    return;
+} // recordWorkloadSample
+
 void
 FEDataManager::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
 {
@@ -435,6 +457,23 @@ FEDataManager::reinitElementMappings()
     // Reset the mappings between grid patches and active mesh elements.
     collectActivePatchElements(d_active_patch_elem_map, d_level_number, d_ghost_width);
 
+    // Report the performance of the calibrated workload model and discard the
+    // samples that were collected with the old data distribution.
+    if (d_workload_calibrator)
+    {
+        updateQuadPointCountData(d_level_number, d_level_number);
+        if (d_load_balancer)
+        {
+            const double predicted_imbalance =
+                d_workload_calibrator->computePredictedImbalance(computeNumberOfLocalCells(), d_num_local_qps);
+            if (d_workload_calibrator->getNumberOfSamples() > 0)
+            {
+                d_workload_calibrator->printReport(predicted_imbalance, plog);
+            }
+        }
+        d_workload_calibrator->clearSamples();
+    }
+
     IBTK_TIMER_STOP(t_reinit_element_mappings);
     return;
 } // reinitElementMappings
@@ -510,6 +549,7 @@ FEDataManager::spread(const int f_data_idx,
                       const double fill_data_time)
 {
     IBTK_TIMER_START(t_spread);
+    if (d_workload_calibrator) d_workload_calibrator->startTimer(WorkloadCalibrator::INTERACTION_WORK);
 
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -729,6 +769,7 @@ FEDataManager::spread(const int f_data_idx,
     VecRestoreArray(X_local_vec, &X_local_soln);
     VecGhostRestoreLocalForm(X_global_vec, &X_local_vec);
 
+    if (d_workload_calibrator) d_workload_calibrator->stopTimer(WorkloadCalibrator::INTERACTION_WORK);
     IBTK_TIMER_STOP(t_spread);
     return;
 } // spread
@@ -975,6 +1016,7 @@ FEDataManager::interpWeighted(const int f_data_idx,
                               const double fill_data_time)
 {
     IBTK_TIMER_START(t_interp_weighted);
+    if (d_workload_calibrator) d_workload_calibrator->startTimer(WorkloadCalibrator::INTERACTION_WORK);
 
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
 
@@ -1190,6 +1232,7 @@ FEDataManager::interpWeighted(const int f_data_idx,
     VecRestoreArray(X_local_vec, &X_local_soln);
     VecGhostRestoreLocalForm(X_global_vec, &X_local_vec);
 
+    if (d_workload_calibrator) d_workload_calibrator->stopTimer(WorkloadCalibrator::INTERACTION_WORK);
     IBTK_TIMER_STOP(t_interp_weighted);
     return;
 } // interpWeighted
@@ -1216,6 +1259,7 @@ FEDataManager::interp(const int f_data_idx,
                       const double fill_data_time)
 {
     IBTK_TIMER_START(t_interp);
+    if (d_workload_calibrator) d_workload_calibrator->startTimer(WorkloadCalibrator::INTERACTION_WORK);
 
     // Interpolate quantity at quadrature points and filter it to nodal points.
     UniquePtr<NumericVector<double> > F_rhs_vec = F_vec.zero_clone();
@@ -1224,6 +1268,7 @@ FEDataManager::interp(const int f_data_idx,
     // Solve for the nodal values.
     computeL2Projection(F_vec, *F_rhs_vec, system_name, interp_spec.use_consistent_mass_matrix);
 
+    if (d_workload_calibrator) d_workload_calibrator->stopTimer(WorkloadCalibrator::INTERACTION_WORK);
     IBTK_TIMER_STOP(t_interp);
     return;
 } // interp
@@ -1838,9 +1883,16 @@ FEDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int fines
     const int ln = d_level_number;
     if (coarsest_ln <= ln && ln <= finest_ln)
     {
+        // Update the cost coefficient using the timings recorded since the
+        // element mappings were last reinitialized.
+        if (d_workload_calibrator && d_workload_calibrator->computeCoefficients())
+        {
+            d_beta_work = d_workload_calibrator->getRelativeLagrangianWorkload();
+        }
+
         updateQuadPointCountData(ln, ln);
         HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, ln, ln);
-        hier_cc_data_ops.add(d_workload_idx, d_qp_count_idx, d_workload_idx);
+        hier_cc_data_ops.axpy(d_workload_idx, d_beta_work, d_qp_count_idx, d_workload_idx);
     }
 
     IBTK_TIMER_STOP(t_update_workload_estimates);
@@ -2066,6 +2118,10 @@ FEDataManager::FEDataManager(const std::string& object_name,
       d_hierarchy(NULL),
       d_coarsest_ln(-1),
       d_finest_ln(-1),
+      d_workload_idx(-1),
+      d_beta_work(1.0),
+      d_workload_calibrator(NULL),
+      d_num_local_qps(0.0),
       d_default_interp_spec(default_interp_spec),
       d_default_spread_spec(default_spread_spec),
       d_ghost_width(ghost_width),
@@ -2169,6 +2225,7 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
         HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, ln, ln);
         hier_cc_data_ops.setToScalar(d_qp_count_idx, 0.0);
         if (ln != d_level_number) continue;
+        d_num_local_qps = 0.0;
 
         // Extract the mesh.
         const MeshBase& mesh = d_es->get_mesh();
@@ -2237,7 +2294,11 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
                 {
                     interpolate(&X_qp[0], qp, X_node, phi);
                     const Index<NDIM> i = IndexUtilities::getCellIndex(X_qp, grid_geom, ratio);
-                    if (patch_box.contains(i)) (*qp_count_data)(i) += 1.0;
+                    if (patch_box.contains(i))
+                    {
+                        (*qp_count_data)(i) += 1.0;
+                        d_num_local_qps += 1.0;
+                    }
                 }
             }
         }
@@ -2248,6 +2309,22 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
     return;
 } // updateQuadPointCountData
 
+double
+FEDataManager::computeNumberOfLocalCells() const
+{
+    double num_local_cells = 0.0;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            num_local_cells += static_cast<double>(patch->getBox().size());
+        }
+    }
+    return num_local_cells;
+} // computeNumberOfLocalCells
+
 std::vector<std::pair<Point, Point> >*
 FEDataManager::computeActiveElementBoundingBoxes()
 {
@@ -40,10 +40,12 @@
 #include <numeric>
 #include <ostream>
 #include <set>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "ArrayData.h"
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
 #include "Box.h"
@@ -54,6 +56,7 @@
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
+#include "CellDataFactory.h"
 #include "CellIndex.h"
 #include "CellIterator.h"
 #include "CellVariable.h"
@@ -66,13 +69,17 @@
 #include "HierarchyCellDataOpsReal.h"
 #include "HierarchyDataOpsManager.h"
 #include "HierarchyDataOpsReal.h"
+#include "Index.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
 #include "MultiblockDataTranslator.h"
 #include "NodeData.h"
+#include "NodeDataFactory.h"
 #include "NodeVariable.h"
 #include "Patch.h"
 #include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "ProcessorMapping.h"
@@ -80,6 +87,7 @@
 #include "RefineOperator.h"
 #include "RefineSchedule.h"
 #include "SideData.h"
+#include "SideDataFactory.h"
 #include "SideVariable.h"
 #include "Variable.h"
 #include "VariableContext.h"
@@ -108,7 +116,10 @@
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/LTransaction.h"
 #include "ibtk/ParallelSet.h"
+#include "ibtk/ReducedDataWriter.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/TelemetryManager.h"
+#include "ibtk/WorkloadCalibrator.h"
 #include "ibtk/compiler_hints.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -119,6 +130,7 @@
 #include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
+#include "tbox/PIO.h"
 #include "tbox/Pointer.h"
 #include "tbox/RestartManager.h"
 #include "tbox/SAMRAI_MPI.h"
@@ -129,15 +141,6 @@
 #include "tbox/Transaction.h"
 #include "tbox/Utilities.h"
 
-namespace SAMRAI
-{
-namespace hier
-{
-template <int DIM>
-class Index;
-} // namespace hier
-} // namespace SAMRAI
-
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
@@ -151,6 +154,7 @@ static Timer* t_spread;
 static Timer* t_interp;
 static Timer* t_map_lagrangian_to_petsc;
 static Timer* t_map_petsc_to_lagrangian;
+static Timer* t_scatter_to_sequential;
 static Timer* t_begin_data_redistribution;
 static Timer* t_end_data_redistribution;
 static Timer* t_update_workload_estimates;
@@ -164,6 +168,11 @@ static Timer* t_end_nonlocal_data_fill;
 static Timer* t_compute_node_distribution;
 static Timer* t_compute_node_offsets;
 
+// Telemetry counters.
+static int c_num_spread_nodes;
+static int c_num_interp_nodes;
+static int c_num_displaced_nodes;
+
 // Assume max(U)dt/dx <= 2.
 static const int CFL_WIDTH = 2;
 
@@ -172,6 +181,47 @@ static const double TOL = sqrt(std::numeric_limits<double>::epsilon());
 
 // Version of LDataManager restart file data.
 static const int LDATA_MANAGER_VERSION = 1;
+
+// Types of scatters from distributed vectors to sequential vectors.
+enum SequentialScatterType
+{
+    SEQ_SCATTER_TO_ALL,
+    SEQ_SCATTER_TO_ZERO,
+    SEQ_SCATTER_STRUCTURES_TO_ZERO
+};
+
+// Add the components of src beginning at src_depth_offset to the components
+// of dst on the intersection of the two data boxes.
+inline void
+accumulate_depths(ArrayData<NDIM, double>& dst, const ArrayData<NDIM, double>& src, const int src_depth_offset)
+{
+    if (dst.getBox() == src.getBox())
+    {
+        // The components are stored contiguously with the same layout, so
+        // they may be accumulated without computing the array offsets.
+        const int n = dst.getBox().size();
+        for (int d = 0; d < dst.getDepth(); ++d)
+        {
+            double* const dst_d = dst.getPointer(d);
+            const double* const src_d = src.getPointer(src_depth_offset + d);
+            for (int i = 0; i < n; ++i)
+            {
+                dst_d[i] += src_d[i];
+            }
+        }
+        return;
+    }
+    const Box<NDIM> box = dst.getBox() * src.getBox();
+    for (int d = 0; d < dst.getDepth(); ++d)
+    {
+        for (Box<NDIM>::Iterator b(box); b; b++)
+        {
+            const Index<NDIM>& i = b();
+            dst(i, d) += src(i, src_depth_offset + d);
+        }
+    }
+    return;
+} // accumulate_depths
 }
 
 const std::string LDataManager::POSN_DATA_NAME = "X";
@@ -285,7 +335,7 @@ LDataManager::setPatchLevels(const int coarsest_ln, const int finest_ln)
     d_strct_id_to_strct_name_map.resize(d_finest_ln + 1);
     d_strct_id_to_lag_idx_range_map.resize(d_finest_ln + 1);
     d_last_lag_idx_to_strct_id_map.resize(d_finest_ln + 1);
-    d_inactive_strcts.resize(d_finest_ln + 1);
+    d_inactive_strcts.resize(d_finest_ln + 1, ParallelSet(REPLICATED_DATA));
     d_displaced_strct_ids.resize(d_finest_ln + 1);
     d_displaced_strct_bounding_boxes.resize(d_finest_ln + 1);
     d_displaced_strct_lnode_idxs.resize(d_finest_ln + 1);
@@ -424,6 +474,7 @@ LDataManager::spread(const int f_data_idx,
                      const int finest_ln_in)
 {
     IBTK_TIMER_START(t_spread);
+    if (d_workload_calibrator) d_workload_calibrator->startTimer(WorkloadCalibrator::INTERACTION_WORK);
 
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
@@ -467,6 +518,7 @@ LDataManager::spread(const int f_data_idx,
         ds_data[ln]->restoreArrays();
     }
 
+    if (d_workload_calibrator) d_workload_calibrator->stopTimer(WorkloadCalibrator::INTERACTION_WORK);
     IBTK_TIMER_STOP(t_spread);
 
     // Spread data from the Lagrangian mesh to the Eulerian grid.
@@ -583,9 +635,20 @@ LDataManager::spread(const int f_data_idx,
                      const int finest_ln_in)
 {
     IBTK_TIMER_START(t_spread);
+    if (d_workload_calibrator) d_workload_calibrator->startTimer(WorkloadCalibrator::INTERACTION_WORK);
 
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
+    if (TelemetryManager::isEnabled())
+    {
+        double num_local_nodes = 0.0;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (levelContainsLagrangianData(ln)) num_local_nodes += getNumberOfLocalNodes(ln);
+        }
+        TelemetryManager::getManager()->incrementCounter(c_num_spread_nodes, num_local_nodes);
+    }
+
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
 
     // Determine the type of data centering.
@@ -688,6 +751,354 @@ LDataManager::spread(const int f_data_idx,
     }
     var_db->removePatchDataIndex(f_copy_data_idx);
 
+    if (d_workload_calibrator) d_workload_calibrator->stopTimer(WorkloadCalibrator::INTERACTION_WORK);
+    IBTK_TIMER_STOP(t_spread);
+    return;
+} // spread
+
+void
+LDataManager::spread(const std::vector<int>& f_data_idxs,
+                     const std::vector<std::vector<Pointer<LData> > >& F_data,
+                     std::vector<Pointer<LData> >& X_data,
+                     const std::vector<RobinPhysBdryPatchStrategy*>& f_phys_bdry_ops,
+                     const std::vector<std::vector<Pointer<RefineSchedule<NDIM> > > >& f_prolongation_scheds,
+                     const double fill_data_time,
+                     const std::vector<bool>& F_data_ghost_node_update,
+                     const bool X_data_ghost_node_update,
+                     const int coarsest_ln,
+                     const int finest_ln)
+{
+    spread(f_data_idxs,
+           F_data,
+           X_data,
+           d_default_spread_kernel_fcn,
+           f_phys_bdry_ops,
+           f_prolongation_scheds,
+           fill_data_time,
+           F_data_ghost_node_update,
+           X_data_ghost_node_update,
+           coarsest_ln,
+           finest_ln);
+    return;
+} // spread
+
+void
+LDataManager::spread(const std::vector<int>& f_data_idxs,
+                     const std::vector<std::vector<Pointer<LData> > >& F_data,
+                     std::vector<Pointer<LData> >& X_data,
+                     const std::string& spread_kernel_fcn,
+                     const std::vector<RobinPhysBdryPatchStrategy*>& f_phys_bdry_ops,
+                     const std::vector<std::vector<Pointer<RefineSchedule<NDIM> > > >& f_prolongation_scheds,
+                     const double fill_data_time,
+                     const std::vector<bool>& F_data_ghost_node_update,
+                     const bool X_data_ghost_node_update,
+                     const int coarsest_ln_in,
+                     const int finest_ln_in)
+{
+    const unsigned int num_fields = static_cast<unsigned int>(f_data_idxs.size());
+#if !defined(NDEBUG)
+    TBOX_ASSERT(F_data.size() == num_fields);
+    TBOX_ASSERT(F_data_ghost_node_update.size() == num_fields);
+    TBOX_ASSERT(f_phys_bdry_ops.empty() || f_phys_bdry_ops.size() == num_fields);
+    TBOX_ASSERT(f_prolongation_scheds.empty() || f_prolongation_scheds.size() == num_fields);
+#endif
+    if (num_fields == 0) return;
+
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+
+    // Determine the type of data centering.  All of the Eulerian quantities
+    // must share a common centering.
+    std::vector<Pointer<Variable<NDIM> > > f_vars(num_fields);
+    for (unsigned int k = 0; k < num_fields; ++k)
+    {
+        var_db->mapIndexToVariable(f_data_idxs[k], f_vars[k]);
+    }
+    Pointer<CellVariable<NDIM, double> > f_cc_var = f_vars[0];
+    Pointer<EdgeVariable<NDIM, double> > f_ec_var = f_vars[0];
+    Pointer<NodeVariable<NDIM, double> > f_nc_var = f_vars[0];
+    Pointer<SideVariable<NDIM, double> > f_sc_var = f_vars[0];
+    const bool cc_data = f_cc_var;
+    const bool ec_data = f_ec_var;
+    const bool nc_data = f_nc_var;
+    const bool sc_data = f_sc_var;
+    TBOX_ASSERT(cc_data || ec_data || nc_data || sc_data);
+    for (unsigned int k = 1; k < num_fields; ++k)
+    {
+        Pointer<CellVariable<NDIM, double> > cc_var = f_vars[k];
+        Pointer<EdgeVariable<NDIM, double> > ec_var = f_vars[k];
+        Pointer<NodeVariable<NDIM, double> > nc_var = f_vars[k];
+        Pointer<SideVariable<NDIM, double> > sc_var = f_vars[k];
+        if (cc_data != static_cast<bool>(cc_var) || ec_data != static_cast<bool>(ec_var) ||
+            nc_data != static_cast<bool>(nc_var) || sc_data != static_cast<bool>(sc_var))
+        {
+            TBOX_ERROR("LDataManager::spread():\n"
+                       << "  all Eulerian quantities must have the same data centering.\n");
+        }
+    }
+
+    // Edge-centered data and single quantities are handled by spreading each
+    // quantity separately.
+    if (ec_data || num_fields == 1)
+    {
+        for (unsigned int k = 0; k < num_fields; ++k)
+        {
+            std::vector<Pointer<LData> > F_data_k = F_data[k];
+            spread(f_data_idxs[k],
+                   F_data_k,
+                   X_data,
+                   spread_kernel_fcn,
+                   f_phys_bdry_ops.empty() ? NULL : f_phys_bdry_ops[k],
+                   f_prolongation_scheds.empty() ? std::vector<Pointer<RefineSchedule<NDIM> > >() :
+                                                   f_prolongation_scheds[k],
+                   fill_data_time,
+                   F_data_ghost_node_update[k],
+                   X_data_ghost_node_update && k == 0,
+                   coarsest_ln_in,
+                   finest_ln_in);
+        }
+        return;
+    }
+
+    IBTK_TIMER_START(t_spread);
+    if (d_workload_calibrator) d_workload_calibrator->startTimer(WorkloadCalibrator::INTERACTION_WORK);
+
+    const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
+    const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
+    // Each quantity is counted separately, as when the quantities are spread
+    // one at a time.
+    if (TelemetryManager::isEnabled())
+    {
+        double num_local_nodes = 0.0;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (levelContainsLagrangianData(ln)) num_local_nodes += getNumberOfLocalNodes(ln);
+        }
+        TelemetryManager::getManager()->incrementCounter(c_num_spread_nodes, num_fields * num_local_nodes);
+    }
+
+    // Make copies of the Eulerian data and determine the layout of the
+    // combined Eulerian data.
+    std::vector<int> f_copy_data_idxs(num_fields);
+    std::vector<Pointer<HierarchyDataOpsReal<NDIM, double> > > f_data_ops(num_fields);
+    std::vector<int> f_depth_offsets(num_fields + 1, 0);
+    IntVector<NDIM> f_gcw = 0;
+    for (unsigned int k = 0; k < num_fields; ++k)
+    {
+        f_copy_data_idxs[k] = var_db->registerClonedPatchDataIndex(f_vars[k], f_data_idxs[k]);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(f_copy_data_idxs[k]);
+        }
+        f_data_ops[k] = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_vars[k], d_hierarchy, true);
+        f_data_ops[k]->swapData(f_copy_data_idxs[k], f_data_idxs[k]);
+        f_data_ops[k]->setToScalar(f_data_idxs[k], 0.0, /*interior_only*/ false);
+
+        Pointer<PatchDataFactory<NDIM> > f_factory = var_db->getPatchDescriptor()->getPatchDataFactory(f_data_idxs[k]);
+        Pointer<CellDataFactory<NDIM, double> > f_cc_factory = f_factory;
+        Pointer<NodeDataFactory<NDIM, double> > f_nc_factory = f_factory;
+        Pointer<SideDataFactory<NDIM, double> > f_sc_factory = f_factory;
+        int depth = 0;
+        if (f_cc_factory) depth = f_cc_factory->getDefaultDepth();
+        if (f_nc_factory) depth = f_nc_factory->getDefaultDepth();
+        if (f_sc_factory) depth = f_sc_factory->getDefaultDepth();
+        f_depth_offsets[k + 1] = f_depth_offsets[k] + depth;
+        f_gcw = IntVector<NDIM>::max(f_gcw, f_factory->getGhostCellWidth());
+    }
+    const int f_depth = f_depth_offsets[num_fields];
+    const int F_depth = sc_data ? NDIM * f_depth : f_depth;
+
+    // Look up (or register) the scratch data used to store the combined
+    // Eulerian data.  The scratch data are allocated the first time that they
+    // are needed on each level and are retained between calls, so that the
+    // combined data are not reallocated for each patch each time that
+    // quantities are spread.
+    std::ostringstream f_combined_name;
+    f_combined_name << d_object_name << "::multi_spread::" << (cc_data ? "CELL" : (nc_data ? "NODE" : "SIDE"))
+                    << "::" << f_depth << "::" << f_gcw;
+    Pointer<Variable<NDIM> > f_combined_var;
+    if (var_db->checkVariableExists(f_combined_name.str()))
+    {
+        f_combined_var = var_db->getVariable(f_combined_name.str());
+    }
+    else if (cc_data)
+    {
+        f_combined_var = new CellVariable<NDIM, double>(f_combined_name.str(), f_depth);
+    }
+    else if (nc_data)
+    {
+        f_combined_var = new NodeVariable<NDIM, double>(f_combined_name.str(), f_depth);
+    }
+    else
+    {
+        f_combined_var = new SideVariable<NDIM, double>(f_combined_name.str(), f_depth);
+    }
+    int f_combined_idx = var_db->mapVariableAndContextToIndex(f_combined_var, d_scratch_context);
+    if (f_combined_idx < 0)
+    {
+        f_combined_idx = var_db->registerVariableAndContext(f_combined_var, d_scratch_context, f_gcw);
+    }
+
+    // Start filling Lagrangian ghost node values.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!levelContainsLagrangianData(ln)) continue;
+
+        for (unsigned int k = 0; k < num_fields; ++k)
+        {
+            if (F_data_ghost_node_update[k]) F_data[k][ln]->beginGhostUpdate();
+        }
+        if (X_data_ghost_node_update) X_data[ln]->beginGhostUpdate();
+    }
+
+    // Spread data from the Lagrangian mesh to the Eulerian grid.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    std::vector<double> F_combined_data;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        // If there are coarser levels in the patch hierarchy, prolong data from
+        // the coarser levels before spreading data on this level.
+        for (unsigned int k = 0; k < f_prolongation_scheds.size(); ++k)
+        {
+            if (ln > coarsest_ln && ln < static_cast<int>(f_prolongation_scheds[k].size()) &&
+                f_prolongation_scheds[k][ln])
+            {
+                f_prolongation_scheds[k][ln]->fillData(fill_data_time);
+            }
+        }
+
+        if (!levelContainsLagrangianData(ln)) continue;
+
+        // Interleave the Lagrangian data so that all quantities associated
+        // with a given node are stored contiguously.
+        for (unsigned int k = 0; k < num_fields; ++k)
+        {
+            if (F_data_ghost_node_update[k]) F_data[k][ln]->endGhostUpdate();
+        }
+        if (X_data_ghost_node_update) X_data[ln]->endGhostUpdate();
+        const unsigned int num_ghosted_nodes = F_data[0][ln]->getLocalNodeCount() + F_data[0][ln]->getGhostNodeCount();
+        F_combined_data.resize(std::max(F_depth * num_ghosted_nodes, 1U));
+        int F_offset = 0;
+        for (unsigned int k = 0; k < num_fields; ++k)
+        {
+            const boost::multi_array_ref<double, 2>& F_k = *F_data[k][ln]->getGhostedLocalFormVecArray();
+            const int F_k_depth = F_data[k][ln]->getDepth();
+            const int f_k_depth = f_depth_offsets[k + 1] - f_depth_offsets[k];
+            if (F_k_depth != (sc_data ? NDIM * f_k_depth : f_k_depth))
+            {
+                TBOX_ERROR("LDataManager::spread():\n"
+                           << "  inconsistent Lagrangian and Eulerian data depths.\n");
+            }
+            for (unsigned int i = 0; i < num_ghosted_nodes; ++i)
+            {
+                for (int d = 0; d < F_k_depth; ++d)
+                {
+                    F_combined_data[F_depth * i + F_offset + d] = F_k[i][d];
+                }
+            }
+            F_data[k][ln]->restoreArrays();
+            F_offset += F_k_depth;
+        }
+        const double* const X_ghosted_data = X_data[ln]->getGhostedLocalFormVecArray()->data();
+
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(f_combined_idx)) level->allocatePatchData(f_combined_idx);
+        const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            const Box<NDIM>& box = idx_data->getGhostBox();
+            if (cc_data)
+            {
+                Pointer<CellData<NDIM, double> > f_combined_data = patch->getPatchData(f_combined_idx);
+                f_combined_data->fillAll(0.0);
+                LEInteractor::spread(f_combined_data,
+                                     &F_combined_data[0],
+                                     F_depth,
+                                     X_ghosted_data,
+                                     NDIM,
+                                     idx_data,
+                                     patch,
+                                     box,
+                                     periodic_shift,
+                                     spread_kernel_fcn);
+                for (unsigned int k = 0; k < num_fields; ++k)
+                {
+                    Pointer<CellData<NDIM, double> > f_cc_data = patch->getPatchData(f_data_idxs[k]);
+                    accumulate_depths(f_cc_data->getArrayData(), f_combined_data->getArrayData(), f_depth_offsets[k]);
+                }
+            }
+            if (nc_data)
+            {
+                Pointer<NodeData<NDIM, double> > f_combined_data = patch->getPatchData(f_combined_idx);
+                f_combined_data->fillAll(0.0);
+                LEInteractor::spread(f_combined_data,
+                                     &F_combined_data[0],
+                                     F_depth,
+                                     X_ghosted_data,
+                                     NDIM,
+                                     idx_data,
+                                     patch,
+                                     box,
+                                     periodic_shift,
+                                     spread_kernel_fcn);
+                for (unsigned int k = 0; k < num_fields; ++k)
+                {
+                    Pointer<NodeData<NDIM, double> > f_nc_data = patch->getPatchData(f_data_idxs[k]);
+                    accumulate_depths(f_nc_data->getArrayData(), f_combined_data->getArrayData(), f_depth_offsets[k]);
+                }
+            }
+            if (sc_data)
+            {
+                Pointer<SideData<NDIM, double> > f_combined_data = patch->getPatchData(f_combined_idx);
+                f_combined_data->fillAll(0.0);
+                LEInteractor::spread(f_combined_data,
+                                     &F_combined_data[0],
+                                     F_depth,
+                                     X_ghosted_data,
+                                     NDIM,
+                                     idx_data,
+                                     patch,
+                                     box,
+                                     periodic_shift,
+                                     spread_kernel_fcn);
+                for (unsigned int k = 0; k < num_fields; ++k)
+                {
+                    Pointer<SideData<NDIM, double> > f_sc_data = patch->getPatchData(f_data_idxs[k]);
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        accumulate_depths(
+                            f_sc_data->getArrayData(axis), f_combined_data->getArrayData(axis), f_depth_offsets[k]);
+                    }
+                }
+            }
+            for (unsigned int k = 0; k < f_phys_bdry_ops.size(); ++k)
+            {
+                if (!f_phys_bdry_ops[k]) continue;
+                Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idxs[k]);
+                f_phys_bdry_ops[k]->setPatchDataIndex(f_data_idxs[k]);
+                f_phys_bdry_ops[k]->accumulateFromPhysicalBoundaryData(
+                    *patch, fill_data_time, f_data->getGhostCellWidth());
+            }
+        }
+        X_data[ln]->restoreArrays();
+    }
+
+    // Accumulate data.
+    for (unsigned int k = 0; k < num_fields; ++k)
+    {
+        f_data_ops[k]->swapData(f_copy_data_idxs[k], f_data_idxs[k]);
+        f_data_ops[k]->add(f_data_idxs[k], f_data_idxs[k], f_copy_data_idxs[k]);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            level->deallocatePatchData(f_copy_data_idxs[k]);
+        }
+        var_db->removePatchDataIndex(f_copy_data_idxs[k]);
+    }
+
+    if (d_workload_calibrator) d_workload_calibrator->stopTimer(WorkloadCalibrator::INTERACTION_WORK);
     IBTK_TIMER_STOP(t_spread);
     return;
 } // spread
@@ -732,9 +1143,20 @@ LDataManager::interp(const int f_data_idx,
                      const int finest_ln_in)
 {
     IBTK_TIMER_START(t_interp);
+    if (d_workload_calibrator) d_workload_calibrator->startTimer(WorkloadCalibrator::INTERACTION_WORK);
 
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
+    if (TelemetryManager::isEnabled())
+    {
+        double num_local_nodes = 0.0;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (levelContainsLagrangianData(ln)) num_local_nodes += getNumberOfLocalNodes(ln);
+        }
+        TelemetryManager::getManager()->incrementCounter(c_num_interp_nodes, num_local_nodes);
+    }
+
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
 
     // Determine the type of data centering.
@@ -834,6 +1256,7 @@ LDataManager::interp(const int f_data_idx,
         zeroInactivatedComponents(F_data[ln], ln);
     }
 
+    if (d_workload_calibrator) d_workload_calibrator->stopTimer(WorkloadCalibrator::INTERACTION_WORK);
     IBTK_TIMER_STOP(t_interp);
     return;
 } // interp
@@ -873,6 +1296,24 @@ LDataManager::registerVisItDataWriter(Pointer<VisItDataWriter<NDIM> > visit_writ
     return;
 } // registerVisItDataWriter
 
+void
+LDataManager::registerReducedDataWriter(Pointer<ReducedDataWriter> reduced_writer)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(reduced_writer);
+#endif
+    d_reduced_writer = reduced_writer;
+    if (d_output_workload)
+    {
+        d_reduced_writer->registerPlotQuantity("workload estimate", "SCALAR", d_workload_idx);
+    }
+    if (d_output_node_count)
+    {
+        d_reduced_writer->registerPlotQuantity("node count", "SCALAR", d_node_count_idx);
+    }
+    return;
+} // registerReducedDataWriter
+
 void
 LDataManager::registerLSiloDataWriter(Pointer<LSiloDataWriter> silo_writer)
 {
@@ -900,6 +1341,23 @@ LDataManager::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balancer, i
     return;
 } // return
 
+void
+LDataManager::enableWorkloadCalibration(const int num_samples)
+{
+    d_workload_calibrator = new WorkloadCalibrator(d_object_name + "::WorkloadCalibrator", num_samples);
+    return;
+} // enableWorkloadCalibration
+
+void
+LDataManager::recordWorkloadSample()
+{
+    if (!d_workload_calibrator) return;
+    double num_local_cells, num_local_nodes;
+    computeLocalWorkloadSize(num_local_cells, num_local_nodes);
+    d_workload_calibrator->completeStep(num_local_cells, num_local_nodes);
+    return;
+} // recordWorkloadSample
+
 Pointer<LData>
 LDataManager::createLData(const std::string& quantity_name,
                           const int level_number,
@@ -1339,37 +1797,47 @@ LDataManager::scatterPETScToLagrangian(Vec& petsc_vec, Vec& lagrangian_vec, cons
 void
 LDataManager::scatterToAll(Vec& parallel_vec, Vec& sequential_vec) const
 {
-    int ierr;
-    const bool create_vout = !sequential_vec;
-    VecScatter ctx;
-    ierr = VecScatterCreateToAll(parallel_vec, &ctx, (create_vout ? &sequential_vec : NULL));
-    IBTK_CHKERRQ(ierr);
-    ierr = VecScatterBegin(ctx, parallel_vec, sequential_vec, INSERT_VALUES, SCATTER_FORWARD);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecScatterEnd(ctx, parallel_vec, sequential_vec, INSERT_VALUES, SCATTER_FORWARD);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecScatterDestroy(&ctx);
-    IBTK_CHKERRQ(ierr);
+    scatterToSequential(parallel_vec, sequential_vec, SEQ_SCATTER_TO_ALL, std::vector<int>(), -1);
     return;
 } // scatterToAll
 
 void
 LDataManager::scatterToZero(Vec& parallel_vec, Vec& sequential_vec) const
 {
-    int ierr;
-    const bool create_vout = !sequential_vec;
-    VecScatter ctx;
-    ierr = VecScatterCreateToZero(parallel_vec, &ctx, (create_vout ? &sequential_vec : NULL));
-    IBTK_CHKERRQ(ierr);
-    ierr = VecScatterBegin(ctx, parallel_vec, sequential_vec, INSERT_VALUES, SCATTER_FORWARD);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecScatterEnd(ctx, parallel_vec, sequential_vec, INSERT_VALUES, SCATTER_FORWARD);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecScatterDestroy(&ctx);
-    IBTK_CHKERRQ(ierr);
+    scatterToSequential(parallel_vec, sequential_vec, SEQ_SCATTER_TO_ZERO, std::vector<int>(), -1);
     return;
 } // scatterToZero
 
+void
+LDataManager::scatterStructuresToZero(Vec& lagrangian_vec,
+                                      Vec& sequential_vec,
+                                      const std::vector<int>& structure_ids,
+                                      const int level_number) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    scatterToSequential(lagrangian_vec, sequential_vec, SEQ_SCATTER_STRUCTURES_TO_ZERO, structure_ids, level_number);
+    return;
+} // scatterStructuresToZero
+
+void
+LDataManager::clearScatterCache()
+{
+    int ierr;
+    for (std::map<std::vector<int>, std::pair<VecScatter, Vec> >::iterator it = d_scatter_cache.begin();
+         it != d_scatter_cache.end();
+         ++it)
+    {
+        ierr = VecScatterDestroy(&it->second.first);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&it->second.second);
+        IBTK_CHKERRQ(ierr);
+    }
+    d_scatter_cache.clear();
+    return;
+} // clearScatterCache
+
 void
 LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest_ln_in)
 {
@@ -1585,6 +2053,7 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_displaced_strct_lnode_posns[level_number].size() == num_nodes);
 #endif
+        IBTK_TELEMETRY_INCREMENT(c_num_displaced_nodes, static_cast<double>(num_nodes));
         typedef LNodeTransaction::LTransactionComponent LNodeTransactionComponent;
         std::vector<std::vector<LNodeTransactionComponent> > src_index_set(num_procs);
         for (size_t k = 0; k < num_nodes; ++k)
@@ -1987,6 +2456,28 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         d_silo_writer->registerLagrangianAO(d_ao, coarsest_ln, finest_ln);
     }
 
+    // Discard cached scatter contexts, which are invalidated by the new data
+    // distribution.
+    clearScatterCache();
+
+    // Report the performance of the calibrated workload model and discard the
+    // samples that were collected with the old data distribution.
+    if (d_workload_calibrator)
+    {
+        if (d_load_balancer)
+        {
+            double num_local_cells, num_local_nodes;
+            computeLocalWorkloadSize(num_local_cells, num_local_nodes);
+            const double predicted_imbalance =
+                d_workload_calibrator->computePredictedImbalance(num_local_cells, num_local_nodes);
+            if (d_workload_calibrator->getNumberOfSamples() > 0)
+            {
+                d_workload_calibrator->printReport(predicted_imbalance, plog);
+            }
+        }
+        d_workload_calibrator->clearSamples();
+    }
+
     IBTK_TIMER_STOP(t_end_data_redistribution);
     return;
 } // endDataRedistribution
@@ -2006,6 +2497,13 @@ LDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int finest
     TBOX_ASSERT(finest_ln >= d_coarsest_ln && finest_ln <= d_finest_ln);
 #endif
 
+    // Update the cost coefficient using the timings recorded since the last
+    // redistribution of the Lagrangian data.
+    if (d_workload_calibrator && d_workload_calibrator->computeCoefficients())
+    {
+        d_beta_work = d_workload_calibrator->getRelativeLagrangianWorkload();
+    }
+
     updateNodeCountData(coarsest_ln, finest_ln);
     HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, coarsest_ln, finest_ln);
     hier_cc_data_ops.axpy(d_workload_idx, d_beta_work, d_node_count_idx, d_workload_idx);
@@ -2153,7 +2651,7 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
         d_strct_id_to_strct_name_map.resize(level_number + 1);
         d_strct_id_to_lag_idx_range_map.resize(level_number + 1);
         d_last_lag_idx_to_strct_id_map.resize(level_number + 1);
-        d_inactive_strcts.resize(level_number + 1);
+        d_inactive_strcts.resize(level_number + 1, ParallelSet(REPLICATED_DATA));
         d_displaced_strct_ids.resize(d_finest_ln + 1);
         d_displaced_strct_bounding_boxes.resize(d_finest_ln + 1);
         d_displaced_strct_lnode_idxs.resize(d_finest_ln + 1);
@@ -2658,6 +3156,7 @@ LDataManager::LDataManager(const std::string& object_name,
       d_coarsest_ln(-1),
       d_finest_ln(-1),
       d_visit_writer(NULL),
+      d_reduced_writer(NULL),
       d_silo_writer(NULL),
       d_load_balancer(NULL),
       d_lag_init(NULL),
@@ -2669,6 +3168,7 @@ LDataManager::LDataManager(const std::string& object_name,
       d_workload_var(NULL),
       d_workload_idx(-1),
       d_output_workload(false),
+      d_workload_calibrator(NULL),
       d_node_count_var(NULL),
       d_node_count_idx(-1),
       d_output_node_count(false),
@@ -2688,6 +3188,7 @@ LDataManager::LDataManager(const std::string& object_name,
       d_lag_mesh_data(),
       d_needs_synch(true),
       d_ao(),
+      d_scatter_cache(),
       d_num_nodes(),
       d_node_offset(),
       d_local_lag_indices(),
@@ -2763,6 +3264,7 @@ LDataManager::LDataManager(const std::string& object_name,
         t_interp = TimerManager::getManager()->getTimer("IBTK::LDataManager::interp()");
         t_map_lagrangian_to_petsc = TimerManager::getManager()->getTimer("IBTK::LDataManager::mapLagrangianToPETSc()");
         t_map_petsc_to_lagrangian = TimerManager::getManager()->getTimer("IBTK::LDataManager::mapPETScToLagrangian()");
+        t_scatter_to_sequential = TimerManager::getManager()->getTimer("IBTK::LDataManager::scatterToSequential()");
         t_begin_data_redistribution =
             TimerManager::getManager()->getTimer("IBTK::LDataManager::beginDataRedistribution()");
         t_end_data_redistribution = TimerManager::getManager()->getTimer("IBTK::LDataManager::endDataRedistribution()");
@@ -2780,11 +3282,21 @@ LDataManager::LDataManager(const std::string& object_name,
         t_compute_node_distribution =
             TimerManager::getManager()->getTimer("IBTK::LDataManager::computeNodeDistribution()");
         t_compute_node_offsets = TimerManager::getManager()->getTimer("IBTK::LDataManager::computeNodeOffsets()"););
+
+    // Setup telemetry counters.
+    IBTK_DO_ONCE(
+        c_num_spread_nodes = TelemetryManager::getManager()->registerCounter("IBTK::LDataManager::spread()[nodes]");
+        c_num_interp_nodes = TelemetryManager::getManager()->registerCounter("IBTK::LDataManager::interp()[nodes]");
+        c_num_displaced_nodes = TelemetryManager::getManager()->registerCounter(
+            "IBTK::LDataManager::endDataRedistribution()[displaced_nodes]"););
     return;
 } // LDataManager
 
 LDataManager::~LDataManager()
 {
+    // Destroy any cached scatter contexts.
+    clearScatterCache();
+
     // Destroy any remaining AO objects.
     int ierr;
     for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
@@ -2872,6 +3384,120 @@ LDataManager::scatterData(Vec& lagrangian_vec, Vec& petsc_vec, const int level_n
     return;
 } // scatterData
 
+void
+LDataManager::scatterToSequential(Vec& parallel_vec,
+                                  Vec& sequential_vec,
+                                  const int scatter_type,
+                                  const std::vector<int>& structure_ids,
+                                  const int level_number) const
+{
+    IBTK_TIMER_START(t_scatter_to_sequential);
+
+    int ierr;
+
+    // Determine the layout of the parallel vector.
+    int global_size, block_size, ilower, iupper;
+    ierr = VecGetSize(parallel_vec, &global_size);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGetBlockSize(parallel_vec, &block_size);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGetOwnershipRange(parallel_vec, &ilower, &iupper);
+    IBTK_CHKERRQ(ierr);
+    std::vector<int> key;
+    key.push_back(scatter_type);
+    key.push_back(global_size);
+    key.push_back(block_size);
+    key.push_back(ilower);
+    key.push_back(iupper);
+    key.push_back(level_number);
+    key.insert(key.end(), structure_ids.begin(), structure_ids.end());
+
+    // Look up the cached scatter context.  Because creating a scatter context
+    // is a collective operation, the cached context is used only if it is
+    // available on all processors.
+    std::map<std::vector<int>, std::pair<VecScatter, Vec> >::iterator it = d_scatter_cache.find(key);
+    const bool use_cached_scatter = SAMRAI_MPI::minReduction(it != d_scatter_cache.end() ? 1 : 0) == 1;
+    if (!use_cached_scatter)
+    {
+        if (it != d_scatter_cache.end())
+        {
+            ierr = VecScatterDestroy(&it->second.first);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecDestroy(&it->second.second);
+            IBTK_CHKERRQ(ierr);
+            d_scatter_cache.erase(it);
+        }
+        VecScatter ctx = NULL;
+        Vec vout = NULL;
+        switch (scatter_type)
+        {
+        case SEQ_SCATTER_TO_ALL:
+            ierr = VecScatterCreateToAll(parallel_vec, &ctx, &vout);
+            IBTK_CHKERRQ(ierr);
+            break;
+        case SEQ_SCATTER_TO_ZERO:
+            ierr = VecScatterCreateToZero(parallel_vec, &ctx, &vout);
+            IBTK_CHKERRQ(ierr);
+            break;
+        case SEQ_SCATTER_STRUCTURES_TO_ZERO:
+        {
+            // Only processor zero receives data.
+            std::vector<int> block_idxs;
+            if (SAMRAI_MPI::getRank() == 0)
+            {
+                for (std::vector<int>::const_iterator cit = structure_ids.begin(); cit != structure_ids.end(); ++cit)
+                {
+                    const std::pair<int, int> lag_idx_range = getLagrangianStructureIndexRange(*cit, level_number);
+                    for (int lag_idx = lag_idx_range.first; lag_idx < lag_idx_range.second; ++lag_idx)
+                    {
+                        block_idxs.push_back(lag_idx);
+                    }
+                }
+            }
+            const int num_blocks = static_cast<int>(block_idxs.size());
+            IS is_from;
+            ierr = ISCreateBlock(PETSC_COMM_SELF,
+                                 block_size,
+                                 num_blocks,
+                                 num_blocks > 0 ? &block_idxs[0] : NULL,
+                                 PETSC_COPY_VALUES,
+                                 &is_from);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecCreateSeq(PETSC_COMM_SELF, block_size * num_blocks, &vout);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecSetBlockSize(vout, block_size);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecScatterCreate(parallel_vec, is_from, vout, NULL, &ctx);
+            IBTK_CHKERRQ(ierr);
+            ierr = ISDestroy(&is_from);
+            IBTK_CHKERRQ(ierr);
+            break;
+        }
+        default:
+            TBOX_ERROR("LDataManager::scatterToSequential():\n"
+                       << "  unrecognized scatter type: "
+                       << scatter_type
+                       << "\n");
+        }
+        it = d_scatter_cache.insert(std::make_pair(key, std::make_pair(ctx, vout))).first;
+    }
+    VecScatter& ctx = it->second.first;
+
+    // Scatter the data into the sequential vector.
+    if (!sequential_vec)
+    {
+        ierr = VecDuplicate(it->second.second, &sequential_vec);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = VecScatterBegin(ctx, parallel_vec, sequential_vec, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecScatterEnd(ctx, parallel_vec, sequential_vec, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+
+    IBTK_TIMER_STOP(t_scatter_to_sequential);
+    return;
+} // scatterToSequential
+
 void
 LDataManager::beginNonlocalDataFill(const int coarsest_ln_in, const int finest_ln_in)
 {
@@ -3141,6 +3767,25 @@ LDataManager::computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_off
     return;
 } // computeNodeOffsets
 
+void
+LDataManager::computeLocalWorkloadSize(double& num_local_cells, double& num_local_nodes) const
+{
+    num_local_cells = 0.0;
+    num_local_nodes = 0.0;
+    if (!d_hierarchy) return;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            num_local_cells += static_cast<double>(patch->getBox().size());
+        }
+        if (levelContainsLagrangianData(ln)) num_local_nodes += static_cast<double>(getNumberOfLocalNodes(ln));
+    }
+    return;
+} // computeLocalWorkloadSize
+
 void
 LDataManager::getFromRestart()
 {
@@ -3173,7 +3818,7 @@ LDataManager::getFromRestart()
     d_strct_id_to_strct_name_map.resize(d_finest_ln + 1);
     d_strct_id_to_lag_idx_range_map.resize(d_finest_ln + 1);
     d_last_lag_idx_to_strct_id_map.resize(d_finest_ln + 1);
-    d_inactive_strcts.resize(d_finest_ln + 1);
+    d_inactive_strcts.resize(d_finest_ln + 1, ParallelSet(REPLICATED_DATA));
     d_displaced_strct_ids.resize(d_finest_ln + 1);
     d_displaced_strct_bounding_boxes.resize(d_finest_ln + 1);
     d_displaced_strct_lnode_idxs.resize(d_finest_ln + 1);
@@ -2873,13 +2873,13 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
     TBOX_ASSERT(q_data);
     TBOX_ASSERT(idx_data);
     TBOX_ASSERT(patch);
-    TBOX_ASSERT(q_data->getDepth() == 1);
-    TBOX_ASSERT(Q_depth == NDIM);
+    TBOX_ASSERT(Q_depth == NDIM * q_data->getDepth());
     TBOX_ASSERT(X_depth == NDIM);
 #else
     NULL_USE(X_depth);
 #endif
-    if (Q_depth != NDIM || q_data->getDepth() != 1)
+    const int q_depth = q_data->getDepth();
+    if (Q_depth != NDIM * q_depth)
     {
         TBOX_ERROR("LEInteractor::spread():\n"
                    << "  side-centered spreading requires vector-valued data.\n");
@@ -2910,7 +2910,7 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
     {
         boost::array<double, NDIM> x_lower_axis, x_upper_axis;
         const int local_sz = (*std::max_element(local_indices.begin(), local_indices.end())) + 1;
-        std::vector<double> Q_data_axis(local_sz);
+        std::vector<double> Q_data_axis(q_depth * local_sz);
         for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
             for (unsigned int d = 0; d < NDIM; ++d)
@@ -2922,14 +2922,18 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
             x_upper_axis[axis] += 0.5 * dx[axis];
             for (unsigned int k = 0; k < local_indices.size(); ++k)
             {
-                Q_data_axis[local_indices[k]] = Q_data[NDIM * local_indices[k] + axis];
+                for (int depth = 0; depth < q_depth; ++depth)
+                {
+                    Q_data_axis[q_depth * local_indices[k] + depth] =
+                        Q_data[Q_depth * local_indices[k] + NDIM * depth + axis];
+                }
             }
             spread(q_data->getPointer(axis),
                    SideGeometry<NDIM>::toSideBox(q_data->getBox(), axis),
                    q_data->getGhostCellWidth(),
-                   /*q_depth*/ 1,
+                   q_depth,
                    &Q_data_axis[0],
-                   /*Q_depth*/ 1,
+                   q_depth,
                    X_data,
                    x_lower_axis.data(),
                    x_upper_axis.data(),
@@ -0,0 +1,811 @@
+// Filename: LTracerParticles.cpp
+// Created on 15 Nov 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Box.h"
+#include "BoxArray.h"
+#include "CartesianGridGeometry.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "ProcessorMapping.h"
+#include "SideData.h"
+#include "ibtk/IndexUtilities.h"
+#include "ibtk/LEInteractor.h"
+#include "ibtk/LMarkerUtilities.h"
+#include "ibtk/LTracerParticles.h"
+#include "ibtk/ParallelExchangeUtilities.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/RestartManager.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Version of LTracerParticles restart file data.
+static const int LTRACER_PARTICLES_VERSION = 1;
+
+// Timers.
+static Timer* t_advance_particles;
+static Timer* t_bin_particles;
+static Timer* t_migrate_particles;
+static Timer* t_redistribute_particles;
+
+// The number of bytes used to send a single particle to another process: the
+// particle ID, level number, and patch number, followed by the position and
+// velocity of the particle.
+static const size_t PARTICLE_RECORD_SIZE = 3 * sizeof(int) + 2 * NDIM * sizeof(double);
+
+inline void
+pack_particle(std::vector<char>& buf, const int id, const int ln, const int patch_num, const double* X, const double* U)
+{
+    const size_t offset = buf.size();
+    buf.resize(offset + PARTICLE_RECORD_SIZE);
+    char* ptr = &buf[offset];
+    const int header[3] = { id, ln, patch_num };
+    memcpy(ptr, header, 3 * sizeof(int));
+    ptr += 3 * sizeof(int);
+    memcpy(ptr, X, NDIM * sizeof(double));
+    ptr += NDIM * sizeof(double);
+    memcpy(ptr, U, NDIM * sizeof(double));
+    return;
+} // pack_particle
+
+inline void
+unpack_particle(const char* ptr, int& id, int& ln, int& patch_num, double* X, double* U)
+{
+    int header[3];
+    memcpy(header, ptr, 3 * sizeof(int));
+    id = header[0];
+    ln = header[1];
+    patch_num = header[2];
+    ptr += 3 * sizeof(int);
+    memcpy(X, ptr, NDIM * sizeof(double));
+    ptr += NDIM * sizeof(double);
+    memcpy(U, ptr, NDIM * sizeof(double));
+    return;
+} // unpack_particle
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LTracerParticles::LTracerParticles(const std::string& object_name,
+                                   Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                   const std::string& interp_fcn,
+                                   const bool register_for_restart)
+    : d_object_name(object_name),
+      d_registered_for_restart(register_for_restart),
+      d_hierarchy(hierarchy),
+      d_grid_geom(hierarchy->getGridGeometry()),
+      d_interp_fcn(interp_fcn),
+      d_particles(),
+      d_refined_boxes(),
+      d_restart_particles(),
+      d_X_stage()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!object_name.empty());
+    TBOX_ASSERT(hierarchy);
+    TBOX_ASSERT(d_grid_geom);
+#endif
+
+    // Setup Timers.
+    IBTK_DO_ONCE(
+        t_advance_particles = TimerManager::getManager()->getTimer("IBTK::LTracerParticles::advanceParticles()");
+        t_bin_particles = TimerManager::getManager()->getTimer("IBTK::LTracerParticles::binParticles()");
+        t_migrate_particles = TimerManager::getManager()->getTimer("IBTK::LTracerParticles::migrateParticles()");
+        t_redistribute_particles =
+            TimerManager::getManager()->getTimer("IBTK::LTracerParticles::redistributeParticles()"););
+
+    if (d_registered_for_restart)
+    {
+        RestartManager::getManager()->registerRestartItem(d_object_name, this);
+    }
+
+    // Initialize object with data read from the restart database.
+    const bool from_restart = RestartManager::getManager()->isFromRestart();
+    if (from_restart && d_registered_for_restart)
+    {
+        getFromRestart();
+    }
+
+    resetHierarchyConfiguration();
+    return;
+} // LTracerParticles
+
+LTracerParticles::~LTracerParticles()
+{
+    if (d_registered_for_restart)
+    {
+        RestartManager::getManager()->unregisterRestartItem(d_object_name);
+    }
+    return;
+} // ~LTracerParticles
+
+void
+LTracerParticles::addParticles(const std::vector<int>& ids, const std::vector<double>& X)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(X.size() == NDIM * ids.size());
+#endif
+    PatchParticles pool;
+    pool.ids = ids;
+    pool.X = X;
+    pool.U.resize(X.size(), 0.0);
+    for (unsigned int k = 0; k < ids.size(); ++k)
+    {
+        applyPeriodicShift(&pool.X[NDIM * k]);
+    }
+    migrateParticles(pool);
+    return;
+} // addParticles
+
+void
+LTracerParticles::initializeParticles(const std::vector<Point>& X_init)
+{
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+    const unsigned long num_particles = X_init.size();
+    const unsigned long k_lower = (num_particles * rank) / nodes;
+    const unsigned long k_upper = (num_particles * (rank + 1)) / nodes;
+    std::vector<int> ids(k_upper - k_lower);
+    std::vector<double> X(NDIM * (k_upper - k_lower));
+    for (unsigned long k = k_lower; k < k_upper; ++k)
+    {
+        ids[k - k_lower] = static_cast<int>(k);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X[NDIM * (k - k_lower) + d] = X_init[k][d];
+        }
+    }
+    addParticles(ids, X);
+    return;
+} // initializeParticles
+
+void
+LTracerParticles::redistributeParticles()
+{
+    IBTK_TIMER_START(t_redistribute_particles);
+    PatchParticles pool;
+    collectLocalParticles(pool.ids, pool.X, pool.U);
+
+    // Include any particles read from the restart database.
+    pool.ids.insert(pool.ids.end(), d_restart_particles.ids.begin(), d_restart_particles.ids.end());
+    pool.X.insert(pool.X.end(), d_restart_particles.X.begin(), d_restart_particles.X.end());
+    pool.U.insert(pool.U.end(), d_restart_particles.U.begin(), d_restart_particles.U.end());
+    d_restart_particles = PatchParticles();
+
+    resetHierarchyConfiguration();
+    migrateParticles(pool);
+    IBTK_TIMER_STOP(t_redistribute_particles);
+    return;
+} // redistributeParticles
+
+void
+LTracerParticles::eulerStep(const int u_current_idx, const double dt)
+{
+    const int u_idx[1] = { u_current_idx };
+    const double a[9] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+    const double b[1] = { 1.0 };
+    advanceParticles(u_idx, a, b, 1, dt);
+    return;
+} // eulerStep
+
+void
+LTracerParticles::midpointStep(const int u_current_idx, const int u_half_idx, const double dt)
+{
+    const int u_idx[2] = { u_current_idx, u_half_idx };
+    const double a[9] = { 0.0, 0.0, 0.0, 0.5, 0.0, 0.0, 0.0, 0.0, 0.0 };
+    const double b[2] = { 0.0, 1.0 };
+    advanceParticles(u_idx, a, b, 2, dt);
+    return;
+} // midpointStep
+
+void
+LTracerParticles::trapezoidalStep(const int u_current_idx, const int u_new_idx, const double dt)
+{
+    const int u_idx[2] = { u_current_idx, u_new_idx };
+    const double a[9] = { 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+    const double b[2] = { 0.5, 0.5 };
+    advanceParticles(u_idx, a, b, 2, dt);
+    return;
+} // trapezoidalStep
+
+void
+LTracerParticles::rk3Step(const int u_current_idx, const int u_half_idx, const int u_new_idx, const double dt)
+{
+    // The stages of the SSP-RK3 method are located at t, t+dt, and t+dt/2.
+    const int u_idx[3] = { u_current_idx, u_new_idx, u_half_idx };
+    const double a[9] = { 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.25, 0.25, 0.0 };
+    const double b[3] = { 1.0 / 6.0, 1.0 / 6.0, 2.0 / 3.0 };
+    advanceParticles(u_idx, a, b, 3, dt);
+    return;
+} // rk3Step
+
+unsigned int
+LTracerParticles::getNumberOfLocalParticles() const
+{
+    unsigned int num_particles = 0;
+    for (unsigned int ln = 0; ln < d_particles.size(); ++ln)
+    {
+        for (unsigned int patch_num = 0; patch_num < d_particles[ln].size(); ++patch_num)
+        {
+            num_particles += d_particles[ln][patch_num].ids.size();
+        }
+    }
+    return num_particles;
+} // getNumberOfLocalParticles
+
+unsigned long
+LTracerParticles::getNumberOfParticles() const
+{
+    unsigned long num_local_particles = getNumberOfLocalParticles(), num_particles = 0;
+    MPI_Allreduce(&num_local_particles, &num_particles, 1, MPI_UNSIGNED_LONG, MPI_SUM, SAMRAI_MPI::getCommunicator());
+    return num_particles;
+} // getNumberOfParticles
+
+const std::vector<double>&
+LTracerParticles::getPositions(const int level_number, const int patch_num) const
+{
+    return d_particles[level_number][patch_num].X;
+} // getPositions
+
+const std::vector<double>&
+LTracerParticles::getVelocities(const int level_number, const int patch_num) const
+{
+    return d_particles[level_number][patch_num].U;
+} // getVelocities
+
+const std::vector<int>&
+LTracerParticles::getIDs(const int level_number, const int patch_num) const
+{
+    return d_particles[level_number][patch_num].ids;
+} // getIDs
+
+void
+LTracerParticles::collectLocalParticles(std::vector<int>& ids, std::vector<double>& X, std::vector<double>& U) const
+{
+    const unsigned int num_particles = getNumberOfLocalParticles();
+    ids.clear();
+    X.clear();
+    U.clear();
+    ids.reserve(num_particles);
+    X.reserve(NDIM * num_particles);
+    U.reserve(NDIM * num_particles);
+    for (unsigned int ln = 0; ln < d_particles.size(); ++ln)
+    {
+        for (unsigned int patch_num = 0; patch_num < d_particles[ln].size(); ++patch_num)
+        {
+            const PatchParticles& particles = d_particles[ln][patch_num];
+            ids.insert(ids.end(), particles.ids.begin(), particles.ids.end());
+            X.insert(X.end(), particles.X.begin(), particles.X.end());
+            U.insert(U.end(), particles.U.begin(), particles.U.end());
+        }
+    }
+    return;
+} // collectLocalParticles
+
+void
+LTracerParticles::putToDatabase(Pointer<Database> db)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(db);
+#endif
+    db->putInteger("LTRACER_PARTICLES_VERSION", LTRACER_PARTICLES_VERSION);
+
+    // Particles that have not yet been assigned to patches are written along
+    // with the local particles.
+    std::vector<int> ids;
+    std::vector<double> X, U;
+    collectLocalParticles(ids, X, U);
+    ids.insert(ids.end(), d_restart_particles.ids.begin(), d_restart_particles.ids.end());
+    X.insert(X.end(), d_restart_particles.X.begin(), d_restart_particles.X.end());
+    U.insert(U.end(), d_restart_particles.U.begin(), d_restart_particles.U.end());
+    const int num_particles = static_cast<int>(ids.size());
+    db->putInteger("num_particles", num_particles);
+    if (num_particles > 0)
+    {
+        db->putIntegerArray("ids", &ids[0], num_particles);
+        db->putDoubleArray("X", &X[0], NDIM * num_particles);
+        db->putDoubleArray("U", &U[0], NDIM * num_particles);
+    }
+    return;
+} // putToDatabase
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+LTracerParticles::advanceParticles(const int* const u_idx,
+                                   const double* const a,
+                                   const double* const b,
+                                   const int num_stages,
+                                   const double dt)
+{
+    IBTK_TIMER_START(t_advance_particles);
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(finest_ln + 1 == static_cast<int>(d_particles.size()));
+#endif
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            advancePatchParticles(d_particles[ln][p()], level->getPatch(p()), u_idx, a, b, num_stages, dt);
+        }
+    }
+    IBTK_TIMER_STOP(t_advance_particles);
+    binParticles();
+    return;
+} // advanceParticles
+
+void
+LTracerParticles::advancePatchParticles(PatchParticles& particles,
+                                        Pointer<Patch<NDIM> > patch,
+                                        const int* const u_idx,
+                                        const double* const a,
+                                        const double* const b,
+                                        const int num_stages,
+                                        const double dt)
+{
+    const unsigned int num_particles = particles.ids.size();
+    if (num_particles == 0) return;
+    const Box<NDIM>& patch_box = patch->getBox();
+    const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+    const int stencil_width = LEInteractor::getMinimumGhostWidth(d_interp_fcn);
+    d_X_stage.resize(NDIM * num_particles);
+    for (int s = 0; s < num_stages; ++s)
+    {
+        d_K[s].resize(NDIM * num_particles);
+        std::fill(d_K[s].begin(), d_K[s].end(), 0.0);
+
+        // Determine the region in which the velocity can be interpolated.
+        Pointer<PatchData<NDIM> > u_data = patch->getPatchData(u_idx[s]);
+        Pointer<CellData<NDIM, double> > u_cc_data = u_data;
+        Pointer<SideData<NDIM, double> > u_sc_data = u_data;
+        const int interp_gcw = u_data->getGhostCellWidth().min() - stencil_width;
+        if (interp_gcw < 0)
+        {
+            TBOX_ERROR(d_object_name << "::advancePatchParticles():\n"
+                                     << "  velocity data does not have enough ghost cells for interpolation kernel "
+                                     << d_interp_fcn << std::endl);
+        }
+        Box<NDIM> interp_box = patch_box;
+        interp_box.grow(IntVector<NDIM>(interp_gcw));
+
+        // Set the stage positions X_s = X + dt*sum_j a_sj*K_j.  The positions
+        // at the beginning of the time step are always within the patch.
+        const std::vector<double>& X_s = (s == 0 ? particles.X : d_X_stage);
+        if (s > 0)
+        {
+            for (unsigned int k = 0; k < NDIM * num_particles; ++k)
+            {
+                double X_k = particles.X[k];
+                for (int j = 0; j < s; ++j)
+                {
+                    X_k += dt * a[3 * s + j] * d_K[j][k];
+                }
+                d_X_stage[k] = X_k;
+            }
+            for (unsigned int k = 0; k < num_particles; ++k)
+            {
+                const Index<NDIM> i = IndexUtilities::getCellIndex(&d_X_stage[NDIM * k], patch_geom, patch_box);
+                if (!interp_box.contains(i))
+                {
+                    TBOX_ERROR(d_object_name << "::advancePatchParticles():\n"
+                                             << "  particle " << particles.ids[k]
+                                             << " moved outside of the ghost cell region of its patch.\n"
+                                             << "  reduce the time step size or increase the ghost cell width "
+                                                "of the velocity data."
+                                             << std::endl);
+                }
+            }
+        }
+
+        // Compute K_s = u(X_s).
+        if (u_cc_data)
+        {
+            LEInteractor::interpolate(d_K[s], NDIM, X_s, NDIM, u_cc_data, patch, interp_box, d_interp_fcn);
+        }
+        else if (u_sc_data)
+        {
+            LEInteractor::interpolate(d_K[s], NDIM, X_s, NDIM, u_sc_data, patch, interp_box, d_interp_fcn);
+        }
+        else
+        {
+            TBOX_ERROR(d_object_name << "::advancePatchParticles():\n"
+                                     << "  unsupported velocity data centering" << std::endl);
+        }
+    }
+
+    // Set U = sum_s b_s*K_s and X := X + dt*U.
+    for (unsigned int k = 0; k < NDIM * num_particles; ++k)
+    {
+        double U_k = 0.0;
+        for (int s = 0; s < num_stages; ++s)
+        {
+            U_k += b[s] * d_K[s][k];
+        }
+        particles.U[k] = U_k;
+        particles.X[k] += dt * U_k;
+    }
+    LMarkerUtilities::preventMarkerEscape(particles.X, d_grid_geom);
+    return;
+} // advancePatchParticles
+
+void
+LTracerParticles::resetHierarchyConfiguration()
+{
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    d_particles.clear();
+    d_particles.resize(finest_ln + 1);
+    d_refined_boxes.clear();
+    d_refined_boxes.resize(finest_ln + 1);
+    d_box_bins.clear();
+    d_box_bins.resize(finest_ln + 1);
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const int num_patches = level->getNumberOfPatches();
+        d_particles[ln].resize(num_patches);
+        d_refined_boxes[ln].resize(num_patches);
+
+        // Bin the boxes of the level.  The bins are at least as large as the
+        // largest box, so each box is inserted into at most 2^NDIM bins.
+        const BoxArray<NDIM>& boxes = level->getBoxes();
+        LevelBoxBins& box_bins = d_box_bins[ln];
+        box_bins.bin_size = IntVector<NDIM>(1);
+        Box<NDIM> bounding_box;
+        for (int k = 0; k < boxes.getNumberOfBoxes(); ++k)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                box_bins.bin_size(d) = std::max(box_bins.bin_size(d), boxes[k].numberCells(d));
+                bounding_box.lower(d) = k == 0 ? boxes[k].lower(d) : std::min(bounding_box.lower(d), boxes[k].lower(d));
+                bounding_box.upper(d) = k == 0 ? boxes[k].upper(d) : std::max(bounding_box.upper(d), boxes[k].upper(d));
+            }
+        }
+        box_bins.bin_box = Box<NDIM>::coarsen(bounding_box, box_bins.bin_size);
+        for (int k = 0; k < boxes.getNumberOfBoxes(); ++k)
+        {
+            const Box<NDIM> bin_box = Box<NDIM>::coarsen(boxes[k], box_bins.bin_size);
+            for (Box<NDIM>::Iterator b(bin_box); b; b++)
+            {
+                box_bins.bins[box_bins.bin_box.offset(b())].push_back(k);
+            }
+        }
+        if (ln == finest_ln) continue;
+
+        // Cache the portions of the local patches that are covered by the next
+        // finer level.  Particles located in these regions are assigned to the
+        // finer level.
+        Pointer<PatchLevel<NDIM> > finer_level = d_hierarchy->getPatchLevel(ln + 1);
+        BoxArray<NDIM> refined_boxes = finer_level->getBoxes();
+        refined_boxes.coarsen(finer_level->getRatioToCoarserLevel());
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
+            for (int k = 0; k < refined_boxes.getNumberOfBoxes(); ++k)
+            {
+                if (refined_boxes[k].intersects(patch_box))
+                {
+                    d_refined_boxes[ln][p()].push_back(refined_boxes[k] * patch_box);
+                }
+            }
+        }
+    }
+    return;
+} // resetHierarchyConfiguration
+
+void
+LTracerParticles::binParticles()
+{
+    IBTK_TIMER_START(t_bin_particles);
+
+    // Remove particles that are no longer located in the interior of their
+    // patches.  The remaining particles are compacted in place.
+    PatchParticles pool;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const IntVector<NDIM>& ratio = level->getRatio();
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
+            const std::vector<Box<NDIM> >& refined_boxes = d_refined_boxes[ln][p()];
+            PatchParticles& particles = d_particles[ln][p()];
+            const unsigned int num_particles = particles.ids.size();
+            unsigned int num_kept = 0;
+            for (unsigned int k = 0; k < num_particles; ++k)
+            {
+                double* const X = &particles.X[NDIM * k];
+                const double* const U = &particles.U[NDIM * k];
+                applyPeriodicShift(X);
+                const Index<NDIM> i = IndexUtilities::getCellIndex(X, d_grid_geom, ratio);
+                bool keep = patch_box.contains(i);
+                for (unsigned int j = 0; keep && j < refined_boxes.size(); ++j)
+                {
+                    keep = !refined_boxes[j].contains(i);
+                }
+                if (keep)
+                {
+                    if (num_kept != k)
+                    {
+                        particles.ids[num_kept] = particles.ids[k];
+                        std::copy(X, X + NDIM, &particles.X[NDIM * num_kept]);
+                        std::copy(U, U + NDIM, &particles.U[NDIM * num_kept]);
+                    }
+                    ++num_kept;
+                }
+                else
+                {
+                    pool.ids.push_back(particles.ids[k]);
+                    pool.X.insert(pool.X.end(), X, X + NDIM);
+                    pool.U.insert(pool.U.end(), U, U + NDIM);
+                }
+            }
+            particles.ids.resize(num_kept);
+            particles.X.resize(NDIM * num_kept);
+            particles.U.resize(NDIM * num_kept);
+        }
+    }
+    IBTK_TIMER_STOP(t_bin_particles);
+
+    // Send the removed particles to their new patches.
+    migrateParticles(pool);
+    return;
+} // binParticles
+
+void
+LTracerParticles::migrateParticles(const PatchParticles& pool)
+{
+    IBTK_TIMER_START(t_migrate_particles);
+
+    // Assign the particles to patches.  Particles owned by other processes are
+    // packed into one message per destination process.
+    const int rank = SAMRAI_MPI::getRank();
+    std::map<int, std::vector<char> > send_data, recv_data;
+    for (unsigned int k = 0; k < pool.ids.size(); ++k)
+    {
+        const double* const X = &pool.X[NDIM * k];
+        const double* const U = &pool.U[NDIM * k];
+        int ln, patch_num, owner_rank;
+        if (!findOwner(X, ln, patch_num, owner_rank))
+        {
+            TBOX_ERROR(d_object_name << "::migrateParticles():\n"
+                                     << "  particle " << pool.ids[k] << " is not located in the patch hierarchy"
+                                     << std::endl);
+        }
+        if (owner_rank == rank)
+        {
+            PatchParticles& particles = d_particles[ln][patch_num];
+            particles.ids.push_back(pool.ids[k]);
+            particles.X.insert(particles.X.end(), X, X + NDIM);
+            particles.U.insert(particles.U.end(), U, U + NDIM);
+        }
+        else
+        {
+            pack_particle(send_data[owner_rank], pool.ids[k], ln, patch_num, X, U);
+        }
+    }
+
+    // Exchange particles with the processes that own them.
+    ParallelExchangeUtilities::exchangeData(send_data, recv_data);
+    for (std::map<int, std::vector<char> >::const_iterator it = recv_data.begin(); it != recv_data.end(); ++it)
+    {
+        const std::vector<char>& buf = it->second;
+#if !defined(NDEBUG)
+        TBOX_ASSERT(buf.size() % PARTICLE_RECORD_SIZE == 0);
+#endif
+        for (size_t offset = 0; offset < buf.size(); offset += PARTICLE_RECORD_SIZE)
+        {
+            int id, ln, patch_num;
+            double X[NDIM], U[NDIM];
+            unpack_particle(&buf[offset], id, ln, patch_num, X, U);
+            PatchParticles& particles = d_particles[ln][patch_num];
+            particles.ids.push_back(id);
+            particles.X.insert(particles.X.end(), X, X + NDIM);
+            particles.U.insert(particles.U.end(), U, U + NDIM);
+        }
+    }
+
+    // Restore the cell ordering of the particles on each local patch.
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            sortPatchParticles(d_particles[ln][p()], ln, level->getPatch(p())->getBox());
+        }
+    }
+    IBTK_TIMER_STOP(t_migrate_particles);
+    return;
+} // migrateParticles
+
+bool
+LTracerParticles::findOwner(const double* const X, int& level_number, int& patch_num, int& rank) const
+{
+    // Only the boxes that overlap the bin containing the particle are
+    // searched, so the cost of the search does not grow with the number of
+    // boxes in the level.
+    for (int ln = d_hierarchy->getFinestLevelNumber(); ln >= 0; --ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const LevelBoxBins& box_bins = d_box_bins[ln];
+        const Index<NDIM> i = IndexUtilities::getCellIndex(X, d_grid_geom, level->getRatio());
+        const Index<NDIM> bin_idx = Box<NDIM>::coarsen(Box<NDIM>(i, i), box_bins.bin_size).lower();
+        if (!box_bins.bin_box.contains(bin_idx)) continue;
+        std::map<int, std::vector<int> >::const_iterator it = box_bins.bins.find(box_bins.bin_box.offset(bin_idx));
+        if (it == box_bins.bins.end()) continue;
+        const BoxArray<NDIM>& boxes = level->getBoxes();
+        for (std::vector<int>::const_iterator k = it->second.begin(); k != it->second.end(); ++k)
+        {
+            if (boxes[*k].contains(i))
+            {
+                level_number = ln;
+                patch_num = *k;
+                rank = level->getProcessorMapping().getProcessorAssignment(*k);
+                return true;
+            }
+        }
+    }
+    return false;
+} // findOwner
+
+void
+LTracerParticles::sortPatchParticles(PatchParticles& particles, const int level_number, const Box<NDIM>& patch_box)
+{
+    const unsigned int num_particles = particles.ids.size();
+    if (num_particles <= 1) return;
+
+    // Counting sort by cell offset.  Sorting is stable, so the relative order
+    // of the particles within each cell is preserved.
+    const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(level_number)->getRatio();
+    std::vector<int> cell_offset(num_particles);
+    std::vector<unsigned int> cell_start(patch_box.size() + 1, 0);
+    bool sorted = true;
+    for (unsigned int k = 0; k < num_particles; ++k)
+    {
+        const Index<NDIM> i = IndexUtilities::getCellIndex(&particles.X[NDIM * k], d_grid_geom, ratio);
+        cell_offset[k] = patch_box.offset(i);
+        sorted = sorted && (k == 0 || cell_offset[k - 1] <= cell_offset[k]);
+        ++cell_start[cell_offset[k] + 1];
+    }
+    if (sorted) return;
+    for (unsigned int c = 1; c < cell_start.size(); ++c)
+    {
+        cell_start[c] += cell_start[c - 1];
+    }
+    std::vector<int> ids(num_particles);
+    std::vector<double> X(NDIM * num_particles), U(NDIM * num_particles);
+    for (unsigned int k = 0; k < num_particles; ++k)
+    {
+        const unsigned int dst = cell_start[cell_offset[k]]++;
+        ids[dst] = particles.ids[k];
+        std::copy(&particles.X[NDIM * k], &particles.X[NDIM * k] + NDIM, &X[NDIM * dst]);
+        std::copy(&particles.U[NDIM * k], &particles.U[NDIM * k] + NDIM, &U[NDIM * dst]);
+    }
+    particles.ids.swap(ids);
+    particles.X.swap(X);
+    particles.U.swap(U);
+    return;
+} // sortPatchParticles
+
+void
+LTracerParticles::applyPeriodicShift(double* const X) const
+{
+    const IntVector<NDIM>& periodic_shift = d_grid_geom->getPeriodicShift();
+    const double* const x_lower = d_grid_geom->getXLower();
+    const double* const x_upper = d_grid_geom->getXUpper();
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (periodic_shift[d] == 0) continue;
+        const double L = x_upper[d] - x_lower[d];
+        if (X[d] < x_lower[d] || X[d] >= x_upper[d])
+        {
+            X[d] -= L * floor((X[d] - x_lower[d]) / L);
+            if (X[d] < x_lower[d] || X[d] >= x_upper[d]) X[d] = x_lower[d];
+        }
+    }
+    return;
+} // applyPeriodicShift
+
+void
+LTracerParticles::getFromRestart()
+{
+    Pointer<Database> restart_db = RestartManager::getManager()->getRootDatabase();
+    Pointer<Database> db;
+    if (restart_db->isDatabase(d_object_name))
+    {
+        db = restart_db->getDatabase(d_object_name);
+    }
+    else
+    {
+        TBOX_ERROR("Restart database corresponding to " << d_object_name << " not found in restart file.");
+    }
+
+    int ver = db->getInteger("LTRACER_PARTICLES_VERSION");
+    if (ver != LTRACER_PARTICLES_VERSION)
+    {
+        TBOX_ERROR(d_object_name << ":  "
+                                 << "Restart file version different than class version.");
+    }
+
+    // The particles are assigned to patches by redistributeParticles() once
+    // the patch hierarchy has been initialized.
+    const int num_particles = db->getInteger("num_particles");
+    d_restart_particles.ids.resize(num_particles);
+    d_restart_particles.X.resize(NDIM * num_particles);
+    d_restart_particles.U.resize(NDIM * num_particles);
+    if (num_particles > 0)
+    {
+        db->getIntegerArray("ids", &d_restart_particles.ids[0], num_particles);
+        db->getDoubleArray("X", &d_restart_particles.X[0], NDIM * num_particles);
+        db->getDoubleArray("U", &d_restart_particles.U[0], NDIM * num_particles);
+    }
+    return;
+} // getFromRestart
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
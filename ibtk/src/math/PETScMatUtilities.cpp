@@ -56,6 +56,7 @@
 #include "SideGeometry.h"
 #include "SideIndex.h"
 #include "boost/array.hpp"
+#include "boost/functional/hash.hpp"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/PETScMatUtilities.h"
@@ -100,6 +101,15 @@ bool inline is_cf_bdry_idx(const Index<NDIM>& idx, const std::vector<Box<NDIM> >
     return contains_idx;
 } // is_cf_bdry_idx
 
+inline void
+hash_nonzero_structure_row(std::size_t& signature, const int row, const int ncols, const int* const cols)
+{
+    boost::hash_combine(signature, row);
+    boost::hash_combine(signature, ncols);
+    for (int k = 0; k < ncols; ++k) boost::hash_combine(signature, cols[k]);
+    return;
+} // hash_nonzero_structure_row
+
 static const int LOWER = 0;
 static const int UPPER = 1;
 static const std::string CONSERVATIVE = "CONSERVATIVE";
@@ -118,7 +128,8 @@ PETScMatUtilities::constructPatchLevelCCLaplaceOp(Mat& mat,
                                                   double data_time,
                                                   const std::vector<int>& num_dofs_per_proc,
                                                   const int dof_index_idx,
-                                                  Pointer<PatchLevel<NDIM> > patch_level)
+                                                  Pointer<PatchLevel<NDIM> > patch_level,
+                                                  const bool reuse_nonzero_structure)
 {
     constructPatchLevelCCLaplaceOp(mat,
                                    poisson_spec,
@@ -126,7 +137,8 @@ PETScMatUtilities::constructPatchLevelCCLaplaceOp(Mat& mat,
                                    data_time,
                                    num_dofs_per_proc,
                                    dof_index_idx,
-                                   patch_level);
+                                   patch_level,
+                                   reuse_nonzero_structure);
     return;
 } // constructPatchLevelCCLaplaceOp
 
@@ -137,10 +149,11 @@ PETScMatUtilities::constructPatchLevelCCLaplaceOp(Mat& mat,
                                                   double data_time,
                                                   const std::vector<int>& num_dofs_per_proc,
                                                   const int dof_index_idx,
-                                                  Pointer<PatchLevel<NDIM> > patch_level)
+                                                  Pointer<PatchLevel<NDIM> > patch_level,
+                                                  const bool reuse_nonzero_structure)
 {
     int ierr;
-    if (mat)
+    if (mat && !reuse_nonzero_structure)
     {
         ierr = MatDestroy(&mat);
         IBTK_CHKERRQ(ierr);
@@ -166,65 +179,77 @@ PETScMatUtilities::constructPatchLevelCCLaplaceOp(Mat& mat,
     const int i_upper = i_lower + n_local;
     const int n_total = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.end(), 0);
 
-    // Determine the non-zero structure of the matrix.
-    std::vector<int> d_nnz(n_local, 0), o_nnz(n_local, 0);
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    if (mat)
     {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        Pointer<CellData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        // The nonzero structure of the existing matrix is unchanged, so its
+        // values are overwritten in place.
+        ierr = MatZeroEntries(mat);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatSetOption(mat, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
+    }
+    else
+    {
+        // Determine the non-zero structure of the matrix.
+        std::vector<int> d_nnz(n_local, 0), o_nnz(n_local, 0);
+        for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CellData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
 #if !defined(NDEBUG)
-        TBOX_ASSERT(depth == dof_index_data->getDepth());
+            TBOX_ASSERT(depth == dof_index_data->getDepth());
 #endif
-        for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
-        {
-            const CellIndex<NDIM>& i = b();
-            for (int d = 0; d < depth; ++d)
+            for (Box<NDIM>::Iterator b(CellGeometry<NDIM>::toCellBox(patch_box)); b; b++)
             {
-                const int dof_index = (*dof_index_data)(i, d);
-                if (i_lower <= dof_index && dof_index < i_upper)
+                const CellIndex<NDIM>& i = b();
+                for (int d = 0; d < depth; ++d)
                 {
-                    // Stencil for finite difference operator.
-                    const int local_idx = dof_index - i_lower;
-                    d_nnz[local_idx] += 1;
-                    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
+                    const int dof_index = (*dof_index_data)(i, d);
+                    if (i_lower <= dof_index && dof_index < i_upper)
                     {
-                        for (int side = 0; side <= 1; ++side, ++stencil_index)
+                        // Stencil for finite difference operator.
+                        const int local_idx = dof_index - i_lower;
+                        d_nnz[local_idx] += 1;
+                        for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
                         {
-                            const int dof_index = (*dof_index_data)(i + stencil[stencil_index], d);
-                            if (dof_index >= i_lower && dof_index < i_upper)
-                            {
-                                d_nnz[local_idx] += 1;
-                            }
-                            else
+                            for (int side = 0; side <= 1; ++side, ++stencil_index)
                             {
-                                o_nnz[local_idx] += 1;
+                                const int dof_index = (*dof_index_data)(i + stencil[stencil_index], d);
+                                if (dof_index >= i_lower && dof_index < i_upper)
+                                {
+                                    d_nnz[local_idx] += 1;
+                                }
+                                else
+                                {
+                                    o_nnz[local_idx] += 1;
+                                }
                             }
                         }
+                        d_nnz[local_idx] = std::min(n_local, d_nnz[local_idx]);
+                        o_nnz[local_idx] = std::min(n_total - n_local, o_nnz[local_idx]);
                     }
-                    d_nnz[local_idx] = std::min(n_local, d_nnz[local_idx]);
-                    o_nnz[local_idx] = std::min(n_total - n_local, o_nnz[local_idx]);
                 }
             }
         }
-    }
 
-    // Create an empty matrix.
-    ierr = MatCreateAIJ(PETSC_COMM_WORLD,
-                        n_local,
-                        n_local,
-                        PETSC_DETERMINE,
-                        PETSC_DETERMINE,
-                        0,
-                        n_local ? &d_nnz[0] : NULL,
-                        0,
-                        n_local ? &o_nnz[0] : NULL,
-                        &mat);
-    IBTK_CHKERRQ(ierr);
+        // Create an empty matrix.
+        ierr = MatCreateAIJ(PETSC_COMM_WORLD,
+                            n_local,
+                            n_local,
+                            PETSC_DETERMINE,
+                            PETSC_DETERMINE,
+                            0,
+                            n_local ? &d_nnz[0] : NULL,
+                            0,
+                            n_local ? &o_nnz[0] : NULL,
+                            &mat);
+        IBTK_CHKERRQ(ierr);
 
-    // Set block size.
-    ierr = MatSetBlockSize(mat, depth);
-    IBTK_CHKERRQ(ierr);
+        // Set block size.
+        ierr = MatSetBlockSize(mat, depth);
+        IBTK_CHKERRQ(ierr);
+    }
 
     // Set the matrix coefficients to correspond to the standard finite
     // difference approximation to the Laplacian.
@@ -285,14 +310,15 @@ PETScMatUtilities::constructPatchLevelSCLaplaceOp(Mat& mat,
                                                   double data_time,
                                                   const std::vector<int>& num_dofs_per_proc,
                                                   const int dof_index_idx,
-                                                  Pointer<PatchLevel<NDIM> > patch_level)
+                                                  Pointer<PatchLevel<NDIM> > patch_level,
+                                                  const bool reuse_nonzero_structure)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(bc_coefs.size() == NDIM);
 #endif
 
     int ierr;
-    if (mat)
+    if (mat && !reuse_nonzero_structure)
     {
         ierr = MatDestroy(&mat);
         IBTK_CHKERRQ(ierr);
@@ -316,61 +342,73 @@ PETScMatUtilities::constructPatchLevelSCLaplaceOp(Mat& mat,
     const int i_upper = i_lower + n_local;
     const int n_total = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.end(), 0);
 
-    // Determine the non-zero structure of the matrix.
-    std::vector<int> d_nnz(n_local, 0), o_nnz(n_local, 0);
-    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    if (mat)
     {
-        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
-        const Box<NDIM>& patch_box = patch->getBox();
-        Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        // The nonzero structure of the existing matrix is unchanged, so its
+        // values are overwritten in place.
+        ierr = MatZeroEntries(mat);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatSetOption(mat, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
+    }
+    else
+    {
+        // Determine the non-zero structure of the matrix.
+        std::vector<int> d_nnz(n_local, 0), o_nnz(n_local, 0);
+        for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<SideData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
 #if !defined(NDEBUG)
-        TBOX_ASSERT(dof_index_data->getDepth() == 1);
+            TBOX_ASSERT(dof_index_data->getDepth() == 1);
 #endif
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
-                const int dof_index = (*dof_index_data)(i);
-                if (i_lower <= dof_index && dof_index < i_upper)
+                for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
                 {
-                    // Stencil for finite difference operator.
-                    const int local_idx = dof_index - i_lower;
-                    d_nnz[local_idx] += 1;
-                    for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
+                    const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
+                    const int dof_index = (*dof_index_data)(i);
+                    if (i_lower <= dof_index && dof_index < i_upper)
                     {
-                        for (int side = 0; side <= 1; ++side, ++stencil_index)
+                        // Stencil for finite difference operator.
+                        const int local_idx = dof_index - i_lower;
+                        d_nnz[local_idx] += 1;
+                        for (unsigned int axis = 0, stencil_index = 1; axis < NDIM; ++axis)
                         {
-                            const int dof_index = (*dof_index_data)(i + stencil[stencil_index]);
-                            if (dof_index >= i_lower && dof_index < i_upper)
-                            {
-                                d_nnz[local_idx] += 1;
-                            }
-                            else
+                            for (int side = 0; side <= 1; ++side, ++stencil_index)
                             {
-                                o_nnz[local_idx] += 1;
+                                const int dof_index = (*dof_index_data)(i + stencil[stencil_index]);
+                                if (dof_index >= i_lower && dof_index < i_upper)
+                                {
+                                    d_nnz[local_idx] += 1;
+                                }
+                                else
+                                {
+                                    o_nnz[local_idx] += 1;
+                                }
                             }
                         }
+                        d_nnz[local_idx] = std::min(n_local, d_nnz[local_idx]);
+                        o_nnz[local_idx] = std::min(n_total - n_local, o_nnz[local_idx]);
                     }
-                    d_nnz[local_idx] = std::min(n_local, d_nnz[local_idx]);
-                    o_nnz[local_idx] = std::min(n_total - n_local, o_nnz[local_idx]);
                 }
             }
         }
-    }
 
-    // Create an empty matrix.
-    ierr = MatCreateAIJ(PETSC_COMM_WORLD,
-                        n_local,
-                        n_local,
-                        PETSC_DETERMINE,
-                        PETSC_DETERMINE,
-                        0,
-                        n_local ? &d_nnz[0] : NULL,
-                        0,
-                        n_local ? &o_nnz[0] : NULL,
-                        &mat);
-    IBTK_CHKERRQ(ierr);
+        // Create an empty matrix.
+        ierr = MatCreateAIJ(PETSC_COMM_WORLD,
+                            n_local,
+                            n_local,
+                            PETSC_DETERMINE,
+                            PETSC_DETERMINE,
+                            0,
+                            n_local ? &d_nnz[0] : NULL,
+                            0,
+                            n_local ? &o_nnz[0] : NULL,
+                            &mat);
+        IBTK_CHKERRQ(ierr);
+    }
 
     // Set the matrix coefficients to correspond to the standard finite
     // difference approximation to the Laplacian.
@@ -436,11 +474,6 @@ PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
     if (interp_stencil % 2 != 0) interp_stencil += 1;
 
     int ierr;
-    if (mat)
-    {
-        ierr = MatDestroy(&mat);
-        IBTK_CHKERRQ(ierr);
-    }
 
     // Determine the grid extents.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = patch_level->getGridGeometry();
@@ -468,6 +501,9 @@ PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
     int i_lower, i_upper;
     ierr = VecGetOwnershipRange(X_vec, &i_lower, &i_upper);
     IBTK_CHKERRQ(ierr);
+    int m_total;
+    ierr = VecGetSize(X_vec, &m_total);
+    IBTK_CHKERRQ(ierr);
 
     const int mpi_rank = SAMRAI_MPI::getRank();
     const int n_local = num_dofs_per_proc[mpi_rank];
@@ -478,7 +514,19 @@ PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
     // Determine the index of the Cartesian grid cell containing each local IB
     // point; find that index in a local patch or in the ghost cell region of a
     // local patch; compute the stencil boxes for each local IB point; and
-    // compute the nonzero structure of the matrix.
+    // compute the nonzero structure of the matrix.  When a matrix is provided,
+    // we also compute the signature of the new nonzero structure so that the
+    // existing matrix can be reused if its structure is unchanged.
+    const bool compute_signature = mat != NULL;
+    std::size_t signature = 0;
+    if (compute_signature)
+    {
+        boost::hash_combine(signature, m_local);
+        boost::hash_combine(signature, n_local);
+        boost::hash_combine(signature, m_total);
+        boost::hash_combine(signature, n_total);
+    }
+    std::vector<int> row_cols;
     const int n_local_points = m_local / NDIM;
     double* X_arr;
     ierr = VecGetArray(X_vec, &X_arr);
@@ -566,6 +614,7 @@ PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
 #if !defined(NDEBUG)
             TBOX_ASSERT(SideGeometry<NDIM>::toSideBox(dof_index_data->getGhostBox(), axis).contains(stencil_box_axis));
 #endif
+            row_cols.clear();
             for (Box<NDIM>::Iterator b(stencil_box_axis); b; b++)
             {
                 const int dof_index = (*dof_index_data)(SideIndex<NDIM>(b(), axis, SideIndex<NDIM>::Lower));
@@ -577,24 +626,55 @@ PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
                 {
                     o_nnz[local_idx] += 1;
                 }
+                if (compute_signature) row_cols.push_back(dof_index);
             }
             d_nnz[local_idx] = std::min(n_local, d_nnz[local_idx]);
             o_nnz[local_idx] = std::min(n_total - n_local, o_nnz[local_idx]);
+            if (compute_signature)
+            {
+                std::sort(row_cols.begin(), row_cols.end());
+                row_cols.erase(std::unique(row_cols.begin(), row_cols.end()), row_cols.end());
+                hash_nonzero_structure_row(
+                    signature, i_lower + local_idx, static_cast<int>(row_cols.size()), &row_cols[0]);
+            }
+        }
+    }
+
+    // Reuse the existing matrix if its nonzero structure is unchanged on all
+    // processors.  In this case, all of the existing nonzero entries are
+    // overwritten below, and operations that depend only on the nonzero
+    // structure of the matrix (e.g., symbolic matrix-matrix products) remain
+    // valid.
+    if (mat)
+    {
+        const int same_structure = signature == computeNonzeroStructureSignature(mat) ? 1 : 0;
+        if (SAMRAI_MPI::minReduction(same_structure) == 1)
+        {
+            ierr = MatSetOption(mat, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+        }
+        else
+        {
+            ierr = MatDestroy(&mat);
+            IBTK_CHKERRQ(ierr);
         }
     }
 
     // Create an empty matrix.
-    ierr = MatCreateAIJ(PETSC_COMM_WORLD,
-                        m_local,
-                        n_local,
-                        PETSC_DETERMINE,
-                        PETSC_DETERMINE,
-                        0,
-                        m_local ? &d_nnz[0] : NULL,
-                        0,
-                        m_local ? &o_nnz[0] : NULL,
-                        &mat);
-    IBTK_CHKERRQ(ierr);
+    if (!mat)
+    {
+        ierr = MatCreateAIJ(PETSC_COMM_WORLD,
+                            m_local,
+                            n_local,
+                            PETSC_DETERMINE,
+                            PETSC_DETERMINE,
+                            0,
+                            m_local ? &d_nnz[0] : NULL,
+                            0,
+                            m_local ? &o_nnz[0] : NULL,
+                            &mat);
+        IBTK_CHKERRQ(ierr);
+    }
 
     // Set the matrix coefficients.
     for (int k = 0; k < m_local / NDIM; ++k)
@@ -662,6 +742,36 @@ PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
     return;
 } // constructPatchLevelSCInterpOp
 
+std::size_t
+PETScMatUtilities::computeNonzeroStructureSignature(const Mat& mat)
+{
+    int ierr;
+    std::size_t signature = 0;
+    int m_local, n_local, m_total, n_total;
+    ierr = MatGetLocalSize(mat, &m_local, &n_local);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatGetSize(mat, &m_total, &n_total);
+    IBTK_CHKERRQ(ierr);
+    boost::hash_combine(signature, m_local);
+    boost::hash_combine(signature, n_local);
+    boost::hash_combine(signature, m_total);
+    boost::hash_combine(signature, n_total);
+    int i_lower, i_upper;
+    ierr = MatGetOwnershipRange(mat, &i_lower, &i_upper);
+    IBTK_CHKERRQ(ierr);
+    for (int i = i_lower; i < i_upper; ++i)
+    {
+        int ncols;
+        const int* cols;
+        ierr = MatGetRow(mat, i, &ncols, &cols, NULL);
+        IBTK_CHKERRQ(ierr);
+        hash_nonzero_structure_row(signature, i, ncols, cols);
+        ierr = MatRestoreRow(mat, i, &ncols, &cols, NULL);
+        IBTK_CHKERRQ(ierr);
+    }
+    return signature;
+} // computeNonzeroStructureSignature
+
 void
 PETScMatUtilities::constructProlongationOp(Mat& mat,
                                            const std::string& op_type,
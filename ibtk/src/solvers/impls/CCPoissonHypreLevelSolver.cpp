@@ -89,6 +89,7 @@ static Timer* t_solve_system;
 static Timer* t_solve_system_hypre;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
+static Timer* t_update_coefficients;
 
 // hypre solver options.
 enum HypreStructRAPType
@@ -212,7 +213,9 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
                  t_initialize_solver_state =
                      TimerManager::getManager()->getTimer("IBTK::CCPoissonHypreLevelSolver::initializeSolverState()");
                  t_deallocate_solver_state =
-                     TimerManager::getManager()->getTimer("IBTK::CCPoissonHypreLevelSolver::deallocateSolverState()"););
+                     TimerManager::getManager()->getTimer("IBTK::CCPoissonHypreLevelSolver::deallocateSolverState()");
+                 t_update_coefficients =
+                     TimerManager::getManager()->getTimer("IBTK::CCPoissonHypreLevelSolver::updateCoefficients()"););
     return;
 } // CCPoissonHypreLevelSolver
 
@@ -378,6 +381,49 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
     return;
 } // initializeSolverState
 
+bool
+CCPoissonHypreLevelSolver::updateCoefficients()
+{
+    if (!d_is_initialized) return false;
+
+    IBTK_TIMER_START(t_update_coefficients);
+
+    // The stencil depends on whether the anisotropy is grid aligned, so the
+    // hypre data structures must be rebuilt if that changes.
+    bool grid_aligned_anisotropy = true;
+    if (!d_poisson_spec.dIsConstant())
+    {
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<SideDataFactory<NDIM, double> > pdat_factory =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_poisson_spec.getDPatchDataId());
+#if !defined(NDEBUG)
+        TBOX_ASSERT(pdat_factory);
+#endif
+        grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
+    }
+
+    // Reset the matrix values on the existing grid and redo the solver setup.
+    destroyHypreSolver();
+    if (grid_aligned_anisotropy != d_grid_aligned_anisotropy)
+    {
+        deallocateHypreData();
+        d_grid_aligned_anisotropy = grid_aligned_anisotropy;
+        allocateHypreData();
+    }
+    if (d_grid_aligned_anisotropy)
+    {
+        setMatrixCoefficients_aligned();
+    }
+    else
+    {
+        setMatrixCoefficients_nonaligned();
+    }
+    setupHypreSolver();
+
+    IBTK_TIMER_STOP(t_update_coefficients);
+    return true;
+} // updateCoefficients
+
 void
 CCPoissonHypreLevelSolver::deallocateSolverState()
 {
@@ -528,29 +574,25 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_aligned()
 {
     // Set matrix entries and copy them to the hypre matrix structures.
     const int stencil_sz = static_cast<int>(d_stencil_offsets.size());
-    std::vector<int> stencil_indices(stencil_sz);
-    for (int i = 0; i < stencil_sz; ++i)
-    {
-        stencil_indices[i] = i;
-    }
-    std::vector<double> mat_vals(stencil_sz, 0.0);
     for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
+        Index<NDIM> lower = patch_box.lower();
+        Index<NDIM> upper = patch_box.upper();
         CellData<NDIM, double> matrix_coefs(patch_box, stencil_sz, IntVector<NDIM>(0));
         for (unsigned int k = 0; k < d_depth; ++k)
         {
             PoissonUtilities::computeMatrixCoefficients(
                 matrix_coefs, patch, d_stencil_offsets, d_poisson_spec, d_bc_coefs[k], d_solution_time);
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+
+            // NOTE: Because matrix_coefs has no ghost cells, each depth of the
+            // patch data is a contiguous array over the patch box that is
+            // ordered in the same way as hypre box values, so that each
+            // stencil entry can be set with a single call.
+            for (int j = 0; j < stencil_sz; ++j)
             {
-                Index<NDIM> i = b();
-                for (int j = 0; j < stencil_sz; ++j)
-                {
-                    mat_vals[j] = matrix_coefs(i, j);
-                }
-                HYPRE_StructMatrixSetValues(d_matrices[k], i, stencil_sz, &stencil_indices[0], &mat_vals[0]);
+                HYPRE_StructMatrixSetBoxValues(d_matrices[k], lower, upper, 1, &j, matrix_coefs.getPointer(j));
             }
         }
     }
@@ -652,13 +694,19 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
 
         // Set the matrix coefficients to correspond to a second-order accurate
         // finite difference stencil for the Laplace operator.
-        for (Box<NDIM>::Iterator b(patch_box); b; b++)
+        //
+        // NOTE: The coefficients are accumulated in a contiguous array that is
+        // ordered with the stencil index varying fastest, followed by the cell
+        // index in the order in which hypre stores box values.
+        std::vector<double> box_vals(stencil_sz * patch_box.size(), 0.0);
+        int offset = 0;
+        for (Box<NDIM>::Iterator b(patch_box); b; b++, offset += stencil_sz)
         {
             Index<NDIM> i = b();
             static const Index<NDIM> i_stencil_center(0);
             const int stencil_center = stencil_index_map[i_stencil_center];
 
-            std::vector<double> mat_vals(stencil_sz, 0.0);
+            double* const mat_vals = &box_vals[offset];
             mat_vals[stencil_center] = (*C_data)(i);
 
             // The grid aligned part of the stencil (normal derivatives).
@@ -755,11 +803,13 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
                     }
                 }
             }
+        }
 
-            for (unsigned int k = 0; k < d_depth; ++k)
-            {
-                HYPRE_StructMatrixSetValues(d_matrices[k], i, stencil_sz, stencil_indices, &mat_vals[0]);
-            }
+        Index<NDIM> lower = patch_box.lower();
+        Index<NDIM> upper = patch_box.upper();
+        for (unsigned int k = 0; k < d_depth; ++k)
+        {
+            HYPRE_StructMatrixSetBoxValues(d_matrices[k], lower, upper, stencil_sz, stencil_indices, &box_vals[0]);
         }
     }
 
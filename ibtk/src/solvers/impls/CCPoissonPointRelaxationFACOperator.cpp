@@ -66,6 +66,7 @@
 #include "SideData.h"
 #include "SideIndex.h"
 #include "Variable.h"
+#include "VariableContext.h"
 #include "VariableDatabase.h"
 #include "VariableFillPattern.h"
 #include "boost/array.hpp"
@@ -101,10 +102,14 @@
 #if (NDIM == 2)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth2d, GSSMOOTH2D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth2d, RBGSSMOOTH2D)
+#define GS_SMOOTH_SP_FC IBTK_FC_FUNC(gssmoothsp2d, GSSMOOTHSP2D)
+#define RB_GS_SMOOTH_SP_FC IBTK_FC_FUNC(rbgssmoothsp2d, RBGSSMOOTHSP2D)
 #endif
 #if (NDIM == 3)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth3d, GSSMOOTH3D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth3d, RBGSSMOOTH3D)
+#define GS_SMOOTH_SP_FC IBTK_FC_FUNC(gssmoothsp3d, GSSMOOTHSP3D)
+#define RB_GS_SMOOTH_SP_FC IBTK_FC_FUNC(rbgssmoothsp3d, RBGSSMOOTHSP3D)
 #endif
 
 // Function interfaces
@@ -141,6 +146,39 @@ void RB_GS_SMOOTH_FC(double* U,
 #endif
                      const double* dx,
                      const int& red_or_black);
+
+void GS_SMOOTH_SP_FC(float* U,
+                     const int& U_gcw,
+                     const double& alpha,
+                     const double& beta,
+                     const float* F,
+                     const int& F_gcw,
+                     const int& ilower0,
+                     const int& iupper0,
+                     const int& ilower1,
+                     const int& iupper1,
+#if (NDIM == 3)
+                     const int& ilower2,
+                     const int& iupper2,
+#endif
+                     const double* dx);
+
+void RB_GS_SMOOTH_SP_FC(float* U,
+                        const int& U_gcw,
+                        const double& alpha,
+                        const double& beta,
+                        const float* F,
+                        const int& F_gcw,
+                        const int& ilower0,
+                        const int& iupper0,
+                        const int& ilower1,
+                        const int& iupper1,
+#if (NDIM == 3)
+                        const int& ilower2,
+                        const int& iupper2,
+#endif
+                        const double* dx,
+                        const int& red_or_black);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -162,6 +200,12 @@ static const int DEFAULT_DATA_DEPTH = 1;
 // Number of ghosts cells used for each variable quantity.
 static const int CELLG = 1;
 
+// Number of interior cell layers adjacent to each patch boundary that are
+// copied from single to double precision before ghost cell values are refilled
+// during single precision smoothing.  This must cover the interior stencils of
+// the physical boundary and coarse-fine interface operators.
+static const int SP_SYNC_WIDTH = 3;
+
 // Types of refining and coarsening to perform prior to setting coarse-fine
 // boundary and physical boundary ghost cell values.
 static const std::string DATA_REFINE_TYPE = "NONE";
@@ -237,6 +281,45 @@ do_local_data_update(SmootherType smoother_type)
         return false;
     }
 } // do_local_data_update
+
+template <class TDST, class TSRC>
+inline void
+copy_array_data(ArrayData<NDIM, TDST>& dst, const ArrayData<NDIM, TSRC>& src)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst.getBox() == src.getBox());
+    TBOX_ASSERT(dst.getDepth() == src.getDepth());
+#endif
+    const int n = dst.getDepth() * dst.getBox().size();
+    TDST* const dst_vals = dst.getPointer();
+    const TSRC* const src_vals = src.getPointer();
+    for (int k = 0; k < n; ++k)
+    {
+        dst_vals[k] = static_cast<TDST>(src_vals[k]);
+    }
+    return;
+} // copy_array_data
+
+template <class TDST, class TSRC>
+inline void
+copy_array_data(ArrayData<NDIM, TDST>& dst, const ArrayData<NDIM, TSRC>& src, const BoxList<NDIM>& boxes)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst.getDepth() == src.getDepth());
+#endif
+    for (BoxList<NDIM>::Iterator bl(boxes); bl; bl++)
+    {
+        const Box<NDIM> box = bl() * dst.getBox() * src.getBox();
+        for (int d = 0; d < dst.getDepth(); ++d)
+        {
+            for (Box<NDIM>::Iterator b(box); b; b++)
+            {
+                dst(b(), d) = static_cast<TDST>(src(b(), d));
+            }
+        }
+    }
+    return;
+} // copy_array_data
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -253,7 +336,11 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
       d_coarse_solver(NULL),
       d_coarse_solver_db(),
       d_patch_bc_box_overlap(),
-      d_patch_neighbor_overlap()
+      d_patch_neighbor_overlap(),
+      d_use_single_precision_smoother(false),
+      d_sp_error_idx(-1),
+      d_sp_residual_idx(-1),
+      d_patch_sp_sync_boxes()
 {
     // Set some default values.
     d_smoother_type = "PATCH_GAUSS_SEIDEL";
@@ -286,6 +373,8 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
         {
             d_coarse_solver_db = input_db->getDatabase("coarse_solver_db");
         }
+        if (input_db->keyExists("use_single_precision_smoother"))
+            d_use_single_precision_smoother = input_db->getBool("use_single_precision_smoother");
         if (input_db->isDatabase("bottom_solver"))
         {
             tbox::pout << "WARNING: ``bottom_solver'' input entry is no longer used by class "
@@ -306,6 +395,30 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
         }
     }
 
+    // Setup single precision scratch variables.
+    if (d_use_single_precision_smoother)
+    {
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<Variable<NDIM> > sp_error_var =
+            new CellVariable<NDIM, float>(object_name + "::sp_error", DEFAULT_DATA_DEPTH);
+        if (var_db->checkVariableExists(sp_error_var->getName()))
+        {
+            sp_error_var = var_db->getVariable(sp_error_var->getName());
+            d_sp_error_idx = var_db->mapVariableAndContextToIndex(sp_error_var, d_context);
+            var_db->removePatchDataIndex(d_sp_error_idx);
+        }
+        d_sp_error_idx = var_db->registerVariableAndContext(sp_error_var, d_context, d_gcw);
+        Pointer<Variable<NDIM> > sp_residual_var =
+            new CellVariable<NDIM, float>(object_name + "::sp_residual", DEFAULT_DATA_DEPTH);
+        if (var_db->checkVariableExists(sp_residual_var->getName()))
+        {
+            sp_residual_var = var_db->getVariable(sp_residual_var->getName());
+            d_sp_residual_idx = var_db->mapVariableAndContextToIndex(sp_residual_var, d_context);
+            var_db->removePatchDataIndex(d_sp_residual_idx);
+        }
+        d_sp_residual_idx = var_db->registerVariableAndContext(sp_residual_var, d_context, d_gcw);
+    }
+
     // Configure the coarse level solver.
     setCoarseSolverType(d_coarse_solver_type);
 
@@ -361,8 +474,8 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                                                  const SAMRAIVectorReal<NDIM, double>& residual,
                                                  int level_num,
                                                  int num_sweeps,
-                                                 bool /*performing_pre_sweeps*/,
-                                                 bool /*performing_post_sweeps*/)
+                                                 bool performing_pre_sweeps,
+                                                 bool performing_post_sweeps)
 {
     if (num_sweeps == 0) return;
 
@@ -371,6 +484,15 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     const int error_idx = error.getComponentDescriptorIndex(0);
     const int scratch_idx = d_scratch_idx;
+    const bool single_precision = d_use_single_precision_smoother;
+
+    // The residual on a level is not modified between the pre- and
+    // post-smoothing sweeps of a FAC cycle, so the single precision residual
+    // converted for the pre-sweeps is reused by the post-sweeps.
+    const int residual_idx = residual.getComponentDescriptorIndex(0);
+    const bool convert_residual =
+        single_precision && !(performing_post_sweeps && d_sp_residual_src_idx[level_num] == residual_idx);
+    if (single_precision) d_sp_residual_src_idx[level_num] = performing_pre_sweeps ? residual_idx : -1;
 
     // Determine the smoother type.
     const std::string& smoother_type_string = (level_num == d_coarsest_ln ? d_coarse_solver_type : d_smoother_type);
@@ -401,10 +523,46 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
         }
     }
 
+    // When smoothing in single precision, convert the error and residual data.
+    // Ghost cell values of the single precision error are set after they have
+    // been computed in double precision below.
+    if (single_precision)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            Pointer<CellData<NDIM, float> > sp_error_data = patch->getPatchData(d_sp_error_idx);
+            copy_array_data(sp_error_data->getArrayData(), error_data->getArrayData());
+            if (convert_residual)
+            {
+                Pointer<CellData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
+                Pointer<CellData<NDIM, float> > sp_residual_data = patch->getPatchData(d_sp_residual_idx);
+                copy_array_data(sp_residual_data->getArrayData(), residual_data->getArrayData());
+            }
+        }
+    }
+
     // Smooth the error by the specified number of sweeps.
     if (red_black_ordering) num_sweeps *= 2;
     for (int isweep = 0; isweep < num_sweeps; ++isweep)
     {
+        // Copy the updated single precision values that are needed to fill
+        // ghost cells back into the double precision error data.
+        if (single_precision && isweep > 0)
+        {
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+                Pointer<CellData<NDIM, float> > sp_error_data = patch->getPatchData(d_sp_error_idx);
+                copy_array_data(error_data->getArrayData(),
+                                sp_error_data->getArrayData(),
+                                d_patch_sp_sync_boxes[level_num][patch_counter]);
+            }
+        }
+
         // Re-fill ghost cell data as needed.
         if (level_num > d_coarsest_ln)
         {
@@ -449,6 +607,21 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             xeqScheduleGhostFillNoCoarse(error_idx, level_num);
         }
 
+        // Copy the ghost cell values into the single precision error data.
+        if (single_precision)
+        {
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+                Pointer<CellData<NDIM, float> > sp_error_data = patch->getPatchData(d_sp_error_idx);
+                copy_array_data(sp_error_data->getArrayData(),
+                                error_data->getArrayData(),
+                                d_patch_bc_box_overlap[level_num][patch_counter]);
+            }
+        }
+
         // Smooth the error on the patches.
         int patch_counter = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
@@ -456,12 +629,25 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
             Pointer<CellData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
+            Pointer<CellData<NDIM, float> > sp_error_data, sp_residual_data;
+            if (single_precision)
+            {
+                sp_error_data = patch->getPatchData(d_sp_error_idx);
+                sp_residual_data = patch->getPatchData(d_sp_residual_idx);
+            }
 #if !defined(NDEBUG)
             const Box<NDIM>& ghost_box = error_data->getGhostBox();
             TBOX_ASSERT(ghost_box == residual_data->getGhostBox());
             TBOX_ASSERT(error_data->getGhostCellWidth() == d_gcw);
             TBOX_ASSERT(residual_data->getGhostCellWidth() == d_gcw);
             TBOX_ASSERT(error_data->getDepth() == residual_data->getDepth());
+            if (single_precision)
+            {
+                TBOX_ASSERT(ghost_box == sp_error_data->getGhostBox());
+                TBOX_ASSERT(ghost_box == sp_residual_data->getGhostBox());
+                TBOX_ASSERT(error_data->getDepth() == sp_error_data->getDepth());
+                TBOX_ASSERT(error_data->getDepth() == sp_residual_data->getDepth());
+            }
 #endif
             const Box<NDIM>& patch_box = patch->getBox();
             const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
@@ -478,8 +664,17 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                     const int src_patch_num = cit->first;
                     const Box<NDIM>& overlap = cit->second;
                     Pointer<Patch<NDIM> > src_patch = level->getPatch(src_patch_num);
-                    Pointer<CellData<NDIM, double> > src_error_data = error.getComponentPatchData(0, *src_patch);
-                    error_data->getArrayData().copy(src_error_data->getArrayData(), overlap, IntVector<NDIM>(0));
+                    if (single_precision)
+                    {
+                        Pointer<CellData<NDIM, float> > src_sp_error_data = src_patch->getPatchData(d_sp_error_idx);
+                        sp_error_data->getArrayData().copy(
+                            src_sp_error_data->getArrayData(), overlap, IntVector<NDIM>(0));
+                    }
+                    else
+                    {
+                        Pointer<CellData<NDIM, double> > src_error_data = error.getComponentPatchData(0, *src_patch);
+                        error_data->getArrayData().copy(src_error_data->getArrayData(), overlap, IntVector<NDIM>(0));
+                    }
                 }
             }
 
@@ -494,51 +689,112 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             const double& beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
             for (int depth = 0; depth < error_data->getDepth(); ++depth)
             {
-                double* const U = error_data->getPointer(depth);
-                const int U_ghosts = (error_data->getGhostCellWidth()).max();
-                const double* const F = residual_data->getPointer(depth);
-                const int F_ghosts = (residual_data->getGhostCellWidth()).max();
-                if (red_black_ordering)
+                if (single_precision)
                 {
-                    int red_or_black = isweep % 2; // "red" = 0, "black" = 1
-                    RB_GS_SMOOTH_FC(U,
-                                    U_ghosts,
-                                    alpha,
-                                    beta,
-                                    F,
-                                    F_ghosts,
-                                    patch_box.lower(0),
-                                    patch_box.upper(0),
-                                    patch_box.lower(1),
-                                    patch_box.upper(1),
+                    float* const U = sp_error_data->getPointer(depth);
+                    const int U_ghosts = (sp_error_data->getGhostCellWidth()).max();
+                    const float* const F = sp_residual_data->getPointer(depth);
+                    const int F_ghosts = (sp_residual_data->getGhostCellWidth()).max();
+                    if (red_black_ordering)
+                    {
+                        int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                        RB_GS_SMOOTH_SP_FC(U,
+                                           U_ghosts,
+                                           alpha,
+                                           beta,
+                                           F,
+                                           F_ghosts,
+                                           patch_box.lower(0),
+                                           patch_box.upper(0),
+                                           patch_box.lower(1),
+                                           patch_box.upper(1),
 #if (NDIM == 3)
-                                    patch_box.lower(2),
-                                    patch_box.upper(2),
+                                           patch_box.lower(2),
+                                           patch_box.upper(2),
 #endif
-                                    dx,
-                                    red_or_black);
+                                           dx,
+                                           red_or_black);
+                    }
+                    else
+                    {
+                        GS_SMOOTH_SP_FC(U,
+                                        U_ghosts,
+                                        alpha,
+                                        beta,
+                                        F,
+                                        F_ghosts,
+                                        patch_box.lower(0),
+                                        patch_box.upper(0),
+                                        patch_box.lower(1),
+                                        patch_box.upper(1),
+#if (NDIM == 3)
+                                        patch_box.lower(2),
+                                        patch_box.upper(2),
+#endif
+                                        dx);
+                    }
                 }
                 else
                 {
-                    GS_SMOOTH_FC(U,
-                                 U_ghosts,
-                                 alpha,
-                                 beta,
-                                 F,
-                                 F_ghosts,
-                                 patch_box.lower(0),
-                                 patch_box.upper(0),
-                                 patch_box.lower(1),
-                                 patch_box.upper(1),
+                    double* const U = error_data->getPointer(depth);
+                    const int U_ghosts = (error_data->getGhostCellWidth()).max();
+                    const double* const F = residual_data->getPointer(depth);
+                    const int F_ghosts = (residual_data->getGhostCellWidth()).max();
+                    if (red_black_ordering)
+                    {
+                        int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                        RB_GS_SMOOTH_FC(U,
+                                        U_ghosts,
+                                        alpha,
+                                        beta,
+                                        F,
+                                        F_ghosts,
+                                        patch_box.lower(0),
+                                        patch_box.upper(0),
+                                        patch_box.lower(1),
+                                        patch_box.upper(1),
+#if (NDIM == 3)
+                                        patch_box.lower(2),
+                                        patch_box.upper(2),
+#endif
+                                        dx,
+                                        red_or_black);
+                    }
+                    else
+                    {
+                        GS_SMOOTH_FC(U,
+                                     U_ghosts,
+                                     alpha,
+                                     beta,
+                                     F,
+                                     F_ghosts,
+                                     patch_box.lower(0),
+                                     patch_box.upper(0),
+                                     patch_box.lower(1),
+                                     patch_box.upper(1),
 #if (NDIM == 3)
-                                 patch_box.lower(2),
-                                 patch_box.upper(2),
+                                     patch_box.lower(2),
+                                     patch_box.upper(2),
 #endif
-                                 dx);
+                                     dx);
+                    }
                 }
             }
         }
     }
+
+    // Copy the smoothed single precision error back into the double precision
+    // error data.
+    if (single_precision)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            Pointer<CellData<NDIM, float> > sp_error_data = patch->getPatchData(d_sp_error_idx);
+            copy_array_data(error_data->getArrayData(), sp_error_data->getArrayData());
+        }
+    }
     IBTK_TIMER_STOP(t_smooth_error);
     return;
 } // smoothError
@@ -689,6 +945,15 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
     Pointer<CellDataFactory<NDIM, double> > scratch_pdat_fac =
         var_db->getPatchDescriptor()->getPatchDataFactory(d_scratch_idx);
     scratch_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+    if (d_use_single_precision_smoother)
+    {
+        Pointer<CellDataFactory<NDIM, float> > sp_error_pdat_fac =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_sp_error_idx);
+        sp_error_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+        Pointer<CellDataFactory<NDIM, float> > sp_residual_pdat_fac =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_sp_residual_idx);
+        sp_residual_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+    }
 
     // Initialize the coarse level solvers when needed.
     if (coarsest_reset_ln == d_coarsest_ln && d_coarse_solver)
@@ -764,24 +1029,86 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
             }
         }
     }
+
+    // Allocate single precision smoother data and determine the layers of
+    // interior cells that must be synchronized between sweeps.
+    if (d_use_single_precision_smoother)
+    {
+        d_sp_residual_src_idx.assign(d_finest_ln + 1, -1);
+        d_patch_sp_sync_boxes.resize(d_finest_ln + 1);
+        for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (!level->checkAllocated(d_sp_error_idx)) level->allocatePatchData(d_sp_error_idx);
+            if (!level->checkAllocated(d_sp_residual_idx)) level->allocatePatchData(d_sp_residual_idx);
+            const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+            d_patch_sp_sync_boxes[ln].resize(num_local_patches);
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                d_patch_sp_sync_boxes[ln][patch_counter] = BoxList<NDIM>(patch_box);
+                d_patch_sp_sync_boxes[ln][patch_counter].removeIntersections(
+                    Box<NDIM>::grow(patch_box, -SP_SYNC_WIDTH));
+            }
+        }
+    }
     return;
 } // initializeOperatorStateSpecialized
 
 void
-CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int /*coarsest_reset_ln*/,
-                                                                        const int /*finest_reset_ln*/)
+CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int coarsest_reset_ln,
+                                                                        const int finest_reset_ln)
 {
     if (!d_is_initialized) return;
 
+    if (d_use_single_precision_smoother)
+    {
+        for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (level->checkAllocated(d_sp_error_idx)) level->deallocatePatchData(d_sp_error_idx);
+            if (level->checkAllocated(d_sp_residual_idx)) level->deallocatePatchData(d_sp_residual_idx);
+        }
+    }
+
     if (!d_in_initialize_operator_state)
     {
         d_patch_bc_box_overlap.clear();
         d_patch_neighbor_overlap.clear();
+        d_patch_sp_sync_boxes.clear();
+        d_sp_residual_src_idx.clear();
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
     }
     return;
 } // deallocateOperatorStateSpecialized
 
+bool
+CCPoissonPointRelaxationFACOperator::updateOperatorCoefficientsSpecialized()
+{
+    const bool constant_coefficients =
+        (d_poisson_spec.cIsZero() || d_poisson_spec.cIsConstant()) && d_poisson_spec.dIsConstant();
+    if (!constant_coefficients) return false;
+
+    // Update the coarse level solver, reinitializing it only when it does not
+    // support coefficient updates.
+    if (d_coarse_solver)
+    {
+        d_coarse_solver->setSolutionTime(d_solution_time);
+        d_coarse_solver->setTimeInterval(d_current_time, d_new_time);
+        d_coarse_solver->setPoissonSpecifications(d_poisson_spec);
+        d_coarse_solver->setPhysicalBcCoefs(d_bc_coefs);
+        d_coarse_solver->setHomogeneousBc(true);
+        if (!d_coarse_solver->updateCoefficients())
+        {
+            d_coarse_solver->initializeSolverState(*getLevelSAMRAIVectorReal(*d_solution, d_coarsest_ln),
+                                                   *getLevelSAMRAIVectorReal(*d_rhs, d_coarsest_ln));
+        }
+    }
+    return true;
+} // updateOperatorCoefficientsSpecialized
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
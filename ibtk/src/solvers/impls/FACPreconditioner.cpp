@@ -248,6 +248,13 @@ FACPreconditioner::deallocateSolverState()
     return;
 } // deallocateSolverState
 
+bool
+FACPreconditioner::updateCoefficients()
+{
+    if (!d_is_initialized) return false;
+    return d_fac_strategy->updateOperatorCoefficients();
+} // updateCoefficients
+
 void
 FACPreconditioner::setInitialGuessNonzero(bool initial_guess_nonzero)
 {
@@ -0,0 +1,294 @@
+// Filename: PETScInitialGuessProjector.cpp
+// Created on 27 Nov 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "ibtk/IBTK_CHKERRQ.h"
+#include "ibtk/PETScInitialGuessProjector.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "petscksp.h"
+#include "petscmat.h"
+#include "petscvec.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Relative tolerance used to detect (numerically) linearly dependent
+// directions.
+static const double DEPENDENCE_TOL = 1.0e-8;
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PETScInitialGuessProjector::PETScInitialGuessProjector(const std::string& object_name,
+                                         const int max_dim,
+                                         const bool recompute_images)
+    : d_object_name(object_name),
+      d_max_dim(max_dim),
+      d_recompute_images(recompute_images),
+      d_U(),
+      d_C(),
+      d_x0(NULL),
+      d_r(NULL),
+      d_initial_guess_nonzero(PETSC_FALSE)
+{
+    if (d_max_dim < 0)
+    {
+        TBOX_ERROR(d_object_name << "::PETScInitialGuessProjector():\n"
+                                 << "  projection space dimension must be nonnegative"
+                                 << std::endl);
+    }
+    return;
+} // PETScInitialGuessProjector
+
+PETScInitialGuessProjector::~PETScInitialGuessProjector()
+{
+    reset();
+    return;
+} // ~PETScInitialGuessProjector
+
+void
+PETScInitialGuessProjector::preSolve(KSP petsc_ksp, Vec b, Vec x)
+{
+    if (d_max_dim == 0) return;
+
+    int ierr;
+    ierr = KSPGetInitialGuessNonzero(petsc_ksp, &d_initial_guess_nonzero);
+    IBTK_CHKERRQ(ierr);
+    if (!d_x0)
+    {
+        ierr = VecDuplicate(x, &d_x0);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDuplicate(x, &d_r);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (!d_initial_guess_nonzero)
+    {
+        ierr = VecSet(x, 0.0);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    if (!d_U.empty())
+    {
+        Mat A;
+        ierr = KSPGetOperators(petsc_ksp, &A, NULL);
+        IBTK_CHKERRQ(ierr);
+
+        // Recompute C = A U when the operator may have changed since the
+        // projection space was constructed.
+        if (d_recompute_images)
+        {
+            unsigned int k = 0;
+            while (k < d_U.size())
+            {
+                ierr = MatMult(A, d_U[k], d_C[k]);
+                IBTK_CHKERRQ(ierr);
+                double c_norm;
+                ierr = VecNorm(d_C[k], NORM_2, &c_norm);
+                IBTK_CHKERRQ(ierr);
+                if (c_norm == 0.0 || orthonormalize(d_U[k], d_C[k], k) <= DEPENDENCE_TOL * c_norm)
+                {
+                    ierr = VecDestroy(&d_U[k]);
+                    IBTK_CHKERRQ(ierr);
+                    ierr = VecDestroy(&d_C[k]);
+                    IBTK_CHKERRQ(ierr);
+                    d_U.erase(d_U.begin() + k);
+                    d_C.erase(d_C.begin() + k);
+                }
+                else
+                {
+                    ++k;
+                }
+            }
+        }
+
+        // Compute the initial residual r = b - A x.
+        if (d_initial_guess_nonzero)
+        {
+            ierr = MatMult(A, x, d_r);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecAYPX(d_r, -1.0, b);
+            IBTK_CHKERRQ(ierr);
+        }
+        else
+        {
+            ierr = VecCopy(b, d_r);
+            IBTK_CHKERRQ(ierr);
+        }
+
+        // Minimize the residual over x + range(U): because the columns of C
+        // are orthonormal, x := x + U C^T r.
+        const int n = static_cast<int>(d_U.size());
+        if (n > 0)
+        {
+            std::vector<PetscScalar> alpha(n);
+            ierr = VecMDot(d_r, n, &d_C[0], &alpha[0]);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecMAXPY(x, n, &alpha[0], &d_U[0]);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
+    ierr = VecCopy(x, d_x0);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetInitialGuessNonzero(petsc_ksp, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // preSolve
+
+void
+PETScInitialGuessProjector::postSolve(KSP petsc_ksp, Vec x)
+{
+    if (d_max_dim == 0 || !d_x0) return;
+
+    int ierr;
+    ierr = KSPSetInitialGuessNonzero(petsc_ksp, d_initial_guess_nonzero);
+    IBTK_CHKERRQ(ierr);
+
+    // The new direction is the correction computed by the Krylov method.
+    Mat A;
+    ierr = KSPGetOperators(petsc_ksp, &A, NULL);
+    IBTK_CHKERRQ(ierr);
+    Vec u, c;
+    ierr = VecDuplicate(x, &u);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDuplicate(x, &c);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecWAXPY(u, -1.0, d_x0, x);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatMult(A, u, c);
+    IBTK_CHKERRQ(ierr);
+    double c_norm;
+    ierr = VecNorm(c, NORM_2, &c_norm);
+    IBTK_CHKERRQ(ierr);
+    if (c_norm == 0.0 || orthonormalize(u, c, static_cast<unsigned int>(d_C.size())) <= DEPENDENCE_TOL * c_norm)
+    {
+        ierr = VecDestroy(&u);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&c);
+        IBTK_CHKERRQ(ierr);
+        return;
+    }
+
+    // Discard the oldest direction once the maximum dimension is reached.
+    if (static_cast<int>(d_U.size()) == d_max_dim)
+    {
+        ierr = VecDestroy(&d_U.front());
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&d_C.front());
+        IBTK_CHKERRQ(ierr);
+        d_U.erase(d_U.begin());
+        d_C.erase(d_C.begin());
+    }
+    d_U.push_back(u);
+    d_C.push_back(c);
+    return;
+} // postSolve
+
+void
+PETScInitialGuessProjector::reset()
+{
+    int ierr;
+    for (unsigned int k = 0; k < d_U.size(); ++k)
+    {
+        ierr = VecDestroy(&d_U[k]);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&d_C[k]);
+        IBTK_CHKERRQ(ierr);
+    }
+    d_U.clear();
+    d_C.clear();
+    ierr = VecDestroy(&d_x0);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&d_r);
+    IBTK_CHKERRQ(ierr);
+    d_x0 = NULL;
+    d_r = NULL;
+    return;
+} // reset
+
+int
+PETScInitialGuessProjector::getDimension() const
+{
+    return static_cast<int>(d_U.size());
+} // getDimension
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+double
+PETScInitialGuessProjector::orthonormalize(Vec u, Vec c, const unsigned int num_cols)
+{
+    int ierr;
+
+    // Use two passes of modified Gram-Schmidt orthogonalization.
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (unsigned int j = 0; j < num_cols; ++j)
+        {
+            PetscScalar h;
+            ierr = VecDot(c, d_C[j], &h);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecAXPY(c, -h, d_C[j]);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecAXPY(u, -h, d_U[j]);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    double c_norm;
+    ierr = VecNorm(c, NORM_2, &c_norm);
+    IBTK_CHKERRQ(ierr);
+    if (c_norm > 0.0)
+    {
+        ierr = VecScale(c, 1.0 / c_norm);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScale(u, 1.0 / c_norm);
+        IBTK_CHKERRQ(ierr);
+    }
+    return c_norm;
+} // orthonormalize
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
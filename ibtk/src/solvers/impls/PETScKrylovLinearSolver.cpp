@@ -53,6 +53,7 @@
 #include "ibtk/PETScMatLOWrapper.h"
 #include "ibtk/PETScPCLSWrapper.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
+#include "ibtk/TelemetryManager.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "mpi.h"
@@ -82,6 +83,9 @@ namespace
 static Timer* t_solve_system;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
+
+// Telemetry counters.
+static int c_num_iterations;
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -92,6 +96,10 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
                                                  MPI_Comm petsc_comm)
     : d_ksp_type(KSPGMRES),
       d_reinitializing_solver(false),
+      d_use_packed_work_vectors(false),
+      d_guess_projection_dim(0),
+      d_guess_projection_recompute_images(false),
+      d_guess_projector(NULL),
       d_petsc_x(NULL),
       d_petsc_b(NULL),
       d_options_prefix(default_options_prefix),
@@ -128,6 +136,19 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+        if (input_db->keyExists("use_packed_work_vectors"))
+            d_use_packed_work_vectors = input_db->getBool("use_packed_work_vectors");
+        if (input_db->keyExists("guess_projection_dim"))
+            d_guess_projection_dim = input_db->getInteger("guess_projection_dim");
+        if (input_db->keyExists("guess_projection_recompute_images"))
+            d_guess_projection_recompute_images = input_db->getBool("guess_projection_recompute_images");
+    }
+
+    // Setup the initial guess projection.
+    if (d_guess_projection_dim > 0)
+    {
+        d_guess_projector = new PETScInitialGuessProjector(
+            d_object_name + "::guess_projector", d_guess_projection_dim, d_guess_projection_recompute_images);
     }
 
     // Common constructor functionality.
@@ -138,6 +159,10 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name,
 PETScKrylovLinearSolver::PETScKrylovLinearSolver(const std::string& object_name, const KSP& petsc_ksp)
     : d_ksp_type("none"),
       d_reinitializing_solver(false),
+      d_use_packed_work_vectors(false),
+      d_guess_projection_dim(0),
+      d_guess_projection_recompute_images(false),
+      d_guess_projector(NULL),
       d_petsc_x(NULL),
       d_petsc_b(NULL),
       d_options_prefix(""),
@@ -257,14 +282,17 @@ PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVe
     d_A->setHomogeneousBc(true);
     PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_x, Pointer<SAMRAIVectorReal<NDIM, double> >(&x, false));
     PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_b, d_b);
+    if (d_guess_projector) d_guess_projector->preSolve(d_petsc_ksp, d_petsc_b, d_petsc_x);
     ierr = KSPSolve(d_petsc_ksp, d_petsc_b, d_petsc_x);
     IBTK_CHKERRQ(ierr);
+    if (d_guess_projector) d_guess_projector->postSolve(d_petsc_ksp, d_petsc_x);
     d_A->setHomogeneousBc(d_homogeneous_bc);
     d_A->imposeSolBcs(x);
 
     // Get iterations count and residual norm.
     ierr = KSPGetIterationNumber(d_petsc_ksp, &d_current_iterations);
     IBTK_CHKERRQ(ierr);
+    IBTK_TELEMETRY_INCREMENT(c_num_iterations, d_current_iterations);
     ierr = KSPGetResidualNorm(d_petsc_ksp, &d_current_residual_norm);
     IBTK_CHKERRQ(ierr);
     d_A->setHomogeneousBc(d_homogeneous_bc);
@@ -375,10 +403,10 @@ PETScKrylovLinearSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, doub
 
     // Setup solution and rhs vectors.
     d_x = x.cloneVector(x.getName());
-    d_petsc_x = PETScSAMRAIVectorReal::createPETScVector(d_x, d_petsc_comm);
+    d_petsc_x = PETScSAMRAIVectorReal::createPETScVector(d_x, d_petsc_comm, d_use_packed_work_vectors);
 
     d_b = b.cloneVector(b.getName());
-    d_petsc_b = PETScSAMRAIVectorReal::createPETScVector(d_b, d_petsc_comm);
+    d_petsc_b = PETScSAMRAIVectorReal::createPETScVector(d_b, d_petsc_comm, d_use_packed_work_vectors);
 
     // Initialize the linear operator and preconditioner objects.
     if (d_A) d_A->initializeOperatorState(*d_x, *d_b);
@@ -437,6 +465,9 @@ PETScKrylovLinearSolver::deallocateSolverState()
         if (d_A) d_A->deallocateOperatorState();
     }
 
+    // Discard the initial guess projection space.
+    if (d_guess_projector) d_guess_projector->reset();
+
     // Delete the solution and rhs vectors.
     PETScSAMRAIVectorReal::destroyPETScVector(d_petsc_x);
     d_petsc_x = NULL;
@@ -467,6 +498,14 @@ PETScKrylovLinearSolver::deallocateSolverState()
     return;
 } // deallocateSolverState
 
+bool
+PETScKrylovLinearSolver::updateCoefficients()
+{
+    if (!d_is_initialized) return false;
+    if (d_pc_solver) return d_pc_solver->updateCoefficients();
+    return true;
+} // updateCoefficients
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
@@ -478,6 +517,10 @@ PETScKrylovLinearSolver::common_ctor()
                      TimerManager::getManager()->getTimer("IBTK::PETScKrylovLinearSolver::initializeSolverState()");
                  t_deallocate_solver_state =
                      TimerManager::getManager()->getTimer("IBTK::PETScKrylovLinearSolver::deallocateSolverState()"););
+
+    // Setup telemetry counters.
+    IBTK_DO_ONCE(c_num_iterations = TelemetryManager::getManager()->registerCounter(
+                     "IBTK::PETScKrylovLinearSolver::solveSystem()[iterations]"););
     return;
 } // common_ctor
 
@@ -72,6 +72,7 @@ namespace
 static Timer* t_solve_system;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
+static Timer* t_update_coefficients;
 
 void
 generate_petsc_is_from_std_is(std::vector<std::set<int> >& overlap_std,
@@ -155,7 +156,9 @@ PETScLevelSolver::PETScLevelSolver()
                  t_initialize_solver_state =
                      TimerManager::getManager()->getTimer("IBTK::PETScLevelSolver::initializeSolverState()");
                  t_deallocate_solver_state =
-                     TimerManager::getManager()->getTimer("IBTK::PETScLevelSolver::deallocateSolverState()"););
+                     TimerManager::getManager()->getTimer("IBTK::PETScLevelSolver::deallocateSolverState()");
+                 t_update_coefficients =
+                     TimerManager::getManager()->getTimer("IBTK::PETScLevelSolver::updateCoefficients()"););
     return;
 } // PETScLevelSolver
 
@@ -761,6 +764,93 @@ PETScLevelSolver::deallocateSolverState()
     return;
 } // deallocateSolverState
 
+bool
+PETScLevelSolver::updateCoefficients()
+{
+    if (!d_is_initialized) return false;
+
+    IBTK_TIMER_START(t_update_coefficients);
+
+    // Perform specialized operations to update the matrix values.
+    if (!updateCoefficientsSpecialized())
+    {
+        IBTK_TIMER_STOP(t_update_coefficients);
+        return false;
+    }
+
+    // Update the subdomain matrices and solvers for the shell preconditioner.
+    int ierr;
+    if (d_pc_type == "shell")
+    {
+        if (d_n_local_subdomains > 0)
+        {
+#if PETSC_VERSION_GE(3,8,0)
+            ierr = MatCreateSubMatrices(
+                d_petsc_mat, d_n_local_subdomains, &d_overlap_is[0], &d_overlap_is[0], MAT_REUSE_MATRIX, &d_sub_mat);
+#else
+            ierr = MatGetSubMatrices(
+                d_petsc_mat, d_n_local_subdomains, &d_overlap_is[0], &d_overlap_is[0], MAT_REUSE_MATRIX, &d_sub_mat);
+#endif
+            IBTK_CHKERRQ(ierr);
+        }
+        if (d_shell_pc_type == "multiplicative" && d_n_local_subdomains > 0)
+        {
+            PetscInt n_lo, n_hi;
+            ierr = VecGetOwnershipRange(d_petsc_x, &n_lo, &n_hi);
+            IBTK_CHKERRQ(ierr);
+            IS local_idx;
+            ierr = ISCreateStride(PETSC_COMM_WORLD, n_hi - n_lo, n_lo, 1, &local_idx);
+            IBTK_CHKERRQ(ierr);
+            std::vector<IS> local_idxs(d_n_local_subdomains, local_idx);
+#if PETSC_VERSION_GE(3,8,0)
+            ierr = MatCreateSubMatrices(
+                d_petsc_mat, d_n_local_subdomains, &d_overlap_is[0], &local_idxs[0], MAT_REUSE_MATRIX, &d_sub_bc_mat);
+#else
+            ierr = MatGetSubMatrices(
+                d_petsc_mat, d_n_local_subdomains, &d_overlap_is[0], &local_idxs[0], MAT_REUSE_MATRIX, &d_sub_bc_mat);
+#endif
+            IBTK_CHKERRQ(ierr);
+            for (int i = 0; i < d_n_local_subdomains; ++i)
+            {
+                ierr = MatScale(d_sub_bc_mat[i], -1.0);
+                IBTK_CHKERRQ(ierr);
+            }
+            ierr = ISDestroy(&local_idx);
+            IBTK_CHKERRQ(ierr);
+        }
+
+        // NOTE: The subdomain KSPs are configured to reuse their
+        // preconditioners, so we temporarily disable reuse to force the
+        // (numeric) factorizations to be recomputed.
+        for (int i = 0; i < d_n_local_subdomains; ++i)
+        {
+            ierr = KSPSetOperators(d_sub_ksp[i], d_sub_mat[i], d_sub_mat[i]);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetReusePreconditioner(d_sub_ksp[i], PETSC_FALSE);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetUp(d_sub_ksp[i]);
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetReusePreconditioner(d_sub_ksp[i], PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
+    // Set up the preconditioner again.  Because the nonzero structure of the
+    // matrix is unchanged, PETSc preconditioners reuse their symbolic data
+    // (e.g., ASM subdomains and symbolic factorizations).
+    ierr = KSPSetOperators(d_petsc_ksp, d_petsc_mat, d_petsc_pc);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetReusePreconditioner(d_petsc_ksp, PETSC_FALSE);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetUp(d_petsc_ksp);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetReusePreconditioner(d_petsc_ksp, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+
+    IBTK_TIMER_STOP(t_update_coefficients);
+    return true;
+} // updateCoefficients
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void
@@ -806,6 +896,12 @@ PETScLevelSolver::generateFieldSplitSubdomains(std::vector<std::string>& /*field
     return;
 } // generateFieldSplitSubdomains
 
+bool
+PETScLevelSolver::updateCoefficientsSpecialized()
+{
+    return false;
+} // updateCoefficientsSpecialized
+
 void
 PETScLevelSolver::setupNullspace()
 {
@@ -418,6 +418,10 @@ PoissonFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVectorReal
     TBOX_ASSERT(d_cf_bdry_op);
 #endif
 
+    // Discard any boundary condition coefficients cached for a previous
+    // hierarchy configuration.
+    d_bc_op->clearBcCoefCache();
+
     // Setup level operators.
     d_level_data_ops.resize(d_finest_ln + 1);
     d_level_bdry_fill_ops.resize(d_finest_ln + 1, NULL);
@@ -577,8 +581,21 @@ PoissonFACPreconditionerStrategy::deallocateOperatorState()
     return;
 } // deallocateOperatorState
 
+bool
+PoissonFACPreconditionerStrategy::updateOperatorCoefficients()
+{
+    if (!d_is_initialized) return false;
+    return updateOperatorCoefficientsSpecialized();
+} // updateOperatorCoefficients
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+bool
+PoissonFACPreconditionerStrategy::updateOperatorCoefficientsSpecialized()
+{
+    return false;
+} // updateOperatorCoefficientsSpecialized
+
 void
 PoissonFACPreconditionerStrategy::xeqScheduleProlongation(const int dst_idx, const int src_idx, const int dst_ln)
 {
@@ -41,6 +41,7 @@
 #include "PoissonSpecifications.h"
 #include "RobinBcCoefStrategy.h"
 #include "ibtk/PoissonSolver.h"
+#include "ibtk/SolutionHistoryInitialGuess.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
@@ -53,7 +54,7 @@ namespace IBTK
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
-PoissonSolver::PoissonSolver() : d_poisson_spec(""), d_default_bc_coef(NULL), d_bc_coefs()
+PoissonSolver::PoissonSolver() : d_poisson_spec(""), d_default_bc_coef(NULL), d_bc_coefs(), d_initial_guess(NULL)
 {
     // intentionally blank
     return;
@@ -98,6 +99,19 @@ PoissonSolver::setPhysicalBcCoefs(const std::vector<RobinBcCoefStrategy<NDIM>*>&
     return;
 } // setPhysicalBcCoefs
 
+void
+PoissonSolver::setInitialGuessEngine(Pointer<SolutionHistoryInitialGuess> initial_guess)
+{
+    d_initial_guess = initial_guess;
+    return;
+} // setInitialGuessEngine
+
+Pointer<SolutionHistoryInitialGuess>
+PoissonSolver::getInitialGuessEngine() const
+{
+    return d_initial_guess;
+} // getInitialGuessEngine
+
 void
 PoissonSolver::initSpecialized(const std::string& object_name, const bool /*homogeneous_bc*/)
 {
@@ -79,6 +79,7 @@ static Timer* t_solve_system;
 static Timer* t_solve_system_hypre;
 static Timer* t_initialize_solver_state;
 static Timer* t_deallocate_solver_state;
+static Timer* t_update_coefficients;
 
 // hypre solver options.
 enum HypreSStructRelaxType
@@ -172,7 +173,9 @@ SCPoissonHypreLevelSolver::SCPoissonHypreLevelSolver(const std::string& object_n
                  t_initialize_solver_state =
                      TimerManager::getManager()->getTimer("IBTK::SCPoissonHypreLevelSolver::initializeSolverState()");
                  t_deallocate_solver_state =
-                     TimerManager::getManager()->getTimer("IBTK::SCPoissonHypreLevelSolver::deallocateSolverState()"););
+                     TimerManager::getManager()->getTimer("IBTK::SCPoissonHypreLevelSolver::deallocateSolverState()");
+                 t_update_coefficients =
+                     TimerManager::getManager()->getTimer("IBTK::SCPoissonHypreLevelSolver::updateCoefficients()"););
     return;
 } // SCPoissonHypreLevelSolver
 
@@ -315,6 +318,22 @@ SCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
     return;
 } // initializeSolverState
 
+bool
+SCPoissonHypreLevelSolver::updateCoefficients()
+{
+    if (!d_is_initialized) return false;
+
+    IBTK_TIMER_START(t_update_coefficients);
+
+    // Reset the matrix values on the existing grid and redo the solver setup.
+    destroyHypreSolver();
+    setMatrixCoefficients();
+    setupHypreSolver();
+
+    IBTK_TIMER_STOP(t_update_coefficients);
+    return true;
+} // updateCoefficients
+
 void
 SCPoissonHypreLevelSolver::deallocateSolverState()
 {
@@ -434,28 +453,26 @@ SCPoissonHypreLevelSolver::setMatrixCoefficients()
             matrix_coefs, patch, d_stencil_offsets, d_poisson_spec, d_bc_coefs, d_solution_time);
 
         // Copy matrix entries to the hypre matrix structure.
-        std::vector<int> stencil_indices(stencil_sz);
-        for (int i = 0; i < stencil_sz; ++i)
-        {
-            stencil_indices[i] = i;
-        }
-        std::vector<double> mat_vals(stencil_sz, 0.0);
+        //
+        // NOTE: Because matrix_coefs has no ghost cells, each depth of the
+        // patch data is a contiguous array over the side box that is ordered
+        // in the same way as hypre box values, so that each stencil entry can
+        // be set with a single call.
         for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
+            // NOTE: In SAMRAI, face-centered values are associated with the
+            // cell index located on the "upper" side of the face, but in hypre,
+            // face-centered values are associated with the cell index located
+            // on the "lower" side of the face.
             Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-            for (Box<NDIM>::Iterator b(side_box); b; b++)
+            Index<NDIM> lower = side_box.lower();
+            Index<NDIM> upper = side_box.upper();
+            lower(axis) -= 1;
+            upper(axis) -= 1;
+            for (int k = 0; k < stencil_sz; ++k)
             {
-                SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
-                for (int k = 0; k < stencil_sz; ++k)
-                {
-                    mat_vals[k] = matrix_coefs(i, k);
-                }
-                // NOTE: In SAMRAI, face-centered values are associated with the
-                // cell index located on the "upper" side of the face, but in
-                // hypre, face-centered values are associated with the cell
-                // index located on the "lower" side of the face.
-                i(axis) -= 1;
-                HYPRE_SStructMatrixSetValues(d_matrix, PART, i, axis, stencil_sz, &stencil_indices[0], &mat_vals[0]);
+                HYPRE_SStructMatrixSetBoxValues(
+                    d_matrix, PART, lower, upper, axis, 1, &k, matrix_coefs.getPointer(axis, k));
             }
         }
     }
@@ -168,6 +168,20 @@ SCPoissonPETScLevelSolver::deallocateSolverStateSpecialized()
     return;
 } // deallocateSolverStateSpecialized
 
+bool
+SCPoissonPETScLevelSolver::updateCoefficientsSpecialized()
+{
+    PETScMatUtilities::constructPatchLevelSCLaplaceOp(d_petsc_mat,
+                                                      d_poisson_spec,
+                                                      d_bc_coefs,
+                                                      d_solution_time,
+                                                      d_num_dofs_per_proc,
+                                                      d_dof_index_idx,
+                                                      d_level,
+                                                      /*reuse_nonzero_structure*/ true);
+    return true;
+} // updateCoefficientsSpecialized
+
 void
 SCPoissonPETScLevelSolver::copyToPETScVec(Vec& petsc_x, SAMRAIVectorReal<NDIM, double>& x)
 {
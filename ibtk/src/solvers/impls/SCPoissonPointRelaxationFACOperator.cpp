@@ -98,12 +98,20 @@
 #define GS_SMOOTH_MASK_FC IBTK_FC_FUNC(gssmoothmask2d, GSSMOOTHMASK2D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth2d, RBGSSMOOTH2D)
 #define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask2d, RBGSSMOOTHMASK2D)
+#define GS_SMOOTH_SP_FC IBTK_FC_FUNC(gssmoothsp2d, GSSMOOTHSP2D)
+#define GS_SMOOTH_MASK_SP_FC IBTK_FC_FUNC(gssmoothmasksp2d, GSSMOOTHMASKSP2D)
+#define RB_GS_SMOOTH_SP_FC IBTK_FC_FUNC(rbgssmoothsp2d, RBGSSMOOTHSP2D)
+#define RB_GS_SMOOTH_MASK_SP_FC IBTK_FC_FUNC(rbgssmoothmasksp2d, RBGSSMOOTHMASKSP2D)
 #endif
 #if (NDIM == 3)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth3d, GSSMOOTH3D)
 #define GS_SMOOTH_MASK_FC IBTK_FC_FUNC(gssmoothmask3d, GSSMOOTHMASK3D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth3d, RBGSSMOOTH3D)
 #define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask3d, RBGSSMOOTHMASK3D)
+#define GS_SMOOTH_SP_FC IBTK_FC_FUNC(gssmoothsp3d, GSSMOOTHSP3D)
+#define GS_SMOOTH_MASK_SP_FC IBTK_FC_FUNC(gssmoothmasksp3d, GSSMOOTHMASKSP3D)
+#define RB_GS_SMOOTH_SP_FC IBTK_FC_FUNC(rbgssmoothsp3d, RBGSSMOOTHSP3D)
+#define RB_GS_SMOOTH_MASK_SP_FC IBTK_FC_FUNC(rbgssmoothmasksp3d, RBGSSMOOTHMASKSP3D)
 #endif
 
 // Function interfaces
@@ -177,6 +185,76 @@ void RB_GS_SMOOTH_MASK_FC(double* U,
 #endif
                           const double* dx,
                           const int& red_or_black);
+
+void GS_SMOOTH_SP_FC(float* U,
+                     const int& U_gcw,
+                     const double& alpha,
+                     const double& beta,
+                     const float* F,
+                     const int& F_gcw,
+                     const int& ilower0,
+                     const int& iupper0,
+                     const int& ilower1,
+                     const int& iupper1,
+#if (NDIM == 3)
+                     const int& ilower2,
+                     const int& iupper2,
+#endif
+                     const double* dx);
+
+void GS_SMOOTH_MASK_SP_FC(float* U,
+                          const int& U_gcw,
+                          const double& alpha,
+                          const double& beta,
+                          const float* F,
+                          const int& F_gcw,
+                          const int* mask,
+                          const int& mask_gcw,
+                          const int& ilower0,
+                          const int& iupper0,
+                          const int& ilower1,
+                          const int& iupper1,
+#if (NDIM == 3)
+                          const int& ilower2,
+                          const int& iupper2,
+#endif
+                          const double* dx);
+
+void RB_GS_SMOOTH_SP_FC(float* U,
+                        const int& U_gcw,
+                        const double& alpha,
+                        const double& beta,
+                        const float* F,
+                        const int& F_gcw,
+                        const int& ilower0,
+                        const int& iupper0,
+                        const int& ilower1,
+                        const int& iupper1,
+#if (NDIM == 3)
+                        const int& ilower2,
+                        const int& iupper2,
+#endif
+                        const double* dx,
+                        const int& red_or_black);
+
+void RB_GS_SMOOTH_MASK_SP_FC(float* U,
+                             const int& U_gcw,
+                             const double& alpha,
+                             const double& beta,
+                             const float* F,
+                             const int& F_gcw,
+                             const int* mask,
+                             const int& mask_gcw,
+                             const int& ilower0,
+                             const int& iupper0,
+                             const int& ilower1,
+                             const int& iupper1,
+#if (NDIM == 3)
+                             const int& ilower2,
+                             const int& iupper2,
+#endif
+                             const double* dx,
+                             const int& red_or_black);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -198,6 +276,11 @@ static const int DEFAULT_DATA_DEPTH = 1;
 // Number of ghosts cells used for each variable quantity.
 static const int SIDEG = 1;
 
+// Number of interior layers of side indices adjacent to each patch boundary
+// that are copied from single to double precision before ghost cell values are
+// refilled during single precision smoothing.
+static const int SP_SYNC_WIDTH = 3;
+
 // Types of refining and coarsening to perform prior to setting coarse-fine
 // boundary and physical boundary ghost cell values.
 static const std::string DATA_REFINE_TYPE = "NONE";
@@ -256,6 +339,45 @@ do_local_data_update(SmootherType smoother_type)
         return false;
     }
 } // do_local_data_update
+
+template <class TDST, class TSRC>
+inline void
+copy_array_data(ArrayData<NDIM, TDST>& dst, const ArrayData<NDIM, TSRC>& src)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst.getBox() == src.getBox());
+    TBOX_ASSERT(dst.getDepth() == src.getDepth());
+#endif
+    const int n = dst.getDepth() * dst.getBox().size();
+    TDST* const dst_vals = dst.getPointer();
+    const TSRC* const src_vals = src.getPointer();
+    for (int k = 0; k < n; ++k)
+    {
+        dst_vals[k] = static_cast<TDST>(src_vals[k]);
+    }
+    return;
+} // copy_array_data
+
+template <class TDST, class TSRC>
+inline void
+copy_array_data(ArrayData<NDIM, TDST>& dst, const ArrayData<NDIM, TSRC>& src, const BoxList<NDIM>& boxes)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst.getDepth() == src.getDepth());
+#endif
+    for (BoxList<NDIM>::Iterator bl(boxes); bl; bl++)
+    {
+        const Box<NDIM> box = bl() * dst.getBox() * src.getBox();
+        for (int d = 0; d < dst.getDepth(); ++d)
+        {
+            for (Box<NDIM>::Iterator b(box); b; b++)
+            {
+                dst(b(), d) = static_cast<TDST>(src(b(), d));
+            }
+        }
+    }
+    return;
+} // copy_array_data
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -272,7 +394,11 @@ SCPoissonPointRelaxationFACOperator::SCPoissonPointRelaxationFACOperator(const s
       d_coarse_solver(NULL),
       d_coarse_solver_db(),
       d_patch_bc_box_overlap(),
-      d_patch_neighbor_overlap()
+      d_patch_neighbor_overlap(),
+      d_use_single_precision_smoother(false),
+      d_sp_error_idx(-1),
+      d_sp_residual_idx(-1),
+      d_patch_sp_sync_boxes()
 {
     // Set some default values.
     d_smoother_type = "PATCH_GAUSS_SEIDEL";
@@ -304,6 +430,8 @@ SCPoissonPointRelaxationFACOperator::SCPoissonPointRelaxationFACOperator(const s
         {
             d_coarse_solver_db = input_db->getDatabase("coarse_solver_db");
         }
+        if (input_db->keyExists("use_single_precision_smoother"))
+            d_use_single_precision_smoother = input_db->getBool("use_single_precision_smoother");
         if (input_db->isDatabase("bottom_solver"))
         {
             tbox::pout << "WARNING: ``bottom_solver'' input entry is no longer used by class "
@@ -339,6 +467,29 @@ SCPoissonPointRelaxationFACOperator::SCPoissonPointRelaxationFACOperator(const s
     IntVector<NDIM> no_ghosts = 0;
     d_mask_idx = var_db->registerVariableAndContext(mask_var, d_context, no_ghosts);
 
+    // Setup single precision scratch variables.
+    if (d_use_single_precision_smoother)
+    {
+        Pointer<Variable<NDIM> > sp_error_var =
+            new SideVariable<NDIM, float>(object_name + "::sp_error", DEFAULT_DATA_DEPTH);
+        if (var_db->checkVariableExists(sp_error_var->getName()))
+        {
+            sp_error_var = var_db->getVariable(sp_error_var->getName());
+            d_sp_error_idx = var_db->mapVariableAndContextToIndex(sp_error_var, d_context);
+            var_db->removePatchDataIndex(d_sp_error_idx);
+        }
+        d_sp_error_idx = var_db->registerVariableAndContext(sp_error_var, d_context, d_gcw);
+        Pointer<Variable<NDIM> > sp_residual_var =
+            new SideVariable<NDIM, float>(object_name + "::sp_residual", DEFAULT_DATA_DEPTH);
+        if (var_db->checkVariableExists(sp_residual_var->getName()))
+        {
+            sp_residual_var = var_db->getVariable(sp_residual_var->getName());
+            d_sp_residual_idx = var_db->mapVariableAndContextToIndex(sp_residual_var, d_context);
+            var_db->removePatchDataIndex(d_sp_residual_idx);
+        }
+        d_sp_residual_idx = var_db->registerVariableAndContext(sp_residual_var, d_context, d_gcw);
+    }
+
     // Setup Timers.
     IBTK_DO_ONCE(t_smooth_error =
                      TimerManager::getManager()->getTimer("IBTK::SCPoissonPointRelaxationFACOperator::smoothError()");
@@ -388,8 +539,8 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                                                  const SAMRAIVectorReal<NDIM, double>& residual,
                                                  int level_num,
                                                  int num_sweeps,
-                                                 bool /*performing_pre_sweeps*/,
-                                                 bool /*performing_post_sweeps*/)
+                                                 bool performing_pre_sweeps,
+                                                 bool performing_post_sweeps)
 {
     if (num_sweeps == 0) return;
 
@@ -398,6 +549,14 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     const int error_idx = error.getComponentDescriptorIndex(0);
     const int scratch_idx = d_scratch_idx;
+    const bool single_precision = d_use_single_precision_smoother;
+
+    // Reuse the single precision residual converted for the pre-sweeps on this
+    // level in the post-sweeps (see CCPoissonPointRelaxationFACOperator).
+    const int residual_idx = residual.getComponentDescriptorIndex(0);
+    const bool convert_residual =
+        single_precision && !(performing_post_sweeps && d_sp_residual_src_idx[level_num] == residual_idx);
+    if (single_precision) d_sp_residual_src_idx[level_num] = performing_pre_sweeps ? residual_idx : -1;
 
     // Determine the smoother type.
     const std::string& smoother_type_string = (level_num == d_coarsest_ln ? d_coarse_solver_type : d_smoother_type);
@@ -432,10 +591,57 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
         }
     }
 
+    // When smoothing in single precision, enforce any Dirichlet boundary
+    // conditions and convert the error and residual data.  Ghost cell values of
+    // the single precision error are set after they have been computed in
+    // double precision below.
+    if (single_precision)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<SideData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            Pointer<SideData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
+            Pointer<SideData<NDIM, float> > sp_error_data = patch->getPatchData(d_sp_error_idx);
+            Pointer<SideData<NDIM, float> > sp_residual_data = patch->getPatchData(d_sp_residual_idx);
+            if (d_bc_helper->patchTouchesDirichletBoundary(patch))
+            {
+                d_bc_helper->copyDataAtDirichletBoundaries(error_data, residual_data, patch);
+            }
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                copy_array_data(sp_error_data->getArrayData(axis), error_data->getArrayData(axis));
+                if (convert_residual)
+                {
+                    copy_array_data(sp_residual_data->getArrayData(axis), residual_data->getArrayData(axis));
+                }
+            }
+        }
+    }
+
     // Smooth the error by the specified number of sweeps.
     if (red_black_ordering) num_sweeps *= 2;
     for (int isweep = 0; isweep < num_sweeps; ++isweep)
     {
+        // Copy the updated single precision values that are needed to fill
+        // ghost cells back into the double precision error data.
+        if (single_precision && isweep > 0)
+        {
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<SideData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+                Pointer<SideData<NDIM, float> > sp_error_data = patch->getPatchData(d_sp_error_idx);
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    copy_array_data(error_data->getArrayData(axis),
+                                    sp_error_data->getArrayData(axis),
+                                    d_patch_sp_sync_boxes[level_num][patch_counter][axis]);
+                }
+            }
+        }
+
         // Re-fill ghost cell data as needed.
         if (level_num > d_coarsest_ln)
         {
@@ -483,6 +689,24 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             xeqScheduleGhostFillNoCoarse(error_idx, level_num);
         }
 
+        // Copy the ghost cell values into the single precision error data.
+        if (single_precision)
+        {
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<SideData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+                Pointer<SideData<NDIM, float> > sp_error_data = patch->getPatchData(d_sp_error_idx);
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    copy_array_data(sp_error_data->getArrayData(axis),
+                                    error_data->getArrayData(axis),
+                                    d_patch_bc_box_overlap[level_num][patch_counter][axis]);
+                }
+            }
+        }
+
         // Smooth the error on the patches.
         int patch_counter = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
@@ -490,12 +714,25 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<SideData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
             Pointer<SideData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
+            Pointer<SideData<NDIM, float> > sp_error_data, sp_residual_data;
+            if (single_precision)
+            {
+                sp_error_data = patch->getPatchData(d_sp_error_idx);
+                sp_residual_data = patch->getPatchData(d_sp_residual_idx);
+            }
 #if !defined(NDEBUG)
             const Box<NDIM>& ghost_box = error_data->getGhostBox();
             TBOX_ASSERT(ghost_box == residual_data->getGhostBox());
             TBOX_ASSERT(error_data->getGhostCellWidth() == d_gcw);
             TBOX_ASSERT(residual_data->getGhostCellWidth() == d_gcw);
             TBOX_ASSERT(error_data->getDepth() == residual_data->getDepth());
+            if (single_precision)
+            {
+                TBOX_ASSERT(ghost_box == sp_error_data->getGhostBox());
+                TBOX_ASSERT(ghost_box == sp_residual_data->getGhostBox());
+                TBOX_ASSERT(error_data->getDepth() == sp_error_data->getDepth());
+                TBOX_ASSERT(error_data->getDepth() == sp_residual_data->getDepth());
+            }
 #endif
             Pointer<SideData<NDIM, int> > mask_data = patch->getPatchData(d_mask_idx);
             const Box<NDIM>& patch_box = patch->getBox();
@@ -516,16 +753,28 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                         const int src_patch_num = cit->first;
                         const Box<NDIM>& overlap = cit->second;
                         Pointer<Patch<NDIM> > src_patch = level->getPatch(src_patch_num);
-                        Pointer<SideData<NDIM, double> > src_error_data = error.getComponentPatchData(0, *src_patch);
-                        error_data->getArrayData(axis)
-                            .copy(src_error_data->getArrayData(axis), overlap, IntVector<NDIM>(0));
+                        if (single_precision)
+                        {
+                            Pointer<SideData<NDIM, float> > src_sp_error_data =
+                                src_patch->getPatchData(d_sp_error_idx);
+                            sp_error_data->getArrayData(axis)
+                                .copy(src_sp_error_data->getArrayData(axis), overlap, IntVector<NDIM>(0));
+                        }
+                        else
+                        {
+                            Pointer<SideData<NDIM, double> > src_error_data =
+                                error.getComponentPatchData(0, *src_patch);
+                            error_data->getArrayData(axis)
+                                .copy(src_error_data->getArrayData(axis), overlap, IntVector<NDIM>(0));
+                        }
                     }
                 }
             }
 
-            // Enforce any Dirichlet boundary conditions.
+            // Enforce any Dirichlet boundary conditions.  In single precision,
+            // these values were set before the error data were converted.
             const bool patch_has_dirichlet_bdry = d_bc_helper->patchTouchesDirichletBoundary(patch);
-            if (patch_has_dirichlet_bdry)
+            if (patch_has_dirichlet_bdry && !single_precision)
             {
                 d_bc_helper->copyDataAtDirichletBoundaries(error_data, residual_data, patch);
             }
@@ -538,96 +787,192 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                 const Box<NDIM> side_patch_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
                 for (int depth = 0; depth < error_data->getDepth(); ++depth)
                 {
-                    double* const U = error_data->getPointer(axis, depth);
-                    const int U_ghosts = (error_data->getGhostCellWidth()).max();
-                    const double* const F = residual_data->getPointer(axis, depth);
-                    const int F_ghosts = (residual_data->getGhostCellWidth()).max();
                     const int* const mask = mask_data->getPointer(axis, depth);
                     const int mask_ghosts = (mask_data->getGhostCellWidth()).max();
-                    if (patch_has_dirichlet_bdry && d_bc_helper->patchTouchesDirichletBoundaryAxis(patch, axis))
+                    if (single_precision)
                     {
-                        if (red_black_ordering)
+                        float* const U = sp_error_data->getPointer(axis, depth);
+                        const int U_ghosts = (sp_error_data->getGhostCellWidth()).max();
+                        const float* const F = sp_residual_data->getPointer(axis, depth);
+                        const int F_ghosts = (sp_residual_data->getGhostCellWidth()).max();
+                        if (patch_has_dirichlet_bdry && d_bc_helper->patchTouchesDirichletBoundaryAxis(patch, axis))
                         {
-                            int red_or_black = isweep % 2; // "red" = 0, "black" = 1
-                            RB_GS_SMOOTH_MASK_FC(U,
-                                                 U_ghosts,
-                                                 alpha,
-                                                 beta,
-                                                 F,
-                                                 F_ghosts,
-                                                 mask,
-                                                 mask_ghosts,
-                                                 side_patch_box.lower(0),
-                                                 side_patch_box.upper(0),
-                                                 side_patch_box.lower(1),
-                                                 side_patch_box.upper(1),
+                            if (red_black_ordering)
+                            {
+                                int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                                RB_GS_SMOOTH_MASK_SP_FC(U,
+                                                        U_ghosts,
+                                                        alpha,
+                                                        beta,
+                                                        F,
+                                                        F_ghosts,
+                                                        mask,
+                                                        mask_ghosts,
+                                                        side_patch_box.lower(0),
+                                                        side_patch_box.upper(0),
+                                                        side_patch_box.lower(1),
+                                                        side_patch_box.upper(1),
+#if (NDIM == 3)
+                                                        side_patch_box.lower(2),
+                                                        side_patch_box.upper(2),
+#endif
+                                                        dx,
+                                                        red_or_black);
+                            }
+                            else
+                            {
+                                GS_SMOOTH_MASK_SP_FC(U,
+                                                     U_ghosts,
+                                                     alpha,
+                                                     beta,
+                                                     F,
+                                                     F_ghosts,
+                                                     mask,
+                                                     mask_ghosts,
+                                                     side_patch_box.lower(0),
+                                                     side_patch_box.upper(0),
+                                                     side_patch_box.lower(1),
+                                                     side_patch_box.upper(1),
 #if (NDIM == 3)
-                                                 side_patch_box.lower(2),
-                                                 side_patch_box.upper(2),
+                                                     side_patch_box.lower(2),
+                                                     side_patch_box.upper(2),
 #endif
-                                                 dx,
-                                                 red_or_black);
+                                                     dx);
+                            }
                         }
                         else
                         {
-                            GS_SMOOTH_MASK_FC(U,
-                                              U_ghosts,
-                                              alpha,
-                                              beta,
-                                              F,
-                                              F_ghosts,
-                                              mask,
-                                              mask_ghosts,
-                                              side_patch_box.lower(0),
-                                              side_patch_box.upper(0),
-                                              side_patch_box.lower(1),
-                                              side_patch_box.upper(1),
+                            if (red_black_ordering)
+                            {
+                                int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                                RB_GS_SMOOTH_SP_FC(U,
+                                                   U_ghosts,
+                                                   alpha,
+                                                   beta,
+                                                   F,
+                                                   F_ghosts,
+                                                   side_patch_box.lower(0),
+                                                   side_patch_box.upper(0),
+                                                   side_patch_box.lower(1),
+                                                   side_patch_box.upper(1),
 #if (NDIM == 3)
-                                              side_patch_box.lower(2),
-                                              side_patch_box.upper(2),
+                                                   side_patch_box.lower(2),
+                                                   side_patch_box.upper(2),
 #endif
-                                              dx);
+                                                   dx,
+                                                   red_or_black);
+                            }
+                            else
+                            {
+                                GS_SMOOTH_SP_FC(U,
+                                                U_ghosts,
+                                                alpha,
+                                                beta,
+                                                F,
+                                                F_ghosts,
+                                                side_patch_box.lower(0),
+                                                side_patch_box.upper(0),
+                                                side_patch_box.lower(1),
+                                                side_patch_box.upper(1),
+#if (NDIM == 3)
+                                                side_patch_box.lower(2),
+                                                side_patch_box.upper(2),
+#endif
+                                                dx);
+                            }
                         }
                     }
                     else
                     {
-                        if (red_black_ordering)
+                        double* const U = error_data->getPointer(axis, depth);
+                        const int U_ghosts = (error_data->getGhostCellWidth()).max();
+                        const double* const F = residual_data->getPointer(axis, depth);
+                        const int F_ghosts = (residual_data->getGhostCellWidth()).max();
+                        if (patch_has_dirichlet_bdry && d_bc_helper->patchTouchesDirichletBoundaryAxis(patch, axis))
                         {
-                            int red_or_black = isweep % 2; // "red" = 0, "black" = 1
-                            RB_GS_SMOOTH_FC(U,
-                                            U_ghosts,
-                                            alpha,
-                                            beta,
-                                            F,
-                                            F_ghosts,
-                                            side_patch_box.lower(0),
-                                            side_patch_box.upper(0),
-                                            side_patch_box.lower(1),
-                                            side_patch_box.upper(1),
+                            if (red_black_ordering)
+                            {
+                                int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                                RB_GS_SMOOTH_MASK_FC(U,
+                                                     U_ghosts,
+                                                     alpha,
+                                                     beta,
+                                                     F,
+                                                     F_ghosts,
+                                                     mask,
+                                                     mask_ghosts,
+                                                     side_patch_box.lower(0),
+                                                     side_patch_box.upper(0),
+                                                     side_patch_box.lower(1),
+                                                     side_patch_box.upper(1),
 #if (NDIM == 3)
-                                            side_patch_box.lower(2),
-                                            side_patch_box.upper(2),
+                                                     side_patch_box.lower(2),
+                                                     side_patch_box.upper(2),
 #endif
-                                            dx,
-                                            red_or_black);
+                                                     dx,
+                                                     red_or_black);
+                            }
+                            else
+                            {
+                                GS_SMOOTH_MASK_FC(U,
+                                                  U_ghosts,
+                                                  alpha,
+                                                  beta,
+                                                  F,
+                                                  F_ghosts,
+                                                  mask,
+                                                  mask_ghosts,
+                                                  side_patch_box.lower(0),
+                                                  side_patch_box.upper(0),
+                                                  side_patch_box.lower(1),
+                                                  side_patch_box.upper(1),
+#if (NDIM == 3)
+                                                  side_patch_box.lower(2),
+                                                  side_patch_box.upper(2),
+#endif
+                                                  dx);
+                            }
                         }
                         else
                         {
-                            GS_SMOOTH_FC(U,
-                                         U_ghosts,
-                                         alpha,
-                                         beta,
-                                         F,
-                                         F_ghosts,
-                                         side_patch_box.lower(0),
-                                         side_patch_box.upper(0),
-                                         side_patch_box.lower(1),
-                                         side_patch_box.upper(1),
+                            if (red_black_ordering)
+                            {
+                                int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                                RB_GS_SMOOTH_FC(U,
+                                                U_ghosts,
+                                                alpha,
+                                                beta,
+                                                F,
+                                                F_ghosts,
+                                                side_patch_box.lower(0),
+                                                side_patch_box.upper(0),
+                                                side_patch_box.lower(1),
+                                                side_patch_box.upper(1),
 #if (NDIM == 3)
-                                         side_patch_box.lower(2),
-                                         side_patch_box.upper(2),
+                                                side_patch_box.lower(2),
+                                                side_patch_box.upper(2),
 #endif
-                                         dx);
+                                                dx,
+                                                red_or_black);
+                            }
+                            else
+                            {
+                                GS_SMOOTH_FC(U,
+                                             U_ghosts,
+                                             alpha,
+                                             beta,
+                                             F,
+                                             F_ghosts,
+                                             side_patch_box.lower(0),
+                                             side_patch_box.upper(0),
+                                             side_patch_box.lower(1),
+                                             side_patch_box.upper(1),
+#if (NDIM == 3)
+                                             side_patch_box.lower(2),
+                                             side_patch_box.upper(2),
+#endif
+                                             dx);
+                            }
                         }
                     }
                 }
@@ -635,6 +980,22 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
         }
     }
 
+    // Copy the smoothed single precision error back into the double precision
+    // error data.
+    if (single_precision)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<SideData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            Pointer<SideData<NDIM, float> > sp_error_data = patch->getPatchData(d_sp_error_idx);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                copy_array_data(error_data->getArrayData(axis), sp_error_data->getArrayData(axis));
+            }
+        }
+    }
+
     // Synchronize data along patch boundaries.
     xeqScheduleDataSynch(error_idx, level_num);
     IBTK_TIMER_STOP(t_smooth_error);
@@ -780,6 +1141,15 @@ SCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
     Pointer<SideDataFactory<NDIM, double> > scratch_pdat_fac =
         var_db->getPatchDescriptor()->getPatchDataFactory(d_scratch_idx);
     scratch_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+    if (d_use_single_precision_smoother)
+    {
+        Pointer<SideDataFactory<NDIM, float> > sp_error_pdat_fac =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_sp_error_idx);
+        sp_error_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+        Pointer<SideDataFactory<NDIM, float> > sp_residual_pdat_fac =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_sp_residual_idx);
+        sp_residual_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+    }
 
     // Setup cached BC data.
     d_bc_helper = new StaggeredPhysicalBoundaryHelper();
@@ -884,24 +1254,93 @@ SCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
             }
         }
     }
+
+    // Allocate single precision smoother data and determine the layers of
+    // interior side indices that must be synchronized between sweeps.
+    if (d_use_single_precision_smoother)
+    {
+        d_sp_residual_src_idx.assign(d_finest_ln + 1, -1);
+        d_patch_sp_sync_boxes.resize(d_finest_ln + 1);
+        for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (!level->checkAllocated(d_sp_error_idx)) level->allocatePatchData(d_sp_error_idx);
+            if (!level->checkAllocated(d_sp_residual_idx)) level->allocatePatchData(d_sp_residual_idx);
+            const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+            d_patch_sp_sync_boxes[ln].resize(num_local_patches);
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+                    d_patch_sp_sync_boxes[ln][patch_counter][axis] = BoxList<NDIM>(side_box);
+                    d_patch_sp_sync_boxes[ln][patch_counter][axis].removeIntersections(
+                        Box<NDIM>::grow(side_box, -SP_SYNC_WIDTH));
+                }
+            }
+        }
+    }
     return;
 } // initializeOperatorStateSpecialized
 
 void
-SCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int /*coarsest_reset_ln*/,
-                                                                        const int /*finest_reset_ln*/)
+SCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int coarsest_reset_ln,
+                                                                        const int finest_reset_ln)
 {
     if (!d_is_initialized) return;
 
+    if (d_use_single_precision_smoother)
+    {
+        for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (level->checkAllocated(d_sp_error_idx)) level->deallocatePatchData(d_sp_error_idx);
+            if (level->checkAllocated(d_sp_residual_idx)) level->deallocatePatchData(d_sp_residual_idx);
+        }
+    }
+
     if (!d_in_initialize_operator_state)
     {
         d_patch_bc_box_overlap.clear();
         d_patch_neighbor_overlap.clear();
+        d_patch_sp_sync_boxes.clear();
+        d_sp_residual_src_idx.clear();
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
     }
     return;
 } // deallocateOperatorStateSpecialized
 
+bool
+SCPoissonPointRelaxationFACOperator::updateOperatorCoefficientsSpecialized()
+{
+    // The ghost cell fill pattern depends on whether D is constant.
+    if (d_poisson_spec.dIsConstant() == !d_op_stencil_fill_pattern) return false;
+
+    // Reset cached BC data.
+    d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
+    d_bc_helper->setupMaskingFunction(d_mask_idx);
+
+    // Update the coarse level solver, reinitializing it only when it does not
+    // support coefficient updates.
+    if (d_coarse_solver)
+    {
+        d_coarse_solver->setSolutionTime(d_solution_time);
+        d_coarse_solver->setTimeInterval(d_current_time, d_new_time);
+        d_coarse_solver->setPoissonSpecifications(d_poisson_spec);
+        d_coarse_solver->setPhysicalBcCoefs(d_bc_coefs);
+        d_coarse_solver->setHomogeneousBc(true);
+        if (!d_coarse_solver->updateCoefficients())
+        {
+            d_coarse_solver->initializeSolverState(*getLevelSAMRAIVectorReal(*d_solution, d_coarsest_ln),
+                                                   *getLevelSAMRAIVectorReal(*d_rhs, d_coarsest_ln));
+        }
+    }
+    return true;
+} // updateOperatorCoefficientsSpecialized
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,300 @@
+// Filename: SolutionHistoryInitialGuess.cpp
+// Created on 29 Nov 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "SAMRAIVectorReal.h"
+#include "ibtk/SolutionHistoryInitialGuess.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Relative tolerance used to detect (numerically) linearly dependent
+// right-hand sides.
+static const double DEPENDENCE_TOL = 1.0e-12;
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+SolutionHistoryInitialGuess::SolutionHistoryInitialGuess(const std::string& object_name, Pointer<Database> input_db)
+    : d_object_name(object_name), d_use_pod(false), d_history_size(4), d_pod_energy_tol(1.0e-8), d_X(), d_B(), d_gram()
+{
+    if (input_db)
+    {
+        if (input_db->keyExists("basis_type"))
+        {
+            const std::string basis_type = input_db->getString("basis_type");
+            if (basis_type == "HISTORY")
+            {
+                d_use_pod = false;
+            }
+            else if (basis_type == "POD")
+            {
+                d_use_pod = true;
+            }
+            else
+            {
+                TBOX_ERROR(d_object_name << "::SolutionHistoryInitialGuess():\n"
+                                         << "  unrecognized basis type: " << basis_type << "\n"
+                                         << "  valid basis types are: HISTORY, POD" << std::endl);
+            }
+        }
+        if (input_db->keyExists("history_size")) d_history_size = input_db->getInteger("history_size");
+        if (input_db->keyExists("pod_energy_tol")) d_pod_energy_tol = input_db->getDouble("pod_energy_tol");
+    }
+    if (d_history_size < (d_use_pod ? 2 : 1))
+    {
+        TBOX_ERROR(d_object_name << "::SolutionHistoryInitialGuess():\n"
+                                 << "  history_size must be at least " << (d_use_pod ? 2 : 1) << std::endl);
+    }
+    return;
+} // SolutionHistoryInitialGuess
+
+SolutionHistoryInitialGuess::~SolutionHistoryInitialGuess()
+{
+    reset();
+    return;
+} // ~SolutionHistoryInitialGuess
+
+bool
+SolutionHistoryInitialGuess::computeInitialGuess(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& b)
+{
+    const int n = static_cast<int>(d_X.size());
+    if (n == 0) return false;
+
+    // Solve the normal equations G alpha = B^T b using the pseudo-inverse of
+    // the Gram matrix, which is robust to (nearly) dependent right-hand sides.
+    Eigen::VectorXd c;
+    computeInnerProducts(c, Pointer<SAMRAIVectorReal<NDIM, double> >(&b, false));
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eig(d_gram);
+    const Eigen::VectorXd& lambda = eig.eigenvalues();
+    const double lambda_max = lambda(n - 1);
+    if (lambda_max <= 0.0) return false;
+    Eigen::VectorXd w = eig.eigenvectors().transpose() * c;
+    for (int k = 0; k < n; ++k)
+    {
+        w(k) = lambda(k) > DEPENDENCE_TOL * lambda_max ? w(k) / lambda(k) : 0.0;
+    }
+    const Eigen::VectorXd alpha = eig.eigenvectors() * w;
+
+    // Form the initial guess.
+    Pointer<SAMRAIVectorReal<NDIM, double> > x_ptr(&x, false);
+    x.scale(alpha(0), d_X[0]);
+    for (int k = 1; k < n; ++k)
+    {
+        x.axpy(alpha(k), d_X[k], x_ptr);
+    }
+    return true;
+} // computeInitialGuess
+
+void
+SolutionHistoryInitialGuess::storeSolution(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& b)
+{
+    Pointer<SAMRAIVectorReal<NDIM, double> > x_new, b_new;
+    if (!d_use_pod && static_cast<int>(d_X.size()) == d_history_size)
+    {
+        // Reuse the storage of the oldest pair.
+        x_new = d_X.front();
+        b_new = d_B.front();
+        d_X.front().setNull();
+        d_B.front().setNull();
+        removePair(0);
+    }
+    else
+    {
+        x_new = x.cloneVector(d_object_name + "::x");
+        x_new->allocateVectorData();
+        b_new = b.cloneVector(d_object_name + "::b");
+        b_new->allocateVectorData();
+    }
+    x_new->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&x, false));
+    b_new->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&b, false));
+    d_X.push_back(x_new);
+    d_B.push_back(b_new);
+
+    // Update the Gram matrix.
+    const int n = static_cast<int>(d_B.size());
+    Eigen::VectorXd c;
+    computeInnerProducts(c, b_new);
+    d_gram.conservativeResize(n, n);
+    d_gram.row(n - 1) = c.transpose();
+    d_gram.col(n - 1) = c;
+
+    // Discard trivial right-hand sides, and compress the POD basis once it is
+    // full.
+    if (c(n - 1) <= 0.0)
+    {
+        removePair(n - 1);
+    }
+    else if (d_use_pod && n > d_history_size)
+    {
+        compressBasis();
+    }
+    return;
+} // storeSolution
+
+void
+SolutionHistoryInitialGuess::reset()
+{
+    for (unsigned int k = 0; k < d_X.size(); ++k)
+    {
+        freeVector(d_X[k]);
+        freeVector(d_B[k]);
+    }
+    d_X.clear();
+    d_B.clear();
+    d_gram.resize(0, 0);
+    return;
+} // reset
+
+int
+SolutionHistoryInitialGuess::getBasisSize() const
+{
+    return static_cast<int>(d_X.size());
+} // getBasisSize
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+SolutionHistoryInitialGuess::computeInnerProducts(Eigen::VectorXd& c, Pointer<SAMRAIVectorReal<NDIM, double> > b) const
+{
+    const int n = static_cast<int>(d_B.size());
+    c.resize(n);
+    for (int k = 0; k < n; ++k)
+    {
+        c(k) = d_B[k]->dot(b, /*local_only*/ true);
+    }
+    if (n > 0) SAMRAI_MPI::sumReduction(c.data(), n);
+    return;
+} // computeInnerProducts
+
+void
+SolutionHistoryInitialGuess::removePair(const int k)
+{
+    const int n = static_cast<int>(d_B.size());
+#if !defined(NDEBUG)
+    TBOX_ASSERT(0 <= k && k < n);
+#endif
+    freeVector(d_X[k]);
+    freeVector(d_B[k]);
+    d_X.erase(d_X.begin() + k);
+    d_B.erase(d_B.begin() + k);
+    Eigen::MatrixXd gram(n - 1, n - 1);
+    for (int i = 0, ii = 0; i < n; ++i)
+    {
+        if (i == k) continue;
+        for (int j = 0, jj = 0; j < n; ++j)
+        {
+            if (j == k) continue;
+            gram(ii, jj++) = d_gram(i, j);
+        }
+        ++ii;
+    }
+    d_gram = gram;
+    return;
+} // removePair
+
+void
+SolutionHistoryInitialGuess::compressBasis()
+{
+    const int n = static_cast<int>(d_B.size());
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eig(d_gram);
+    const Eigen::VectorXd& lambda = eig.eigenvalues();
+    const double lambda_max = lambda(n - 1);
+
+    // Keep the most energetic modes, leaving room for at least one new pair.
+    int num_modes = 0;
+    for (int k = n - 1; k >= 0 && num_modes < d_history_size - 1; --k, ++num_modes)
+    {
+        if (lambda(k) <= std::max(d_pod_energy_tol, DEPENDENCE_TOL) * lambda_max) break;
+    }
+
+    // Form the modes.  The right-hand side modes B V diag(lambda)^(-1/2) are
+    // orthonormal, and the same linear combinations of the stored solutions
+    // yield the corresponding solution modes.
+    std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > > X_modes(num_modes), B_modes(num_modes);
+    for (int m = 0; m < num_modes; ++m)
+    {
+        const int k = n - 1 - m;
+        const Eigen::VectorXd v = eig.eigenvectors().col(k) / std::sqrt(lambda(k));
+        X_modes[m] = d_X[0]->cloneVector(d_object_name + "::x");
+        X_modes[m]->allocateVectorData();
+        B_modes[m] = d_B[0]->cloneVector(d_object_name + "::b");
+        B_modes[m]->allocateVectorData();
+        X_modes[m]->scale(v(0), d_X[0]);
+        B_modes[m]->scale(v(0), d_B[0]);
+        for (int i = 1; i < n; ++i)
+        {
+            X_modes[m]->axpy(v(i), d_X[i], X_modes[m]);
+            B_modes[m]->axpy(v(i), d_B[i], B_modes[m]);
+        }
+    }
+    reset();
+    d_X = X_modes;
+    d_B = B_modes;
+    d_gram = Eigen::MatrixXd::Identity(num_modes, num_modes);
+    return;
+} // compressBasis
+
+void
+SolutionHistoryInitialGuess::freeVector(Pointer<SAMRAIVectorReal<NDIM, double> >& v)
+{
+    if (!v) return;
+    v->deallocateVectorData();
+    v->freeVectorComponents();
+    v.setNull();
+    return;
+} // freeVector
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -152,6 +152,12 @@ FACPreconditionerStrategy::deallocateOperatorState()
     return;
 } // deallocateOperatorState
 
+bool
+FACPreconditionerStrategy::updateOperatorCoefficients()
+{
+    return false;
+} // updateOperatorCoefficients
+
 void
 FACPreconditionerStrategy::allocateScratchData()
 {
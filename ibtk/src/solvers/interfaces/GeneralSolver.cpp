@@ -173,6 +173,12 @@ GeneralSolver::deallocateSolverState()
     return;
 } // deallocateSolverState
 
+bool
+GeneralSolver::updateCoefficients()
+{
+    return false;
+} // updateCoefficients
+
 void
 GeneralSolver::setMaxIterations(int max_iterations)
 {
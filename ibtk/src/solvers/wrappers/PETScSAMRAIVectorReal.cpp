@@ -34,11 +34,24 @@
 
 #include <math.h>
 #include <algorithm>
+#include <cmath>
 #include <ostream>
+#include <vector>
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "CellData.h"
+#include "CellVariable.h"
+#include "Index.h"
 #include "IntVector.h"
+#include "Patch.h"
+#include "PatchData.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
+#include "SideData.h"
+#include "SideGeometry.h"
+#include "SideVariable.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/NormOps.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
@@ -98,9 +111,446 @@ static Timer* t_vec_m_t_dot_local;
 static Timer* t_vec_max_pointwise_divide;
 static Timer* t_vec_dot_norm2;
 
+// Fused multi-vector kernels.
+//
+// These kernels are used in place of sequences of single-vector SAMRAI vector
+// operations for vectors whose components are all cell- or side-centered
+// double-precision data.  They stream each row of the patch interior data of
+// the "shared" vector once, while it is resident in cache, and apply all of
+// the requested operations to that row.
+
+typedef SAMRAIVectorReal<NDIM, double> SAMRAIVectorType;
+
+inline bool
+has_fused_kernels(const SAMRAIVectorType& vec)
+{
+    const int ncomp = vec.getNumberOfComponents();
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        Pointer<CellVariable<NDIM, double> > comp_cc_var = vec.getComponentVariable(comp);
+        Pointer<SideVariable<NDIM, double> > comp_sc_var = vec.getComponentVariable(comp);
+        if (!comp_cc_var && !comp_sc_var) return false;
+    }
+    return true;
+} // has_fused_kernels
+
+inline ArrayData<NDIM, double>*
+get_interior_array_data(const Pointer<PatchData<NDIM> >& data, const unsigned int axis, Box<NDIM>& interior_box)
+{
+    Pointer<CellData<NDIM, double> > cc_data = data;
+    if (cc_data)
+    {
+        interior_box = cc_data->getBox();
+        return &cc_data->getArrayData();
+    }
+    Pointer<SideData<NDIM, double> > sc_data = data;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(sc_data);
+#endif
+    interior_box = SideGeometry<NDIM>::toSideBox(sc_data->getBox(), axis);
+    return &sc_data->getArrayData(axis);
+} // get_interior_array_data
+
+// Accumulate val[k] += (x, y[k]) and, when requested, x_sq += (x, x) over the
+// indices in box, using the control volume weights when they are provided.
+inline void
+mdot_box(const ArrayData<NDIM, double>& x,
+         const std::vector<const ArrayData<NDIM, double>*>& y,
+         const ArrayData<NDIM, double>* const cvol,
+         const Box<NDIM>& box,
+         double* const val,
+         double* const x_sq)
+{
+    const int nv = static_cast<int>(y.size());
+    const int depth = x.getDepth();
+    const int row_length = box.numberCells(0);
+    Box<NDIM> row_box = box;
+    row_box.upper()(0) = row_box.lower()(0);
+    std::vector<const double*> y_row(nv);
+    for (int d = 0; d < depth; ++d)
+    {
+        for (Box<NDIM>::Iterator b(row_box); b; b++)
+        {
+            const Index<NDIM>& i = b();
+            const double* const x_row = x.getPointer(d) + x.getBox().offset(i);
+            for (int k = 0; k < nv; ++k)
+            {
+                y_row[k] = y[k]->getPointer(d) + y[k]->getBox().offset(i);
+            }
+            if (cvol)
+            {
+                const double* const cvol_row =
+                    cvol->getPointer(cvol->getDepth() == depth ? d : 0) + cvol->getBox().offset(i);
+                for (int k = 0; k < nv; ++k)
+                {
+                    const double* const y_k_row = y_row[k];
+                    double sum = 0.0;
+                    for (int j = 0; j < row_length; ++j) sum += x_row[j] * y_k_row[j] * cvol_row[j];
+                    val[k] += sum;
+                }
+                if (x_sq)
+                {
+                    double sum = 0.0;
+                    for (int j = 0; j < row_length; ++j) sum += x_row[j] * x_row[j] * cvol_row[j];
+                    *x_sq += sum;
+                }
+            }
+            else
+            {
+                for (int k = 0; k < nv; ++k)
+                {
+                    const double* const y_k_row = y_row[k];
+                    double sum = 0.0;
+                    for (int j = 0; j < row_length; ++j) sum += x_row[j] * y_k_row[j];
+                    val[k] += sum;
+                }
+                if (x_sq)
+                {
+                    double sum = 0.0;
+                    for (int j = 0; j < row_length; ++j) sum += x_row[j] * x_row[j];
+                    *x_sq += sum;
+                }
+            }
+        }
+    }
+    return;
+} // mdot_box
+
+// Compute the local parts of the dot products val[k] = (x, y[k]) and, when
+// requested, of the squared norm x_sq = (x, x) in a single pass over x.
+inline void
+fused_mdot_local(const SAMRAIVectorType& x,
+                 const std::vector<const SAMRAIVectorType*>& y,
+                 double* const val,
+                 double* const x_sq)
+{
+    const int nv = static_cast<int>(y.size());
+    std::fill(val, val + nv, 0.0);
+    if (x_sq) *x_sq = 0.0;
+    Pointer<PatchHierarchy<NDIM> > hierarchy = x.getPatchHierarchy();
+    const int coarsest_ln = x.getCoarsestLevelNumber();
+    const int finest_ln = x.getFinestLevelNumber();
+    const int ncomp = x.getNumberOfComponents();
+    std::vector<const ArrayData<NDIM, double>*> y_data(nv);
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        Pointer<CellVariable<NDIM, double> > comp_cc_var = x.getComponentVariable(comp);
+        const unsigned int num_arrays = comp_cc_var ? 1 : NDIM;
+        const int x_idx = x.getComponentDescriptorIndex(comp);
+        const int cvol_idx = x.getControlVolumeIndex(comp);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                for (unsigned int axis = 0; axis < num_arrays; ++axis)
+                {
+                    Box<NDIM> box, data_box;
+                    const ArrayData<NDIM, double>* const x_data =
+                        get_interior_array_data(patch->getPatchData(x_idx), axis, box);
+                    for (int k = 0; k < nv; ++k)
+                    {
+                        y_data[k] = get_interior_array_data(
+                            patch->getPatchData(y[k]->getComponentDescriptorIndex(comp)), axis, data_box);
+                    }
+                    const ArrayData<NDIM, double>* const cvol_data =
+                        cvol_idx >= 0 ? get_interior_array_data(patch->getPatchData(cvol_idx), axis, data_box) :
+                                        NULL;
+                    mdot_box(*x_data, y_data, cvol_data, box, val, x_sq);
+                }
+            }
+        }
+    }
+    return;
+} // fused_mdot_local
+
+// Compute y := y + sum_k alpha[k] x[k] in a single pass over the patch interior
+// data of y.
+inline void
+fused_maxpy(SAMRAIVectorType& y, const PetscScalar* const alpha, const std::vector<const SAMRAIVectorType*>& x)
+{
+    const int nv = static_cast<int>(x.size());
+    Pointer<PatchHierarchy<NDIM> > hierarchy = y.getPatchHierarchy();
+    const int coarsest_ln = y.getCoarsestLevelNumber();
+    const int finest_ln = y.getFinestLevelNumber();
+    const int ncomp = y.getNumberOfComponents();
+    std::vector<const ArrayData<NDIM, double>*> x_data(nv);
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        Pointer<CellVariable<NDIM, double> > comp_cc_var = y.getComponentVariable(comp);
+        const unsigned int num_arrays = comp_cc_var ? 1 : NDIM;
+        const int y_idx = y.getComponentDescriptorIndex(comp);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                for (unsigned int axis = 0; axis < num_arrays; ++axis)
+                {
+                    Box<NDIM> box, data_box;
+                    ArrayData<NDIM, double>* const y_data =
+                        get_interior_array_data(patch->getPatchData(y_idx), axis, box);
+                    for (int k = 0; k < nv; ++k)
+                    {
+                        x_data[k] = get_interior_array_data(
+                            patch->getPatchData(x[k]->getComponentDescriptorIndex(comp)), axis, data_box);
+                    }
+                    const int depth = y_data->getDepth();
+                    const int row_length = box.numberCells(0);
+                    Box<NDIM> row_box = box;
+                    row_box.upper()(0) = row_box.lower()(0);
+                    for (int d = 0; d < depth; ++d)
+                    {
+                        for (Box<NDIM>::Iterator b(row_box); b; b++)
+                        {
+                            const Index<NDIM>& i = b();
+                            double* const y_row = y_data->getPointer(d) + y_data->getBox().offset(i);
+                            for (int k = 0; k < nv; ++k)
+                            {
+                                const double a = alpha[k];
+                                const double* const x_k_row =
+                                    x_data[k]->getPointer(d) + x_data[k]->getBox().offset(i);
+                                for (int j = 0; j < row_length; ++j) y_row[j] += a * x_k_row[j];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // fused_maxpy
+
+// Packed storage.
+//
+// Vectors that use packed storage keep the patch interior values of all
+// components on all levels in a single contiguous array, ordered by component,
+// level, patch, data axis, and data depth, and then row by row through each
+// interior box.
+
+inline bool
+has_control_volumes(const SAMRAIVectorType& vec)
+{
+    const int ncomp = vec.getNumberOfComponents();
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        if (vec.getControlVolumeIndex(comp) >= 0) return true;
+    }
+    return false;
+} // has_control_volumes
+
+enum PackedDataTransfer
+{
+    COUNT_PACKED_VALUES,
+    PACK_PATCH_DATA,
+    UNPACK_PATCH_DATA,
+    PACK_CONTROL_VOLUMES
+};
+
+// Visit the patch interior values of vec in packed storage order and transfer
+// them between the patch data (or the control volume data) and buf.  Returns
+// the number of values visited.
+//
+// NOTE: Only the patch boxes and variable depths are used to count the packed
+// values, so that the patch data of vec need not be allocated.  Unit weights
+// are used for components that do not have control volumes.
+int
+transfer_packed_data(const SAMRAIVectorType& vec, double* const buf, const PackedDataTransfer transfer)
+{
+    int offset = 0;
+    Pointer<PatchHierarchy<NDIM> > hierarchy = vec.getPatchHierarchy();
+    const int coarsest_ln = vec.getCoarsestLevelNumber();
+    const int finest_ln = vec.getFinestLevelNumber();
+    const int ncomp = vec.getNumberOfComponents();
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        Pointer<CellVariable<NDIM, double> > comp_cc_var = vec.getComponentVariable(comp);
+        Pointer<SideVariable<NDIM, double> > comp_sc_var = vec.getComponentVariable(comp);
+        const unsigned int num_arrays = comp_cc_var ? 1 : NDIM;
+        const int depth = comp_cc_var ? comp_cc_var->getDepth() : comp_sc_var->getDepth();
+        const int data_idx =
+            transfer == PACK_CONTROL_VOLUMES ? vec.getControlVolumeIndex(comp) : vec.getComponentDescriptorIndex(comp);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                for (unsigned int axis = 0; axis < num_arrays; ++axis)
+                {
+                    const Box<NDIM> box = comp_cc_var ? patch_box : SideGeometry<NDIM>::toSideBox(patch_box, axis);
+                    if (transfer == COUNT_PACKED_VALUES)
+                    {
+                        offset += depth * box.size();
+                        continue;
+                    }
+                    Box<NDIM> data_box;
+                    ArrayData<NDIM, double>* const data =
+                        data_idx >= 0 ? get_interior_array_data(patch->getPatchData(data_idx), axis, data_box) : NULL;
+                    const int row_length = box.numberCells(0);
+                    Box<NDIM> row_box = box;
+                    row_box.upper()(0) = row_box.lower()(0);
+                    for (int d = 0; d < depth; ++d)
+                    {
+                        for (Box<NDIM>::Iterator b(row_box); b; b++)
+                        {
+                            double* const packed_row = buf + offset;
+                            if (data)
+                            {
+                                const Index<NDIM>& i = b();
+                                double* const data_row =
+                                    data->getPointer(data->getDepth() == depth ? d : 0) + data->getBox().offset(i);
+                                if (transfer == UNPACK_PATCH_DATA)
+                                {
+                                    std::copy(packed_row, packed_row + row_length, data_row);
+                                }
+                                else
+                                {
+                                    std::copy(data_row, data_row + row_length, packed_row);
+                                }
+                            }
+                            else
+                            {
+                                std::fill(packed_row, packed_row + row_length, 1.0);
+                            }
+                            offset += row_length;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return offset;
+} // transfer_packed_data
+
+// Compute the local parts of the dot products val[k] = (x, y[k]) and, when
+// requested, of the squared norm x_sq = (x, x) for packed data of length n,
+// using the weights w when they are provided.  The data are processed in short
+// blocks so that the weighted values of x are reused from cache for each y[k].
+void
+packed_mdot_local(const double* const x,
+                  const std::vector<const double*>& y,
+                  const double* const w,
+                  const int n,
+                  double* const val,
+                  double* const x_sq)
+{
+    static const int BLOCK_SIZE = 512;
+    double wx[BLOCK_SIZE];
+    const int nv = static_cast<int>(y.size());
+    std::fill(val, val + nv, 0.0);
+    if (x_sq) *x_sq = 0.0;
+    for (int start = 0; start < n; start += BLOCK_SIZE)
+    {
+        const int len = std::min(BLOCK_SIZE, n - start);
+        const double* const x_block = x + start;
+        if (w)
+        {
+            const double* const w_block = w + start;
+            for (int j = 0; j < len; ++j) wx[j] = w_block[j] * x_block[j];
+        }
+        else
+        {
+            std::copy(x_block, x_block + len, wx);
+        }
+        for (int k = 0; k < nv; ++k)
+        {
+            const double* const y_block = y[k] + start;
+            double sum = 0.0;
+            for (int j = 0; j < len; ++j) sum += wx[j] * y_block[j];
+            val[k] += sum;
+        }
+        if (x_sq)
+        {
+            double sum = 0.0;
+            for (int j = 0; j < len; ++j) sum += wx[j] * x_block[j];
+            *x_sq += sum;
+        }
+    }
+    return;
+} // packed_mdot_local
+
+// Compute the local parts of the weighted L1 norm, the squared weighted L2
+// norm, and the max norm of packed data of length n.  As in SAMRAI, the max
+// norm is restricted to values with positive weights when weights are provided.
+void
+packed_norms_local(const double* const x,
+                   const double* const w,
+                   const int n,
+                   double* const l1,
+                   double* const l2_sq,
+                   double* const max)
+{
+    if (l1)
+    {
+        double sum = 0.0;
+        if (w)
+        {
+            for (int j = 0; j < n; ++j) sum += w[j] * std::abs(x[j]);
+        }
+        else
+        {
+            for (int j = 0; j < n; ++j) sum += std::abs(x[j]);
+        }
+        *l1 = sum;
+    }
+    if (l2_sq)
+    {
+        double sum = 0.0;
+        if (w)
+        {
+            for (int j = 0; j < n; ++j) sum += w[j] * x[j] * x[j];
+        }
+        else
+        {
+            for (int j = 0; j < n; ++j) sum += x[j] * x[j];
+        }
+        *l2_sq = sum;
+    }
+    if (max)
+    {
+        double val = 0.0;
+        if (w)
+        {
+            for (int j = 0; j < n; ++j)
+            {
+                if (w[j] > 0.0) val = std::max(val, std::abs(x[j]));
+            }
+        }
+        else
+        {
+            for (int j = 0; j < n; ++j) val = std::max(val, std::abs(x[j]));
+        }
+        *max = val;
+    }
+    return;
+} // packed_norms_local
+
 #define PSVR_CAST1(v) (static_cast<PETScSAMRAIVectorReal*>(v->data))
 #define PSVR_CAST2(v) (static_cast<PETScSAMRAIVectorReal*>(v->data)->d_samrai_vector)
 
+#define PSVR_PACKED1(v) (PSVR_CAST1(v)->d_packed_vec != NULL)
+#define PSVR_PACKED2(v1, v2) (PSVR_PACKED1(v1) && PSVR_PACKED1(v2))
+#define PSVR_PACKED3(v1, v2, v3) (PSVR_PACKED1(v1) && PSVR_PACKED1(v2) && PSVR_PACKED1(v3))
+
+#define PSVR_SYNC1(v) PSVR_CAST1((v))->makePatchDataCurrent();
+#define PSVR_SYNC2(v1, v2)                                                                                             \
+    PSVR_SYNC1((v1));                                                                                                  \
+    PSVR_SYNC1((v2));
+#define PSVR_SYNC3(v1, v2, v3)                                                                                         \
+    PSVR_SYNC1((v1));                                                                                                  \
+    PSVR_SYNC1((v2));                                                                                                  \
+    PSVR_SYNC1((v3));
+#define PSVR_SYNCN(v, N)                                                                                               \
+    for (int i = 0; i < static_cast<int>(N); ++i)                                                                      \
+    {                                                                                                                  \
+        PSVR_SYNC1((v)[i]);                                                                                            \
+    }
+#define PSVR_MODIFIED(v) PSVR_CAST1((v))->setPatchDataModified();
+
 #if !defined(NDEBUG)
 #define PSVR_CHECK1(v)                                                                                                 \
     TBOX_ASSERT((v));                                                                                                  \
@@ -135,7 +585,13 @@ PETScSAMRAIVectorReal::PETScSAMRAIVectorReal(Pointer<SAMRAIVectorReal<NDIM, Pets
     : d_samrai_vector(samrai_vector),
       d_vector_created_via_duplicate(vector_created_via_duplicate),
       d_vector_checked_out_read_write(false),
-      d_vector_checked_out_read(false)
+      d_vector_checked_out_read(false),
+      d_use_packed_duplicates(false),
+      d_packed_vec(NULL),
+      d_packed_wgt(NULL),
+      d_packed_data_current(false),
+      d_patch_data_current(true),
+      d_patch_data_allocated(true)
 {
     // Setup Timers.
     IBTK_DO_ONCE(
@@ -234,16 +690,198 @@ PETScSAMRAIVectorReal::PETScSAMRAIVectorReal(Pointer<SAMRAIVectorReal<NDIM, Pets
 
 PETScSAMRAIVectorReal::~PETScSAMRAIVectorReal()
 {
+    int ierr;
+    ierr = VecDestroy(&d_packed_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&d_packed_wgt);
+    IBTK_CHKERRQ(ierr);
     if (!d_vector_created_via_duplicate)
     {
         d_petsc_vector->ops->destroy = 0;
-        int ierr = VecDestroy(&d_petsc_vector);
+        ierr = VecDestroy(&d_petsc_vector);
         IBTK_CHKERRQ(ierr);
     }
 }
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+PETScSAMRAIVectorReal::makePatchDataCurrent()
+{
+    if (!d_packed_vec || d_patch_data_current) return;
+    if (!d_patch_data_allocated)
+    {
+        d_samrai_vector->allocateVectorData();
+        d_patch_data_allocated = true;
+    }
+    const PetscScalar* packed_arr = NULL;
+    int ierr = VecGetArrayRead(d_packed_vec, &packed_arr);
+    IBTK_CHKERRQ(ierr);
+    transfer_packed_data(*d_samrai_vector, const_cast<PetscScalar*>(packed_arr), UNPACK_PATCH_DATA);
+    ierr = VecRestoreArrayRead(d_packed_vec, &packed_arr);
+    IBTK_CHKERRQ(ierr);
+    d_patch_data_current = true;
+    return;
+} // makePatchDataCurrent
+
+void
+PETScSAMRAIVectorReal::setPatchDataModified()
+{
+    if (d_packed_vec) d_packed_data_current = false;
+    return;
+} // setPatchDataModified
+
+void
+PETScSAMRAIVectorReal::makePackedDataCurrent()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_packed_vec);
+#endif
+    if (d_packed_data_current) return;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_patch_data_current);
+#endif
+    PetscScalar* packed_arr = NULL;
+    int ierr = VecGetArray(d_packed_vec, &packed_arr);
+    IBTK_CHKERRQ(ierr);
+    transfer_packed_data(*d_samrai_vector, packed_arr, PACK_PATCH_DATA);
+    ierr = VecRestoreArray(d_packed_vec, &packed_arr);
+    IBTK_CHKERRQ(ierr);
+    d_packed_data_current = true;
+    return;
+} // makePackedDataCurrent
+
+Vec
+PETScSAMRAIVectorReal::getPackedVecRead()
+{
+    makePackedDataCurrent();
+    return d_packed_vec;
+} // getPackedVecRead
+
+Vec
+PETScSAMRAIVectorReal::getPackedVec()
+{
+    makePackedDataCurrent();
+    d_patch_data_current = false;
+    return d_packed_vec;
+} // getPackedVec
+
+Vec
+PETScSAMRAIVectorReal::getPackedVecWrite()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_packed_vec);
+#endif
+    d_packed_data_current = true;
+    d_patch_data_current = false;
+    return d_packed_vec;
+} // getPackedVecWrite
+
+bool
+PETScSAMRAIVectorReal::hasPackedData(Vec x, PetscInt nv, const Vec* y)
+{
+    if (!PSVR_PACKED1(x)) return false;
+    for (PetscInt i = 0; i < nv; ++i)
+    {
+        if (!PSVR_PACKED1(y[i])) return false;
+    }
+    return true;
+} // hasPackedData
+
+void
+PETScSAMRAIVectorReal::packedMDotLocal(Vec x, PetscInt nv, const Vec* y, PetscScalar* val, PetscScalar* x_sq)
+{
+    int ierr;
+    PetscInt n;
+    Vec x_packed = PSVR_CAST1(x)->getPackedVecRead();
+    Vec w_packed = PSVR_CAST1(x)->d_packed_wgt;
+    std::vector<Vec> y_packed(nv);
+    for (PetscInt i = 0; i < nv; ++i) y_packed[i] = PSVR_CAST1(y[i])->getPackedVecRead();
+    ierr = VecGetLocalSize(x_packed, &n);
+    IBTK_CHKERRQ(ierr);
+    const PetscScalar* x_arr = NULL;
+    const PetscScalar* w_arr = NULL;
+    std::vector<const PetscScalar*> y_arr(nv, static_cast<const PetscScalar*>(NULL));
+    ierr = VecGetArrayRead(x_packed, &x_arr);
+    IBTK_CHKERRQ(ierr);
+    if (w_packed)
+    {
+        ierr = VecGetArrayRead(w_packed, &w_arr);
+        IBTK_CHKERRQ(ierr);
+    }
+    for (PetscInt i = 0; i < nv; ++i)
+    {
+        ierr = VecGetArrayRead(y_packed[i], &y_arr[i]);
+        IBTK_CHKERRQ(ierr);
+    }
+    packed_mdot_local(x_arr, y_arr, w_arr, n, val, x_sq);
+    for (PetscInt i = 0; i < nv; ++i)
+    {
+        ierr = VecRestoreArrayRead(y_packed[i], &y_arr[i]);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (w_packed)
+    {
+        ierr = VecRestoreArrayRead(w_packed, &w_arr);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = VecRestoreArrayRead(x_packed, &x_arr);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // packedMDotLocal
+
+void
+PETScSAMRAIVectorReal::packedNormLocal(Vec x, NormType type, PetscScalar* val)
+{
+    int ierr;
+    PetscInt n;
+    Vec x_packed = PSVR_CAST1(x)->getPackedVecRead();
+    Vec w_packed = PSVR_CAST1(x)->d_packed_wgt;
+    ierr = VecGetLocalSize(x_packed, &n);
+    IBTK_CHKERRQ(ierr);
+    const PetscScalar* x_arr = NULL;
+    const PetscScalar* w_arr = NULL;
+    ierr = VecGetArrayRead(x_packed, &x_arr);
+    IBTK_CHKERRQ(ierr);
+    if (w_packed)
+    {
+        ierr = VecGetArrayRead(w_packed, &w_arr);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (type == NORM_1)
+    {
+        packed_norms_local(x_arr, w_arr, n, &val[0], NULL, NULL);
+    }
+    else if (type == NORM_2)
+    {
+        packed_norms_local(x_arr, w_arr, n, NULL, &val[0], NULL);
+    }
+    else if (type == NORM_INFINITY)
+    {
+        packed_norms_local(x_arr, w_arr, n, NULL, NULL, &val[0]);
+    }
+    else if (type == NORM_1_AND_2)
+    {
+        packed_norms_local(x_arr, w_arr, n, &val[0], &val[1], NULL);
+    }
+    else
+    {
+        TBOX_ERROR("PETScSAMRAIVectorReal::norm()\n"
+                   << "  vector norm type "
+                   << static_cast<int>(type)
+                   << " unsupported"
+                   << std::endl);
+    }
+    if (w_packed)
+    {
+        ierr = VecRestoreArrayRead(w_packed, &w_arr);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = VecRestoreArrayRead(x_packed, &x_arr);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // packedNormLocal
+
 PetscErrorCode
 PETScSAMRAIVectorReal::VecDuplicate_SAMRAI(Vec v, Vec* newv)
 {
@@ -251,12 +889,44 @@ PETScSAMRAIVectorReal::VecDuplicate_SAMRAI(Vec v, Vec* newv)
     PSVR_CHECK1(v);
     PetscErrorCode ierr;
     Pointer<SAMRAIVectorReal<NDIM, PetscScalar> > samrai_vec = PSVR_CAST2(v)->cloneVector(PSVR_CAST2(v)->getName());
-    samrai_vec->allocateVectorData();
+    const bool use_packed_data = PSVR_CAST1(v)->d_use_packed_duplicates && has_fused_kernels(*samrai_vec);
+    if (!use_packed_data) samrai_vec->allocateVectorData();
     static const bool vector_created_via_duplicate = true;
     MPI_Comm comm;
     ierr = PetscObjectGetComm(reinterpret_cast<PetscObject>(v), &comm);
     CHKERRQ(ierr);
     PETScSAMRAIVectorReal* new_psv = new PETScSAMRAIVectorReal(samrai_vec, vector_created_via_duplicate, comm);
+    new_psv->d_use_packed_duplicates = PSVR_CAST1(v)->d_use_packed_duplicates;
+    if (use_packed_data)
+    {
+        // Patch data are allocated only when they are first needed.
+        const int n_local = transfer_packed_data(*samrai_vec, NULL, COUNT_PACKED_VALUES);
+        ierr = VecCreateMPI(comm, n_local, PETSC_DETERMINE, &new_psv->d_packed_vec);
+        CHKERRQ(ierr);
+        new_psv->d_packed_data_current = true;
+        new_psv->d_patch_data_current = false;
+        new_psv->d_patch_data_allocated = false;
+
+        // Setup (or reuse) the control volume weights in packed storage order.
+        Vec& packed_wgt = PSVR_CAST1(v)->d_packed_wgt;
+        if (!packed_wgt && has_control_volumes(*samrai_vec))
+        {
+            ierr = VecDuplicate(new_psv->d_packed_vec, &packed_wgt);
+            CHKERRQ(ierr);
+            PetscScalar* wgt_arr = NULL;
+            ierr = VecGetArray(packed_wgt, &wgt_arr);
+            CHKERRQ(ierr);
+            transfer_packed_data(*samrai_vec, wgt_arr, PACK_CONTROL_VOLUMES);
+            ierr = VecRestoreArray(packed_wgt, &wgt_arr);
+            CHKERRQ(ierr);
+        }
+        if (packed_wgt)
+        {
+            ierr = PetscObjectReference(reinterpret_cast<PetscObject>(packed_wgt));
+            CHKERRQ(ierr);
+            new_psv->d_packed_wgt = packed_wgt;
+        }
+    }
     *newv = new_psv->d_petsc_vector;
     ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(*newv));
     CHKERRQ(ierr);
@@ -274,7 +944,7 @@ PETScSAMRAIVectorReal::VecDestroy_SAMRAI(Vec v)
         PSVR_CAST2(v)->resetLevels(0,
                                    std::min(PSVR_CAST2(v)->getFinestLevelNumber(),
                                             PSVR_CAST2(v)->getPatchHierarchy()->getFinestLevelNumber()));
-        PSVR_CAST2(v)->deallocateVectorData();
+        if (PSVR_CAST1(v)->d_patch_data_allocated) PSVR_CAST2(v)->deallocateVectorData();
         PSVR_CAST2(v)->freeVectorComponents();
         PSVR_CAST2(v).setNull();
         destroyPETScVector(PSVR_CAST1(v)->d_petsc_vector);
@@ -318,7 +988,16 @@ PETScSAMRAIVectorReal::VecDot_SAMRAI(Vec x, Vec y, PetscScalar* val)
 {
     IBTK_TIMER_START(t_vec_dot);
     PSVR_CHECK2(x, y);
-    *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y));
+    if (PSVR_PACKED2(x, y))
+    {
+        packedMDotLocal(x, 1, &y, val, NULL);
+        SAMRAI_MPI::sumReduction(val, 1);
+    }
+    else
+    {
+        PSVR_SYNC2(x, y);
+        *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y));
+    }
     IBTK_TIMER_STOP(t_vec_dot);
     PetscFunctionReturn(0);
 }
@@ -329,12 +1008,43 @@ PETScSAMRAIVectorReal::VecMDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSca
     IBTK_TIMER_START(t_vec_m_dot);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    const bool use_packed_data = hasPackedData(x, nv, y);
+    if (!use_packed_data)
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        PSVR_SYNC1(x);
+        PSVR_SYNCN(y, nv);
+    }
+    if (use_packed_data || has_fused_kernels(*PSVR_CAST2(x)))
+    {
+        // Compute the squared norm of x along with the dot products, and cache
+        // the norm so that a subsequent call to VecNorm() does not require an
+        // additional pass over x or an additional reduction.
+        std::vector<PetscScalar> vals(nv + 1);
+        if (use_packed_data)
+        {
+            packedMDotLocal(x, nv, y, &vals[0], &vals[nv]);
+        }
+        else
+        {
+            std::vector<const SAMRAIVectorReal<NDIM, PetscScalar>*> y_vecs(nv);
+            for (PetscInt i = 0; i < nv; ++i) y_vecs[i] = PSVR_CAST2(y[i]).getPointer();
+            fused_mdot_local(*PSVR_CAST2(x), y_vecs, &vals[0], &vals[nv]);
+        }
+        SAMRAI_MPI::sumReduction(&vals[0], nv + 1);
+        std::copy(vals.begin(), vals.begin() + nv, val);
+        int ierr = PetscObjectComposedDataSetReal(
+            reinterpret_cast<PetscObject>(x), NormIds[NORM_2], std::sqrt(std::max(vals[nv], 0.0)));
+        CHKERRQ(ierr);
+    }
+    else
+    {
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
+        SAMRAI_MPI::sumReduction(val, nv);
     }
-    SAMRAI_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_dot);
     PetscFunctionReturn(0);
 }
@@ -344,6 +1054,23 @@ PETScSAMRAIVectorReal::VecNorm_SAMRAI(Vec x, NormType type, PetscScalar* val)
 {
     IBTK_TIMER_START(t_vec_norm);
     PSVR_CHECK1(x);
+    if (PSVR_PACKED1(x))
+    {
+        packedNormLocal(x, type, val);
+        if (type == NORM_INFINITY)
+        {
+            *val = SAMRAI_MPI::maxReduction(*val);
+        }
+        else
+        {
+            SAMRAI_MPI::sumReduction(val, type == NORM_1_AND_2 ? 2 : 1);
+            if (type == NORM_2) val[0] = std::sqrt(val[0]);
+            if (type == NORM_1_AND_2) val[1] = std::sqrt(val[1]);
+        }
+        IBTK_TIMER_STOP(t_vec_norm);
+        PetscFunctionReturn(0);
+    }
+    PSVR_SYNC1(x);
     if (type == NORM_1)
     {
         *val = NormOps::L1Norm(PSVR_CAST2(x));
@@ -382,7 +1109,16 @@ PETScSAMRAIVectorReal::VecTDot_SAMRAI(Vec x, Vec y, PetscScalar* val)
 {
     IBTK_TIMER_START(t_vec_t_dot);
     PSVR_CHECK2(x, y);
-    *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y));
+    if (PSVR_PACKED2(x, y))
+    {
+        packedMDotLocal(x, 1, &y, val, NULL);
+        SAMRAI_MPI::sumReduction(val, 1);
+    }
+    else
+    {
+        PSVR_SYNC2(x, y);
+        *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y));
+    }
     IBTK_TIMER_STOP(t_vec_t_dot);
     PetscFunctionReturn(0);
 }
@@ -393,12 +1129,43 @@ PETScSAMRAIVectorReal::VecMTDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSc
     IBTK_TIMER_START(t_vec_m_t_dot);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    const bool use_packed_data = hasPackedData(x, nv, y);
+    if (!use_packed_data)
+    {
+        PSVR_SYNC1(x);
+        PSVR_SYNCN(y, nv);
+    }
+    if (use_packed_data || has_fused_kernels(*PSVR_CAST2(x)))
+    {
+        // Compute the squared norm of x along with the dot products, and cache
+        // the norm so that a subsequent call to VecNorm() does not require an
+        // additional pass over x or an additional reduction.
+        std::vector<PetscScalar> vals(nv + 1);
+        if (use_packed_data)
+        {
+            packedMDotLocal(x, nv, y, &vals[0], &vals[nv]);
+        }
+        else
+        {
+            std::vector<const SAMRAIVectorReal<NDIM, PetscScalar>*> y_vecs(nv);
+            for (PetscInt i = 0; i < nv; ++i) y_vecs[i] = PSVR_CAST2(y[i]).getPointer();
+            fused_mdot_local(*PSVR_CAST2(x), y_vecs, &vals[0], &vals[nv]);
+        }
+        SAMRAI_MPI::sumReduction(&vals[0], nv + 1);
+        std::copy(vals.begin(), vals.begin() + nv, val);
+        int ierr = PetscObjectComposedDataSetReal(
+            reinterpret_cast<PetscObject>(x), NormIds[NORM_2], std::sqrt(std::max(vals[nv], 0.0)));
+        CHKERRQ(ierr);
+    }
+    else
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
+        SAMRAI_MPI::sumReduction(val, nv);
     }
-    SAMRAI_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_t_dot);
     PetscFunctionReturn(0);
 }
@@ -408,9 +1175,18 @@ PETScSAMRAIVectorReal::VecScale_SAMRAI(Vec x, PetscScalar alpha)
 {
     IBTK_TIMER_START(t_vec_scale);
     PSVR_CHECK1(x);
-    static const bool interior_only = false;
-    PSVR_CAST2(x)->scale(alpha, PSVR_CAST2(x), interior_only);
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(x));
+    int ierr;
+    if (PSVR_PACKED1(x))
+    {
+        ierr = VecScale(PSVR_CAST1(x)->getPackedVec(), alpha);
+        CHKERRQ(ierr);
+    }
+    else
+    {
+        static const bool interior_only = false;
+        PSVR_CAST2(x)->scale(alpha, PSVR_CAST2(x), interior_only);
+    }
+    ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(x));
     CHKERRQ(ierr);
     IBTK_TIMER_STOP(t_vec_scale);
     PetscFunctionReturn(0);
@@ -421,9 +1197,22 @@ PETScSAMRAIVectorReal::VecCopy_SAMRAI(Vec x, Vec y)
 {
     IBTK_TIMER_START(t_vec_copy);
     PSVR_CHECK2(x, y);
-    static const bool interior_only = false;
-    PSVR_CAST2(y)->copyVector(PSVR_CAST2(x), interior_only);
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
+    int ierr;
+    if (PSVR_PACKED2(x, y))
+    {
+        Vec x_packed = PSVR_CAST1(x)->getPackedVecRead();
+        Vec y_packed = PSVR_CAST1(y)->getPackedVecWrite();
+        ierr = VecCopy(x_packed, y_packed);
+        CHKERRQ(ierr);
+    }
+    else
+    {
+        PSVR_SYNC2(x, y);
+        static const bool interior_only = false;
+        PSVR_CAST2(y)->copyVector(PSVR_CAST2(x), interior_only);
+        PSVR_MODIFIED(y);
+    }
+    ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
     CHKERRQ(ierr);
     IBTK_TIMER_STOP(t_vec_copy);
     PetscFunctionReturn(0);
@@ -434,9 +1223,18 @@ PETScSAMRAIVectorReal::VecSet_SAMRAI(Vec x, PetscScalar alpha)
 {
     IBTK_TIMER_START(t_vec_set);
     PSVR_CHECK1(x);
-    static const bool interior_only = false;
-    PSVR_CAST2(x)->setToScalar(alpha, interior_only);
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(x));
+    int ierr;
+    if (PSVR_PACKED1(x))
+    {
+        ierr = VecSet(PSVR_CAST1(x)->getPackedVecWrite(), alpha);
+        CHKERRQ(ierr);
+    }
+    else
+    {
+        static const bool interior_only = false;
+        PSVR_CAST2(x)->setToScalar(alpha, interior_only);
+    }
+    ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(x));
     CHKERRQ(ierr);
     IBTK_TIMER_STOP(t_vec_set);
     PetscFunctionReturn(0);
@@ -447,8 +1245,21 @@ PETScSAMRAIVectorReal::VecSwap_SAMRAI(Vec x, Vec y)
 {
     IBTK_TIMER_START(t_vec_swap);
     PSVR_CHECK2(x, y);
-    PSVR_CAST2(x)->swapVectors(PSVR_CAST2(y));
     int ierr;
+    if (PSVR_PACKED2(x, y))
+    {
+        Vec x_packed = PSVR_CAST1(x)->getPackedVec();
+        Vec y_packed = PSVR_CAST1(y)->getPackedVec();
+        ierr = VecSwap(x_packed, y_packed);
+        CHKERRQ(ierr);
+    }
+    else
+    {
+        PSVR_SYNC2(x, y);
+        PSVR_CAST2(x)->swapVectors(PSVR_CAST2(y));
+        PSVR_MODIFIED(x);
+        PSVR_MODIFIED(y);
+    }
     ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(x));
     CHKERRQ(ierr);
     ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
@@ -462,20 +1273,33 @@ PETScSAMRAIVectorReal::VecAXPY_SAMRAI(Vec y, PetscScalar alpha, Vec x)
 {
     IBTK_TIMER_START(t_vec_axpy);
     PSVR_CHECK2(x, y);
-    static const bool interior_only = false;
-    if (MathUtilities<double>::equalEps(alpha, 1.0))
-    {
-        PSVR_CAST2(y)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    }
-    else if (MathUtilities<double>::equalEps(alpha, -1.0))
+    int ierr;
+    if (PSVR_PACKED2(x, y))
     {
-        PSVR_CAST2(y)->subtract(PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+        Vec x_packed = PSVR_CAST1(x)->getPackedVecRead();
+        Vec y_packed = PSVR_CAST1(y)->getPackedVec();
+        ierr = VecAXPY(y_packed, alpha, x_packed);
+        CHKERRQ(ierr);
     }
     else
     {
-        PSVR_CAST2(y)->axpy(alpha, PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        PSVR_SYNC2(x, y);
+        static const bool interior_only = false;
+        if (MathUtilities<double>::equalEps(alpha, 1.0))
+        {
+            PSVR_CAST2(y)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        }
+        else if (MathUtilities<double>::equalEps(alpha, -1.0))
+        {
+            PSVR_CAST2(y)->subtract(PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+        }
+        else
+        {
+            PSVR_CAST2(y)->axpy(alpha, PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        }
+        PSVR_MODIFIED(y);
     }
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
+    ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
     CHKERRQ(ierr);
     IBTK_TIMER_STOP(t_vec_axpy);
     PetscFunctionReturn(0);
@@ -486,24 +1310,37 @@ PETScSAMRAIVectorReal::VecAXPBY_SAMRAI(Vec y, PetscScalar alpha, PetscScalar bet
 {
     IBTK_TIMER_START(t_vec_axpby);
     PSVR_CHECK2(x, y);
-    static const bool interior_only = false;
-    if (MathUtilities<double>::equalEps(alpha, 1.0) && MathUtilities<double>::equalEps(beta, 1.0))
-    {
-        PSVR_CAST2(y)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    }
-    else if (MathUtilities<double>::equalEps(beta, 1.0))
-    {
-        PSVR_CAST2(y)->axpy(alpha, PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    }
-    else if (MathUtilities<double>::equalEps(alpha, 1.0))
+    int ierr;
+    if (PSVR_PACKED2(x, y))
     {
-        PSVR_CAST2(y)->axpy(beta, PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+        Vec x_packed = PSVR_CAST1(x)->getPackedVecRead();
+        Vec y_packed = PSVR_CAST1(y)->getPackedVec();
+        ierr = VecAXPBY(y_packed, alpha, beta, x_packed);
+        CHKERRQ(ierr);
     }
     else
     {
-        PSVR_CAST2(y)->linearSum(alpha, PSVR_CAST2(x), beta, PSVR_CAST2(y), interior_only);
+        PSVR_SYNC2(x, y);
+        static const bool interior_only = false;
+        if (MathUtilities<double>::equalEps(alpha, 1.0) && MathUtilities<double>::equalEps(beta, 1.0))
+        {
+            PSVR_CAST2(y)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        }
+        else if (MathUtilities<double>::equalEps(beta, 1.0))
+        {
+            PSVR_CAST2(y)->axpy(alpha, PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        }
+        else if (MathUtilities<double>::equalEps(alpha, 1.0))
+        {
+            PSVR_CAST2(y)->axpy(beta, PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+        }
+        else
+        {
+            PSVR_CAST2(y)->linearSum(alpha, PSVR_CAST2(x), beta, PSVR_CAST2(y), interior_only);
+        }
+        PSVR_MODIFIED(y);
     }
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
+    ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
     CHKERRQ(ierr);
     IBTK_TIMER_STOP(t_vec_axpby);
     PetscFunctionReturn(0);
@@ -515,23 +1352,48 @@ PETScSAMRAIVectorReal::VecMAXPY_SAMRAI(Vec y, PetscInt nv, const PetscScalar* al
     IBTK_TIMER_START(t_vec_maxpy);
     PSVR_CHECK1(y);
     PSVR_CHECKN(x, nv);
-    static const bool interior_only = false;
-    for (PetscInt i = 0; i < nv; ++i)
+    int ierr;
+    if (hasPackedData(y, nv, x))
     {
-        if (MathUtilities<double>::equalEps(alpha[i], 1.0))
-        {
-            PSVR_CAST2(y)->add(PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
-        }
-        else if (MathUtilities<double>::equalEps(alpha[i], -1.0))
+        std::vector<Vec> x_packed(nv);
+        for (PetscInt i = 0; i < nv; ++i) x_packed[i] = PSVR_CAST1(x[i])->getPackedVecRead();
+        Vec y_packed = PSVR_CAST1(y)->getPackedVec();
+        ierr = VecMAXPY(y_packed, nv, alpha, nv > 0 ? &x_packed[0] : NULL);
+        CHKERRQ(ierr);
+    }
+    else
+    {
+        PSVR_SYNC1(y);
+        PSVR_SYNCN(x, nv);
+        if (has_fused_kernels(*PSVR_CAST2(y)))
         {
-            PSVR_CAST2(y)->subtract(PSVR_CAST2(y), PSVR_CAST2(x[i]), interior_only);
+            // NOTE: Only the patch interior values of y are updated.
+            std::vector<const SAMRAIVectorReal<NDIM, PetscScalar>*> x_vecs(nv);
+            for (PetscInt i = 0; i < nv; ++i) x_vecs[i] = PSVR_CAST2(x[i]).getPointer();
+            fused_maxpy(*PSVR_CAST2(y), alpha, x_vecs);
         }
         else
         {
-            PSVR_CAST2(y)->axpy(alpha[i], PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
+            static const bool interior_only = false;
+            for (PetscInt i = 0; i < nv; ++i)
+            {
+                if (MathUtilities<double>::equalEps(alpha[i], 1.0))
+                {
+                    PSVR_CAST2(y)->add(PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
+                }
+                else if (MathUtilities<double>::equalEps(alpha[i], -1.0))
+                {
+                    PSVR_CAST2(y)->subtract(PSVR_CAST2(y), PSVR_CAST2(x[i]), interior_only);
+                }
+                else
+                {
+                    PSVR_CAST2(y)->axpy(alpha[i], PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
+                }
+            }
         }
+        PSVR_MODIFIED(y);
     }
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
+    ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
     CHKERRQ(ierr);
     IBTK_TIMER_STOP(t_vec_maxpy);
     PetscFunctionReturn(0);
@@ -542,20 +1404,33 @@ PETScSAMRAIVectorReal::VecAYPX_SAMRAI(Vec y, const PetscScalar alpha, Vec x)
 {
     IBTK_TIMER_START(t_vec_aypx);
     PSVR_CHECK2(x, y);
-    static const bool interior_only = false;
-    if (MathUtilities<double>::equalEps(alpha, 1.0))
-    {
-        PSVR_CAST2(y)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    }
-    else if (MathUtilities<double>::equalEps(alpha, -1.0))
+    int ierr;
+    if (PSVR_PACKED2(x, y))
     {
-        PSVR_CAST2(y)->subtract(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        Vec x_packed = PSVR_CAST1(x)->getPackedVecRead();
+        Vec y_packed = PSVR_CAST1(y)->getPackedVec();
+        ierr = VecAYPX(y_packed, alpha, x_packed);
+        CHKERRQ(ierr);
     }
     else
     {
-        PSVR_CAST2(y)->axpy(alpha, PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+        PSVR_SYNC2(x, y);
+        static const bool interior_only = false;
+        if (MathUtilities<double>::equalEps(alpha, 1.0))
+        {
+            PSVR_CAST2(y)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        }
+        else if (MathUtilities<double>::equalEps(alpha, -1.0))
+        {
+            PSVR_CAST2(y)->subtract(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        }
+        else
+        {
+            PSVR_CAST2(y)->axpy(alpha, PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+        }
+        PSVR_MODIFIED(y);
     }
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
+    ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
     CHKERRQ(ierr);
     IBTK_TIMER_STOP(t_vec_aypx);
     PetscFunctionReturn(0);
@@ -566,20 +1441,34 @@ PETScSAMRAIVectorReal::VecWAXPY_SAMRAI(Vec w, PetscScalar alpha, Vec x, Vec y)
 {
     IBTK_TIMER_START(t_vec_waxpy);
     PSVR_CHECK3(w, x, y);
-    static const bool interior_only = false;
-    if (MathUtilities<double>::equalEps(alpha, 1.0))
-    {
-        PSVR_CAST2(w)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    }
-    else if (MathUtilities<double>::equalEps(alpha, -1.0))
+    int ierr;
+    if (PSVR_PACKED3(w, x, y))
     {
-        PSVR_CAST2(w)->subtract(PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+        Vec x_packed = PSVR_CAST1(x)->getPackedVecRead();
+        Vec y_packed = PSVR_CAST1(y)->getPackedVecRead();
+        Vec w_packed = PSVR_CAST1(w)->getPackedVecWrite();
+        ierr = VecWAXPY(w_packed, alpha, x_packed, y_packed);
+        CHKERRQ(ierr);
     }
     else
     {
-        PSVR_CAST2(w)->axpy(alpha, PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        PSVR_SYNC3(w, x, y);
+        static const bool interior_only = false;
+        if (MathUtilities<double>::equalEps(alpha, 1.0))
+        {
+            PSVR_CAST2(w)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        }
+        else if (MathUtilities<double>::equalEps(alpha, -1.0))
+        {
+            PSVR_CAST2(w)->subtract(PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+        }
+        else
+        {
+            PSVR_CAST2(w)->axpy(alpha, PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        }
+        PSVR_MODIFIED(w);
     }
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(w));
+    ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(w));
     CHKERRQ(ierr);
     IBTK_TIMER_STOP(t_vec_waxpy);
     PetscFunctionReturn(0);
@@ -590,10 +1479,24 @@ PETScSAMRAIVectorReal::VecAXPBYPCZ_SAMRAI(Vec z, PetscScalar alpha, PetscScalar
 {
     IBTK_TIMER_START(t_vec_axpbypcz);
     PSVR_CHECK3(x, y, z);
-    static const bool interior_only = false;
-    PSVR_CAST2(z)->linearSum(alpha, PSVR_CAST2(x), gamma, PSVR_CAST2(z), interior_only);
-    PSVR_CAST2(z)->axpy(beta, PSVR_CAST2(y), PSVR_CAST2(z), interior_only);
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(z));
+    int ierr;
+    if (PSVR_PACKED3(x, y, z))
+    {
+        Vec x_packed = PSVR_CAST1(x)->getPackedVecRead();
+        Vec y_packed = PSVR_CAST1(y)->getPackedVecRead();
+        Vec z_packed = PSVR_CAST1(z)->getPackedVec();
+        ierr = VecAXPBYPCZ(z_packed, alpha, beta, gamma, x_packed, y_packed);
+        CHKERRQ(ierr);
+    }
+    else
+    {
+        PSVR_SYNC3(x, y, z);
+        static const bool interior_only = false;
+        PSVR_CAST2(z)->linearSum(alpha, PSVR_CAST2(x), gamma, PSVR_CAST2(z), interior_only);
+        PSVR_CAST2(z)->axpy(beta, PSVR_CAST2(y), PSVR_CAST2(z), interior_only);
+        PSVR_MODIFIED(z);
+    }
+    ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(z));
     CHKERRQ(ierr);
     IBTK_TIMER_STOP(t_vec_axpbypcz);
     PetscFunctionReturn(0);
@@ -604,9 +1507,23 @@ PETScSAMRAIVectorReal::VecPointwiseMult_SAMRAI(Vec w, Vec x, Vec y)
 {
     IBTK_TIMER_START(t_vec_pointwise_mult);
     PSVR_CHECK3(w, x, y);
-    static const bool interior_only = false;
-    PSVR_CAST2(w)->multiply(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(w));
+    int ierr;
+    if (PSVR_PACKED3(w, x, y))
+    {
+        Vec x_packed = PSVR_CAST1(x)->getPackedVecRead();
+        Vec y_packed = PSVR_CAST1(y)->getPackedVecRead();
+        Vec w_packed = PSVR_CAST1(w)->getPackedVecWrite();
+        ierr = VecPointwiseMult(w_packed, x_packed, y_packed);
+        CHKERRQ(ierr);
+    }
+    else
+    {
+        PSVR_SYNC3(w, x, y);
+        static const bool interior_only = false;
+        PSVR_CAST2(w)->multiply(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        PSVR_MODIFIED(w);
+    }
+    ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(w));
     CHKERRQ(ierr);
     IBTK_TIMER_STOP(t_vec_pointwise_mult);
     PetscFunctionReturn(0);
@@ -617,9 +1534,23 @@ PETScSAMRAIVectorReal::VecPointwiseDivide_SAMRAI(Vec w, Vec x, Vec y)
 {
     IBTK_TIMER_START(t_vec_pointwise_divide);
     PSVR_CHECK3(w, x, y);
-    static const bool interior_only = false;
-    PSVR_CAST2(w)->divide(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(w));
+    int ierr;
+    if (PSVR_PACKED3(w, x, y))
+    {
+        Vec x_packed = PSVR_CAST1(x)->getPackedVecRead();
+        Vec y_packed = PSVR_CAST1(y)->getPackedVecRead();
+        Vec w_packed = PSVR_CAST1(w)->getPackedVecWrite();
+        ierr = VecPointwiseDivide(w_packed, x_packed, y_packed);
+        CHKERRQ(ierr);
+    }
+    else
+    {
+        PSVR_SYNC3(w, x, y);
+        static const bool interior_only = false;
+        PSVR_CAST2(w)->divide(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        PSVR_MODIFIED(w);
+    }
+    ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(w));
     CHKERRQ(ierr);
     IBTK_TIMER_STOP(t_vec_pointwise_divide);
     PetscFunctionReturn(0);
@@ -651,7 +1582,15 @@ PETScSAMRAIVectorReal::VecMax_SAMRAI(Vec x, PetscInt* p, PetscScalar* val)
     IBTK_TIMER_START(t_vec_max);
     PSVR_CHECK1(x);
     *p = -1;
-    *val = PSVR_CAST2(x)->max();
+    if (PSVR_PACKED1(x))
+    {
+        int ierr = VecMax(PSVR_CAST1(x)->getPackedVecRead(), NULL, val);
+        CHKERRQ(ierr);
+    }
+    else
+    {
+        *val = PSVR_CAST2(x)->max();
+    }
     IBTK_TIMER_STOP(t_vec_max);
     PetscFunctionReturn(0);
 }
@@ -662,7 +1601,15 @@ PETScSAMRAIVectorReal::VecMin_SAMRAI(Vec x, PetscInt* p, PetscScalar* val)
     IBTK_TIMER_START(t_vec_min);
     PSVR_CHECK1(x);
     *p = -1;
-    *val = PSVR_CAST2(x)->min();
+    if (PSVR_PACKED1(x))
+    {
+        int ierr = VecMin(PSVR_CAST1(x)->getPackedVecRead(), NULL, val);
+        CHKERRQ(ierr);
+    }
+    else
+    {
+        *val = PSVR_CAST2(x)->min();
+    }
     IBTK_TIMER_STOP(t_vec_min);
     PetscFunctionReturn(0);
 }
@@ -672,11 +1619,19 @@ PETScSAMRAIVectorReal::VecSetRandom_SAMRAI(Vec x, PetscRandom rctx)
 {
     IBTK_TIMER_START(t_vec_set_random);
     PSVR_CHECK1(x);
-    PetscScalar lo, hi;
     int ierr;
-    ierr = PetscRandomGetInterval(rctx, &lo, &hi);
-    CHKERRQ(ierr);
-    PSVR_CAST2(x)->setRandomValues(hi - lo, lo);
+    if (PSVR_PACKED1(x))
+    {
+        ierr = VecSetRandom(PSVR_CAST1(x)->getPackedVecWrite(), rctx);
+        CHKERRQ(ierr);
+    }
+    else
+    {
+        PetscScalar lo, hi;
+        ierr = PetscRandomGetInterval(rctx, &lo, &hi);
+        CHKERRQ(ierr);
+        PSVR_CAST2(x)->setRandomValues(hi - lo, lo);
+    }
     ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(x));
     CHKERRQ(ierr);
     IBTK_TIMER_STOP(t_vec_set_random);
@@ -688,8 +1643,16 @@ PETScSAMRAIVectorReal::VecDot_local_SAMRAI(Vec x, Vec y, PetscScalar* val)
 {
     IBTK_TIMER_START(t_vec_dot_local);
     PSVR_CHECK2(x, y);
-    static const bool local_only = true;
-    *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y), local_only);
+    if (PSVR_PACKED2(x, y))
+    {
+        packedMDotLocal(x, 1, &y, val, NULL);
+    }
+    else
+    {
+        PSVR_SYNC2(x, y);
+        static const bool local_only = true;
+        *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y), local_only);
+    }
     IBTK_TIMER_STOP(t_vec_dot_local);
     PetscFunctionReturn(0);
 }
@@ -699,8 +1662,16 @@ PETScSAMRAIVectorReal::VecTDot_local_SAMRAI(Vec x, Vec y, PetscScalar* val)
 {
     IBTK_TIMER_START(t_vec_t_dot_local);
     PSVR_CHECK2(x, y);
-    static const bool local_only = true;
-    *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y), local_only);
+    if (PSVR_PACKED2(x, y))
+    {
+        packedMDotLocal(x, 1, &y, val, NULL);
+    }
+    else
+    {
+        PSVR_SYNC2(x, y);
+        static const bool local_only = true;
+        *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y), local_only);
+    }
     IBTK_TIMER_STOP(t_vec_t_dot_local);
     PetscFunctionReturn(0);
 }
@@ -710,6 +1681,15 @@ PETScSAMRAIVectorReal::VecNorm_local_SAMRAI(Vec x, NormType type, PetscScalar* v
 {
     IBTK_TIMER_START(t_vec_norm_local);
     PSVR_CHECK1(x);
+    if (PSVR_PACKED1(x))
+    {
+        packedNormLocal(x, type, val);
+        if (type == NORM_2) val[0] = std::sqrt(val[0]);
+        if (type == NORM_1_AND_2) val[1] = std::sqrt(val[1]);
+        IBTK_TIMER_STOP(t_vec_norm_local);
+        PetscFunctionReturn(0);
+    }
+    PSVR_SYNC1(x);
     static const bool local_only = true;
     if (type == NORM_1)
     {
@@ -746,10 +1726,27 @@ PETScSAMRAIVectorReal::VecMDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, Pe
     IBTK_TIMER_START(t_vec_m_dot_local);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    if (hasPackedData(x, nv, y))
+    {
+        packedMDotLocal(x, nv, y, val, NULL);
+        IBTK_TIMER_STOP(t_vec_m_dot_local);
+        PetscFunctionReturn(0);
+    }
+    PSVR_SYNC1(x);
+    PSVR_SYNCN(y, nv);
+    if (has_fused_kernels(*PSVR_CAST2(x)))
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        std::vector<const SAMRAIVectorReal<NDIM, PetscScalar>*> y_vecs(nv);
+        for (PetscInt i = 0; i < nv; ++i) y_vecs[i] = PSVR_CAST2(y[i]).getPointer();
+        fused_mdot_local(*PSVR_CAST2(x), y_vecs, val, NULL);
+    }
+    else
+    {
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
     }
     IBTK_TIMER_STOP(t_vec_m_dot_local);
     PetscFunctionReturn(0);
@@ -761,10 +1758,27 @@ PETScSAMRAIVectorReal::VecMTDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, P
     IBTK_TIMER_START(t_vec_m_t_dot_local);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
+    if (hasPackedData(x, nv, y))
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        packedMDotLocal(x, nv, y, val, NULL);
+        IBTK_TIMER_STOP(t_vec_m_t_dot_local);
+        PetscFunctionReturn(0);
+    }
+    PSVR_SYNC1(x);
+    PSVR_SYNCN(y, nv);
+    if (has_fused_kernels(*PSVR_CAST2(x)))
+    {
+        std::vector<const SAMRAIVectorReal<NDIM, PetscScalar>*> y_vecs(nv);
+        for (PetscInt i = 0; i < nv; ++i) y_vecs[i] = PSVR_CAST2(y[i]).getPointer();
+        fused_mdot_local(*PSVR_CAST2(x), y_vecs, val, NULL);
+    }
+    else
+    {
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
     }
     IBTK_TIMER_STOP(t_vec_m_t_dot_local);
     PetscFunctionReturn(0);
@@ -775,7 +1789,18 @@ PETScSAMRAIVectorReal::VecMaxPointwiseDivide_SAMRAI(Vec x, Vec y, PetscScalar* m
 {
     IBTK_TIMER_START(t_vec_max_pointwise_divide);
     PSVR_CHECK2(x, y);
-    *max = PSVR_CAST2(x)->maxPointwiseDivide(PSVR_CAST2(y));
+    if (PSVR_PACKED2(x, y))
+    {
+        Vec x_packed = PSVR_CAST1(x)->getPackedVecRead();
+        Vec y_packed = PSVR_CAST1(y)->getPackedVecRead();
+        int ierr = VecMaxPointwiseDivide(x_packed, y_packed, max);
+        CHKERRQ(ierr);
+    }
+    else
+    {
+        PSVR_SYNC2(x, y);
+        *max = PSVR_CAST2(x)->maxPointwiseDivide(PSVR_CAST2(y));
+    }
     IBTK_TIMER_STOP(t_vec_max_pointwise_divide);
     PetscFunctionReturn(0);
 }
@@ -785,8 +1810,32 @@ PETScSAMRAIVectorReal::VecDotNorm2_SAMRAI(Vec s, Vec t, PetscScalar* dp, PetscSc
 {
     IBTK_TIMER_START(t_vec_dot_norm2);
     PSVR_CHECK2(s, t);
-    *dp = PSVR_CAST2(s)->dot(PSVR_CAST2(t));
-    *nm = PSVR_CAST2(t)->dot(PSVR_CAST2(t));
+    const bool use_packed_data = PSVR_PACKED2(s, t);
+    if (!use_packed_data)
+    {
+        PSVR_SYNC2(s, t);
+    }
+    if (use_packed_data || has_fused_kernels(*PSVR_CAST2(t)))
+    {
+        PetscScalar vals[2];
+        if (use_packed_data)
+        {
+            packedMDotLocal(t, 1, &s, &vals[0], &vals[1]);
+        }
+        else
+        {
+            std::vector<const SAMRAIVectorReal<NDIM, PetscScalar>*> s_vec(1, PSVR_CAST2(s).getPointer());
+            fused_mdot_local(*PSVR_CAST2(t), s_vec, &vals[0], &vals[1]);
+        }
+        SAMRAI_MPI::sumReduction(vals, 2);
+        *dp = vals[0];
+        *nm = vals[1];
+    }
+    else
+    {
+        *dp = PSVR_CAST2(s)->dot(PSVR_CAST2(t));
+        *nm = PSVR_CAST2(t)->dot(PSVR_CAST2(t));
+    }
     IBTK_TIMER_STOP(t_vec_dot_norm2);
     PetscFunctionReturn(0);
 }
@@ -42,6 +42,7 @@
 #include "VisItDataWriter.h"
 #include "ibtk/AppInitializer.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/ReducedDataWriter.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
@@ -72,6 +73,7 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
       d_viz_writers(),
       d_visit_data_writer(NULL),
       d_silo_data_writer(NULL),
+      d_reduced_data_writer(NULL),
       d_exodus_filename("output.ex2"),
       d_gmv_filename("output.gmv"),
       d_restart_dump_interval(0),
@@ -251,6 +253,13 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
             d_silo_data_writer = new LSiloDataWriter("LSiloDataWriter", d_viz_dump_dirname);
         }
 
+        if (d_viz_writers[i] == "Reduced")
+        {
+            Pointer<Database> reduced_db;
+            if (d_input_db->isDatabase("ReducedDataWriter")) reduced_db = d_input_db->getDatabase("ReducedDataWriter");
+            d_reduced_data_writer = new ReducedDataWriter("ReducedDataWriter", d_viz_dump_dirname, reduced_db);
+        }
+
         if (d_viz_writers[i] == "ExodusII")
         {
             if (main_db->keyExists("exodus_filename")) d_exodus_filename = main_db->getString("exodus_filename");
@@ -489,6 +498,12 @@ AppInitializer::getLSiloDataWriter() const
     return d_silo_data_writer;
 } // getLSiloDataWriter
 
+Pointer<ReducedDataWriter>
+AppInitializer::getReducedDataWriter() const
+{
+    return d_reduced_data_writer;
+} // getReducedDataWriter
+
 std::string
 AppInitializer::getExodusIIFilename(const std::string& prefix) const
 {
@@ -77,7 +77,9 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/ReducedDataWriter.h"
 #include "ibtk/RefinePatchStrategySet.h"
+#include "ibtk/TelemetryManager.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
@@ -127,6 +129,7 @@ HierarchyIntegrator::HierarchyIntegrator(const std::string& object_name,
     d_regridding_hierarchy = false;
     d_at_regrid_time_step = false;
     d_visit_writer = NULL;
+    d_reduced_writer = NULL;
     d_parent_integrator = NULL;
     d_current_num_cycles = -1;
     d_current_cycle_num = -1;
@@ -325,6 +328,10 @@ HierarchyIntegrator::advanceHierarchy(double dt)
         plog << d_object_name << "::advanceHierarchy(): time interval = [" << current_time << "," << new_time
              << "], dt = " << dt << "\n";
 
+    // Begin collecting performance telemetry for the outermost integrator.
+    const bool collect_telemetry = TelemetryManager::isEnabled() && !d_parent_integrator;
+    if (collect_telemetry) TelemetryManager::getManager()->beginStep(d_integrator_step, current_time, dt);
+
     // Regrid the patch hierarchy.
     if (atRegridPoint())
     {
@@ -390,6 +397,9 @@ HierarchyIntegrator::advanceHierarchy(double dt)
 
     // Reset the regrid indicator.
     d_at_regrid_time_step = false;
+
+    // Record the performance telemetry for the timestep.
+    if (collect_telemetry) TelemetryManager::getManager()->endStep();
     return;
 } // advanceHierarchy
 
@@ -580,6 +590,24 @@ HierarchyIntegrator::getVisItDataWriter() const
     return d_visit_writer;
 }
 
+void
+HierarchyIntegrator::registerReducedDataWriter(Pointer<ReducedDataWriter> reduced_writer)
+{
+    d_reduced_writer = reduced_writer;
+    for (std::set<HierarchyIntegrator*>::iterator it = d_child_integrators.begin(); it != d_child_integrators.end();
+         ++it)
+    {
+        (*it)->registerReducedDataWriter(reduced_writer);
+    }
+    return;
+} // registerReducedDataWriter
+
+Pointer<ReducedDataWriter>
+HierarchyIntegrator::getReducedDataWriter() const
+{
+    return d_reduced_writer;
+} // getReducedDataWriter
+
 void
 HierarchyIntegrator::setupPlotData()
 {
@@ -1414,6 +1442,26 @@ HierarchyIntegrator::executeApplyGradientDetectorCallbackFcns(const Pointer<Base
     return;
 } // executeApplyGradientDetectorCallbackFcns
 
+void
+HierarchyIntegrator::registerPlotQuantity(const std::string& variable_name,
+                                          const std::string& variable_type,
+                                          const int patch_data_index,
+                                          const int start_depth_id,
+                                          const double scale_factor)
+{
+    if (d_visit_writer)
+    {
+        d_visit_writer->registerPlotQuantity(
+            variable_name, variable_type, patch_data_index, start_depth_id, scale_factor);
+    }
+    if (d_reduced_writer)
+    {
+        d_reduced_writer->registerPlotQuantity(
+            variable_name, variable_type, patch_data_index, start_depth_id, scale_factor);
+    }
+    return;
+} // registerPlotQuantity
+
 void
 HierarchyIntegrator::registerGhostfillRefineAlgorithm(const std::string& name,
                                                       Pointer<RefineAlgorithm<NDIM> > ghostfill_alg,
@@ -1594,6 +1642,7 @@ HierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
     if (db->keyExists("enable_logging")) d_enable_logging = db->getBool("enable_logging");
     if (db->keyExists("bdry_extrap_type")) d_bdry_extrap_type = db->getString("bdry_extrap_type");
     if (db->keyExists("tag_buffer")) d_tag_buffer = db->getIntegerArray("tag_buffer");
+    if (db->isDatabase("telemetry")) TelemetryManager::getManager()->initialize(db->getDatabase("telemetry"));
     return;
 } // getFromInput
 
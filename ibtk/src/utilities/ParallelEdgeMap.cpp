@@ -39,6 +39,8 @@
 #include <vector>
 
 #include "ibtk/ParallelEdgeMap.h"
+#include "ibtk/ParallelExchangeUtilities.h"
+#include "ibtk/ibtk_enums.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
@@ -51,9 +53,12 @@ namespace IBTK
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
-ParallelEdgeMap::ParallelEdgeMap() : d_edge_map(), d_pending_additions(), d_pending_removals()
+ParallelEdgeMap::ParallelEdgeMap(const ParallelDataMode data_mode)
+    : d_data_mode(data_mode), d_edge_map(), d_pending_additions(), d_pending_removals()
 {
-    // intentionally blank
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_data_mode == REPLICATED_DATA || d_data_mode == DISTRIBUTED_DATA);
+#endif
     return;
 } // ParallelEdgeMap
 
@@ -94,6 +99,12 @@ ParallelEdgeMap::removeEdge(const std::pair<int, int>& link, int mastr_idx)
 void
 ParallelEdgeMap::communicateData()
 {
+    if (d_data_mode == DISTRIBUTED_DATA)
+    {
+        communicateDistributedData();
+        return;
+    }
+
     const int size = SAMRAI_MPI::getNodes();
     const int rank = SAMRAI_MPI::getRank();
 
@@ -156,54 +167,15 @@ ParallelEdgeMap::communicateData()
         }
     }
 
-    typedef std::multimap<int, std::pair<int, int> >::iterator multimap_iterator;
     typedef std::multimap<int, std::pair<int, int> >::const_iterator multimap_const_iterator;
     for (multimap_const_iterator cit = d_pending_additions.begin(); cit != d_pending_additions.end(); ++cit)
     {
         d_edge_map.insert(std::make_pair(cit->first, cit->second));
     }
 
-    typedef std::multimap<int, std::pair<int, int> >::const_iterator multimap_const_iterator;
     for (multimap_const_iterator cit = d_pending_removals.begin(); cit != d_pending_removals.end(); ++cit)
     {
-        int mastr_idx = cit->first;
-        const std::pair<int, int>& link = cit->second;
-
-        bool found_link = false;
-
-        std::pair<multimap_iterator, multimap_iterator> range = d_edge_map.equal_range(mastr_idx);
-        for (multimap_iterator it = range.first; it != range.second && !found_link; ++it)
-        {
-            if (it->second == link)
-            {
-                found_link = true;
-                d_edge_map.erase(it);
-            }
-        }
-
-        if (!found_link)
-        {
-            const int idx1 = link.first;
-            const int idx2 = link.second;
-            if (mastr_idx == idx1)
-            {
-                mastr_idx = idx2;
-            }
-            else
-            {
-                mastr_idx = idx1;
-            }
-
-            std::pair<multimap_iterator, multimap_iterator> range = d_edge_map.equal_range(mastr_idx);
-            for (multimap_iterator it = range.first; it != range.second && !found_link; ++it)
-            {
-                if (it->second == link)
-                {
-                    found_link = true;
-                    d_edge_map.erase(it);
-                }
-            }
-        }
+        removeLink(cit->first, cit->second, /*check_owner*/ false);
     }
 
     d_pending_additions.clear();
@@ -217,8 +189,134 @@ ParallelEdgeMap::getEdgeMap() const
     return d_edge_map;
 } // getEdgeMap
 
+ParallelDataMode
+ParallelEdgeMap::getDataMode() const
+{
+    return d_data_mode;
+} // getDataMode
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+ParallelEdgeMap::communicateDistributedData()
+{
+    // Route pending additions and removals to the owner of the master index.
+    static const int SIZE = 3;
+    typedef std::multimap<int, std::pair<int, int> >::const_iterator multimap_const_iterator;
+    std::map<int, std::vector<int> > additions_to_send, removals_to_send;
+    for (multimap_const_iterator cit = d_pending_additions.begin(); cit != d_pending_additions.end(); ++cit)
+    {
+        std::vector<int>& data = additions_to_send[ParallelExchangeUtilities::getOwnerRank(cit->first)];
+        data.push_back(cit->first);
+        data.push_back(cit->second.first);
+        data.push_back(cit->second.second);
+    }
+    for (multimap_const_iterator cit = d_pending_removals.begin(); cit != d_pending_removals.end(); ++cit)
+    {
+        std::vector<int>& data = removals_to_send[ParallelExchangeUtilities::getOwnerRank(cit->first)];
+        data.push_back(cit->first);
+        data.push_back(cit->second.first);
+        data.push_back(cit->second.second);
+    }
+
+    // Each message consists of the number of additions, the additions, and the
+    // removals.
+    std::map<int, std::vector<int> > send_data, recv_data;
+    for (std::map<int, std::vector<int> >::const_iterator cit = additions_to_send.begin();
+         cit != additions_to_send.end();
+         ++cit)
+    {
+        std::vector<int>& data = send_data[cit->first];
+        data.push_back(static_cast<int>(cit->second.size()) / SIZE);
+        data.insert(data.end(), cit->second.begin(), cit->second.end());
+    }
+    for (std::map<int, std::vector<int> >::const_iterator cit = removals_to_send.begin();
+         cit != removals_to_send.end();
+         ++cit)
+    {
+        std::vector<int>& data = send_data[cit->first];
+        if (data.empty()) data.push_back(0);
+        data.insert(data.end(), cit->second.begin(), cit->second.end());
+    }
+    ParallelExchangeUtilities::exchangeData(send_data, recv_data);
+    d_pending_additions.clear();
+    d_pending_removals.clear();
+
+    // Add all received edges, and then remove all received edges.
+    for (std::map<int, std::vector<int> >::const_iterator cit = recv_data.begin(); cit != recv_data.end(); ++cit)
+    {
+        const std::vector<int>& data = cit->second;
+        const int num_additions = data[0];
+        for (int k = 0; k < num_additions; ++k)
+        {
+            const int* const transaction = &data[1 + SIZE * k];
+            d_edge_map.insert(std::make_pair(transaction[0], std::make_pair(transaction[1], transaction[2])));
+        }
+    }
+
+    // The master index provided for a removal is only a hint.  When the link is
+    // not stored under the master index, forward the removal to the owner of
+    // the other vertex of the link.  Removals are forwarded only after the
+    // first attempt fails so that each removal erases at most one entry.
+    std::map<int, std::vector<int> > forward_data, forward_recv_data;
+    for (std::map<int, std::vector<int> >::const_iterator cit = recv_data.begin(); cit != recv_data.end(); ++cit)
+    {
+        const std::vector<int>& data = cit->second;
+        const int num_additions = data[0];
+        const int num_removals = (static_cast<int>(data.size()) - 1 - SIZE * num_additions) / SIZE;
+        for (int k = 0; k < num_removals; ++k)
+        {
+            const int* const transaction = &data[1 + SIZE * (num_additions + k)];
+            const int mastr_idx = transaction[0];
+            const std::pair<int, int> link = std::make_pair(transaction[1], transaction[2]);
+            if (removeLink(mastr_idx, link, /*check_owner*/ true)) continue;
+            const int other_idx = (mastr_idx == link.first ? link.second : link.first);
+            const int other_owner = ParallelExchangeUtilities::getOwnerRank(other_idx);
+            if (other_owner == SAMRAI_MPI::getRank()) continue;
+            std::vector<int>& other_data = forward_data[other_owner];
+            other_data.push_back(other_idx);
+            other_data.push_back(link.first);
+            other_data.push_back(link.second);
+        }
+    }
+    ParallelExchangeUtilities::exchangeData(forward_data, forward_recv_data);
+    for (std::map<int, std::vector<int> >::const_iterator cit = forward_recv_data.begin();
+         cit != forward_recv_data.end();
+         ++cit)
+    {
+        const std::vector<int>& data = cit->second;
+        const int num_removals = static_cast<int>(data.size()) / SIZE;
+        for (int k = 0; k < num_removals; ++k)
+        {
+            const int* const transaction = &data[SIZE * k];
+            removeLink(transaction[0], std::make_pair(transaction[1], transaction[2]), /*check_owner*/ true);
+        }
+    }
+    return;
+} // communicateDistributedData
+
+bool
+ParallelEdgeMap::removeLink(const int mastr_idx, const std::pair<int, int>& link, const bool check_owner)
+{
+    typedef std::multimap<int, std::pair<int, int> >::iterator multimap_iterator;
+    const int rank = SAMRAI_MPI::getRank();
+    const int idxs[2] = { mastr_idx, (mastr_idx == link.first ? link.second : link.first) };
+    for (int k = 0; k < 2; ++k)
+    {
+        if (check_owner && ParallelExchangeUtilities::getOwnerRank(idxs[k]) != rank) continue;
+        std::pair<multimap_iterator, multimap_iterator> range = d_edge_map.equal_range(idxs[k]);
+        for (multimap_iterator it = range.first; it != range.second; ++it)
+        {
+            if (it->second == link)
+            {
+                d_edge_map.erase(it);
+                return true;
+            }
+        }
+    }
+    return false;
+} // removeLink
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -0,0 +1,214 @@
+// Filename: ParallelExchangeUtilities.cpp
+// Created on 08 Nov 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <map>
+#include <vector>
+
+#include "ibtk/ParallelExchangeUtilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/ShutdownRegistry.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Message tags used by the exchange routines.  Consecutive exchanges alternate
+// between the two tags: a process can be at most one exchange ahead of any
+// other process, and so messages belonging to different exchanges cannot be
+// confused.
+static const int EXCHANGE_TAGS[2] = { 0, 1 };
+static int s_exchange_counter = 0;
+
+// The exchange routines communicate over a duplicate of the SAMRAI
+// communicator so that their messages cannot be matched by other wildcard
+// receives posted on the SAMRAI communicator, or vice versa.
+static MPI_Comm s_exchange_comm = MPI_COMM_NULL;
+static const unsigned char s_shutdown_priority = 200;
+
+void
+free_exchange_communicator()
+{
+    if (s_exchange_comm != MPI_COMM_NULL) MPI_Comm_free(&s_exchange_comm);
+    s_exchange_comm = MPI_COMM_NULL;
+    return;
+} // free_exchange_communicator
+
+MPI_Comm
+get_exchange_communicator()
+{
+    if (s_exchange_comm == MPI_COMM_NULL)
+    {
+        MPI_Comm_dup(SAMRAI_MPI::getCommunicator(), &s_exchange_comm);
+        ShutdownRegistry::registerShutdownRoutine(free_exchange_communicator, s_shutdown_priority);
+    }
+    return s_exchange_comm;
+} // get_exchange_communicator
+
+inline MPI_Datatype
+get_mpi_type(const int*)
+{
+    return MPI_INT;
+} // get_mpi_type
+
+inline MPI_Datatype
+get_mpi_type(const char*)
+{
+    return MPI_CHAR;
+} // get_mpi_type
+
+template <typename T>
+void
+exchange_data(const std::map<int, std::vector<T> >& send_data, std::map<int, std::vector<T> >& recv_data)
+{
+    recv_data.clear();
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+    const MPI_Datatype mpi_type = get_mpi_type(static_cast<const T*>(NULL));
+    const int tag = EXCHANGE_TAGS[s_exchange_counter];
+    s_exchange_counter = (s_exchange_counter + 1) % 2;
+
+    // Post synchronous sends for all nonempty messages.  Data destined for
+    // this process are copied directly.
+    MPI_Comm communicator = get_exchange_communicator();
+    std::vector<MPI_Request> send_reqs;
+    send_reqs.reserve(send_data.size());
+    for (typename std::map<int, std::vector<T> >::const_iterator cit = send_data.begin(); cit != send_data.end();
+         ++cit)
+    {
+        const int dst = cit->first;
+        const std::vector<T>& data = cit->second;
+#if !defined(NDEBUG)
+        TBOX_ASSERT(dst >= 0 && dst < nodes);
+#endif
+        if (data.empty()) continue;
+        if (dst == rank)
+        {
+            recv_data[rank] = data;
+            continue;
+        }
+        send_reqs.push_back(MPI_REQUEST_NULL);
+        MPI_Issend(const_cast<T*>(&data[0]),
+                   static_cast<int>(data.size()),
+                   mpi_type,
+                   dst,
+                   tag,
+                   communicator,
+                   &send_reqs.back());
+    }
+
+    // Receive messages until all processes have had all of their messages
+    // received.  A synchronous send completes only once the matching receive
+    // has started, so once all local sends have completed, this process enters
+    // a nonblocking barrier.  Completion of the barrier indicates that there
+    // are no messages left to receive.
+    bool barrier_active = false;
+    MPI_Request barrier_req = MPI_REQUEST_NULL;
+    int done = 0;
+    while (!done)
+    {
+        int flag = 0;
+        MPI_Status status;
+        MPI_Iprobe(MPI_ANY_SOURCE, tag, communicator, &flag, &status);
+        if (flag)
+        {
+            int count = 0;
+            MPI_Get_count(&status, mpi_type, &count);
+            std::vector<T>& data = recv_data[status.MPI_SOURCE];
+            data.resize(count);
+            MPI_Recv(&data[0], count, mpi_type, status.MPI_SOURCE, tag, communicator, MPI_STATUS_IGNORE);
+        }
+        if (barrier_active)
+        {
+            MPI_Test(&barrier_req, &done, MPI_STATUS_IGNORE);
+        }
+        else
+        {
+            int sends_done = 1;
+            if (!send_reqs.empty())
+            {
+                MPI_Testall(static_cast<int>(send_reqs.size()), &send_reqs[0], &sends_done, MPI_STATUSES_IGNORE);
+            }
+            if (sends_done)
+            {
+                MPI_Ibarrier(communicator, &barrier_req);
+                barrier_active = true;
+            }
+        }
+    }
+    return;
+} // exchange_data
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+int
+ParallelExchangeUtilities::getOwnerRank(const int key)
+{
+    // Use a multiplicative hash so that consecutive keys are spread across
+    // processes.
+    const unsigned int hash = static_cast<unsigned int>(key) * 2654435761u;
+    return static_cast<int>(hash % static_cast<unsigned int>(SAMRAI_MPI::getNodes()));
+} // getOwnerRank
+
+void
+ParallelExchangeUtilities::exchangeData(const std::map<int, std::vector<int> >& send_data,
+                                        std::map<int, std::vector<int> >& recv_data)
+{
+    exchange_data(send_data, recv_data);
+    return;
+} // exchangeData
+
+void
+ParallelExchangeUtilities::exchangeData(const std::map<int, std::vector<char> >& send_data,
+                                        std::map<int, std::vector<char> >& recv_data)
+{
+    exchange_data(send_data, recv_data);
+    return;
+} // exchangeData
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -34,14 +34,17 @@
 
 #include <map>
 #include <ostream>
+#include <set>
 #include <utility>
 #include <vector>
 
 #include "IntVector.h"
 #include "ibtk/FixedSizedStream.h"
+#include "ibtk/ParallelExchangeUtilities.h"
 #include "ibtk/ParallelMap.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/StreamableManager.h"
+#include "ibtk/ibtk_enums.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/AbstractStream.h"
 #include "tbox/Pointer.h"
@@ -56,14 +59,20 @@ namespace IBTK
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
-ParallelMap::ParallelMap() : d_map(), d_pending_additions(), d_pending_removals()
+ParallelMap::ParallelMap(const ParallelDataMode data_mode)
+    : d_data_mode(data_mode), d_map(), d_pending_additions(), d_pending_removals()
 {
-    // intentionally blank
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_data_mode == REPLICATED_DATA || d_data_mode == DISTRIBUTED_DATA);
+#endif
     return;
 } // ParallelMap
 
 ParallelMap::ParallelMap(const ParallelMap& from)
-    : d_map(from.d_map), d_pending_additions(from.d_pending_additions), d_pending_removals(from.d_pending_removals)
+    : d_data_mode(from.d_data_mode),
+      d_map(from.d_map),
+      d_pending_additions(from.d_pending_additions),
+      d_pending_removals(from.d_pending_removals)
 {
     // intentionally blank
     return;
@@ -79,6 +88,7 @@ ParallelMap& ParallelMap::operator=(const ParallelMap& that)
 {
     if (this != &that)
     {
+        d_data_mode = that.d_data_mode;
         d_map = that.d_map;
         d_pending_additions = that.d_pending_additions;
         d_pending_removals = that.d_pending_removals;
@@ -103,6 +113,12 @@ ParallelMap::removeItem(const int key)
 void
 ParallelMap::communicateData()
 {
+    if (d_data_mode == DISTRIBUTED_DATA)
+    {
+        communicateDistributedData();
+        return;
+    }
+
     const int size = SAMRAI_MPI::getNodes();
     const int rank = SAMRAI_MPI::getRank();
 
@@ -234,8 +250,115 @@ ParallelMap::getMap() const
     return d_map;
 } // getMap
 
+ParallelDataMode
+ParallelMap::getDataMode() const
+{
+    return d_data_mode;
+} // getDataMode
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+ParallelMap::communicateDistributedData()
+{
+    StreamableManager* streamable_manager = StreamableManager::getManager();
+
+    // Sort the pending additions and removals by owning process.
+    std::map<int, std::vector<int> > addition_keys_to_send, removal_keys_to_send;
+    std::map<int, std::vector<tbox::Pointer<Streamable> > > addition_items_to_send;
+    for (std::map<int, tbox::Pointer<Streamable> >::const_iterator cit = d_pending_additions.begin();
+         cit != d_pending_additions.end();
+         ++cit)
+    {
+        const int owner = ParallelExchangeUtilities::getOwnerRank(cit->first);
+        addition_keys_to_send[owner].push_back(cit->first);
+        addition_items_to_send[owner].push_back(cit->second);
+    }
+    for (std::vector<int>::const_iterator cit = d_pending_removals.begin(); cit != d_pending_removals.end(); ++cit)
+    {
+        removal_keys_to_send[ParallelExchangeUtilities::getOwnerRank(*cit)].push_back(*cit);
+    }
+    std::set<int> dsts;
+    for (std::map<int, std::vector<int> >::const_iterator cit = addition_keys_to_send.begin();
+         cit != addition_keys_to_send.end();
+         ++cit)
+    {
+        dsts.insert(cit->first);
+    }
+    for (std::map<int, std::vector<int> >::const_iterator cit = removal_keys_to_send.begin();
+         cit != removal_keys_to_send.end();
+         ++cit)
+    {
+        dsts.insert(cit->first);
+    }
+
+    // Pack the data for each owning process.  Each message consists of the
+    // keys and data items to add followed by the keys to remove.
+    std::map<int, std::vector<char> > send_data, recv_data;
+    for (std::set<int>::const_iterator cit = dsts.begin(); cit != dsts.end(); ++cit)
+    {
+        const int dst = *cit;
+        std::vector<int>& addition_keys = addition_keys_to_send[dst];
+        std::vector<tbox::Pointer<Streamable> >& addition_items = addition_items_to_send[dst];
+        std::vector<int>& removal_keys = removal_keys_to_send[dst];
+        const int num_additions = static_cast<int>(addition_keys.size());
+        const int num_removals = static_cast<int>(removal_keys.size());
+        const int data_sz = static_cast<int>(
+            tbox::AbstractStream::sizeofInt() * (2 + num_additions + num_removals) +
+            streamable_manager->getDataStreamSize(addition_items));
+        FixedSizedStream stream(data_sz);
+        stream.pack(&num_additions, 1);
+        if (num_additions > 0) stream.pack(&addition_keys[0], num_additions);
+        streamable_manager->packStream(stream, addition_items);
+        stream.pack(&num_removals, 1);
+        if (num_removals > 0) stream.pack(&removal_keys[0], num_removals);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(stream.getCurrentSize() == data_sz);
+#endif
+        const char* const buffer = static_cast<const char*>(stream.getBufferStart());
+        send_data[dst].assign(buffer, buffer + data_sz);
+    }
+    ParallelExchangeUtilities::exchangeData(send_data, recv_data);
+    d_pending_additions.clear();
+    d_pending_removals.clear();
+
+    // Unpack the received data.  As in the replicated case, all additions are
+    // processed before any removals.
+    std::vector<int> keys_to_remove;
+    for (std::map<int, std::vector<char> >::iterator it = recv_data.begin(); it != recv_data.end(); ++it)
+    {
+        std::vector<char>& buffer = it->second;
+        FixedSizedStream stream(&buffer[0], static_cast<int>(buffer.size()));
+        int num_additions;
+        stream.unpack(&num_additions, 1);
+        std::vector<int> keys_received(num_additions);
+        if (num_additions > 0) stream.unpack(&keys_received[0], num_additions);
+        std::vector<tbox::Pointer<Streamable> > data_items_received;
+        hier::IntVector<NDIM> offset = 0;
+        streamable_manager->unpackStream(stream, offset, data_items_received);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(keys_received.size() == data_items_received.size());
+#endif
+        for (int k = 0; k < num_additions; ++k)
+        {
+            d_map[keys_received[k]] = data_items_received[k];
+        }
+        int num_removals;
+        stream.unpack(&num_removals, 1);
+        if (num_removals > 0)
+        {
+            const std::size_t old_size = keys_to_remove.size();
+            keys_to_remove.resize(old_size + num_removals);
+            stream.unpack(&keys_to_remove[old_size], num_removals);
+        }
+    }
+    for (std::vector<int>::const_iterator cit = keys_to_remove.begin(); cit != keys_to_remove.end(); ++cit)
+    {
+        d_map.erase(*cit);
+    }
+    return;
+} // communicateDistributedData
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
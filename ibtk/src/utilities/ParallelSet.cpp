@@ -32,11 +32,14 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <map>
 #include <ostream>
 #include <set>
 #include <vector>
 
+#include "ibtk/ParallelExchangeUtilities.h"
 #include "ibtk/ParallelSet.h"
+#include "ibtk/ibtk_enums.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/SAMRAI_MPI.h"
 #include "tbox/Utilities.h"
@@ -49,14 +52,20 @@ namespace IBTK
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
-ParallelSet::ParallelSet() : d_set(), d_pending_additions(), d_pending_removals()
+ParallelSet::ParallelSet(const ParallelDataMode data_mode)
+    : d_data_mode(data_mode), d_set(), d_pending_additions(), d_pending_removals()
 {
-    // intentionally blank
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_data_mode == REPLICATED_DATA || d_data_mode == DISTRIBUTED_DATA);
+#endif
     return;
 } // ParallelSet
 
 ParallelSet::ParallelSet(const ParallelSet& from)
-    : d_set(from.d_set), d_pending_additions(from.d_pending_additions), d_pending_removals(from.d_pending_removals)
+    : d_data_mode(from.d_data_mode),
+      d_set(from.d_set),
+      d_pending_additions(from.d_pending_additions),
+      d_pending_removals(from.d_pending_removals)
 {
     // intentionally blank
     return;
@@ -72,6 +81,7 @@ ParallelSet& ParallelSet::operator=(const ParallelSet& that)
 {
     if (this != &that)
     {
+        d_data_mode = that.d_data_mode;
         d_set = that.d_set;
         d_pending_additions = that.d_pending_additions;
         d_pending_removals = that.d_pending_removals;
@@ -96,6 +106,12 @@ ParallelSet::removeItem(const int key)
 void
 ParallelSet::communicateData()
 {
+    if (d_data_mode == DISTRIBUTED_DATA)
+    {
+        communicateDistributedData();
+        return;
+    }
+
     const int size = SAMRAI_MPI::getNodes();
     const int rank = SAMRAI_MPI::getRank();
 
@@ -191,8 +207,69 @@ ParallelSet::getSet() const
     return d_set;
 } // getSet
 
+ParallelDataMode
+ParallelSet::getDataMode() const
+{
+    return d_data_mode;
+} // getDataMode
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+ParallelSet::communicateDistributedData()
+{
+    // Route pending additions and removals to the owning processes.  Each
+    // message consists of the number of additions, the keys to add, and the
+    // keys to remove.
+    std::map<int, std::vector<int> > additions_to_send, removals_to_send;
+    for (std::vector<int>::const_iterator cit = d_pending_additions.begin(); cit != d_pending_additions.end(); ++cit)
+    {
+        additions_to_send[ParallelExchangeUtilities::getOwnerRank(*cit)].push_back(*cit);
+    }
+    for (std::vector<int>::const_iterator cit = d_pending_removals.begin(); cit != d_pending_removals.end(); ++cit)
+    {
+        removals_to_send[ParallelExchangeUtilities::getOwnerRank(*cit)].push_back(*cit);
+    }
+    std::map<int, std::vector<int> > send_data, recv_data;
+    for (std::map<int, std::vector<int> >::const_iterator cit = additions_to_send.begin();
+         cit != additions_to_send.end();
+         ++cit)
+    {
+        std::vector<int>& data = send_data[cit->first];
+        data.push_back(static_cast<int>(cit->second.size()));
+        data.insert(data.end(), cit->second.begin(), cit->second.end());
+    }
+    for (std::map<int, std::vector<int> >::const_iterator cit = removals_to_send.begin();
+         cit != removals_to_send.end();
+         ++cit)
+    {
+        std::vector<int>& data = send_data[cit->first];
+        if (data.empty()) data.push_back(0);
+        data.insert(data.end(), cit->second.begin(), cit->second.end());
+    }
+    ParallelExchangeUtilities::exchangeData(send_data, recv_data);
+    d_pending_additions.clear();
+    d_pending_removals.clear();
+
+    // Add all received items, and then remove all received items.
+    for (std::map<int, std::vector<int> >::const_iterator cit = recv_data.begin(); cit != recv_data.end(); ++cit)
+    {
+        const std::vector<int>& data = cit->second;
+        const int num_additions = data[0];
+        d_set.insert(data.begin() + 1, data.begin() + 1 + num_additions);
+    }
+    for (std::map<int, std::vector<int> >::const_iterator cit = recv_data.begin(); cit != recv_data.end(); ++cit)
+    {
+        const std::vector<int>& data = cit->second;
+        const int num_additions = data[0];
+        for (std::vector<int>::const_iterator it = data.begin() + 1 + num_additions; it != data.end(); ++it)
+        {
+            d_set.erase(*it);
+        }
+    }
+    return;
+} // communicateDistributedData
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
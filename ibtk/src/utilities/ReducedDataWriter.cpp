@@ -0,0 +1,594 @@
+// Filename: ReducedDataWriter.cpp
+// Created on 06 Dec 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Box.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "CellIndex.h"
+#include "CellVariable.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "Variable.h"
+#include "VariableDatabase.h"
+#include "ibtk/ReducedDataWriter.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Array.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Version number and markers for the reduced data stream format.  If the
+// format is changed, the version number must be incremented and the Python
+// reader must be updated accordingly.
+static const int32_t REDUCED_DATA_VERSION = 1;
+static const char REDUCED_DATA_MAGIC[8] = { 'I', 'B', 'T', 'K', 'R', 'E', 'D', '\0' };
+static const int32_t BYTE_ORDER_MARKER = 0x01020304;
+static const int32_t RECORD_MARKER = 0x52454344;
+
+template <class T>
+inline void
+write_value(std::ostream& os, const T& val)
+{
+    os.write(reinterpret_cast<const char*>(&val), sizeof(T));
+    return;
+} // write_value
+
+inline void
+append_varint(uint64_t val, std::vector<unsigned char>& out)
+{
+    while (val >= 0x80)
+    {
+        out.push_back(static_cast<unsigned char>((val & 0x7f) | 0x80));
+        val >>= 7;
+    }
+    out.push_back(static_cast<unsigned char>(val));
+    return;
+} // append_varint
+
+// Split a sequence of words into byte planes, ordered from least to most
+// significant byte, so that the (typically zero) high-order bytes of small
+// values are stored contiguously.
+template <class UInt>
+void
+shuffle_bytes(const std::vector<UInt>& words, std::vector<unsigned char>& planes)
+{
+    const size_t n = words.size();
+    planes.resize(n * sizeof(UInt));
+    for (size_t b = 0; b < sizeof(UInt); ++b)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            planes[b * n + i] = static_cast<unsigned char>(words[i] >> (8 * b));
+        }
+    }
+    return;
+} // shuffle_bytes
+
+// Encode runs of zero bytes.  The encoded data are a sequence of tokens, each
+// consisting of a literal byte count, the literal bytes, and a count of zero
+// bytes.  Counts are stored as variable-length (LEB128) integers.
+void
+encode_zero_runs(const std::vector<unsigned char>& in, std::vector<unsigned char>& out)
+{
+    out.clear();
+    const size_t n = in.size();
+    size_t i = 0;
+    while (i < n)
+    {
+        const size_t literal_start = i;
+        while (i < n && !(in[i] == 0 && (i + 1 == n || in[i + 1] == 0))) ++i;
+        const size_t zero_start = i;
+        while (i < n && in[i] == 0) ++i;
+        append_varint(zero_start - literal_start, out);
+        out.insert(out.end(), in.begin() + literal_start, in.begin() + zero_start);
+        append_varint(i - zero_start, out);
+    }
+    return;
+} // encode_zero_runs
+
+// Store values without compression, in native byte order.
+template <class Real>
+void
+encode_raw(const std::vector<double>& vals, std::vector<unsigned char>& out)
+{
+    out.resize(vals.size() * sizeof(Real));
+    for (size_t i = 0; i < vals.size(); ++i)
+    {
+        const Real val = static_cast<Real>(vals[i]);
+        std::memcpy(&out[i * sizeof(Real)], &val, sizeof(Real));
+    }
+    return;
+} // encode_raw
+
+// Losslessly compress values by XORing the bit pattern of each value with
+// that of its predecessor.  Smooth data produce XOR residuals with many zero
+// bytes, which are removed by byte shuffling and zero-run encoding.
+template <class Real, class UInt>
+void
+encode_lossless(const std::vector<double>& vals, std::vector<unsigned char>& out)
+{
+    std::vector<UInt> words(vals.size());
+    UInt prev = 0;
+    for (size_t i = 0; i < vals.size(); ++i)
+    {
+        const Real val = static_cast<Real>(vals[i]);
+        UInt bits;
+        std::memcpy(&bits, &val, sizeof(UInt));
+        words[i] = bits ^ prev;
+        prev = bits;
+    }
+    std::vector<unsigned char> planes;
+    shuffle_bytes(words, planes);
+    encode_zero_runs(planes, out);
+    return;
+} // encode_lossless
+
+// Compress values subject to an absolute error bound by quantizing them to
+// bins of width 2*tol.  The differences between consecutive bin indices are
+// zigzag encoded, byte shuffled, and zero-run encoded.
+void
+encode_error_bounded(const std::vector<double>& vals,
+                     const double tol,
+                     std::vector<unsigned char>& out,
+                     const std::string& object_name)
+{
+    const double bin_width = 2.0 * tol;
+    std::vector<uint64_t> words(vals.size());
+    int64_t prev = 0;
+    for (size_t i = 0; i < vals.size(); ++i)
+    {
+        const double q = std::floor(vals[i] / bin_width + 0.5);
+        if (!(std::abs(q) < 4.0e18))
+        {
+            TBOX_ERROR(object_name << "::writePlotData():\n"
+                                   << "  value " << vals[i] << " cannot be quantized with error tolerance " << tol
+                                   << std::endl);
+        }
+        const int64_t q_idx = static_cast<int64_t>(q);
+        const int64_t delta = q_idx - prev;
+        prev = q_idx;
+        words[i] = (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63);
+    }
+    std::vector<unsigned char> planes;
+    shuffle_bytes(words, planes);
+    encode_zero_runs(planes, out);
+    return;
+} // encode_error_bounded
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+ReducedDataWriter::ReducedDataWriter(const std::string& object_name,
+                                     const std::string& dump_dirname,
+                                     Pointer<Database> input_db)
+    : d_object_name(object_name),
+      d_dump_dirname(dump_dirname),
+      d_input_db(input_db),
+      d_default_settings(),
+      d_selected_variables(),
+      d_plot_items(),
+      d_created_dump_dirname(false)
+{
+    if (d_dump_dirname.empty())
+    {
+        TBOX_ERROR(d_object_name << "::ReducedDataWriter():\n"
+                                 << "  dump directory name is empty" << std::endl);
+    }
+
+    // Set default reduction settings.
+    d_default_settings.crop = false;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        d_default_settings.x_lo[d] = 0.0;
+        d_default_settings.x_up[d] = 0.0;
+    }
+    d_default_settings.stride = 1;
+    d_default_settings.single_precision = false;
+    d_default_settings.compression = NO_COMPRESSION;
+    d_default_settings.error_tol = 0.0;
+
+    // Read values from input.
+    if (d_input_db)
+    {
+        if (d_input_db->keyExists("variables"))
+        {
+            const Array<std::string> variables = d_input_db->getStringArray("variables");
+            for (int k = 0; k < variables.getSize(); ++k)
+            {
+                d_selected_variables.push_back(variables[k]);
+            }
+        }
+        getSettingsFromDatabase(d_input_db, d_default_settings);
+    }
+    return;
+} // ReducedDataWriter
+
+ReducedDataWriter::~ReducedDataWriter()
+{
+    // intentionally blank
+    return;
+} // ~ReducedDataWriter
+
+void
+ReducedDataWriter::registerPlotQuantity(const std::string& variable_name,
+                                        const std::string& variable_type,
+                                        const int patch_data_index,
+                                        const int start_depth_id,
+                                        const double scale_factor)
+{
+    // Skip quantities that have not been selected for output.
+    if (!d_selected_variables.empty() &&
+        std::find(d_selected_variables.begin(), d_selected_variables.end(), variable_name) ==
+            d_selected_variables.end())
+    {
+        return;
+    }
+
+    // Only cell-centered quantities are supported.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<Variable<NDIM> > var;
+    var_db->mapIndexToVariable(patch_data_index, var);
+    Pointer<CellVariable<NDIM, double> > cc_var = var;
+    if (!cc_var)
+    {
+        TBOX_WARNING(d_object_name << "::registerPlotQuantity():\n"
+                                   << "  quantity `" << variable_name
+                                   << "' is not a cell-centered double precision quantity and will not be written"
+                                   << std::endl);
+        return;
+    }
+
+    PlotItem item;
+    item.name = variable_name;
+    item.patch_data_idx = patch_data_index;
+    item.start_depth = start_depth_id;
+    item.scale = scale_factor;
+    if (variable_type == "SCALAR")
+    {
+        item.num_components = 1;
+    }
+    else if (variable_type == "VECTOR")
+    {
+        item.num_components = NDIM;
+    }
+    else if (variable_type == "TENSOR")
+    {
+        item.num_components = NDIM * NDIM;
+    }
+    else
+    {
+        TBOX_ERROR(d_object_name << "::registerPlotQuantity():\n"
+                                 << "  unknown variable type " << variable_type << " for quantity `"
+                                 << variable_name << "'" << std::endl);
+    }
+
+    // Determine the reduction settings for this quantity.
+    item.settings = d_default_settings;
+    std::string db_name = variable_name;
+    std::replace(db_name.begin(), db_name.end(), ' ', '_');
+    if (d_input_db && d_input_db->isDatabase(db_name))
+    {
+        getSettingsFromDatabase(d_input_db->getDatabase(db_name), item.settings);
+    }
+    if (item.settings.compression == ERROR_BOUNDED_COMPRESSION && !(item.settings.error_tol > 0.0))
+    {
+        TBOX_ERROR(d_object_name << "::registerPlotQuantity():\n"
+                                 << "  error-bounded compression of quantity `" << variable_name
+                                 << "' requires a positive error tolerance" << std::endl);
+    }
+
+    // Replace any previous registration of the same quantity.
+    for (std::vector<PlotItem>::iterator it = d_plot_items.begin(); it != d_plot_items.end(); ++it)
+    {
+        if (it->name == variable_name)
+        {
+            *it = item;
+            return;
+        }
+    }
+    d_plot_items.push_back(item);
+    return;
+} // registerPlotQuantity
+
+void
+ReducedDataWriter::writePlotData(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                 const int time_step_number,
+                                 const double simulation_time)
+{
+    if (!d_created_dump_dirname)
+    {
+        Utilities::recursiveMkdir(d_dump_dirname);
+        SAMRAI_MPI::barrier();
+        d_created_dump_dirname = true;
+    }
+
+    // Each process appends its data to its own stream.
+    const std::string file_name =
+        d_dump_dirname + "/reduced_data.proc_" + Utilities::intToString(SAMRAI_MPI::getRank(), 6) + ".bin";
+    std::ofstream os(file_name.c_str(), std::ios::out | std::ios::binary | std::ios::app);
+    if (!os.good())
+    {
+        TBOX_ERROR(d_object_name << "::writePlotData():\n"
+                                 << "  unable to open file " << file_name << std::endl);
+    }
+    os.seekp(0, std::ios::end);
+    if (os.tellp() == std::streampos(0))
+    {
+        os.write(REDUCED_DATA_MAGIC, sizeof(REDUCED_DATA_MAGIC));
+        write_value(os, BYTE_ORDER_MARKER);
+        write_value(os, REDUCED_DATA_VERSION);
+        write_value(os, static_cast<int32_t>(NDIM));
+    }
+
+    double full_bytes = 0.0, written_bytes = 0.0;
+    std::vector<double> vals;
+    std::vector<unsigned char> payload;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    for (std::vector<PlotItem>::const_iterator it = d_plot_items.begin(); it != d_plot_items.end(); ++it)
+    {
+        const PlotItem& item = *it;
+        const ReductionSettings& settings = item.settings;
+        const int stride = settings.stride;
+        const int value_size = settings.single_precision ? sizeof(float) : sizeof(double);
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            if (!settings.levels.empty() &&
+                std::find(settings.levels.begin(), settings.levels.end(), ln) == settings.levels.end())
+            {
+                continue;
+            }
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            if (!level->checkAllocated(item.patch_data_idx)) continue;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                const double* const dx = pgeom->getDx();
+                const double* const patch_x_lo = pgeom->getXLower();
+                full_bytes += static_cast<double>(item.num_components * value_size) * patch_box.size();
+
+                // Determine the strided, cropped range of cell indices to
+                // output.  Samples are aligned to multiples of the stride so
+                // that the sampled grid is the same on all patches.
+                int32_t first[NDIM], num[NDIM];
+                size_t num_samples = 1;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    int lo = patch_box.lower(d), hi = patch_box.upper(d);
+                    if (settings.crop)
+                    {
+                        const double max_offset = patch_box.numberCells(d) + 1.0;
+                        const double crop_lo = std::min(
+                            std::max((settings.x_lo[d] - patch_x_lo[d]) / dx[d] - 0.5, -1.0), max_offset);
+                        const double crop_up = std::min(
+                            std::max((settings.x_up[d] - patch_x_lo[d]) / dx[d] - 0.5, -1.0), max_offset);
+                        lo = std::max(lo, patch_box.lower(d) + static_cast<int>(std::ceil(crop_lo)));
+                        hi = std::min(hi, patch_box.lower(d) + static_cast<int>(std::floor(crop_up)));
+                    }
+                    const int r = ((lo % stride) + stride) % stride;
+                    first[d] = (r == 0 ? lo : lo + stride - r);
+                    num[d] = (first[d] <= hi ? (hi - first[d]) / stride + 1 : 0);
+                    num_samples *= num[d];
+                }
+                if (num_samples == 0) continue;
+
+                double x_first[NDIM], dx_sample[NDIM];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    x_first[d] = patch_x_lo[d] + dx[d] * (static_cast<double>(first[d] - patch_box.lower(d)) + 0.5);
+                    dx_sample[d] = dx[d] * stride;
+                }
+
+                Pointer<CellData<NDIM, double> > data = patch->getPatchData(item.patch_data_idx);
+                vals.resize(num_samples);
+                for (int comp = 0; comp < item.num_components; ++comp)
+                {
+                    // Gather the samples in column-major order.
+                    const int depth = item.start_depth + comp;
+                    int offset[NDIM];
+                    for (unsigned int d = 0; d < NDIM; ++d) offset[d] = 0;
+                    for (size_t k = 0; k < num_samples; ++k)
+                    {
+                        CellIndex<NDIM> i;
+                        for (unsigned int d = 0; d < NDIM; ++d) i(d) = first[d] + stride * offset[d];
+                        vals[k] = item.scale * (*data)(i, depth);
+                        for (unsigned int d = 0; d < NDIM; ++d)
+                        {
+                            if (++offset[d] < num[d]) break;
+                            offset[d] = 0;
+                        }
+                    }
+
+                    // Encode the samples.
+                    switch (settings.compression)
+                    {
+                    case NO_COMPRESSION:
+                        if (settings.single_precision)
+                            encode_raw<float>(vals, payload);
+                        else
+                            encode_raw<double>(vals, payload);
+                        break;
+                    case LOSSLESS_COMPRESSION:
+                        if (settings.single_precision)
+                            encode_lossless<float, uint32_t>(vals, payload);
+                        else
+                            encode_lossless<double, uint64_t>(vals, payload);
+                        break;
+                    case ERROR_BOUNDED_COMPRESSION:
+                        encode_error_bounded(vals, settings.error_tol, payload, d_object_name);
+                        break;
+                    default:
+                        TBOX_ERROR("this statement should not be reached");
+                    }
+                    written_bytes += payload.size();
+
+                    // Write the record.
+                    write_value(os, RECORD_MARKER);
+                    write_value(os, static_cast<int32_t>(item.name.size()));
+                    os.write(item.name.data(), item.name.size());
+                    write_value(os, static_cast<int32_t>(time_step_number));
+                    write_value(os, simulation_time);
+                    write_value(os, static_cast<int32_t>(ln));
+                    write_value(os, static_cast<int32_t>(comp));
+                    write_value(os, static_cast<int32_t>(stride));
+                    for (unsigned int d = 0; d < NDIM; ++d) write_value(os, num[d]);
+                    for (unsigned int d = 0; d < NDIM; ++d) write_value(os, first[d]);
+                    for (unsigned int d = 0; d < NDIM; ++d) write_value(os, x_first[d]);
+                    for (unsigned int d = 0; d < NDIM; ++d) write_value(os, dx_sample[d]);
+                    write_value(os, static_cast<int32_t>(value_size));
+                    write_value(os, static_cast<int32_t>(settings.compression));
+                    write_value(os, settings.error_tol);
+                    write_value(os, static_cast<int64_t>(num_samples));
+                    write_value(os, static_cast<int64_t>(payload.size()));
+                    if (!payload.empty()) os.write(reinterpret_cast<const char*>(&payload[0]), payload.size());
+                }
+            }
+        }
+    }
+    os.close();
+    if (!os)
+    {
+        TBOX_ERROR(d_object_name << "::writePlotData():\n"
+                                 << "  error writing file " << file_name << std::endl);
+    }
+
+    full_bytes = SAMRAI_MPI::sumReduction(full_bytes);
+    written_bytes = SAMRAI_MPI::sumReduction(written_bytes);
+    plog << d_object_name << "::writePlotData(): wrote " << written_bytes << " bytes for " << full_bytes
+         << " bytes of full-resolution plot data\n";
+    return;
+} // writePlotData
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+ReducedDataWriter::getSettingsFromDatabase(Pointer<Database> db, ReductionSettings& settings) const
+{
+    if (db->keyExists("levels"))
+    {
+        const Array<int> levels = db->getIntegerArray("levels");
+        settings.levels.clear();
+        for (int k = 0; k < levels.getSize(); ++k) settings.levels.push_back(levels[k]);
+    }
+    if (db->keyExists("x_lo") || db->keyExists("x_up"))
+    {
+        if (!db->keyExists("x_lo") || !db->keyExists("x_up"))
+        {
+            TBOX_ERROR(d_object_name << "::getSettingsFromDatabase():\n"
+                                     << "  both x_lo and x_up must be specified to crop output" << std::endl);
+        }
+        db->getDoubleArray("x_lo", settings.x_lo, NDIM);
+        db->getDoubleArray("x_up", settings.x_up, NDIM);
+        settings.crop = true;
+    }
+    if (db->keyExists("stride"))
+    {
+        settings.stride = db->getInteger("stride");
+        if (settings.stride < 1)
+        {
+            TBOX_ERROR(d_object_name << "::getSettingsFromDatabase():\n"
+                                     << "  stride must be positive" << std::endl);
+        }
+    }
+    if (db->keyExists("precision"))
+    {
+        const std::string precision = db->getString("precision");
+        if (precision == "FLOAT")
+        {
+            settings.single_precision = true;
+        }
+        else if (precision == "DOUBLE")
+        {
+            settings.single_precision = false;
+        }
+        else
+        {
+            TBOX_ERROR(d_object_name << "::getSettingsFromDatabase():\n"
+                                     << "  unknown precision " << precision << std::endl);
+        }
+    }
+    if (db->keyExists("compression"))
+    {
+        const std::string compression = db->getString("compression");
+        if (compression == "NONE")
+        {
+            settings.compression = NO_COMPRESSION;
+        }
+        else if (compression == "LOSSLESS")
+        {
+            settings.compression = LOSSLESS_COMPRESSION;
+        }
+        else if (compression == "ERROR_BOUNDED")
+        {
+            settings.compression = ERROR_BOUNDED_COMPRESSION;
+        }
+        else
+        {
+            TBOX_ERROR(d_object_name << "::getSettingsFromDatabase():\n"
+                                     << "  unknown compression type " << compression << std::endl);
+        }
+    }
+    if (db->keyExists("error_tolerance")) settings.error_tol = db->getDouble("error_tolerance");
+    return;
+} // getSettingsFromDatabase
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
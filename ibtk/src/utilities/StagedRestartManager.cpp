@@ -0,0 +1,244 @@
+// Filename: StagedRestartManager.cpp
+// Created on 04 Dec 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <pthread.h>
+#include <ostream>
+#include <string>
+
+#include "hdf5.h"
+#include "ibtk/StagedRestartManager.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/Array.h"
+#include "tbox/Complex.h"
+#include "tbox/Database.h"
+#include "tbox/DatabaseBox.h"
+#include "tbox/HDFDatabase.h"
+#include "tbox/MemoryDatabase.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/RestartManager.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/ShutdownRegistry.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Recursively copy the contents of one database to another.
+void
+copy_database(Pointer<Database> src_db, Pointer<Database> dst_db)
+{
+    const Array<std::string> keys = src_db->getAllKeys();
+    for (int k = 0; k < keys.getSize(); ++k)
+    {
+        const std::string& key = keys[k];
+        switch (src_db->getArrayType(key))
+        {
+        case Database::SAMRAI_DATABASE:
+            copy_database(src_db->getDatabase(key), dst_db->putDatabase(key));
+            break;
+        case Database::SAMRAI_BOOL:
+            dst_db->putBoolArray(key, src_db->getBoolArray(key));
+            break;
+        case Database::SAMRAI_CHAR:
+            dst_db->putCharArray(key, src_db->getCharArray(key));
+            break;
+        case Database::SAMRAI_COMPLEX:
+            dst_db->putComplexArray(key, src_db->getComplexArray(key));
+            break;
+        case Database::SAMRAI_DOUBLE:
+            dst_db->putDoubleArray(key, src_db->getDoubleArray(key));
+            break;
+        case Database::SAMRAI_FLOAT:
+            dst_db->putFloatArray(key, src_db->getFloatArray(key));
+            break;
+        case Database::SAMRAI_INTEGER:
+            dst_db->putIntegerArray(key, src_db->getIntegerArray(key));
+            break;
+        case Database::SAMRAI_STRING:
+            dst_db->putStringArray(key, src_db->getStringArray(key));
+            break;
+        case Database::SAMRAI_BOX:
+            dst_db->putDatabaseBoxArray(key, src_db->getDatabaseBoxArray(key));
+            break;
+        default:
+            break;
+        }
+    }
+    return;
+} // copy_database
+}
+
+StagedRestartManager* StagedRestartManager::s_staged_restart_manager_instance = NULL;
+bool StagedRestartManager::s_registered_callback = false;
+unsigned char StagedRestartManager::s_shutdown_priority = 200;
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+StagedRestartManager*
+StagedRestartManager::getManager()
+{
+    if (!s_staged_restart_manager_instance)
+    {
+        s_staged_restart_manager_instance = new StagedRestartManager();
+    }
+    if (!s_registered_callback)
+    {
+        ShutdownRegistry::registerShutdownRoutine(freeManager, s_shutdown_priority);
+        s_registered_callback = true;
+    }
+    return s_staged_restart_manager_instance;
+} // getManager
+
+void
+StagedRestartManager::freeManager()
+{
+    delete s_staged_restart_manager_instance;
+    s_staged_restart_manager_instance = NULL;
+    return;
+} // freeManager
+
+void
+StagedRestartManager::initialize(Pointer<Database> input_db)
+{
+    if (!input_db) return;
+    if (input_db->keyExists("asynchronous")) d_asynchronous = input_db->getBool("asynchronous");
+    return;
+} // initialize
+
+void
+StagedRestartManager::writeRestartFile(const std::string& root_dirname, const int restore_num)
+{
+    // Complete the previous write before staging new data.
+    waitForCompletion();
+
+    // Create the restart directory, using the same layout as the SAMRAI
+    // RestartManager.
+    const std::string restart_dirname = root_dirname + "/restore." + Utilities::intToString(restore_num, 6) +
+                                        "/nodes." + Utilities::nodeToString(SAMRAI_MPI::getNodes());
+    d_staged_file_name = restart_dirname + "/proc." + Utilities::processorToString(SAMRAI_MPI::getRank());
+    Utilities::recursiveMkdir(restart_dirname);
+    SAMRAI_MPI::barrier();
+
+    // Stage the restart data by writing them to an in-memory database.
+    const double stage_start_time = MPI_Wtime();
+    d_staged_db = new MemoryDatabase(d_staged_file_name);
+    RestartManager::getManager()->writeRestartToDatabase(d_staged_db);
+    plog << "StagedRestartManager::writeRestartFile(): staged restart data in " << MPI_Wtime() - stage_start_time
+         << " s\n";
+
+    // Write the staged data, in the background if possible.
+    if (d_asynchronous)
+    {
+        if (pthread_create(&d_thread, NULL, writeStagedDataThread, this) == 0)
+        {
+            d_thread_active = true;
+            return;
+        }
+        TBOX_WARNING("StagedRestartManager::writeRestartFile():\n"
+                     << "  unable to create background thread; writing restart data synchronously" << std::endl);
+    }
+    writeStagedData();
+    d_staged_db.setNull();
+    return;
+} // writeRestartFile
+
+void
+StagedRestartManager::waitForCompletion()
+{
+    if (!d_thread_active) return;
+    const double wait_start_time = MPI_Wtime();
+    pthread_join(d_thread, NULL);
+    d_thread_active = false;
+    d_staged_db.setNull();
+    plog << "StagedRestartManager::waitForCompletion(): waited " << MPI_Wtime() - wait_start_time
+         << " s for restart data to be written\n";
+    return;
+} // waitForCompletion
+
+bool
+StagedRestartManager::isWritePending() const
+{
+    return d_thread_active;
+} // isWritePending
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+StagedRestartManager::StagedRestartManager()
+    : d_asynchronous(false), d_staged_db(NULL), d_staged_file_name(), d_thread(), d_thread_active(false)
+{
+#if defined(H5_HAVE_THREADSAFE)
+    d_asynchronous = true;
+#endif
+    return;
+} // StagedRestartManager
+
+StagedRestartManager::~StagedRestartManager()
+{
+    waitForCompletion();
+    return;
+} // ~StagedRestartManager
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+StagedRestartManager::writeStagedData()
+{
+    // NOTE: This method may be called from the background thread, and so it
+    // must not perform any MPI communication.
+    Pointer<HDFDatabase> restart_db = new HDFDatabase(d_staged_file_name);
+    restart_db->create(d_staged_file_name);
+    copy_database(d_staged_db, restart_db);
+    restart_db->close();
+    return;
+} // writeStagedData
+
+void*
+StagedRestartManager::writeStagedDataThread(void* manager)
+{
+    static_cast<StagedRestartManager*>(manager)->writeStagedData();
+    return NULL;
+} // writeStagedDataThread
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
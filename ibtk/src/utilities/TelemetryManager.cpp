@@ -0,0 +1,436 @@
+// Filename: TelemetryManager.cpp
+// Created on 20 Nov 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ibtk/TelemetryManager.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/Array.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/ShutdownRegistry.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Categories of recorded values.
+enum FieldType
+{
+    STEP_FIELD,
+    TIMER_FIELD,
+    COUNTER_FIELD
+};
+
+// Number of precision digits used when writing records.
+static const int PRECISION = 12;
+
+// Reduction operation that simultaneously computes the minimum, maximum, and
+// sum of values that are stored as (min,max,sum) triples.  The length is the
+// number of triples, each of which is a single element of a contiguous MPI
+// datatype, so that implementations that segment messages never split a
+// triple.
+void
+reduce_min_max_sum(void* in, void* inout, int* len, MPI_Datatype* /*datatype*/)
+{
+    const double* const in_vals = static_cast<const double*>(in);
+    double* const inout_vals = static_cast<double*>(inout);
+    for (int k = 0; k < *len; ++k)
+    {
+        inout_vals[3 * k] = std::min(inout_vals[3 * k], in_vals[3 * k]);
+        inout_vals[3 * k + 1] = std::max(inout_vals[3 * k + 1], in_vals[3 * k + 1]);
+        inout_vals[3 * k + 2] += in_vals[3 * k + 2];
+    }
+    return;
+} // reduce_min_max_sum
+
+inline std::string
+escape_string(const std::string& str)
+{
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (std::string::const_iterator it = str.begin(); it != str.end(); ++it)
+    {
+        if (*it == '"' || *it == '\\') escaped.push_back('\\');
+        escaped.push_back(*it);
+    }
+    return escaped;
+} // escape_string
+
+inline void
+write_json_stats(std::ostream& os, const std::string& name, const double* const min_max_sum, const int num_procs)
+{
+    os << "\"" << escape_string(name) << "\":{\"min\":" << min_max_sum[0] << ",\"max\":" << min_max_sum[1]
+       << ",\"avg\":" << min_max_sum[2] / static_cast<double>(num_procs) << "}";
+    return;
+} // write_json_stats
+}
+
+TelemetryManager* TelemetryManager::s_telemetry_manager_instance = NULL;
+bool TelemetryManager::s_registered_callback = false;
+unsigned char TelemetryManager::s_shutdown_priority = 200;
+bool TelemetryManager::s_enabled = false;
+
+TelemetryManager*
+TelemetryManager::getManager()
+{
+    if (!s_telemetry_manager_instance)
+    {
+        s_telemetry_manager_instance = new TelemetryManager();
+    }
+    if (!s_registered_callback)
+    {
+        ShutdownRegistry::registerShutdownRoutine(freeManager, s_shutdown_priority);
+        s_registered_callback = true;
+    }
+    return s_telemetry_manager_instance;
+} // getManager
+
+void
+TelemetryManager::freeManager()
+{
+    delete s_telemetry_manager_instance;
+    s_telemetry_manager_instance = NULL;
+    return;
+} // freeManager
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+TelemetryManager::initialize(Pointer<Database> input_db)
+{
+    if (d_is_initialized) return;
+    d_is_initialized = true;
+    if (!input_db) return;
+
+    bool enable = true;
+    if (input_db->keyExists("enable")) enable = input_db->getBool("enable");
+    if (input_db->keyExists("output_file")) d_output_file = input_db->getString("output_file");
+    if (input_db->keyExists("format"))
+    {
+        const std::string format = input_db->getString("format");
+        if (format == "JSON_LINES")
+        {
+            d_format = JSON_LINES;
+        }
+        else if (format == "CSV")
+        {
+            d_format = CSV;
+        }
+        else
+        {
+            TBOX_ERROR("TelemetryManager::initialize():\n"
+                       << "  unrecognized output format: "
+                       << format
+                       << "\n"
+                       << "  valid choices are: JSON_LINES, CSV\n");
+        }
+    }
+    if (input_db->keyExists("timers"))
+    {
+        const Array<std::string> timer_names = input_db->getStringArray("timers");
+        for (int k = 0; k < timer_names.getSize(); ++k)
+        {
+            d_timer_names.push_back(timer_names[k]);
+        }
+    }
+    if (input_db->keyExists("flush_interval")) d_flush_interval = input_db->getInteger("flush_interval");
+    if (d_flush_interval < 1)
+    {
+        TBOX_ERROR("TelemetryManager::initialize():\n"
+                   << "  flush_interval must be positive\n");
+    }
+    if (!enable) return;
+
+    for (std::vector<std::string>::const_iterator cit = d_timer_names.begin(); cit != d_timer_names.end(); ++cit)
+    {
+        d_timers.push_back(TimerManager::getManager()->getTimer(*cit));
+    }
+    d_timer_start_vals.resize(d_timers.size(), 0.0);
+    MPI_Type_contiguous(3, MPI_DOUBLE, &d_reduction_type);
+    MPI_Type_commit(&d_reduction_type);
+    MPI_Op_create(reduce_min_max_sum, /*commute*/ 1, &d_reduction_op);
+    s_enabled = true;
+    return;
+} // initialize
+
+int
+TelemetryManager::registerCounter(const std::string& name)
+{
+    std::map<std::string, int>::const_iterator cit = d_counter_ids.find(name);
+    if (cit != d_counter_ids.end()) return cit->second;
+    const int counter_id = static_cast<int>(d_counter_vals.size());
+    d_counter_ids[name] = counter_id;
+    d_counter_vals.push_back(0.0);
+    return counter_id;
+} // registerCounter
+
+void
+TelemetryManager::beginStep(const int step_num, const double current_time, const double dt)
+{
+    if (!s_enabled) return;
+    d_in_step = true;
+    d_step_num = step_num;
+    d_step_time = current_time;
+    d_step_dt = dt;
+    for (unsigned int k = 0; k < d_timers.size(); ++k)
+    {
+        d_timer_start_vals[k] = d_timers[k]->getTotalWallclockTime();
+    }
+    std::fill(d_counter_vals.begin(), d_counter_vals.end(), 0.0);
+    d_step_start_wtime = MPI_Wtime();
+    return;
+} // beginStep
+
+void
+TelemetryManager::endStep()
+{
+    if (!s_enabled || !d_in_step) return;
+    const double step_wtime = MPI_Wtime() - d_step_start_wtime;
+    d_in_step = false;
+
+    // Complete the reduction for the previous timestep before reusing the
+    // communication buffers.
+    completeReduction();
+
+    // Pack the local values as (min,max,sum) triples.  Counters are packed in
+    // order of their names so that the layout is independent of the order in
+    // which they were registered on each process.
+    d_pending_step_num = d_step_num;
+    d_pending_step_time = d_step_time;
+    d_pending_step_dt = d_step_dt;
+    d_pending_field_names.clear();
+    d_pending_field_types.clear();
+    std::vector<double> vals;
+    d_pending_field_names.push_back("step_wall_time");
+    d_pending_field_types.push_back(STEP_FIELD);
+    vals.push_back(step_wtime);
+    for (unsigned int k = 0; k < d_timers.size(); ++k)
+    {
+        d_pending_field_names.push_back(d_timer_names[k]);
+        d_pending_field_types.push_back(TIMER_FIELD);
+        vals.push_back(d_timers[k]->getTotalWallclockTime() - d_timer_start_vals[k]);
+    }
+    for (std::map<std::string, int>::const_iterator cit = d_counter_ids.begin(); cit != d_counter_ids.end(); ++cit)
+    {
+        d_pending_field_names.push_back(cit->first);
+        d_pending_field_types.push_back(COUNTER_FIELD);
+        vals.push_back(d_counter_vals[cit->second]);
+    }
+    const int num_vals = static_cast<int>(vals.size());
+    d_reduction_send_buf.resize(3 * num_vals);
+    d_reduction_recv_buf.resize(3 * num_vals);
+    for (int k = 0; k < num_vals; ++k)
+    {
+        d_reduction_send_buf[3 * k] = vals[k];
+        d_reduction_send_buf[3 * k + 1] = vals[k];
+        d_reduction_send_buf[3 * k + 2] = vals[k];
+    }
+
+    // Initiate the reduction.  It is completed at the end of the next timestep,
+    // so that the communication overlaps with computation.
+    MPI_Ireduce(&d_reduction_send_buf[0],
+                &d_reduction_recv_buf[0],
+                num_vals,
+                d_reduction_type,
+                d_reduction_op,
+                0,
+                SAMRAI_MPI::getCommunicator(),
+                &d_reduction_req);
+
+    if (static_cast<int>(d_buffered_records.size()) >= d_flush_interval) writeRecords();
+    return;
+} // endStep
+
+void
+TelemetryManager::flush()
+{
+    if (!s_enabled) return;
+    completeReduction();
+    writeRecords();
+    return;
+} // flush
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+TelemetryManager::TelemetryManager()
+    : d_is_initialized(false),
+      d_output_file("telemetry.jsonl"),
+      d_format(JSON_LINES),
+      d_flush_interval(10),
+      d_timer_names(),
+      d_timers(),
+      d_timer_start_vals(),
+      d_counter_ids(),
+      d_counter_vals(),
+      d_in_step(false),
+      d_step_num(-1),
+      d_step_time(0.0),
+      d_step_dt(0.0),
+      d_step_start_wtime(0.0),
+      d_reduction_type(MPI_DATATYPE_NULL),
+      d_reduction_op(MPI_OP_NULL),
+      d_reduction_req(MPI_REQUEST_NULL),
+      d_pending_step_num(-1),
+      d_pending_step_time(0.0),
+      d_pending_step_dt(0.0),
+      d_pending_field_names(),
+      d_pending_field_types(),
+      d_reduction_send_buf(),
+      d_reduction_recv_buf(),
+      d_buffered_records(),
+      d_csv_header()
+{
+    // intentionally blank
+    return;
+} // TelemetryManager
+
+TelemetryManager::~TelemetryManager()
+{
+    flush();
+    if (d_reduction_op != MPI_OP_NULL) MPI_Op_free(&d_reduction_op);
+    if (d_reduction_type != MPI_DATATYPE_NULL) MPI_Type_free(&d_reduction_type);
+    s_enabled = false;
+    return;
+} // ~TelemetryManager
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+TelemetryManager::completeReduction()
+{
+    if (d_reduction_req == MPI_REQUEST_NULL) return;
+    MPI_Wait(&d_reduction_req, MPI_STATUS_IGNORE);
+    if (SAMRAI_MPI::getRank() != 0) return;
+
+    const int num_procs = SAMRAI_MPI::getNodes();
+    const int num_vals = static_cast<int>(d_pending_field_names.size());
+    std::ostringstream os;
+    os.precision(PRECISION);
+    if (d_format == JSON_LINES)
+    {
+        os << "{\"step\":" << d_pending_step_num << ",\"time\":" << d_pending_step_time
+           << ",\"dt\":" << d_pending_step_dt << ",\"num_procs\":" << num_procs;
+        for (int k = 0; k < num_vals; ++k)
+        {
+            if (d_pending_field_types[k] != STEP_FIELD) continue;
+            os << ",";
+            write_json_stats(os, d_pending_field_names[k], &d_reduction_recv_buf[3 * k], num_procs);
+        }
+        static const int NUM_GROUPS = 2;
+        static const int GROUP_TYPES[NUM_GROUPS] = { TIMER_FIELD, COUNTER_FIELD };
+        static const char* const GROUP_NAMES[NUM_GROUPS] = { "timers", "counters" };
+        for (int group = 0; group < NUM_GROUPS; ++group)
+        {
+            os << ",\"" << GROUP_NAMES[group] << "\":{";
+            bool first = true;
+            for (int k = 0; k < num_vals; ++k)
+            {
+                if (d_pending_field_types[k] != GROUP_TYPES[group]) continue;
+                if (!first) os << ",";
+                write_json_stats(os, d_pending_field_names[k], &d_reduction_recv_buf[3 * k], num_procs);
+                first = false;
+            }
+            os << "}";
+        }
+        os << "}";
+    }
+    else
+    {
+        // Emit a new header line whenever the set of recorded values changes.
+        std::ostringstream header;
+        header << "step,time,dt,num_procs";
+        for (int k = 0; k < num_vals; ++k)
+        {
+            const std::string name = escape_string(d_pending_field_names[k]);
+            header << ",\"" << name << " min\",\"" << name << " max\",\"" << name << " avg\"";
+        }
+        if (header.str() != d_csv_header)
+        {
+            d_csv_header = header.str();
+            d_buffered_records.push_back(d_csv_header);
+        }
+        os << d_pending_step_num << "," << d_pending_step_time << "," << d_pending_step_dt << "," << num_procs;
+        for (int k = 0; k < num_vals; ++k)
+        {
+            os << "," << d_reduction_recv_buf[3 * k] << "," << d_reduction_recv_buf[3 * k + 1] << ","
+               << d_reduction_recv_buf[3 * k + 2] / static_cast<double>(num_procs);
+        }
+    }
+    d_buffered_records.push_back(os.str());
+    return;
+} // completeReduction
+
+void
+TelemetryManager::writeRecords()
+{
+    if (d_buffered_records.empty()) return;
+    std::ofstream stream(d_output_file.c_str(), std::ios::app);
+    if (!stream.is_open())
+    {
+        TBOX_ERROR("TelemetryManager::writeRecords():\n"
+                   << "  unable to open file: "
+                   << d_output_file
+                   << "\n");
+    }
+    for (std::vector<std::string>::const_iterator cit = d_buffered_records.begin(); cit != d_buffered_records.end();
+         ++cit)
+    {
+        stream << *cit << "\n";
+    }
+    d_buffered_records.clear();
+    return;
+} // writeRecords
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
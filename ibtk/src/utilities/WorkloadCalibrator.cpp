@@ -0,0 +1,377 @@
+// Filename: WorkloadCalibrator.cpp
+// Created on 06 Nov 2017 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <deque>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ibtk/WorkloadCalibrator.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Number of values communicated per process when fitting the coefficients.
+static const int NUM_FIT_VALUES = 3 + WorkloadCalibrator::NUM_WORKLOAD_COMPONENTS + 1;
+
+// Wait for all processes and return the time spent waiting.
+inline double
+timed_barrier()
+{
+    const double start_time = MPI_Wtime();
+    SAMRAI_MPI::barrier();
+    return MPI_Wtime() - start_time;
+} // timed_barrier
+
+// Fit y = a*C + b*N in the least-squares sense, given the sums of products of
+// the per-process values.  Returns false if the columns C and N are (nearly)
+// linearly dependent, in which case a and b are not determined by the data.
+inline bool
+fit_two_coefficients(const double C_C,
+                     const double C_N,
+                     const double N_N,
+                     const double C_y,
+                     const double N_y,
+                     double& a,
+                     double& b)
+{
+    const double det = C_C * N_N - C_N * C_N;
+    if (det <= 1.0e-8 * C_C * N_N) return false;
+    a = (N_N * C_y - C_N * N_y) / det;
+    b = (C_C * N_y - C_N * C_y) / det;
+    return true;
+} // fit_two_coefficients
+
+inline double
+compute_imbalance(const std::vector<double>& cost)
+{
+    if (cost.empty()) return 1.0;
+    double max_cost = 0.0, sum_cost = 0.0;
+    for (unsigned int k = 0; k < cost.size(); ++k)
+    {
+        max_cost = std::max(max_cost, cost[k]);
+        sum_cost += cost[k];
+    }
+    const double avg_cost = sum_cost / static_cast<double>(cost.size());
+    return (avg_cost > 0.0 ? max_cost / avg_cost : 1.0);
+} // compute_imbalance
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+WorkloadCalibrator::WorkloadCalibrator(const std::string& object_name, const int num_samples)
+    : d_object_name(object_name),
+      d_num_samples(num_samples),
+      d_samples(),
+      d_step_start_time(-1.0),
+      d_num_active_components(0),
+      d_wait_time(0.0),
+      d_alpha(1.0),
+      d_beta_total(0.0),
+      d_measured_imbalance(1.0),
+      d_model_imbalance(1.0)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!object_name.empty());
+#endif
+    if (d_num_samples <= 0)
+    {
+        TBOX_ERROR(d_object_name << "::WorkloadCalibrator():\n"
+                                 << "  number of samples must be positive" << std::endl);
+    }
+    for (int k = 0; k < NUM_WORKLOAD_COMPONENTS; ++k)
+    {
+        d_component_start_time[k] = 0.0;
+        d_component_time[k] = 0.0;
+        d_component_depth[k] = 0;
+        d_beta[k] = 0.0;
+    }
+    return;
+} // WorkloadCalibrator
+
+WorkloadCalibrator::~WorkloadCalibrator()
+{
+    // intentionally blank
+    return;
+} // ~WorkloadCalibrator
+
+void
+WorkloadCalibrator::startTimer(const WorkloadComponent component)
+{
+    if (d_component_depth[component]++ == 0)
+    {
+        if (d_num_active_components++ == 0) d_wait_time += timed_barrier();
+        d_component_start_time[component] = MPI_Wtime();
+    }
+    return;
+} // startTimer
+
+void
+WorkloadCalibrator::stopTimer(const WorkloadComponent component)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_component_depth[component] > 0);
+#endif
+    if (--d_component_depth[component] == 0)
+    {
+        d_component_time[component] += MPI_Wtime() - d_component_start_time[component];
+        if (--d_num_active_components == 0) d_wait_time += timed_barrier();
+    }
+    return;
+} // stopTimer
+
+void
+WorkloadCalibrator::completeStep(const double num_local_cells, const double num_local_lag_points)
+{
+    d_wait_time += timed_barrier();
+    const double current_time = MPI_Wtime();
+    if (d_step_start_time >= 0.0)
+    {
+        Sample sample;
+        sample.step_time = current_time - d_step_start_time;
+        sample.wait_time = d_wait_time;
+        for (int k = 0; k < NUM_WORKLOAD_COMPONENTS; ++k)
+        {
+            sample.component_time[k] = d_component_time[k];
+        }
+        sample.num_cells = num_local_cells;
+        sample.num_lag_points = num_local_lag_points;
+        d_samples.push_back(sample);
+        while (static_cast<int>(d_samples.size()) > d_num_samples) d_samples.pop_front();
+    }
+    d_step_start_time = current_time;
+    d_wait_time = 0.0;
+    for (int k = 0; k < NUM_WORKLOAD_COMPONENTS; ++k)
+    {
+        d_component_time[k] = 0.0;
+    }
+    return;
+} // completeStep
+
+void
+WorkloadCalibrator::clearSamples()
+{
+    d_samples.clear();
+    d_step_start_time = -1.0;
+    d_wait_time = 0.0;
+    for (int k = 0; k < NUM_WORKLOAD_COMPONENTS; ++k)
+    {
+        d_component_time[k] = 0.0;
+    }
+    return;
+} // clearSamples
+
+int
+WorkloadCalibrator::getNumberOfSamples() const
+{
+    return static_cast<int>(d_samples.size());
+} // getNumberOfSamples
+
+bool
+WorkloadCalibrator::computeCoefficients()
+{
+    // Average the local samples.
+    //
+    // NOTE: The layout of the local values is (eulerian_time, num_cells,
+    // num_lag_points, component_time[0], ..., component_time[n-1],
+    // num_samples).
+    std::vector<double> local_vals(NUM_FIT_VALUES, 0.0);
+    const int num_local_samples = static_cast<int>(d_samples.size());
+    for (std::deque<Sample>::const_iterator cit = d_samples.begin(); cit != d_samples.end(); ++cit)
+    {
+        double lag_time = 0.0;
+        for (int k = 0; k < NUM_WORKLOAD_COMPONENTS; ++k)
+        {
+            local_vals[3 + k] += cit->component_time[k];
+            lag_time += cit->component_time[k];
+        }
+        local_vals[0] += std::max(cit->step_time - cit->wait_time - lag_time, 0.0);
+        local_vals[1] += cit->num_cells;
+        local_vals[2] += cit->num_lag_points;
+    }
+    if (num_local_samples > 0)
+    {
+        for (int i = 0; i < NUM_FIT_VALUES - 1; ++i)
+        {
+            local_vals[i] /= static_cast<double>(num_local_samples);
+        }
+    }
+    local_vals[NUM_FIT_VALUES - 1] = static_cast<double>(num_local_samples);
+
+    // Gather the averaged values from all processes.
+    const int nprocs = SAMRAI_MPI::getNodes();
+    std::vector<double> vals(NUM_FIT_VALUES * nprocs, 0.0);
+    SAMRAI_MPI::allGather(&local_vals[0], NUM_FIT_VALUES, &vals[0], NUM_FIT_VALUES * nprocs);
+
+    // Determine the cost coefficients by fitting the per-process data in the
+    // least-squares sense.  The Eulerian time and the time of each Lagrangian
+    // component are fit jointly to the numbers of cells and Lagrangian points,
+    // so that work that depends on both is attributed correctly even when the
+    // two are correlated across processes.  If the numbers of cells and
+    // Lagrangian points are proportional on all processes (e.g. when there is
+    // only one process), the joint fit is not determined by the data, and the
+    // Eulerian time is instead fit to the number of cells and the time of each
+    // Lagrangian component to the number of Lagrangian points.
+    double C_C = 0.0, C_N = 0.0, N_N = 0.0, C_f = 0.0, N_f = 0.0;
+    double C_t[NUM_WORKLOAD_COMPONENTS], N_t[NUM_WORKLOAD_COMPONENTS];
+    for (int k = 0; k < NUM_WORKLOAD_COMPONENTS; ++k) C_t[k] = N_t[k] = 0.0;
+    for (int p = 0; p < nprocs; ++p)
+    {
+        const double* const proc_vals = &vals[NUM_FIT_VALUES * p];
+        if (proc_vals[NUM_FIT_VALUES - 1] < 1.0) return false;
+        const double f = proc_vals[0];
+        const double C = proc_vals[1];
+        const double N = proc_vals[2];
+        C_C += C * C;
+        C_N += C * N;
+        N_N += N * N;
+        C_f += C * f;
+        N_f += N * f;
+        for (int k = 0; k < NUM_WORKLOAD_COMPONENTS; ++k)
+        {
+            C_t[k] += C * proc_vals[3 + k];
+            N_t[k] += N * proc_vals[3 + k];
+        }
+    }
+    if (C_C <= 0.0 || C_f <= 0.0) return false;
+    double alpha = 0.0, beta_total = 0.0, beta[NUM_WORKLOAD_COMPONENTS];
+    bool joint_fit = N_N > 0.0 && fit_two_coefficients(C_C, C_N, N_N, C_f, N_f, alpha, beta_total);
+    for (int k = 0; k < NUM_WORKLOAD_COMPONENTS && joint_fit; ++k)
+    {
+        double alpha_k = 0.0;
+        joint_fit = fit_two_coefficients(C_C, C_N, N_N, C_t[k], N_t[k], alpha_k, beta[k]);
+        alpha += alpha_k;
+        beta_total += beta[k];
+    }
+    if (!joint_fit || alpha <= 0.0 || beta_total < 0.0)
+    {
+        alpha = C_f / C_C;
+        beta_total = 0.0;
+        for (int k = 0; k < NUM_WORKLOAD_COMPONENTS; ++k)
+        {
+            beta[k] = (N_N > 0.0 ? N_t[k] / N_N : 0.0);
+            beta_total += beta[k];
+        }
+    }
+    d_alpha = alpha;
+    d_beta_total = beta_total;
+    for (int k = 0; k < NUM_WORKLOAD_COMPONENTS; ++k) d_beta[k] = beta[k];
+
+    // Compare the measured per-process cost to the cost predicted by the model.
+    std::vector<double> measured_cost(nprocs, 0.0), model_cost(nprocs, 0.0);
+    for (int p = 0; p < nprocs; ++p)
+    {
+        const double* const proc_vals = &vals[NUM_FIT_VALUES * p];
+        measured_cost[p] = proc_vals[0];
+        for (int k = 0; k < NUM_WORKLOAD_COMPONENTS; ++k) measured_cost[p] += proc_vals[3 + k];
+        model_cost[p] = d_alpha * proc_vals[1] + d_beta_total * proc_vals[2];
+    }
+    d_measured_imbalance = compute_imbalance(measured_cost);
+    d_model_imbalance = compute_imbalance(model_cost);
+    return true;
+} // computeCoefficients
+
+double
+WorkloadCalibrator::getEulerianCoefficient() const
+{
+    return d_alpha;
+} // getEulerianCoefficient
+
+double
+WorkloadCalibrator::getLagrangianCoefficient(const WorkloadComponent component) const
+{
+    return d_beta[component];
+} // getLagrangianCoefficient
+
+double
+WorkloadCalibrator::getRelativeLagrangianWorkload() const
+{
+    return d_beta_total / d_alpha;
+} // getRelativeLagrangianWorkload
+
+double
+WorkloadCalibrator::computePredictedImbalance(const double num_local_cells, const double num_local_lag_points) const
+{
+    const double local_cost = num_local_cells + getRelativeLagrangianWorkload() * num_local_lag_points;
+    std::vector<double> cost(SAMRAI_MPI::getNodes(), 0.0);
+    SAMRAI_MPI::allGather(local_cost, &cost[0]);
+    return compute_imbalance(cost);
+} // computePredictedImbalance
+
+double
+WorkloadCalibrator::getMeasuredImbalance() const
+{
+    return d_measured_imbalance;
+} // getMeasuredImbalance
+
+double
+WorkloadCalibrator::getModelImbalance() const
+{
+    return d_model_imbalance;
+} // getModelImbalance
+
+void
+WorkloadCalibrator::printReport(const double predicted_imbalance, std::ostream& os) const
+{
+    os << d_object_name << "::printReport():\n"
+       << "  cost per cell = " << d_alpha << " s\n"
+       << "  cost per Lagrangian point = " << d_beta_total << " s\n"
+       << "    (interaction) = " << d_beta[INTERACTION_WORK] << " s\n"
+       << "    (force) = " << d_beta[FORCE_WORK] << " s\n"
+       << "  relative Lagrangian workload = " << getRelativeLagrangianWorkload() << "\n"
+       << "  load imbalance prior to regrid: measured = " << d_measured_imbalance
+       << ", predicted = " << d_model_imbalance << "\n"
+       << "  load imbalance after regrid: predicted = " << predicted_imbalance << "\n";
+    return;
+} // printReport
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
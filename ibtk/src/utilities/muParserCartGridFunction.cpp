@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <map>
 #include <ostream>
 #include <string>
@@ -45,16 +46,19 @@
 #include "CellIndex.h"
 #include "CellIterator.h"
 #include "FaceData.h"
+#include "FaceGeometry.h"
 #include "FaceIndex.h"
 #include "FaceIterator.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "NodeData.h"
+#include "NodeGeometry.h"
 #include "NodeIndex.h"
 #include "NodeIterator.h"
 #include "Patch.h"
 #include "PatchData.h"
 #include "SideData.h"
+#include "SideGeometry.h"
 #include "SideIndex.h"
 #include "SideIterator.h"
 #include "ibtk/CartGridFunction.h"
@@ -102,8 +106,9 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
       d_constants(),
       d_function_strings(),
       d_parsers(),
-      d_parser_time(),
-      d_parser_posn()
+      d_parser_time(1, 0.0),
+      d_parser_posn(),
+      d_parser_vals(1, 0.0)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -198,6 +203,9 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
                    << std::endl);
     }
 
+    // Allocate storage for the variables used in bulk evaluation mode.
+    for (unsigned int d = 0; d < NDIM; ++d) d_parser_posn[d].resize(1, 0.0);
+
     // Define the default and user-provided constants.
     const double pi = 3.1415926535897932384626433832795;
     const double* const x_lower = grid_geom->getXLower();
@@ -275,21 +283,11 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
         {
             it->DefineConst(map_cit->first, map_cit->second);
         }
-
-        // Variables.
-        it->DefineVar("T", &d_parser_time);
-        it->DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            std::ostringstream stream;
-            stream << d;
-            const std::string postfix = stream.str();
-            it->DefineVar("X" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("x" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("X_" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("x_" + postfix, &(d_parser_posn[d]));
-        }
     }
+
+    // Variables.
+    defineParserVariables();
+
     return;
 } // muParserCartGridFunction
 
@@ -313,8 +311,6 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                                          const bool /*initial_time*/,
                                          Pointer<PatchLevel<NDIM> > /*level*/)
 {
-    d_parser_time = data_time;
-
     const Box<NDIM>& patch_box = patch->getBox();
     const Index<NDIM>& patch_lower = patch_box.lower();
     Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
@@ -323,6 +319,10 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
     const double* const dx = pgeom->getDx();
 
     // Set the data in the patch.
+    //
+    // NOTE: The coordinates of all data points in each data box are set first,
+    // and then each function is evaluated at all of the points at once using
+    // the bulk evaluation mode of muParser.
     Pointer<PatchData<NDIM> > data = patch->getPatchData(data_idx);
 #if !defined(NDEBUG)
     TBOX_ASSERT(data);
@@ -336,35 +336,25 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(cc_data->getDepth()));
 #endif
+        const int num_points = static_cast<int>(patch_box.size());
+        setBulkTime(data_time, num_points);
+        int k = 0;
+        for (CellIterator<NDIM> ic(patch_box); ic; ic++, ++k)
+        {
+            const CellIndex<NDIM>& i = ic();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+            }
+        }
         for (int data_depth = 0; data_depth < cc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+            evaluateBulk(function_depth, num_points);
+            k = 0;
+            for (CellIterator<NDIM> ic(patch_box); ic; ic++, ++k)
             {
-                const CellIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                }
-                try
-                {
-                    (*cc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: "
-                               << e.GetMsg()
-                               << "\n"
-                               << "  in:    "
-                               << e.GetExpr()
-                               << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
+                (*cc_data)(ic(), data_depth) = d_parser_vals[k];
             }
         }
     }
@@ -375,67 +365,38 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     d_parsers.size() == static_cast<unsigned int>(fc_data->getDepth()) ||
                     d_parsers.size() == NDIM * static_cast<unsigned int>(fc_data->getDepth()));
 #endif
-        for (int data_depth = 0; data_depth < fc_data->getDepth(); ++data_depth)
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            const int num_points = static_cast<int>(FaceGeometry<NDIM>::toFaceBox(patch_box, axis).size());
+            setBulkTime(data_time, num_points);
+            int k = 0;
+            for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
             {
-                int function_depth = -1;
-                const int parsers_size = static_cast<int>(d_parsers.size());
-                const int fc_data_depth = fc_data->getDepth();
-                if (parsers_size == 1)
-                {
-                    function_depth = 0;
-                }
-                else if (parsers_size == NDIM)
-                {
-                    function_depth = axis;
-                }
-                else if (parsers_size == fc_data_depth)
-                {
-                    function_depth = data_depth;
-                }
-                else if (parsers_size == NDIM * fc_data_depth)
-                {
-                    function_depth = NDIM * data_depth + axis;
-                }
-
-                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                const FaceIndex<NDIM>& i = ic();
+                const Index<NDIM>& cell_idx = i.toCell(1);
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    const FaceIndex<NDIM>& i = ic();
-                    const Index<NDIM>& cell_idx = i.toCell(1);
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] =
-                                XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
+                    if (d == axis)
                     {
-                        (*fc_data)(i, data_depth) = d_parsers[function_depth].Eval();
+                        d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
                     }
-                    catch (mu::ParserError& e)
+                    else
                     {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: "
-                                   << e.GetMsg()
-                                   << "\n"
-                                   << "  in:    "
-                                   << e.GetExpr()
-                                   << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
+                        d_parser_posn[d][k] =
+                            XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
                     }
                 }
             }
+            for (int data_depth = 0; data_depth < fc_data->getDepth(); ++data_depth)
+            {
+                const int function_depth = getFunctionDepth(axis, data_depth, fc_data->getDepth());
+                evaluateBulk(function_depth, num_points);
+                k = 0;
+                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
+                {
+                    (*fc_data)(ic(), data_depth) = d_parser_vals[k];
+                }
+            }
         }
     }
     else if (nc_data)
@@ -443,35 +404,25 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(nc_data->getDepth()));
 #endif
+        const int num_points = static_cast<int>(NodeGeometry<NDIM>::toNodeBox(patch_box).size());
+        setBulkTime(data_time, num_points);
+        int k = 0;
+        for (NodeIterator<NDIM> ic(patch_box); ic; ic++, ++k)
+        {
+            const NodeIndex<NDIM>& i = ic();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+            }
+        }
         for (int data_depth = 0; data_depth < nc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (NodeIterator<NDIM> ic(patch_box); ic; ic++)
+            evaluateBulk(function_depth, num_points);
+            k = 0;
+            for (NodeIterator<NDIM> ic(patch_box); ic; ic++, ++k)
             {
-                const NodeIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                }
-                try
-                {
-                    (*nc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: "
-                               << e.GetMsg()
-                               << "\n"
-                               << "  in:    "
-                               << e.GetExpr()
-                               << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
+                (*nc_data)(ic(), data_depth) = d_parser_vals[k];
             }
         }
     }
@@ -482,65 +433,36 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     d_parsers.size() == static_cast<unsigned int>(sc_data->getDepth()) ||
                     d_parsers.size() == NDIM * static_cast<unsigned int>(sc_data->getDepth()));
 #endif
-        for (int data_depth = 0; data_depth < sc_data->getDepth(); ++data_depth)
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            const int num_points = static_cast<int>(SideGeometry<NDIM>::toSideBox(patch_box, axis).size());
+            setBulkTime(data_time, num_points);
+            int k = 0;
+            for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
             {
-                int function_depth = -1;
-                const int parsers_size = static_cast<int>(d_parsers.size());
-                const int sc_data_depth = sc_data->getDepth();
-                if (parsers_size == 1)
-                {
-                    function_depth = 0;
-                }
-                else if (parsers_size == NDIM)
-                {
-                    function_depth = axis;
-                }
-                else if (parsers_size == sc_data_depth)
-                {
-                    function_depth = data_depth;
-                }
-                else if (parsers_size == NDIM * sc_data_depth)
-                {
-                    function_depth = NDIM * data_depth + axis;
-                }
-
-                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                const SideIndex<NDIM>& i = ic();
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    const SideIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
+                    if (d == axis)
                     {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        }
+                        d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
                     }
-                    try
+                    else
                     {
-                        (*sc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: "
-                                   << e.GetMsg()
-                                   << "\n"
-                                   << "  in:    "
-                                   << e.GetExpr()
-                                   << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
+                        d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
                     }
                 }
             }
+            for (int data_depth = 0; data_depth < sc_data->getDepth(); ++data_depth)
+            {
+                const int function_depth = getFunctionDepth(axis, data_depth, sc_data->getDepth());
+                evaluateBulk(function_depth, num_points);
+                k = 0;
+                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++, ++k)
+                {
+                    (*sc_data)(ic(), data_depth) = d_parser_vals[k];
+                }
+            }
         }
     }
     else
@@ -552,6 +474,94 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
     return;
 } // setDataOnPatch
 
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+muParserCartGridFunction::defineParserVariables()
+{
+    for (std::vector<mu::Parser>::iterator it = d_parsers.begin(); it != d_parsers.end(); ++it)
+    {
+        it->DefineVar("T", &d_parser_time[0]);
+        it->DefineVar("t", &d_parser_time[0]);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            std::ostringstream stream;
+            stream << d;
+            const std::string postfix = stream.str();
+            it->DefineVar("X" + postfix, &d_parser_posn[d][0]);
+            it->DefineVar("x" + postfix, &d_parser_posn[d][0]);
+            it->DefineVar("X_" + postfix, &d_parser_posn[d][0]);
+            it->DefineVar("x_" + postfix, &d_parser_posn[d][0]);
+        }
+    }
+    return;
+} // defineParserVariables
+
+void
+muParserCartGridFunction::setBulkTime(const double data_time, const int num_points)
+{
+    // NOTE: In bulk mode, muParser treats every variable as an array of values,
+    // so the variable arrays must be reallocated and re-registered with the
+    // parsers only when the number of points exceeds the current capacity.
+    if (num_points > static_cast<int>(d_parser_vals.size()))
+    {
+        d_parser_time.resize(num_points);
+        for (unsigned int d = 0; d < NDIM; ++d) d_parser_posn[d].resize(num_points);
+        d_parser_vals.resize(num_points);
+        defineParserVariables();
+    }
+    std::fill(d_parser_time.begin(), d_parser_time.begin() + num_points, data_time);
+    return;
+} // setBulkTime
+
+void
+muParserCartGridFunction::evaluateBulk(const int function_depth, const int num_points)
+{
+    try
+    {
+        d_parsers[function_depth].Eval(&d_parser_vals[0], num_points);
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  error: "
+                   << e.GetMsg()
+                   << "\n"
+                   << "  in:    "
+                   << e.GetExpr()
+                   << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+    return;
+} // evaluateBulk
+
+int
+muParserCartGridFunction::getFunctionDepth(const unsigned int axis, const int data_depth, const int depth) const
+{
+    const int parsers_size = static_cast<int>(d_parsers.size());
+    if (parsers_size == 1)
+    {
+        return 0;
+    }
+    else if (parsers_size == NDIM)
+    {
+        return axis;
+    }
+    else if (parsers_size == depth)
+    {
+        return data_depth;
+    }
+    else if (parsers_size == NDIM * depth)
+    {
+        return NDIM * data_depth + axis;
+    }
+    return -1;
+} // getFunctionDepth
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -0,0 +1,339 @@
+// Filename: main.cpp
+// Created on 15 Nov 2017 by Boyce Griffith
+
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellIterator.h>
+#include <SideData.h>
+#include <SideVariable.h>
+#include <VariableDatabase.h>
+#include <tbox/SAMRAIManager.h>
+#include <tbox/SAMRAI_MPI.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitStrategy.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/LTracerParticles.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+namespace
+{
+// Returns the periodic displacement X - Y on the unit square.
+inline double
+periodic_displacement(const double X, const double Y)
+{
+    const double d = X - Y;
+    return d - std::floor(d + 0.5);
+} // periodic_displacement
+
+// Sets a uniform velocity field, including ghost cells, on each new level and
+// tags the cells near a disk that moves with the flow.
+class TracerTagger : public StandardTagAndInitStrategy<NDIM>
+{
+public:
+    TracerTagger(const int u_idx, const double* U, const double* X0, const double radius)
+        : d_u_idx(u_idx), d_radius(radius)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            d_U[d] = U[d];
+            d_X0[d] = X0[d];
+        }
+        return;
+    } // TracerTagger
+
+    void initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                             int level_number,
+                             double init_data_time,
+                             bool /*can_be_refined*/,
+                             bool /*initial_time*/,
+                             Pointer<BasePatchLevel<NDIM> > /*old_level*/ = Pointer<BasePatchLevel<NDIM> >(NULL),
+                             bool allocate_data = true)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        if (allocate_data) level->allocatePatchData(d_u_idx, init_data_time);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(d_u_idx);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                u_data->getArrayData(axis).fillAll(d_U[axis]);
+            }
+        }
+        return;
+    } // initializeLevelData
+
+    void resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > /*hierarchy*/,
+                                     int /*coarsest_level*/,
+                                     int /*finest_level*/)
+    {
+        return;
+    } // resetHierarchyConfiguration
+
+    void applyGradientDetector(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                               int level_number,
+                               double error_data_time,
+                               int tag_index,
+                               bool /*initial_time*/,
+                               bool /*uses_richardson_extrapolation_too*/)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const dx = pgeom->getDx();
+            Pointer<CellData<NDIM, int> > tag_data = patch->getPatchData(tag_index);
+            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+            {
+                const CellIndex<NDIM>& i = ic();
+                double r_sq = 0.0;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    const double X = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_box.lower(d)) + 0.5);
+                    const double r = periodic_displacement(X, d_X0[d] + d_U[d] * error_data_time);
+                    r_sq += r * r;
+                }
+                if (std::sqrt(r_sq) <= d_radius + 2.0 * dx[0]) (*tag_data)(i) = 1;
+            }
+        }
+        return;
+    } // applyGradientDetector
+
+private:
+    int d_u_idx;
+    double d_U[NDIM], d_X0[NDIM];
+    double d_radius;
+};
+}
+
+/*******************************************************************************
+ * This test advects a disk of tracer particles by a uniform velocity field on *
+ * a periodic domain.  The refined patch level is regridded to follow the      *
+ * particles, and the particles are redistributed after each regrid.  For each *
+ * run, the input filename must be given on the command line:                  *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "ltracer_particles.log");
+        Pointer<Database> test_db = app_initializer->getComponentDatabase("LTracerParticlesTester");
+        double U[NDIM], X0[NDIM];
+        test_db->getDoubleArray("velocity", U, NDIM);
+        test_db->getDoubleArray("center", X0, NDIM);
+        const double radius = test_db->getDouble("radius");
+        const int num_particles_per_dim = test_db->getInteger("num_particles_per_dim");
+        const double dt = test_db->getDouble("dt");
+        const int num_steps = test_db->getInteger("num_steps");
+        const int regrid_interval = test_db->getInteger("regrid_interval");
+        const std::string interp_fcn = test_db->getStringWithDefault("interp_fcn", "IB_4");
+        const double tol = test_db->getDoubleWithDefault("tolerance", 1.0e-10);
+        Array<int> tag_buffer(1);
+        tag_buffer[0] = test_db->getIntegerWithDefault("tag_buffer", 1);
+
+        // Create the velocity variable.  The ghost cell width allows the
+        // particles to move up to one cell per time step.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        const IntVector<NDIM> u_ghosts = LEInteractor::getMinimumGhostWidth(interp_fcn) + 1;
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, u_ghosts);
+        TracerTagger tagger(u_idx, U, X0, radius);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", &tagger, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer[0]);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Place the particles on a lattice within the disk.
+        std::vector<Point> X_init;
+        const double h = 2.0 * radius / static_cast<double>(num_particles_per_dim);
+        for (int k = 0; k < static_cast<int>(std::pow(static_cast<double>(num_particles_per_dim), NDIM)); ++k)
+        {
+            Point X;
+            double r_sq = 0.0;
+            for (int d = 0, kk = k; d < NDIM; ++d, kk /= num_particles_per_dim)
+            {
+                X[d] = X0[d] - radius + (static_cast<double>(kk % num_particles_per_dim) + 0.5) * h;
+                r_sq += (X[d] - X0[d]) * (X[d] - X0[d]);
+            }
+            if (r_sq < radius * radius) X_init.push_back(X);
+        }
+        const int num_particles = static_cast<int>(X_init.size());
+
+        // Create one set of particles for each time stepping scheme.  Because
+        // the velocity is uniform in space and time, every scheme reproduces
+        // the exact particle trajectories, and the same velocity data can be
+        // used for all of the stages.
+        static const int NUM_SCHEMES = 4;
+        static const char* const SCHEME_NAMES[NUM_SCHEMES] = { "EULER", "MIDPOINT", "TRAPEZOIDAL", "RK3" };
+        std::vector<Pointer<LTracerParticles> > tracers(NUM_SCHEMES);
+        for (int scheme = 0; scheme < NUM_SCHEMES; ++scheme)
+        {
+            tracers[scheme] = new LTracerParticles(std::string("LTracerParticles::") + SCHEME_NAMES[scheme],
+                                                   patch_hierarchy,
+                                                   interp_fcn,
+                                                   /*register_for_restart*/ false);
+            tracers[scheme]->initializeParticles(X_init);
+        }
+
+        // Advect the particles, regridding periodically.
+        double time = 0.0;
+        for (int step = 1; step <= num_steps; ++step)
+        {
+            tracers[0]->eulerStep(u_idx, dt);
+            tracers[1]->midpointStep(u_idx, u_idx, dt);
+            tracers[2]->trapezoidalStep(u_idx, u_idx, dt);
+            tracers[3]->rk3Step(u_idx, u_idx, u_idx, dt);
+            time += dt;
+            if (step % regrid_interval == 0)
+            {
+                gridding_algorithm->regridAllFinerLevels(patch_hierarchy, 0, time, tag_buffer);
+                for (int scheme = 0; scheme < NUM_SCHEMES; ++scheme)
+                {
+                    tracers[scheme]->redistributeParticles();
+                }
+            }
+        }
+
+        pout << "number of particles:   " << num_particles << "\n";
+        pout << "finest level number:   " << patch_hierarchy->getFinestLevelNumber() << "\n";
+        for (int scheme = 0; scheme < NUM_SCHEMES; ++scheme)
+        {
+            // Check that each particle is stored exactly once and that the
+            // positions and velocities agree with the exact solution.
+            std::vector<int> ids;
+            std::vector<double> X, U_interp;
+            tracers[scheme]->collectLocalParticles(ids, X, U_interp);
+            std::vector<int> id_count(num_particles, 0);
+            double max_err = 0.0;
+            bool local_passed = true;
+            for (unsigned int k = 0; k < ids.size(); ++k)
+            {
+                if (ids[k] < 0 || ids[k] >= num_particles)
+                {
+                    local_passed = false;
+                    continue;
+                }
+                ++id_count[ids[k]];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    const double X_exact = X_init[ids[k]][d] + U[d] * time;
+                    max_err = std::max(max_err, std::abs(periodic_displacement(X[NDIM * k + d], X_exact)));
+                    max_err = std::max(max_err, std::abs(U_interp[NDIM * k + d] - U[d]));
+                }
+            }
+            if (num_particles > 0) SAMRAI_MPI::sumReduction(&id_count[0], num_particles);
+            for (int k = 0; k < num_particles; ++k)
+            {
+                local_passed = local_passed && (id_count[k] == 1);
+            }
+            max_err = SAMRAI_MPI::maxReduction(max_err);
+            bool scheme_passed = (SAMRAI_MPI::minReduction(static_cast<int>(local_passed)) == 1);
+            scheme_passed = scheme_passed && (tracers[scheme]->getNumberOfParticles() ==
+                                              static_cast<unsigned long>(num_particles));
+            scheme_passed = scheme_passed && (max_err <= tol);
+            passed = passed && scheme_passed;
+            pout << SCHEME_NAMES[scheme] << " maximum error: " << max_err << " "
+                 << (scheme_passed ? "PASSED" : "FAILED") << "\n";
+        }
+        pout << "LTracerParticles test: " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed ? 0 : 1;
+} // main
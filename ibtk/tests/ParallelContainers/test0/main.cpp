@@ -0,0 +1,210 @@
+// Filename: main.cpp
+// Created on 08 Nov 2017 by Boyce Griffith
+
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <tbox/SAMRAIManager.h>
+#include <tbox/SAMRAI_MPI.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/ParallelEdgeMap.h>
+#include <ibtk/ParallelExchangeUtilities.h>
+#include <ibtk/ParallelSet.h>
+#include <ibtk/ibtk_enums.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+bool test_exchange_data();
+bool test_parallel_set();
+bool test_parallel_edge_map();
+
+/*******************************************************************************
+ * This test checks the distributed data mode of the IBTK parallel containers  *
+ * against the replicated data mode.  It should be run on several MPI          *
+ * processes, e.g.:                                                            *
+ *                                                                             *
+ *    mpiexec -np 4 ./main2d                                                   *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        pout << "running on " << SAMRAI_MPI::getNodes() << " MPI processes\n";
+        const bool exchange_data_passed = test_exchange_data();
+        pout << "ParallelExchangeUtilities::exchangeData(): " << (exchange_data_passed ? "PASSED" : "FAILED") << "\n";
+        const bool parallel_set_passed = test_parallel_set();
+        pout << "ParallelSet:                               " << (parallel_set_passed ? "PASSED" : "FAILED") << "\n";
+        const bool parallel_edge_map_passed = test_parallel_edge_map();
+        pout << "ParallelEdgeMap:                           " << (parallel_edge_map_passed ? "PASSED" : "FAILED")
+             << "\n";
+        passed = exchange_data_passed && parallel_set_passed && parallel_edge_map_passed;
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed ? 0 : 1;
+} // main
+
+// Each process sends (rank, k) to process (rank + k) mod P for k = 1, 2, 3 and
+// checks that it receives exactly the corresponding messages.
+bool
+test_exchange_data()
+{
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+    static const int NUM_SENDS = 3;
+    std::map<int, std::vector<int> > send_data, recv_data;
+    for (int k = 1; k <= NUM_SENDS; ++k)
+    {
+        std::vector<int>& data = send_data[(rank + k) % nodes];
+        data.push_back(rank);
+        data.push_back(k);
+    }
+    ParallelExchangeUtilities::exchangeData(send_data, recv_data);
+
+    bool passed = true;
+    int num_received = 0;
+    for (std::map<int, std::vector<int> >::const_iterator cit = recv_data.begin(); cit != recv_data.end(); ++cit)
+    {
+        const int src = cit->first;
+        const std::vector<int>& data = cit->second;
+        for (unsigned int i = 0; i + 1 < data.size(); i += 2, ++num_received)
+        {
+            passed = passed && (data[i] == src) && ((src + data[i + 1]) % nodes == rank);
+        }
+    }
+    passed = passed && (num_received == NUM_SENDS);
+    return SAMRAI_MPI::minReduction(static_cast<int>(passed)) == 1;
+} // test_exchange_data
+
+// Apply the same overlapping additions and removals in both data modes and
+// check that each process owns exactly its share of the replicated set.
+bool
+test_parallel_set()
+{
+    const int rank = SAMRAI_MPI::getRank();
+    ParallelSet replicated_set(REPLICATED_DATA), distributed_set(DISTRIBUTED_DATA);
+    for (int j = 0; j < 10; ++j)
+    {
+        replicated_set.addItem(7 * rank + j);
+        distributed_set.addItem(7 * rank + j);
+    }
+    replicated_set.communicateData();
+    distributed_set.communicateData();
+    replicated_set.removeItem(7 * rank + 1);
+    distributed_set.removeItem(7 * rank + 1);
+    replicated_set.communicateData();
+    distributed_set.communicateData();
+
+    std::set<int> expected_set;
+    for (std::set<int>::const_iterator cit = replicated_set.getSet().begin(); cit != replicated_set.getSet().end();
+         ++cit)
+    {
+        if (ParallelExchangeUtilities::getOwnerRank(*cit) == rank) expected_set.insert(*cit);
+    }
+    bool passed = (distributed_set.getSet() == expected_set);
+    passed = passed && (SAMRAI_MPI::sumReduction(static_cast<int>(distributed_set.getSet().size())) ==
+                        static_cast<int>(replicated_set.getSet().size()));
+    return SAMRAI_MPI::minReduction(static_cast<int>(passed)) == 1;
+} // test_parallel_set
+
+// Store duplicate edges, remove them using master index hints that do not
+// always match the stored master index, and check that each removal erases
+// exactly one entry in both data modes.
+bool
+test_parallel_edge_map()
+{
+    const int rank = SAMRAI_MPI::getRank();
+    ParallelEdgeMap replicated_map(REPLICATED_DATA), distributed_map(DISTRIBUTED_DATA);
+    ParallelEdgeMap* maps[2] = { &replicated_map, &distributed_map };
+    for (int m = 0; m < 2; ++m)
+    {
+        const std::pair<int, int> link = std::make_pair(rank, rank + 1);
+        maps[m]->addEdge(link, rank);
+        maps[m]->addEdge(link, rank + 1);
+        if (rank == 0)
+        {
+            maps[m]->addEdge(std::make_pair(1000, 2000), 1000);
+            maps[m]->addEdge(std::make_pair(1000, 2000), 1000);
+        }
+        maps[m]->communicateData();
+        maps[m]->removeEdge(link, rank + 1);
+        if (rank == 0)
+        {
+            maps[m]->removeEdge(std::make_pair(1000, 2000), 2000);
+        }
+        maps[m]->communicateData();
+    }
+
+    typedef std::multimap<int, std::pair<int, int> > edge_map_type;
+    const edge_map_type& replicated_edges = replicated_map.getEdgeMap();
+    const edge_map_type& distributed_edges = distributed_map.getEdgeMap();
+    std::vector<std::pair<int, std::pair<int, int> > > expected_edges, local_edges;
+    for (edge_map_type::const_iterator cit = replicated_edges.begin(); cit != replicated_edges.end(); ++cit)
+    {
+        if (ParallelExchangeUtilities::getOwnerRank(cit->first) == rank) expected_edges.push_back(*cit);
+    }
+    local_edges.assign(distributed_edges.begin(), distributed_edges.end());
+    std::sort(expected_edges.begin(), expected_edges.end());
+    std::sort(local_edges.begin(), local_edges.end());
+
+    // One copy of each link (rank, rank + 1) and one copy of (1000, 2000) must
+    // remain.
+    const int nodes = SAMRAI_MPI::getNodes();
+    bool passed = (local_edges == expected_edges);
+    passed = passed && (static_cast<int>(replicated_edges.size()) == nodes + 1);
+    passed = passed && (SAMRAI_MPI::sumReduction(static_cast<int>(distributed_edges.size())) == nodes + 1);
+    return SAMRAI_MPI::minReduction(static_cast<int>(passed)) == 1;
+} // test_parallel_edge_map
@@ -49,6 +49,7 @@
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/ibamr_utilities.h"
 #include "ibtk/CartExtrapPhysBdryOp.h"
+#include "ibtk/ReducedDataWriter.h"
 #include "tbox/Array.h"
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
@@ -175,6 +176,12 @@ public:
      */
     void registerVisItDataWriter(SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > visit_writer);
 
+    /*!
+     * Register a reduced data writer so this class will write subsampled and
+     * compressed copies of its plot quantities.
+     */
+    void registerReducedDataWriter(SAMRAI::tbox::Pointer<IBTK::ReducedDataWriter> reduced_writer);
+
     /*!
      * Register a face-centered advection velocity to be used to advect
      * cell-centered quantities by the hierarchy integrator.
@@ -499,6 +506,15 @@ private:
      */
     void setInflowBoundaryConditions(SAMRAI::hier::Patch<NDIM>& patch, double fill_time);
 
+    /*
+     * Register a plot quantity with the VisIt data writer and the reduced data
+     * writer, when they are available.
+     */
+    void registerPlotQuantity(const std::string& variable_name,
+                              const std::string& variable_type,
+                              int patch_data_index,
+                              int start_depth_id = 0);
+
     /*
      * These private member functions read data from input and restart.  When
      * beginning a run from a restart file, all data members are read from the
@@ -519,12 +535,13 @@ private:
     bool d_registered_for_restart;
 
     /*
-     * We cache pointers to the grid geometry and VisIt data writer object to
-     * set up initial data, set physical boundary conditions, and register plot
-     * variables.
+     * We cache pointers to the grid geometry and visualization data writer
+     * objects to set up initial data, set physical boundary conditions, and
+     * register plot variables.
      */
     SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > d_grid_geometry;
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > d_visit_writer;
+    SAMRAI::tbox::Pointer<IBTK::ReducedDataWriter> d_reduced_writer;
 
     /*
      * Boundary condition extrapolation helpers.
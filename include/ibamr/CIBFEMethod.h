@@ -56,6 +56,7 @@
 namespace IBTK
 {
 class HierarchyMathsOps;
+class ReducedDataWriter;
 }
 namespace SAMRAI
 {
@@ -409,6 +410,12 @@ public:
      */
     void registerVisItDataWriter(SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > visit_writer);
 
+    /*!
+     * Register a reduced data writer to output subsampled and compressed
+     * copies of the Eulerian plot data.
+     */
+    void registerReducedDataWriter(SAMRAI::tbox::Pointer<IBTK::ReducedDataWriter> reduced_writer);
+
     /*!
      * \brief Get the level number on which structures reside.
      */
@@ -515,6 +522,11 @@ private:
      */
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > d_visit_writer;
 
+    /*!
+     * The object used to write out reduced copies of the Eulerian plot data.
+     */
+    SAMRAI::tbox::Pointer<IBTK::ReducedDataWriter> d_reduced_writer;
+
     /*!
      * Control printing of S[lambda].
      */
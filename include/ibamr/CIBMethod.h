@@ -290,6 +290,12 @@ public:
      */
     void registerVisItDataWriter(SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > visit_writer);
 
+    /*!
+     * \brief Register a reduced data writer to output subsampled and
+     * compressed copies of the Eulerian plot data.
+     */
+    void registerReducedDataWriter(SAMRAI::tbox::Pointer<IBTK::ReducedDataWriter> reduced_writer);
+
     /*!
      * \brief Override the putToDatabase method of the base Serializable class.
      */
@@ -521,6 +527,11 @@ private:
      */
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > d_visit_writer;
 
+    /*!
+     * The object used to write out reduced copies of the Eulerian plot data.
+     */
+    SAMRAI::tbox::Pointer<IBTK::ReducedDataWriter> d_reduced_writer;
+
     /*!
      * Control printing of S[lambda]
      */
@@ -38,6 +38,7 @@
 #include <vector>
 
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PETScInitialGuessProjector.h"
 #include "petscksp.h"
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
@@ -240,6 +241,12 @@ public:
      */
     bool solveSystem(Vec x, Vec b);
 
+    /*!
+     * \brief Return the number of iterations taken by the most recent call to
+     * solveSystem().
+     */
+    int getNumIterations() const;
+
     /*!
      * \brief Compute hierarchy dependent data required for solving \f$Ax=b\f$.
      *
@@ -378,6 +385,11 @@ private:
     bool d_initial_guess_nonzero;
     bool d_enable_logging;
 
+    // Initial guess projection onto the corrections of previous solves.
+    int d_guess_projection_dim;
+    bool d_guess_projection_recompute_images;
+    SAMRAI::tbox::Pointer<IBTK::PETScInitialGuessProjector> d_guess_projector;
+
     // Preconditioner stuff
     SAMRAI::tbox::Pointer<IBAMR::INSStaggeredHierarchyIntegrator> d_ins_integrator;
     SAMRAI::tbox::Pointer<IBAMR::StaggeredStokesSolver> d_LInv;
@@ -69,6 +69,19 @@ namespace IBAMR
  * equation \f$ |\nabla Q | = 1 \f$, which produces the signed distance away from an
  * interface.
  *
+ * The sweeps are carried out independently on each patch and are iterated, with
+ * ghost cell values exchanged between iterations, until the L2-norm of the change
+ * in the distance function falls below the prescribed tolerance.  After the first
+ * iteration, patches whose interior and ghost cell values did not change since
+ * their previous sweep are skipped, unless skip_unchanged_patches is set to
+ * FALSE in the input database.  If a second-order solution is requested,
+ * the converged first-order solution is used as the initial guess for
+ * second-order sweeps, which use second-order upwind differences away from the
+ * interface and from physical boundaries.  The first-order sweeps require at
+ * least one ghost cell and the second-order sweeps require at least two ghost
+ * cells; initializeLSData() reports an error if the distance function has too
+ * few ghost cells.
+ *
  * \note The class can also compute distance function from physical domain boundary if
  * specified through input file. In presence of a physical domain wall, the distance function
  * at a grid point is D = min(distance from interface, distance from wall location).
@@ -104,19 +117,31 @@ protected:
     // Algorithm parameters.
     bool d_consider_phys_bdry_wall;
     int d_wall_location_idx[2 * NDIM];
+    bool d_skip_unchanged_patches;
 
 private:
     /*!
-     * \brief Do one fast sweep over the hierarchy.
+     * \brief Do one fast sweep over the hierarchy.  The values used in the
+     * previous sweep of each patch are stored in \a dist_iter_idx.  If \a
+     * skip_unchanged_patches is true, patches whose data did not change since
+     * their previous sweep are skipped.
+     *
+     * \return The L2-norm of the change in the distance function.
      */
-    void fastSweep(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops, int dist_idx) const;
+    double fastSweep(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops,
+                     int dist_idx,
+                     int dist_iter_idx,
+                     LevelSetOrder ls_order,
+                     bool skip_unchanged_patches,
+                     int& num_patches_swept) const;
 
     /*!
      * \brief Do one fast sweep over a patch.
      */
     void fastSweep(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_data,
                    const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                   const SAMRAI::hier::Box<NDIM>& domain_box) const;
+                   const SAMRAI::hier::Box<NDIM>& domain_box,
+                   LevelSetOrder ls_order) const;
 
     /*!
      * Read input values from a given database.
@@ -582,6 +582,13 @@ public:
 
     /*!
      * Write the equation_systems data to a restart file in the specified directory.
+     *
+     * \note If the input key libmesh_restart_partitioned is set to TRUE, each
+     * processor writes the degrees of freedom that it owns, along with the
+     * node and element ownership map, to its own file.  When restarting on
+     * the same number of processors with the same partitioning, each
+     * processor reads back only its own file; otherwise, the data are
+     * redistributed to the new owners.
      */
     void writeFEDataToRestartFile(const std::string& restart_dump_dirname, unsigned int time_step_number);
 
@@ -739,6 +746,8 @@ protected:
      */
     SAMRAI::tbox::Pointer<SAMRAI::mesh::LoadBalancer<NDIM> > d_load_balancer;
     int d_workload_idx;
+    bool d_calibrate_workload;
+    int d_workload_calibration_num_samples;
 
     /*
      * The object name is used as a handle to databases stored in restart files
@@ -763,6 +772,13 @@ protected:
      */
     std::string d_libmesh_restart_file_extension;
 
+    /*
+     * Whether libMesh equation systems data are written to per-processor
+     * restart files, and whether the data being restored were written that
+     * way.
+     */
+    bool d_libmesh_restart_partitioned, d_libmesh_restart_read_partitioned;
+
 private:
     /*!
      * \brief Default constructor.
@@ -812,6 +828,20 @@ private:
      * members.
      */
     void getFromRestart();
+
+    /*!
+     * Write the equation systems data for the specified part to per-processor
+     * restart files.
+     */
+    void writePartitionedRestartData(const std::string& restart_dump_dirname,
+                                     unsigned int time_step_number,
+                                     unsigned int part);
+
+    /*!
+     * Read the equation systems data for the specified part from
+     * per-processor restart files.
+     */
+    void readPartitionedRestartData(unsigned int part);
 };
 } // namespace IBAMR
 
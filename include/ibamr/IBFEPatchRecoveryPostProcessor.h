@@ -134,6 +134,14 @@ private:
      */
     IBFEPatchRecoveryPostProcessor& operator=(const IBFEPatchRecoveryPostProcessor& that);
 
+    /*!
+     * \brief Apply the element patch recovery operator to quadrature point
+     * values with n_vars interleaved components.
+     */
+    void applyRecoveryOperator(std::vector<double>& nodal_vals,
+                               const std::vector<double>& qp_vals,
+                               unsigned int n_vars) const;
+
     /*
      * FE data associated with this object.
      */
@@ -176,9 +184,12 @@ private:
     std::vector<unsigned int> d_elem_n_qp, d_elem_qp_global_offset, d_elem_qp_local_offset;
 
     /*
-     * Element patch L2 projection matrices.
+     * Element patch recovery operator, stored in compressed sparse row format.
+     * Row k maps the values at the global quadrature points of the k-th local
+     * element patch to the recovered value at the corresponding node.
      */
-    std::vector<Eigen::ColPivHouseholderQR<Eigen::MatrixXd> > d_local_patch_proj_solver;
+    std::vector<unsigned int> d_recovery_op_row_offsets, d_recovery_op_cols;
+    std::vector<double> d_recovery_op_vals;
 
     /*
      * Stress data at interpolation points.
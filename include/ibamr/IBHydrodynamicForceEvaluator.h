@@ -184,6 +184,19 @@ public:
                                SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > patch_hierarchy,
                                int strct_id = 0);
 
+    /*!
+     * \brief Enable or disable the incremental evaluation mode.
+     *
+     * In incremental mode, the face area and volume weights are recomputed
+     * only when the patch hierarchy changes, and the lagged momentum integrals
+     * of control volumes that have not moved to different grid cells since the
+     * last call to computeHydrodynamicForce() are reused rather than
+     * recomputed.  This mode assumes that the velocity passed to
+     * computeLaggedMomentumIntegral() is the velocity that was passed to
+     * computeHydrodynamicForce() during the preceding time step.
+     */
+    void setIncrementalMode(bool incremental_mode);
+
     /*!
      * \brief Set the origin of the position vector used to compute torques
      *
@@ -323,6 +336,30 @@ private:
      */
     void resetFaceVolWeight(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > patch_hierarchy);
 
+    /*!
+     * \brief Reset the face area and volume weights if required.
+     *
+     * \return Whether the weights were reset.
+     */
+    bool resetWeights(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > patch_hierarchy);
+
+    /*!
+     * \brief Compute the cell-centered index boxes covered by the new control
+     * volume on each level of the patch hierarchy.
+     */
+    void getIntegrationBoxes(std::vector<SAMRAI::hier::Box<NDIM> >& integration_boxes,
+                             const IBHydrodynamicForceObject& fobj,
+                             SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > patch_hierarchy);
+
+    /*!
+     * \brief Compute the local (i.e., unreduced) contributions to the linear
+     * and angular momentum integrals over the new control volume.
+     */
+    void computeLocalMomentumIntegrals(IBTK::Vector3d& P_box,
+                                       IBTK::Vector3d& L_box,
+                                       const IBHydrodynamicForceObject& fobj,
+                                       SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > patch_hierarchy);
+
     /*!
      * \brief Allocate and fill velocity and pressure patch data.
      */
@@ -369,6 +406,17 @@ private:
      */
     int d_face_wgt_sc_idx, d_vol_wgt_sc_idx;
 
+    /*!
+     * \brief Data used by the incremental evaluation mode: the finest level
+     * number for which the weights were computed, and the control volume index
+     * boxes and torque origins used to evaluate the most recent momentum
+     * integrals.
+     */
+    bool d_incremental_mode;
+    int d_wgt_finest_ln;
+    std::map<int, std::vector<SAMRAI::hier::Box<NDIM> > > d_integration_boxes;
+    std::map<int, IBTK::Vector3d> d_integration_r0;
+
     /*!
      * \brief Data structure encapsulating hydrodynamic force on an object.
      */
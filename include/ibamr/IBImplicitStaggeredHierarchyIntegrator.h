@@ -375,6 +375,11 @@ private:
     KSP d_schur_solver;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_u_scratch_vec, d_f_scratch_vec;
     Vec d_X_current;
+
+    // Lagrangian force Jacobian and interpolation operator used to construct
+    // the Stokes-IB preconditioner.  These matrices are retained between time
+    // steps so that their nonzero structures can be reused.
+    Mat d_elastic_op, d_interp_op;
 };
 } // namespace IBAMR
 
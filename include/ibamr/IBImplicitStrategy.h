@@ -133,6 +133,9 @@ public:
 
     /*!
      * Construct the linearized Lagrangian force Jacobian.
+     *
+     * If \a A is non-NULL, implementations may reuse the existing matrix,
+     * e.g., when the nonzero structure of the Jacobian is unchanged.
      */
     virtual void constructLagrangianForceJacobian(Mat& A, MatType mat_type, double data_time) = 0;
 
@@ -148,6 +151,9 @@ public:
 
     /*!
      * Construct the IB interpolation operator.
+     *
+     * If \a J is non-NULL, implementations may reuse the existing matrix,
+     * e.g., when the nonzero structure of the operator is unchanged.
      */
     virtual void constructInterpOp(Mat& J,
                                    void (*spread_fnc)(const double, double*),
@@ -590,6 +590,8 @@ protected:
      */
     SAMRAI::tbox::Pointer<SAMRAI::mesh::LoadBalancer<NDIM> > d_load_balancer;
     int d_workload_idx;
+    bool d_calibrate_workload;
+    int d_workload_calibration_num_samples;
 
     /*
      * The object name is used as a handle to databases stored in restart files
@@ -311,6 +311,12 @@ private:
      */
     void reinitializeOperatorsAndSolvers(double current_time, double new_time);
 
+    /*!
+     * Discard the solution histories used to compute initial guesses for the
+     * Stokes and pressure solvers.
+     */
+    void resetInitialGuessEngines();
+
     /*!
      * Project the velocity field following a regridding operation.
      */
@@ -354,6 +360,7 @@ private:
 
     std::string d_stokes_solver_type, d_stokes_precond_type, d_stokes_sub_precond_type;
     SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_stokes_solver_db, d_stokes_precond_db, d_stokes_sub_precond_db;
+    SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_stokes_initial_guess_db, d_pressure_initial_guess_db;
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
     bool d_stokes_solver_needs_init;
 
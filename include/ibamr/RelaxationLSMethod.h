@@ -38,6 +38,7 @@
 #include <string>
 #include <vector>
 
+#include "Box.h"
 #include "ibamr/LSInitStrategy.h"
 #include "ibamr/ibamr_enums.h"
 #include "tbox/Pointer.h"
@@ -53,9 +54,9 @@ class CellData;
 namespace hier
 {
 template <int DIM>
-class Box;
-template <int DIM>
 class Patch;
+template <int DIM>
+class PatchHierarchy;
 } // namespace hier
 } // namespace SAMRAI
 
@@ -70,6 +71,15 @@ namespace IBAMR
  * to the Eikonal equation \f$ |\nabla Q | = 1 \f$. The solution of the Eikonal equation
  * produces the signed distance away from an interface.
  *
+ * If narrow-band mode is enabled (input key <tt>use_narrow_band</tt>), each
+ * patch is divided into tiles of <tt>narrow_band_tile_size</tt> cells in each
+ * direction, and only tiles that contain the interface or values within
+ * <tt>narrow_band_width</tt> grid cells of it are relaxed.  Values in the
+ * remaining tiles are clamped to plus or minus the band width without
+ * iteration.  The set of active tiles is refreshed from the reinitialized
+ * distance function at the end of each call to initializeLSData() and is
+ * combined with the tiles that contain the interface at the start of the next
+ * call.
  *
  * Reference
  * Min, C., <A HREF="http://www.sciencedirect.com/science/article/pii/S0021999109007189">
@@ -99,24 +109,46 @@ public:
                           bool initial_time);
 
 protected:
+    // Narrow-band parameters.  The band width is measured in grid cells.
+    bool d_use_narrow_band;
+    double d_narrow_band_width;
+    int d_narrow_band_tile_size;
 
 private:
     /*!
-     * \brief Do one relaxation step over the hierarchy.
+     * \brief Do one relaxation step over the hierarchy.  The values prior to
+     * relaxation are stored in \a dist_iter_idx on the relaxed cells.
+     *
+     * \return The L2-norm of the change in the distance function.
      */
-    void relax(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops,
-               int dist_idx,
-               int dist_init_idx,
-               const int iter) const;
+    double relax(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops,
+                 int dist_idx,
+                 int dist_iter_idx,
+                 int dist_init_idx,
+                 const int iter) const;
 
     /*!
-     * \brief Do one relaxation step over a patch.
+     * \brief Do one relaxation step over the cells of a patch that are
+     * contained in \a tile_box.
      */
     void relax(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_data,
                const SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_init_idx,
                const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+               const SAMRAI::hier::Box<NDIM>& tile_box,
                const int iter) const;
 
+    /*!
+     * \brief Determine the active tiles of each local patch from the values of
+     * \a dist_idx.  If \a merge_previous_band is true, tiles that were active
+     * in the previously computed band remain active.  If \a clamp_far_field is
+     * true, the values in inactive tiles are set to plus or minus the band
+     * width.
+     */
+    void resetNarrowBand(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                         int dist_idx,
+                         bool merge_previous_band,
+                         bool clamp_far_field);
+
     /*!
      * Read input values from a given database.
      */
@@ -147,6 +179,11 @@ private:
      * \return A reference to this object.
      */
     RelaxationLSMethod& operator=(const RelaxationLSMethod& that);
+
+    // The active tiles of each local patch, along with the patch boxes for
+    // which they were computed, indexed by level number and patch number.
+    std::vector<std::vector<std::vector<SAMRAI::hier::Box<NDIM> > > > d_active_tiles;
+    std::vector<std::vector<SAMRAI::hier::Box<NDIM> > > d_band_patch_boxes;
 };
 } // namespace IBAMR
 
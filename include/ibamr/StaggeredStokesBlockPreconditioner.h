@@ -165,6 +165,17 @@ public:
      */
     void deallocateSolverState();
 
+    /*!
+     * \brief Update the solver state to account for changes in the problem
+     * coefficients.
+     *
+     * The hierarchy operators allocated by initializeSolverState() do not
+     * depend on the values of the problem coefficients, and the velocity and
+     * pressure subdomain solvers are updated by their owners, so this method
+     * only checks that the solver state is initialized.
+     */
+    bool updateCoefficients();
+
 protected:
     /*!
      * \brief Remove components in operator null space.
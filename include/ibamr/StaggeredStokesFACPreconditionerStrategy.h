@@ -336,6 +336,19 @@ public:
      */
     void deallocateOperatorState();
 
+    /*!
+     * \brief Update the coefficient-dependent data set by
+     * initializeOperatorState() to correspond to the current velocity problem
+     * coefficients, boundary conditions, and solution time.
+     *
+     * The communication schedules and transfer operators set by
+     * initializeOperatorState() are reused.
+     *
+     * \return \p true if the operator state was updated, \p false if the
+     * operator state must instead be reinitialized by initializeOperatorState()
+     */
+    bool updateOperatorCoefficients();
+
     //\}
 
 protected:
@@ -352,6 +365,16 @@ protected:
      */
     virtual void deallocateOperatorStateSpecialized(int coarsest_reset_ln, int finest_reset_ln) = 0;
 
+    /*!
+     * \brief Update implementation-specific coefficient-dependent data.
+     *
+     * \note The default implementation does nothing and returns \p false.
+     *
+     * \return \p true if the implementation-specific data were updated, \p
+     * false if the operator state must be reinitialized
+     */
+    virtual bool updateOperatorCoefficientsSpecialized();
+
     /*!
      * \name Methods for executing, caching, and resetting communication
      * schedules.
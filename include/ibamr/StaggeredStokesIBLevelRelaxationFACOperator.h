@@ -35,6 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <cstddef>
 #include <string>
 #include <utility>
 #include <vector>
@@ -123,7 +124,16 @@ namespace IBAMR
  coarse_solver_db = { ... }                     // SAMRAI::tbox::Database for initializing
  coarse
  level solver
+ reuse_SAJ_nonzero_structure = TRUE             // whether to reuse the symbolic phase of
+                                                // the products that form the elasticity
+                                                // operators
  \endverbatim
+ *
+ * When \a reuse_SAJ_nonzero_structure is enabled, the elasticity operators
+ * \f$ S A J \f$ on the various patch levels are retained between
+ * reinitializations of the operator state.  The symbolic phase of each Galerkin
+ * product is recomputed only if the nonzero structure of either of its factors
+ * has changed, e.g., because IB points have moved to different grid cells.
 */
 class StaggeredStokesIBLevelRelaxationFACOperator : public StaggeredStokesFACPreconditionerStrategy
 {
@@ -290,6 +300,19 @@ private:
      */
     StaggeredStokesIBLevelRelaxationFACOperator& operator=(const StaggeredStokesIBLevelRelaxationFACOperator& that);
 
+    /*!
+     * \brief Compute the elasticity operator on the specified patch level as
+     * the Galerkin product \f$ P^T A P \f$, reusing the symbolic phase of the
+     * previously computed product when possible.
+     */
+    void computeSAJOp(int ln, Mat A, Mat P);
+
+    /*!
+     * \brief Destroy the elasticity operators on the specified range of patch
+     * levels.
+     */
+    void destroySAJOps(int coarsest_ln, int finest_ln);
+
     /*
      * Whether we re-discretize the Stokes operator on coarser level or are
      * using Galerkin projection.
@@ -344,6 +367,8 @@ private:
      * on various patch levels.
      */
     double d_SAJ_fill, d_RStokesIBP_fill;
+    bool d_reuse_SAJ_nonzero_structure;
+    std::vector<std::size_t> d_SAJ_A_signature, d_SAJ_P_signature;
     std::vector<Mat> d_SAJ_mat, d_SAJ_prolongation_mat, d_stokesib_prolongation_mat, d_galerkin_stokesib_mat;
     std::vector<Vec> d_scale_SAJ_restriction_mat, d_scale_stokesib_restriction_mat;
 
@@ -155,6 +155,11 @@ protected:
      */
     void deallocateOperatorStateSpecialized(int coarsest_reset_ln, int finest_reset_ln);
 
+    /*!
+     * \brief Update implementation-specific coefficient-dependent data.
+     */
+    bool updateOperatorCoefficientsSpecialized();
+
 private:
     /*!
      * \brief Default constructor.
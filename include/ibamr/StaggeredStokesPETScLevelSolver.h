@@ -123,6 +123,12 @@ protected:
      */
     void deallocateSolverStateSpecialized();
 
+    /*!
+     * \brief Recompute the values of the matrix allocated by
+     * initializeSolverStateSpecialized() while reusing its nonzero structure.
+     */
+    bool updateCoefficientsSpecialized();
+
     /*!
      * \brief Copy a generic vector to the PETSc representation.
      */
@@ -79,6 +79,12 @@ public:
      * \brief Construct a parallel PETSc Mat object corresponding to a MAC
      * discretization of the time-dependent incompressible Stokes equations on a
      * single SAMRAI::hier::PatchLevel.
+     *
+     * If \a mat is non-NULL and \a reuse_nonzero_structure is \p true, the
+     * values of the existing matrix are overwritten in place.  This requires
+     * that the DOF indexing of the patch level is unchanged since \a mat was
+     * constructed.  Otherwise, the existing matrix is destroyed and a new
+     * matrix is created.
      */
     static void constructPatchLevelMACStokesOp(Mat& mat,
                                                const SAMRAI::solv::PoissonSpecifications& u_problem_coefs,
@@ -87,7 +93,8 @@ public:
                                                const std::vector<int>& num_dofs_per_proc,
                                                int u_dof_index_idx,
                                                int p_dof_index_idx,
-                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                                               bool reuse_nonzero_structure = false);
 
     /*!
      * \brief Partition the patch level into subdomains suitable to be used for
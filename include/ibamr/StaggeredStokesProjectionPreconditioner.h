@@ -187,6 +187,9 @@ private:
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_Phi_var, d_F_Phi_var;
     int d_Phi_scratch_idx, d_F_Phi_idx;
+
+    // Time at which the pressure solution history initial guess was last used.
+    double d_pressure_initial_guess_time;
 };
 } // namespace IBAMR
 
@@ -40,6 +40,7 @@
 #include "PoissonSpecifications.h"
 #include "ibamr/StaggeredStokesPhysicalBoundaryHelper.h"
 #include "ibtk/GeneralSolver.h"
+#include "ibtk/SolutionHistoryInitialGuess.h"
 #include "tbox/Pointer.h"
 
 namespace SAMRAI
@@ -108,6 +109,21 @@ public:
      */
     virtual void setPhysicalBoundaryHelper(SAMRAI::tbox::Pointer<StaggeredStokesPhysicalBoundaryHelper> bc_helper);
 
+    /*!
+     * \brief Set the object used to compute initial guesses from the solutions
+     * of previous solves.
+     *
+     * \note This object is not used by the solver itself.  Rather, it is used
+     * by the clients of the solver that compute and store solutions.
+     */
+    virtual void setInitialGuessEngine(SAMRAI::tbox::Pointer<IBTK::SolutionHistoryInitialGuess> initial_guess);
+
+    /*!
+     * \brief Get the object used to compute initial guesses from the solutions
+     * of previous solves.
+     */
+    virtual SAMRAI::tbox::Pointer<IBTK::SolutionHistoryInitialGuess> getInitialGuessEngine() const;
+
 protected:
     // Problem specification.
     SAMRAI::solv::PoissonSpecifications d_U_problem_coefs;
@@ -122,6 +138,9 @@ protected:
     // Nullspace info
     bool d_has_velocity_nullspace, d_has_pressure_nullspace;
 
+    // Solution history used to compute initial guesses.
+    SAMRAI::tbox::Pointer<IBTK::SolutionHistoryInitialGuess> d_initial_guess;
+
 private:
     /*!
      * \brief Copy constructor.
@@ -38,6 +38,7 @@
 #include "ibamr/namespaces.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/ReducedDataWriter.h"
 #include "ibtk/ibtk_utilities.h"
 #include "libmesh/equation_systems.h"
 #include "libmesh/petsc_matrix.h"
@@ -1144,7 +1145,7 @@ CIBFEMethod::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy,
         }
     }
 
-    // Register Eulerian lambda with visit.
+    // Register Eulerian lambda with the visualization data writers.
     if (d_output_eul_lambda && d_visit_writer)
     {
         d_visit_writer->registerPlotQuantity("S_lambda", "VECTOR", d_eul_lambda_idx, 0);
@@ -1155,6 +1156,16 @@ CIBFEMethod::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy,
             if (d == 2) d_visit_writer->registerPlotQuantity("S_lambda_z", "SCALAR", d_eul_lambda_idx, d);
         }
     }
+    if (d_output_eul_lambda && d_reduced_writer)
+    {
+        d_reduced_writer->registerPlotQuantity("S_lambda", "VECTOR", d_eul_lambda_idx, 0);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            if (d == 0) d_reduced_writer->registerPlotQuantity("S_lambda_x", "SCALAR", d_eul_lambda_idx, d);
+            if (d == 1) d_reduced_writer->registerPlotQuantity("S_lambda_y", "SCALAR", d_eul_lambda_idx, d);
+            if (d == 2) d_reduced_writer->registerPlotQuantity("S_lambda_z", "SCALAR", d_eul_lambda_idx, d);
+        }
+    }
 
     bool from_restart = RestartManager::getManager()->isFromRestart();
     if (initial_time || from_restart)
@@ -1194,6 +1205,12 @@ CIBFEMethod::registerVisItDataWriter(Pointer<VisItDataWriter<NDIM> > visit_write
     d_visit_writer = visit_writer;
 } // registerVisItDataWriter
 
+void
+CIBFEMethod::registerReducedDataWriter(Pointer<ReducedDataWriter> reduced_writer)
+{
+    d_reduced_writer = reduced_writer;
+} // registerReducedDataWriter
+
 int
 CIBFEMethod::getStructuresLevelNumber()
 {
@@ -38,6 +38,7 @@
 #include "ibamr/StokesSpecifications.h"
 #include "ibamr/namespaces.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/ReducedDataWriter.h"
 
 namespace IBAMR
 {
@@ -348,9 +349,16 @@ CIBMethod::postprocessIntegrateData(double current_time, double new_time, int nu
         Vec lambda_lag_vec_parallel = NULL;
         Vec lambda_lag_vec_seq = NULL;
 
+        // Gather the multipliers of the rigid structures to processor zero in
+        // the order in which the structures are numbered.  As in
+        // d_struct_lag_idx_range, the rigid parts are the first
+        // d_num_rigid_parts structures in sorted structure ID order.
+        std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(finest_ln);
+        std::sort(structIDs.begin(), structIDs.end());
+        if (structIDs.size() > d_num_rigid_parts) structIDs.resize(d_num_rigid_parts);
         VecDuplicate(lambda_petsc_vec_parallel, &lambda_lag_vec_parallel);
         d_l_data_manager->scatterPETScToLagrangian(lambda_petsc_vec_parallel, lambda_lag_vec_parallel, finest_ln);
-        d_l_data_manager->scatterToZero(lambda_lag_vec_parallel, lambda_lag_vec_seq);
+        d_l_data_manager->scatterStructuresToZero(lambda_lag_vec_parallel, lambda_lag_vec_seq, structIDs, finest_ln);
 
         if (SAMRAI_MPI::getRank() == 0)
         {
@@ -536,6 +544,16 @@ CIBMethod::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy,
             if (d == 2) d_visit_writer->registerPlotQuantity("S_lambda_z", "SCALAR", d_eul_lambda_idx, d);
         }
     }
+    if (d_output_eul_lambda && d_reduced_writer)
+    {
+        d_reduced_writer->registerPlotQuantity("S_lambda", "VECTOR", d_eul_lambda_idx, 0);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            if (d == 0) d_reduced_writer->registerPlotQuantity("S_lambda_x", "SCALAR", d_eul_lambda_idx, d);
+            if (d == 1) d_reduced_writer->registerPlotQuantity("S_lambda_y", "SCALAR", d_eul_lambda_idx, d);
+            if (d == 2) d_reduced_writer->registerPlotQuantity("S_lambda_z", "SCALAR", d_eul_lambda_idx, d);
+        }
+    }
 
     // Initialize mobility regularization data.
     setRegularizationWeight(struct_ln);
@@ -892,6 +910,13 @@ CIBMethod::registerVisItDataWriter(Pointer<VisItDataWriter<NDIM> > visit_writer)
     return;
 } // registerVisItDataWriter
 
+void
+CIBMethod::registerReducedDataWriter(Pointer<ReducedDataWriter> reduced_writer)
+{
+    d_reduced_writer = reduced_writer;
+    return;
+} // registerReducedDataWriter
+
 void
 CIBMethod::putToDatabase(Pointer<Database> db)
 {
@@ -124,10 +124,22 @@ CIBSaddlePointSolver::CIBSaddlePointSolver(const std::string& object_name,
     d_rel_residual_tol = 1.0e-5;
     d_initial_guess_nonzero = true; // Initial guess doesn't have to be zero in the outer solver.
     d_enable_logging = false;
+    d_guess_projection_dim = 0;
+    d_guess_projection_recompute_images = false;
 
     // Get values from the input database.
     if (input_db) getFromInput(input_db);
 
+    // Setup the initial guess projection.  The saddle-point operator changes
+    // as the bodies move, so unless the images of the stored corrections are
+    // recomputed, the projection only approximately minimizes the initial
+    // residual.
+    if (d_guess_projection_dim > 0)
+    {
+        d_guess_projector = new IBTK::PETScInitialGuessProjector(
+            d_object_name + "::guess_projector", d_guess_projection_dim, d_guess_projection_recompute_images);
+    }
+
     // Create the linear operator for the extended Stokes (Krylov) solver.
     d_A = new CIBStaggeredStokesOperator(d_object_name + "CIBStaggeredStokesOperator",
                                          d_cib_strategy,
@@ -444,7 +456,9 @@ CIBSaddlePointSolver::solveSystem(Vec x, Vec b)
     d_A->setHomogeneousBc(true);
 
     // Solve the system.
+    if (d_guess_projector) d_guess_projector->preSolve(d_petsc_ksp, d_petsc_b, d_petsc_x);
     KSPSolve(d_petsc_ksp, d_petsc_b, d_petsc_x);
+    if (d_guess_projector) d_guess_projector->postSolve(d_petsc_ksp, d_petsc_x);
     KSPGetIterationNumber(d_petsc_ksp, &d_current_iterations);
     KSPGetResidualNorm(d_petsc_ksp, &d_current_residual_norm);
 
@@ -468,6 +482,12 @@ CIBSaddlePointSolver::solveSystem(Vec x, Vec b)
     return converged;
 } // solveSystem
 
+int
+CIBSaddlePointSolver::getNumIterations() const
+{
+    return d_current_iterations;
+} // getNumIterations
+
 void
 CIBSaddlePointSolver::initializeSolverState(Vec x, Vec b)
 {
@@ -552,6 +572,9 @@ CIBSaddlePointSolver::deallocateSolverState()
         d_mob_solver->deallocateSolverState();
     }
 
+    // Discard the initial guess projection space.
+    if (d_guess_projector) d_guess_projector->reset();
+
     // Delete the solution and RHS vectors.
     VecDestroy(&d_petsc_b);
     d_petsc_x = NULL;
@@ -588,6 +611,10 @@ CIBSaddlePointSolver::getFromInput(Pointer<Database> input_db)
     if (input_db->keyExists("initial_guess_nonzero"))
         d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
     if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    if (input_db->keyExists("guess_projection_dim"))
+        d_guess_projection_dim = input_db->getInteger("guess_projection_dim");
+    if (input_db->keyExists("guess_projection_recompute_images"))
+        d_guess_projection_recompute_images = input_db->getBool("guess_projection_recompute_images");
     if (input_db->keyExists("scale_interp_operator")) d_scale_interp = input_db->getDouble("scale_interp_operator");
     if (input_db->keyExists("scale_spread_operator")) d_scale_spread = input_db->getDouble("scale_spread_operator");
     if (input_db->keyExists("regularize_mob_factor")) d_reg_mob_factor = input_db->getDouble("regularize_mob_factor");
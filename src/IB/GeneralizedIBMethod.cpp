@@ -522,8 +522,9 @@ GeneralizedIBMethod::spreadForce(const int f_data_idx,
                                  const std::vector<Pointer<RefineSchedule<NDIM> > >& f_prolongation_scheds,
                                  const double data_time)
 {
-    IBMethod::spreadForce(f_data_idx, f_phys_bdry_op, f_prolongation_scheds, data_time);
-
+    std::vector<Pointer<LData> >* F_data = NULL;
+    bool* F_needs_ghost_fill = NULL;
+    getForceData(&F_data, &F_needs_ghost_fill, data_time);
     std::vector<Pointer<LData> >* N_data = NULL;
     bool* N_needs_ghost_fill = NULL;
     if (MathUtilities<double>::equalEps(data_time, d_current_time))
@@ -547,19 +548,36 @@ GeneralizedIBMethod::spreadForce(const int f_data_idx,
     std::vector<Pointer<LData> >* X_LE_data;
     bool* X_LE_needs_ghost_fill;
     getLECouplingPositionData(&X_LE_data, &X_LE_needs_ghost_fill, data_time);
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    resetAnchorPointValues(*F_data, coarsest_ln, finest_ln);
+
+    // Spread the force and torque densities in a single pass over the
+    // Lagrangian mesh.
     getVelocityHierarchyDataOps()->setToScalar(d_n_idx, 0.0, false);
-    d_l_data_manager->spread(d_n_idx,
-                             *N_data,
+    std::vector<int> f_data_idxs(2);
+    f_data_idxs[0] = f_data_idx;
+    f_data_idxs[1] = d_n_idx;
+    std::vector<std::vector<Pointer<LData> > > F_N_data(2);
+    F_N_data[0] = *F_data;
+    F_N_data[1] = *N_data;
+    std::vector<RobinPhysBdryPatchStrategy*> f_phys_bdry_ops(2, f_phys_bdry_op);
+    std::vector<std::vector<Pointer<RefineSchedule<NDIM> > > > f_n_prolongation_scheds(2);
+    f_n_prolongation_scheds[0] = f_prolongation_scheds;
+    std::vector<bool> F_N_needs_ghost_fill(2);
+    F_N_needs_ghost_fill[0] = *F_needs_ghost_fill;
+    F_N_needs_ghost_fill[1] = *N_needs_ghost_fill;
+    d_l_data_manager->spread(f_data_idxs,
+                             F_N_data,
                              *X_LE_data,
-                             f_phys_bdry_op,
-                             std::vector<Pointer<RefineSchedule<NDIM> > >(),
+                             f_phys_bdry_ops,
+                             f_n_prolongation_scheds,
                              data_time,
-                             *N_needs_ghost_fill,
+                             F_N_needs_ghost_fill,
                              *X_LE_needs_ghost_fill);
+    *F_needs_ghost_fill = false;
     *N_needs_ghost_fill = false;
     *X_LE_needs_ghost_fill = false;
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
     const std::vector<Pointer<RefineSchedule<NDIM> > >& n_ghostfill_scheds =
         getGhostfillRefineSchedules(d_object_name + "::n");
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
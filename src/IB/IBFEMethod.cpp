@@ -34,6 +34,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <fstream>
 #include <limits>
 #include <ostream>
 #include <set>
@@ -74,6 +75,7 @@
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LEInteractor.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/WorkloadCalibrator.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
 #include "libmesh/auto_ptr.h"
@@ -81,6 +83,7 @@
 #include "libmesh/compare_types.h"
 #include "libmesh/dense_vector.h"
 #include "libmesh/dof_map.h"
+#include "libmesh/dof_object.h"
 #include "libmesh/edge.h"
 #include "libmesh/elem.h"
 #include "libmesh/enum_fe_family.h"
@@ -89,6 +92,7 @@
 #include "libmesh/equation_systems.h"
 #include "libmesh/fe_type.h"
 #include "libmesh/fem_context.h"
+#include "libmesh/id_types.h"
 #include "libmesh/linear_implicit_system.h"
 #include "libmesh/mesh.h"
 #include "libmesh/mesh_base.h"
@@ -305,6 +309,219 @@ libmesh_restart_file_name(const std::string& restart_dump_dirname,
                      << std::setfill('0') << std::right << time_step_number << "." << extension;
     return file_name_prefix.str();
 }
+
+// Version of the partitioned libMesh restart file format.
+static const int PARTITIONED_RESTART_VERSION = 1;
+
+// Kinds of DoF objects stored in partitioned libMesh restart files.
+static const int NODE_DOF_OBJECT = 0;
+static const int ELEM_DOF_OBJECT = 1;
+
+std::string
+libmesh_partitioned_restart_file_name(const std::string& restart_dump_dirname,
+                                      unsigned int time_step_number,
+                                      unsigned int part,
+                                      int rank)
+{
+    std::ostringstream file_name_prefix;
+    file_name_prefix << restart_dump_dirname << "/libmesh_data_part_" << part << "." << std::setw(6)
+                     << std::setfill('0') << std::right << time_step_number << ".proc_" << std::setw(6) << rank
+                     << ".bin";
+    return file_name_prefix.str();
+}
+
+// The data for one system stored in a partitioned libMesh restart file: the
+// DoF objects owned by the writing processor, their degrees of freedom (in
+// variable-major, component-minor order), and the local part of the solution
+// vector.
+struct PartitionedSystemData
+{
+    std::string name;
+    unsigned int n_vars;
+    dof_id_type n_dofs, first_local_index;
+    std::vector<int> object_kinds;
+    std::vector<dof_id_type> object_ids;
+    std::vector<unsigned int> object_n_dofs;
+    std::vector<dof_id_type> object_dofs;
+    std::vector<double> values;
+};
+
+template <class DofObjectIterator>
+void
+append_owned_dofs(DofObjectIterator it,
+                  const DofObjectIterator end,
+                  const int kind,
+                  const unsigned int sys_num,
+                  PartitionedSystemData& data)
+{
+    for (; it != end; ++it)
+    {
+        const DofObject* const obj = *it;
+        unsigned int n_obj_dofs = 0;
+        for (unsigned int var = 0; var < data.n_vars; ++var)
+        {
+            const unsigned int n_comp = obj->n_comp(sys_num, var);
+            for (unsigned int comp = 0; comp < n_comp; ++comp)
+            {
+                data.object_dofs.push_back(obj->dof_number(sys_num, var, comp));
+            }
+            n_obj_dofs += n_comp;
+        }
+        if (n_obj_dofs == 0) continue;
+        data.object_kinds.push_back(kind);
+        data.object_ids.push_back(obj->id());
+        data.object_n_dofs.push_back(n_obj_dofs);
+    }
+    return;
+}
+
+void
+collect_owned_dofs(const System& system, PartitionedSystemData& data)
+{
+    const MeshBase& mesh = system.get_mesh();
+    data.name = system.name();
+    data.n_vars = system.n_vars();
+    data.n_dofs = system.n_dofs();
+    data.first_local_index = system.get_dof_map().first_dof();
+    data.object_kinds.clear();
+    data.object_ids.clear();
+    data.object_n_dofs.clear();
+    data.object_dofs.clear();
+    append_owned_dofs(mesh.local_nodes_begin(), mesh.local_nodes_end(), NODE_DOF_OBJECT, system.number(), data);
+    append_owned_dofs(mesh.local_elements_begin(), mesh.local_elements_end(), ELEM_DOF_OBJECT, system.number(), data);
+    return;
+}
+
+bool
+has_same_ownership(const PartitionedSystemData& a, const PartitionedSystemData& b)
+{
+    return a.n_vars == b.n_vars && a.n_dofs == b.n_dofs && a.first_local_index == b.first_local_index &&
+           a.object_kinds == b.object_kinds && a.object_ids == b.object_ids && a.object_n_dofs == b.object_n_dofs &&
+           a.object_dofs == b.object_dofs;
+}
+
+const PartitionedSystemData*
+find_system_data(const std::vector<PartitionedSystemData>& file_data, const std::string& name)
+{
+    for (unsigned int k = 0; k < file_data.size(); ++k)
+    {
+        if (file_data[k].name == name) return &file_data[k];
+    }
+    return NULL;
+}
+
+template <typename T>
+inline void
+write_binary(std::ostream& os, const T& val)
+{
+    os.write(reinterpret_cast<const char*>(&val), sizeof(T));
+    return;
+}
+
+template <typename T>
+inline void
+read_binary(std::istream& is, T& val)
+{
+    is.read(reinterpret_cast<char*>(&val), sizeof(T));
+    return;
+}
+
+template <typename T>
+void
+write_binary_array(std::ostream& os, const std::vector<T>& vals)
+{
+    const unsigned long n = vals.size();
+    write_binary(os, n);
+    if (n > 0) os.write(reinterpret_cast<const char*>(&vals[0]), n * sizeof(T));
+    return;
+}
+
+template <typename T>
+void
+read_binary_array(std::istream& is, std::vector<T>& vals)
+{
+    unsigned long n = 0;
+    read_binary(is, n);
+    vals.resize(n);
+    if (n > 0) is.read(reinterpret_cast<char*>(&vals[0]), n * sizeof(T));
+    return;
+}
+
+void
+write_partitioned_system_data(std::ostream& os, const PartitionedSystemData& data)
+{
+    const unsigned long name_len = data.name.size();
+    write_binary(os, name_len);
+    os.write(data.name.data(), name_len);
+    write_binary(os, data.n_vars);
+    write_binary(os, data.n_dofs);
+    write_binary(os, data.first_local_index);
+    write_binary_array(os, data.object_kinds);
+    write_binary_array(os, data.object_ids);
+    write_binary_array(os, data.object_n_dofs);
+    write_binary_array(os, data.object_dofs);
+    write_binary_array(os, data.values);
+    return;
+}
+
+void
+read_partitioned_system_data(std::istream& is, PartitionedSystemData& data)
+{
+    unsigned long name_len = 0;
+    read_binary(is, name_len);
+    data.name.resize(name_len);
+    if (name_len > 0) is.read(&data.name[0], name_len);
+    read_binary(is, data.n_vars);
+    read_binary(is, data.n_dofs);
+    read_binary(is, data.first_local_index);
+    read_binary_array(is, data.object_kinds);
+    read_binary_array(is, data.object_ids);
+    read_binary_array(is, data.object_n_dofs);
+    read_binary_array(is, data.object_dofs);
+    read_binary_array(is, data.values);
+    return;
+}
+
+// Read the header of a partitioned libMesh restart file and return the number
+// of processors that wrote the restart data.
+int
+read_partitioned_restart_header(std::istream& is, const std::string& file_name, unsigned int& n_systems)
+{
+    int version = -1, dof_id_size = -1, num_writers = -1, writer_rank = -1;
+    read_binary(is, version);
+    read_binary(is, dof_id_size);
+    read_binary(is, num_writers);
+    read_binary(is, writer_rank);
+    read_binary(is, n_systems);
+    if (!is.good() || version != PARTITIONED_RESTART_VERSION ||
+        dof_id_size != static_cast<int>(sizeof(dof_id_type)))
+    {
+        TBOX_ERROR("IBFEMethod: invalid or incompatible partitioned restart file " << file_name << std::endl);
+    }
+    return num_writers;
+}
+
+void
+read_partitioned_restart_file(const std::string& file_name, std::vector<PartitionedSystemData>& file_data)
+{
+    std::ifstream is(file_name.c_str(), std::ios::in | std::ios::binary);
+    if (!is.good())
+    {
+        TBOX_ERROR("IBFEMethod: unable to open partitioned restart file " << file_name << std::endl);
+    }
+    unsigned int n_systems = 0;
+    read_partitioned_restart_header(is, file_name, n_systems);
+    file_data.resize(n_systems);
+    for (unsigned int s = 0; s < n_systems; ++s)
+    {
+        read_partitioned_system_data(is, file_data[s]);
+    }
+    if (!is.good())
+    {
+        TBOX_ERROR("IBFEMethod: error reading partitioned restart file " << file_name << std::endl);
+    }
+    return;
+}
 }
 
 const std::string IBFEMethod::COORDS_SYSTEM_NAME = "IB coordinates system";
@@ -634,6 +851,9 @@ IBFEMethod::postprocessIntegrateData(double /*current_time*/, double /*new_time*
 
         // Update the coordinate mapping dX = X - s.
         updateCoordinateMapping(part);
+
+        // Record the cost of the timestep for the workload calibration.
+        d_fe_data_managers[part]->recordWorkloadSample();
     }
 
     d_X_systems.clear();
@@ -761,11 +981,14 @@ IBFEMethod::computeLagrangianForce(const double data_time)
     TBOX_ASSERT(MathUtilities<double>::equalEps(data_time, d_half_time));
     for (unsigned part = 0; part < d_num_parts; ++part)
     {
+        Pointer<WorkloadCalibrator> workload_calibrator = d_fe_data_managers[part]->getWorkloadCalibrator();
+        if (workload_calibrator) workload_calibrator->startTimer(WorkloadCalibrator::FORCE_WORK);
         if (d_stress_normalization_part[part])
         {
             computeStressNormalization(*d_Phi_half_vecs[part], *d_X_half_vecs[part], data_time, part);
         }
         computeInteriorForceDensity(*d_F_half_vecs[part], *d_X_half_vecs[part], d_Phi_half_vecs[part], data_time, part);
+        if (workload_calibrator) workload_calibrator->stopTimer(WorkloadCalibrator::FORCE_WORK);
     }
     return;
 } // computeLagrangianForce
@@ -975,6 +1198,10 @@ IBFEMethod::initializeFEEquationSystems()
         manager_stream << "IBFEMethod FEDataManager::" << part;
         const std::string& manager_name = manager_stream.str();
         d_fe_data_managers[part] = FEDataManager::getManager(manager_name, d_interp_spec[part], d_spread_spec[part]);
+        if (d_calibrate_workload)
+        {
+            d_fe_data_managers[part]->enableWorkloadCalibration(d_workload_calibration_num_samples);
+        }
         d_ghosts = IntVector<NDIM>::max(d_ghosts, d_fe_data_managers[part]->getGhostCellWidth());
 
         // Create FE equation systems objects and corresponding variables.
@@ -982,7 +1209,7 @@ IBFEMethod::initializeFEEquationSystems()
         EquationSystems* equation_systems = d_equation_systems[part];
         d_fe_data_managers[part]->setEquationSystems(equation_systems, d_max_level_number - 1);
         d_fe_data_managers[part]->COORDINATES_SYSTEM_NAME = COORDS_SYSTEM_NAME;
-        if (from_restart)
+        if (from_restart && !d_libmesh_restart_read_partitioned)
         {
             const std::string& file_name = libmesh_restart_file_name(
                 d_libmesh_restart_read_dir, d_libmesh_restart_restore_number, part, d_libmesh_restart_file_extension);
@@ -1040,7 +1267,12 @@ IBFEMethod::initializeFEData()
     {
         // Initialize FE equation systems.
         EquationSystems* equation_systems = d_equation_systems[part];
-        if (from_restart)
+        if (from_restart && d_libmesh_restart_read_partitioned)
+        {
+            equation_systems->init();
+            readPartitionedRestartData(part);
+        }
+        else if (from_restart)
         {
             equation_systems->reinit();
         }
@@ -1287,6 +1519,7 @@ IBFEMethod::putToDatabase(Pointer<Database> db)
     db->putBool("d_split_tangential_force", d_split_tangential_force);
     db->putBool("d_use_jump_conditions", d_use_jump_conditions);
     db->putBool("d_use_consistent_mass_matrix", d_use_consistent_mass_matrix);
+    db->putBool("d_libmesh_restart_partitioned", d_libmesh_restart_partitioned);
     return;
 } // putToDatabase
 
@@ -1295,6 +1528,11 @@ IBFEMethod::writeFEDataToRestartFile(const std::string& restart_dump_dirname, un
 {
     for (unsigned int part = 0; part < d_num_parts; ++part)
     {
+        if (d_libmesh_restart_partitioned)
+        {
+            writePartitionedRestartData(restart_dump_dirname, time_step_number, part);
+            continue;
+        }
         const std::string& file_name =
             libmesh_restart_file_name(restart_dump_dirname, time_step_number, part, d_libmesh_restart_file_extension);
         const XdrMODE xdr_mode = (d_libmesh_restart_file_extension == "xdr" ? ENCODE : WRITE);
@@ -2727,6 +2965,10 @@ IBFEMethod::commonConstructor(const std::string& object_name,
     d_use_jump_conditions = false;
     d_use_consistent_mass_matrix = true;
     d_do_log = false;
+    d_libmesh_restart_partitioned = false;
+    d_libmesh_restart_read_partitioned = false;
+    d_calibrate_workload = false;
+    d_workload_calibration_num_samples = 10;
 
     d_fe_family.resize(d_num_parts, INVALID_FE);
     d_fe_order.resize(d_num_parts, INVALID_ORDER);
@@ -2907,6 +3149,8 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     {
         d_libmesh_restart_file_extension = "xdr";
     }
+    if (db->isBool("libmesh_restart_partitioned"))
+        d_libmesh_restart_partitioned = db->getBool("libmesh_restart_partitioned");
 
     // Other settings.
     if (db->isInteger("min_ghost_cell_width"))
@@ -2921,6 +3165,9 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
         d_do_log = db->getBool("enable_logging");
+    if (db->keyExists("calibrate_workload")) d_calibrate_workload = db->getBool("calibrate_workload");
+    if (db->keyExists("workload_calibration_num_samples"))
+        d_workload_calibration_num_samples = db->getInteger("workload_calibration_num_samples");
 
     if (db->isDouble("epsilon")) d_epsilon = db->getDouble("epsilon");
     return;
@@ -2951,9 +3198,200 @@ IBFEMethod::getFromRestart()
     d_split_tangential_force = db->getBool("d_split_tangential_force");
     d_use_jump_conditions = db->getBool("d_use_jump_conditions");
     d_use_consistent_mass_matrix = db->getBool("d_use_consistent_mass_matrix");
+    if (db->keyExists("d_libmesh_restart_partitioned"))
+        d_libmesh_restart_read_partitioned = db->getBool("d_libmesh_restart_partitioned");
     return;
 } // getFromRestart
 
+void
+IBFEMethod::writePartitionedRestartData(const std::string& restart_dump_dirname,
+                                        const unsigned int time_step_number,
+                                        const unsigned int part)
+{
+    // Each processor writes the degrees of freedom that it owns, along with the
+    // DoF objects that own them, to its own file.  No data are communicated.
+    EquationSystems* equation_systems = d_equation_systems[part];
+    const int rank = SAMRAI_MPI::getRank();
+    const std::string file_name =
+        libmesh_partitioned_restart_file_name(restart_dump_dirname, time_step_number, part, rank);
+    std::ofstream os(file_name.c_str(), std::ios::out | std::ios::binary);
+    if (!os.good())
+    {
+        TBOX_ERROR(d_object_name << "::writeFEDataToRestartFile():\n"
+                                 << "  unable to open file " << file_name << std::endl);
+    }
+    const unsigned int n_systems = equation_systems->n_systems();
+    write_binary(os, PARTITIONED_RESTART_VERSION);
+    write_binary(os, static_cast<int>(sizeof(dof_id_type)));
+    write_binary(os, SAMRAI_MPI::getNodes());
+    write_binary(os, rank);
+    write_binary(os, n_systems);
+    PartitionedSystemData data;
+    for (unsigned int s = 0; s < n_systems; ++s)
+    {
+        const System& system = equation_systems->get_system(s);
+        const NumericVector<double>& solution = *system.solution;
+        collect_owned_dofs(system, data);
+        data.values.resize(solution.local_size());
+        for (unsigned int k = 0; k < data.values.size(); ++k)
+        {
+            data.values[k] = solution(data.first_local_index + k);
+        }
+        write_partitioned_system_data(os, data);
+    }
+    if (!os.good())
+    {
+        TBOX_ERROR(d_object_name << "::writeFEDataToRestartFile():\n"
+                                 << "  error writing file " << file_name << std::endl);
+    }
+    return;
+} // writePartitionedRestartData
+
+void
+IBFEMethod::readPartitionedRestartData(const unsigned int part)
+{
+    EquationSystems* equation_systems = d_equation_systems[part];
+    const MeshBase& mesh = equation_systems->get_mesh();
+    const int rank = SAMRAI_MPI::getRank();
+    const int nodes = SAMRAI_MPI::getNodes();
+
+    // Determine the number of processors that wrote the restart data.
+    int num_writers = 0;
+    if (rank == 0)
+    {
+        const std::string file_name = libmesh_partitioned_restart_file_name(
+            d_libmesh_restart_read_dir, d_libmesh_restart_restore_number, part, 0);
+        std::ifstream is(file_name.c_str(), std::ios::in | std::ios::binary);
+        if (!is.good())
+        {
+            TBOX_ERROR(d_object_name << "::readPartitionedRestartData():\n"
+                                     << "  unable to open file " << file_name << std::endl);
+        }
+        unsigned int n_systems = 0;
+        num_writers = read_partitioned_restart_header(is, file_name, n_systems);
+    }
+    num_writers = SAMRAI_MPI::bcast(num_writers, 0);
+
+    // Read the files assigned to this processor.  When the number of processors
+    // is unchanged, each processor reads only the file that it wrote.
+    std::vector<std::vector<PartitionedSystemData> > file_data;
+    for (int f = rank; f < num_writers; f += nodes)
+    {
+        file_data.push_back(std::vector<PartitionedSystemData>());
+        read_partitioned_restart_file(libmesh_partitioned_restart_file_name(
+                                          d_libmesh_restart_read_dir, d_libmesh_restart_restore_number, part, f),
+                                      file_data.back());
+    }
+
+    // The stored values can be copied directly into the solution vectors only
+    // if every processor owns exactly the same degrees of freedom as the
+    // processor that wrote the corresponding file.
+    const unsigned int n_systems = equation_systems->n_systems();
+    bool same_ownership = (num_writers == nodes);
+    PartitionedSystemData current;
+    for (unsigned int s = 0; s < n_systems && same_ownership; ++s)
+    {
+        const System& system = equation_systems->get_system(s);
+        const PartitionedSystemData* stored = find_system_data(file_data[0], system.name());
+        if (!stored) continue;
+        collect_owned_dofs(system, current);
+        same_ownership = has_same_ownership(current, *stored);
+    }
+    same_ownership = (SAMRAI_MPI::minReduction(same_ownership ? 1 : 0) == 1);
+    if (d_do_log)
+    {
+        plog << d_object_name << "::readPartitionedRestartData(): part " << part << " written by " << num_writers
+             << " processors; " << (same_ownership ? "reading local blocks" : "redistributing data") << "\n";
+    }
+
+    // Restore the solution vectors.  Systems that are not present in the
+    // restart data retain their initial values.
+    std::vector<numeric_index_type> dof_indices;
+    std::vector<double> dof_values;
+    std::vector<dof_id_type> new_obj_dofs;
+    for (unsigned int s = 0; s < n_systems; ++s)
+    {
+        System& system = equation_systems->get_system(s);
+        const unsigned int sys_num = system.number();
+        const unsigned int n_vars = system.n_vars();
+        NumericVector<double>& solution = *system.solution;
+        for (unsigned int f = 0; f < file_data.size(); ++f)
+        {
+            const PartitionedSystemData* stored = find_system_data(file_data[f], system.name());
+            if (!stored) continue;
+            dof_indices.clear();
+            dof_values.clear();
+            if (same_ownership)
+            {
+                for (unsigned int k = 0; k < stored->values.size(); ++k)
+                {
+                    dof_indices.push_back(stored->first_local_index + k);
+                }
+                dof_values = stored->values;
+            }
+            else
+            {
+                // Map the degrees of freedom of each stored DoF object to the
+                // current numbering, which may be owned by other processors.
+                if (stored->n_vars != n_vars)
+                {
+                    TBOX_ERROR(d_object_name << "::readPartitionedRestartData():\n"
+                                             << "  inconsistent number of variables in system " << system.name()
+                                             << std::endl);
+                }
+                unsigned int offset = 0;
+                for (unsigned int j = 0; j < stored->object_ids.size(); ++j)
+                {
+                    const dof_id_type id = stored->object_ids[j];
+                    const DofObject* obj = NULL;
+                    if (stored->object_kinds[j] == NODE_DOF_OBJECT)
+                    {
+                        obj = mesh.query_node_ptr(id);
+                    }
+                    else
+                    {
+                        obj = mesh.query_elem(id);
+                    }
+                    if (!obj)
+                    {
+                        TBOX_ERROR(d_object_name << "::readPartitionedRestartData():\n"
+                                                 << "  DoF object " << id << " is not available on this processor.\n"
+                                                 << "  restarting on a different number of processors requires a\n"
+                                                 << "  replicated mesh." << std::endl);
+                    }
+                    const unsigned int n_obj_dofs = stored->object_n_dofs[j];
+                    new_obj_dofs.clear();
+                    for (unsigned int var = 0; var < n_vars; ++var)
+                    {
+                        const unsigned int n_comp = obj->n_comp(sys_num, var);
+                        for (unsigned int comp = 0; comp < n_comp; ++comp)
+                        {
+                            new_obj_dofs.push_back(obj->dof_number(sys_num, var, comp));
+                        }
+                    }
+                    if (new_obj_dofs.size() != n_obj_dofs)
+                    {
+                        TBOX_ERROR(d_object_name << "::readPartitionedRestartData():\n"
+                                                 << "  inconsistent degrees of freedom for DoF object " << id
+                                                 << " in system " << system.name() << std::endl);
+                    }
+                    for (unsigned int k = 0; k < n_obj_dofs; ++k)
+                    {
+                        const dof_id_type old_dof = stored->object_dofs[offset + k];
+                        dof_indices.push_back(new_obj_dofs[k]);
+                        dof_values.push_back(stored->values[old_dof - stored->first_local_index]);
+                    }
+                    offset += n_obj_dofs;
+                }
+            }
+            if (!dof_indices.empty()) solution.insert(dof_values, dof_indices);
+        }
+        solution.close();
+        system.update();
+    }
+    return;
+} // readPartitionedRestartData
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
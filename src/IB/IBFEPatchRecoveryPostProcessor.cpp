@@ -361,16 +361,29 @@ IBFEPatchRecoveryPostProcessor::initializeFEData(const PeriodicBoundaries* const
     comm.sum(d_elem_qp_global_offset);
     comm.sum(d_elem_qp_local_offset);
 
-    // Set up element patch L2 projection matrices.
+    // Set up the element patch recovery operator.
+    //
+    // The patch geometry is fixed in the reference configuration, so the map
+    // from quadrature point values to recovered nodal values is a constant
+    // sparse linear operator.  Because the reconstruction is evaluated at the
+    // patch center, the recovered value is a(0) = e_0^T M^{-1} f, with M the
+    // (symmetric) patch L2 projection matrix and f = Sum_qp P(x_qp) v_qp, so
+    // that the weight associated with quadrature point qp is g^T P(x_qp), with
+    // g = M^{-1} e_0.
     unsigned int dim = d_mesh->mesh_dimension();
     const unsigned int num_basis_fcns = num_polynomial_basis_fcns(dim, d_interp_order);
     Eigen::MatrixXd M(num_basis_fcns, num_basis_fcns);
-    Eigen::VectorXd P(num_basis_fcns);
+    Eigen::VectorXd P(num_basis_fcns), e0(num_basis_fcns), g(num_basis_fcns);
+    e0.setZero();
+    e0(0) = 1.0;
     UniquePtr<FEBase> fe(FEBase::build(dim, FEType(d_interp_order, LAGRANGE)));
     const std::vector<libMesh::Point>& q_point = fe->get_xyz();
     qrule = QBase::build(QGAUSS, dim, d_quad_order);
     fe->attach_quadrature_rule(qrule.get());
-    d_local_patch_proj_solver.resize(d_local_elem_patches.size());
+    d_recovery_op_row_offsets.resize(d_local_elem_patches.size() + 1);
+    d_recovery_op_row_offsets[0] = 0;
+    d_recovery_op_cols.clear();
+    d_recovery_op_vals.clear();
     unsigned int k = 0;
     for (std::map<dof_id_type, ElemPatch>::iterator it = d_local_elem_patches.begin(); it != d_local_elem_patches.end();
          ++it, ++k)
@@ -391,8 +404,8 @@ IBFEPatchRecoveryPostProcessor::initializeFEData(const PeriodicBoundaries* const
                 M += P * P.transpose();
             }
         }
-        d_local_patch_proj_solver[k] = M.colPivHouseholderQr();
-        if (!d_local_patch_proj_solver[k].isInvertible())
+        Eigen::ColPivHouseholderQR<Eigen::MatrixXd> patch_proj_solver = M.colPivHouseholderQr();
+        if (!patch_proj_solver.isInvertible())
         {
             TBOX_ERROR(
                 "IBFEPatchRecoveryPostProcessor could not construct L2 reconstruction for "
@@ -401,6 +414,22 @@ IBFEPatchRecoveryPostProcessor::initializeFEData(const PeriodicBoundaries* const
                 << node_id
                 << "\n");
         }
+        g = patch_proj_solver.solve(e0);
+        for (ElemPatch::const_iterator el_it = elem_patch.begin(); el_it != elem_patch.end(); ++el_it)
+        {
+            const Elem* const elem = el_it->get<0>();
+            const CompositePeriodicMapping& inverse_mapping = el_it->get<2>();
+            const unsigned int global_offset = d_elem_qp_global_offset[elem->id()];
+            fe->reinit(elem);
+            for (unsigned int qp = 0; qp < qrule->n_points(); ++qp)
+            {
+                evaluate_polynomial_basis_fcns(
+                    P, node, apply_composite_periodic_mapping(inverse_mapping, q_point[qp]), dim, d_interp_order);
+                d_recovery_op_cols.push_back(global_offset + qp);
+                d_recovery_op_vals.push_back(g.dot(P));
+            }
+        }
+        d_recovery_op_row_offsets[k + 1] = static_cast<unsigned int>(d_recovery_op_cols.size());
     }
     return;
 } // initializeFEData
@@ -504,46 +533,19 @@ IBFEPatchRecoveryPostProcessor::reconstructCauchyStress(System& sigma_system)
     const Parallel::Communicator& comm = d_mesh->comm();
     comm.sum(sigma_vals);
 
-    // Perform element patch L2 projections.
-    const unsigned int dim = d_mesh->mesh_dimension();
-    const unsigned int num_basis_fcns = num_polynomial_basis_fcns(dim, d_interp_order);
-    Eigen::VectorXd P(num_basis_fcns), a(num_basis_fcns), f(num_basis_fcns);
-    UniquePtr<FEBase> fe(FEBase::build(dim, FEType(d_interp_order, LAGRANGE)));
-    const std::vector<libMesh::Point>& q_point = fe->get_xyz();
-    UniquePtr<QBase> qrule = QBase::build(QGAUSS, dim, d_quad_order);
-    fe->attach_quadrature_rule(qrule.get());
+    // Apply the element patch recovery operator to all stress components.
+    std::vector<double> recovered_vals;
+    applyRecoveryOperator(recovered_vals, sigma_vals, NVARS);
     unsigned int k = 0;
     for (std::map<dof_id_type, ElemPatch>::const_iterator it = d_local_elem_patches.begin();
          it != d_local_elem_patches.end();
          ++it, ++k)
     {
-        const dof_id_type node_id = it->first;
-        const Node& node = d_mesh->node(node_id);
-        const ElemPatch& elem_patch = it->second;
-        Eigen::ColPivHouseholderQR<Eigen::MatrixXd>& patch_proj_solver = d_local_patch_proj_solver[k];
+        const Node& node = d_mesh->node(it->first);
         for (unsigned int var = 0; var < NVARS; ++var)
         {
-            // Solve for the coefficients of the reconstruction.
-            f.setZero();
-            for (ElemPatch::const_iterator el_it = elem_patch.begin(); el_it != elem_patch.end(); ++el_it)
-            {
-                const Elem* const elem = el_it->get<0>();
-                const CompositePeriodicMapping& inverse_mapping = el_it->get<2>();
-                const dof_id_type elem_id = elem->id();
-                const int global_offset = d_elem_qp_global_offset[elem_id];
-                fe->reinit(elem);
-                for (unsigned int qp = 0; qp < qrule->n_points(); ++qp)
-                {
-                    evaluate_polynomial_basis_fcns(
-                        P, node, apply_composite_periodic_mapping(inverse_mapping, q_point[qp]), dim, d_interp_order);
-                    f += P * sigma_vals[NVARS * (global_offset + qp) + var];
-                }
-            }
-            a = patch_proj_solver.solve(f);
-
-            // Evaluate the reconstruction at the node.
             const int dof_index = node.dof_number(sigma_sys_num, var, 0);
-            sigma_vec.set(dof_index, a(0));
+            sigma_vec.set(dof_index, recovered_vals[NVARS * k + var]);
         }
     }
     return;
@@ -572,46 +574,18 @@ IBFEPatchRecoveryPostProcessor::reconstructPressure(System& p_system)
     const Parallel::Communicator& comm = d_mesh->comm();
     comm.sum(pressure_vals);
 
-    // Perform element patch L2 projections.
-    const unsigned int dim = d_mesh->mesh_dimension();
-    const unsigned int num_basis_fcns = num_polynomial_basis_fcns(dim, d_interp_order);
-    Eigen::VectorXd P(num_basis_fcns), a(num_basis_fcns), f(num_basis_fcns);
-    UniquePtr<FEBase> fe(FEBase::build(dim, FEType(d_interp_order, LAGRANGE)));
-    const std::vector<libMesh::Point>& q_point = fe->get_xyz();
-    UniquePtr<QBase> qrule = QBase::build(QGAUSS, dim, d_quad_order);
-    fe->attach_quadrature_rule(qrule.get());
+    // Apply the element patch recovery operator.
+    std::vector<double> recovered_vals;
+    applyRecoveryOperator(recovered_vals, pressure_vals, 1);
     unsigned int k = 0;
     for (std::map<dof_id_type, ElemPatch>::const_iterator it = d_local_elem_patches.begin();
          it != d_local_elem_patches.end();
          ++it, ++k)
     {
-        const dof_id_type node_id = it->first;
-        const Node& node = d_mesh->node(node_id);
-        const ElemPatch& elem_patch = it->second;
-        Eigen::ColPivHouseholderQR<Eigen::MatrixXd>& patch_proj_solver = d_local_patch_proj_solver[k];
-
-        // Solve for the coefficients of the reconstruction.
-        f.setZero();
-        for (ElemPatch::const_iterator el_it = elem_patch.begin(); el_it != elem_patch.end(); ++el_it)
-        {
-            const Elem* const elem = el_it->get<0>();
-            const CompositePeriodicMapping& inverse_mapping = el_it->get<2>();
-            const dof_id_type elem_id = elem->id();
-            const int global_offset = d_elem_qp_global_offset[elem_id];
-            fe->reinit(elem);
-            for (unsigned int qp = 0; qp < qrule->n_points(); ++qp)
-            {
-                evaluate_polynomial_basis_fcns(
-                    P, node, apply_composite_periodic_mapping(inverse_mapping, q_point[qp]), dim, d_interp_order);
-                f += P * pressure_vals[global_offset + qp];
-            }
-        }
-        a = patch_proj_solver.solve(f);
-
-        // Evaluate the reconstruction at the node.
+        const Node& node = d_mesh->node(it->first);
         const unsigned int var = 0;
         const int dof_index = node.dof_number(p_sys_num, var, 0);
-        p_vec.set(dof_index, a(0));
+        p_vec.set(dof_index, recovered_vals[k]);
     }
     return;
 } // reconstructPressure
@@ -620,6 +594,29 @@ IBFEPatchRecoveryPostProcessor::reconstructPressure(System& p_system)
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+IBFEPatchRecoveryPostProcessor::applyRecoveryOperator(std::vector<double>& nodal_vals,
+                                                      const std::vector<double>& qp_vals,
+                                                      const unsigned int n_vars) const
+{
+    const unsigned int n_rows = static_cast<unsigned int>(d_recovery_op_row_offsets.size()) - 1;
+    nodal_vals.assign(n_vars * n_rows, 0.0);
+    for (unsigned int row = 0; row < n_rows; ++row)
+    {
+        double* const nodal_vals_row = &nodal_vals[n_vars * row];
+        for (unsigned int l = d_recovery_op_row_offsets[row]; l < d_recovery_op_row_offsets[row + 1]; ++l)
+        {
+            const double w = d_recovery_op_vals[l];
+            const double* const qp_vals_col = &qp_vals[n_vars * d_recovery_op_cols[l]];
+            for (unsigned int var = 0; var < n_vars; ++var)
+            {
+                nodal_vals_row[var] += w * qp_vals_col[var];
+            }
+        }
+    }
+    return;
+} // applyRecoveryOperator
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
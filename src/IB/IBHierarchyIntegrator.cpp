@@ -535,6 +535,10 @@ IBHierarchyIntegrator::IBHierarchyIntegrator(const std::string& object_name,
     d_workload_var.setNull();
     d_workload_idx = -1;
 
+    // Physical boundary operators are created when the hierarchy is initialized.
+    d_u_phys_bdry_op = NULL;
+    d_p_phys_bdry_op = NULL;
+
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
     if (from_restart) getFromRestart();
@@ -627,6 +631,10 @@ IBHierarchyIntegrator::resetHierarchyConfigurationSpecialized(const Pointer<Base
     d_hier_velocity_data_ops->resetLevels(0, finest_hier_level);
     d_hier_pressure_data_ops->resetLevels(0, finest_hier_level);
     d_hier_cc_data_ops->resetLevels(0, finest_hier_level);
+
+    // Discard boundary condition coefficients cached on the old hierarchy.
+    if (d_u_phys_bdry_op) d_u_phys_bdry_op->clearBcCoefCache();
+    if (d_p_phys_bdry_op) d_p_phys_bdry_op->clearBcCoefCache();
     return;
 } // resetHierarchyConfigurationSpecialized
 
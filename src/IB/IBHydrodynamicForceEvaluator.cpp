@@ -68,6 +68,8 @@ IBHydrodynamicForceEvaluator::IBHydrodynamicForceEvaluator(const std::string& ob
     d_rho = rho;
     d_mu = mu;
     d_current_time = current_time;
+    d_incremental_mode = false;
+    d_wgt_finest_ln = -1;
 
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     d_u_var = new SideVariable<NDIM, double>(d_object_name + "::u_var", 1);
@@ -276,6 +278,15 @@ IBHydrodynamicForceEvaluator::updateStructureDomain(const IBTK::Vector3d& box_ve
 
 } // updateStructureDomain
 
+void
+IBHydrodynamicForceEvaluator::setIncrementalMode(const bool incremental_mode)
+{
+    d_incremental_mode = incremental_mode;
+    d_integration_boxes.clear();
+    d_integration_r0.clear();
+    return;
+} // setIncrementalMode
+
 void
 IBHydrodynamicForceEvaluator::setTorqueOrigin(const IBTK::Vector3d& X0, int strct_id)
 {
@@ -314,143 +325,58 @@ IBHydrodynamicForceEvaluator::computeLaggedMomentumIntegral(
     Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
     const std::vector<RobinBcCoefStrategy<NDIM>*>& u_src_bc_coef)
 {
-    resetFaceAreaWeight(patch_hierarchy);
-    resetFaceVolWeight(patch_hierarchy);
-    fillPatchData(u_old_idx, -1, patch_hierarchy, u_src_bc_coef, NULL, d_current_time);
-
-    const int coarsest_ln = 0;
-    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
-
-    // Whether or not the simulation has adaptive mesh refinement
-    const bool amr_case = (coarsest_ln != finest_ln);
-
+    const bool hierarchy_changed = resetWeights(patch_hierarchy);
+
+    // In incremental mode, the lagged momentum integrals need to be recomputed
+    // only for control volumes that have moved to different grid cells (or
+    // whose torque origins have changed) since the integrals were last
+    // evaluated in computeHydrodynamicForce().  Otherwise, the integrals over
+    // the current velocity field are identical to the values carried over by
+    // postprocessIntegrateData().
+    std::vector<IBHydrodynamicForceObject*> fobjs;
     for (std::map<int, IBHydrodynamicForceObject>::iterator it = d_hydro_objs.begin(); it != d_hydro_objs.end(); ++it)
     {
         IBHydrodynamicForceObject& fobj = it->second;
-
-        // Compute the momentum integral:= (rho * u * dv) for the previous time step (integral is over new control
-        // volume)
-        fobj.P_box_current.setZero();
-
-        // Compute the rotational momentum integral:= (rho * r x u * dv) for the previous time step (integral is over
-        // new control volume)
-        fobj.L_box_current.setZero();
-
-        // Coordinate of the side index and r vector needed for cross product
-        IBTK::Vector3d side_coord, r_vec;
-
-        for (int ln = finest_ln; ln >= coarsest_ln; --ln)
+        if (d_incremental_mode && !hierarchy_changed && d_integration_boxes.count(it->first))
         {
-            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
-            Box<NDIM> integration_box(
-                IndexUtilities::getCellIndex(fobj.box_X_lower_new.data(), level->getGridGeometry(), level->getRatio()),
-                IndexUtilities::getCellIndex(fobj.box_X_upper_new.data(), level->getGridGeometry(), level->getRatio()));
-
-            // Shorten the integration box so it only includes the control volume
-            integration_box.upper() -= 1;
-
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            std::vector<Box<NDIM> > integration_boxes;
+            getIntegrationBoxes(integration_boxes, fobj, patch_hierarchy);
+            if (integration_boxes == d_integration_boxes[it->first] && fobj.r0 == d_integration_r0[it->first])
             {
-                Pointer<Patch<NDIM> > patch = level->getPatch(p());
-                const Box<NDIM>& patch_box = patch->getBox();
-                const bool boxes_intersect = patch_box.intersects(integration_box);
-                if (!boxes_intersect) continue;
-
-                // Part of the box on this patch.
-                Box<NDIM> trim_box = patch_box * integration_box;
-
-                // Loop over the box and compute momentum.
-                Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(d_u_idx);
-                Pointer<SideData<NDIM, double> > vol_sc_data = patch->getPatchData(d_vol_wgt_sc_idx);
-
-                for (int axis = 0; axis < NDIM; ++axis)
-                {
-                    for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(trim_box, axis)); b; b++)
-                    {
-                        const CellIndex<NDIM>& cell_idx = *b;
-                        const SideIndex<NDIM> side_idx(cell_idx, axis, SideIndex<NDIM>::Lower);
-                        const double& u_axis = (*u_data)(side_idx);
-                        const double& vol = (*vol_sc_data)(side_idx);
-                        double dV;
-
-                        // Check if cell is a CV boundary
-                        const bool lower_bdry_vel = (cell_idx(axis) == (integration_box.lower())(axis));
-                        const bool upper_bdry_vel = (cell_idx(axis) == (integration_box.upper())(axis) + 1);
-
-                        // Check if CV boundary intersects a patch boundary
-                        const bool lower_patch_bdry_eq_box_bdry =
-                            ((patch_box.lower())(axis) == (integration_box.lower())(axis));
-                        const bool upper_patch_bdry_eq_box_bdry =
-                            ((patch_box.upper())(axis) + 1 == (integration_box.upper())(axis) + 1);
-
-                        if (!amr_case)
-                        {
-                            /* Uniform mesh scaling correction
-                             * If the velocity is on the CV boundary, scale the volume element by 1/2
-                             * If the patch boundary equals the CV boundary, then volume element is correct (dx * dy)/2
-                             */
-
-                            const bool scale_dV = (lower_bdry_vel && !lower_patch_bdry_eq_box_bdry) ||
-                                                  (upper_bdry_vel && !upper_patch_bdry_eq_box_bdry);
-
-                            dV = scale_dV ? 0.5 * vol : vol;
-                        }
-                        else
-                        {
-                            /* Adaptive mesh scaling correction
-                             * If on a CV boundary, set dV to (dx * dy)/2, using the patch grid spacing
-                             * If vol == 0, don't change anything
-                             */
-
-                            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-                            const double* const patch_dx = patch_geom->getDx();
-                            const double box_edge_dV = 0.5 * patch_dx[0] * patch_dx[1]
-#if (NDIM == 3)
-                                                       * patch_dx[2]
-#endif
-                                ;
-
-                            const bool modify_dV = (lower_bdry_vel || upper_bdry_vel) && vol > 0;
-                            dV = modify_dV ? box_edge_dV : vol;
-                        }
-
-                        fobj.P_box_current(axis) += d_rho * u_axis * dV;
-
-                        // Compute angular momentum by looping over all the sides in one axis direction
-
-                        if (axis == 0)
-                        {
-                            // Get the coordinate of the side index and r vector
-                            side_coord.setZero();
-                            getPhysicalCoordinateFromSideIndex(side_coord, level, patch, side_idx, axis);
-                            r_vec = side_coord - fobj.r0;
-                            IBTK::Vector3d u_vec = IBTK::Vector3d::Zero();
-                            u_vec(axis) = u_axis;
-
-                            for (int d = 0; d < NDIM; ++d)
-                            {
-                                if (d == axis) continue;
-
-                                CellIndex<NDIM> cell_left_idx = cell_idx;
-                                cell_left_idx(axis) -= 1;
-                                u_vec(d) =
-                                    0.25 * ((*u_data)(SideIndex<NDIM>(cell_left_idx, d, SideIndex<NDIM>::Lower)) +
-                                            (*u_data)(SideIndex<NDIM>(cell_left_idx, d, SideIndex<NDIM>::Upper)) +
-                                            (*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Lower)) +
-                                            (*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Upper)));
-                            }
-
-                            fobj.L_box_current += d_rho * r_vec.cross(u_vec) * dV;
-                        }
-                    }
-                }
+                continue;
             }
         }
-
-        SAMRAI_MPI::sumReduction(fobj.P_box_current.data(), 3);
-        SAMRAI_MPI::sumReduction(fobj.L_box_current.data(), 3);
+        fobjs.push_back(&fobj);
     }
+    if (fobjs.empty()) return;
 
+    fillPatchData(u_old_idx, -1, patch_hierarchy, u_src_bc_coef, NULL, d_current_time);
+
+    // Compute the momentum integral:= (rho * u * dv) and the rotational
+    // momentum integral:= (rho * r x u * dv) for the previous time step
+    // (integrals are over new control volume).  All structures are reduced
+    // together.
+    std::vector<double> box_momenta(6 * fobjs.size(), 0.0);
+    for (unsigned int k = 0; k < fobjs.size(); ++k)
+    {
+        IBHydrodynamicForceObject& fobj = *fobjs[k];
+        computeLocalMomentumIntegrals(fobj.P_box_current, fobj.L_box_current, fobj, patch_hierarchy);
+        for (int d = 0; d < 3; ++d)
+        {
+            box_momenta[6 * k + d] = fobj.P_box_current(d);
+            box_momenta[6 * k + 3 + d] = fobj.L_box_current(d);
+        }
+    }
+    SAMRAI_MPI::sumReduction(&box_momenta[0], static_cast<int>(box_momenta.size()));
+    for (unsigned int k = 0; k < fobjs.size(); ++k)
+    {
+        IBHydrodynamicForceObject& fobj = *fobjs[k];
+        for (int d = 0; d < 3; ++d)
+        {
+            fobj.P_box_current(d) = box_momenta[6 * k + d];
+            fobj.L_box_current(d) = box_momenta[6 * k + 3 + d];
+        }
+    }
     return;
 
 } // computeLaggedMomentumIntegral
@@ -483,140 +409,30 @@ IBHydrodynamicForceEvaluator::computeHydrodynamicForce(int u_idx,
                                                        const std::vector<RobinBcCoefStrategy<NDIM>*>& u_src_bc_coef,
                                                        RobinBcCoefStrategy<NDIM>* p_src_bc_coef)
 {
-    resetFaceAreaWeight(patch_hierarchy);
-    resetFaceVolWeight(patch_hierarchy);
+    resetWeights(patch_hierarchy);
     fillPatchData(u_idx, p_idx, patch_hierarchy, u_src_bc_coef, p_src_bc_coef, d_current_time + dt);
 
     const int coarsest_ln = 0;
     const int finest_ln = patch_hierarchy->getFinestLevelNumber();
 
-    // Whether or not the simulation has adaptive mesh refinement
-    const bool amr_case = (coarsest_ln != finest_ln);
-
-    for (std::map<int, IBHydrodynamicForceObject>::iterator it = d_hydro_objs.begin(); it != d_hydro_objs.end(); ++it)
+    // Local contributions to the momentum and surface integrals of all
+    // structures, which are reduced together.
+    static const int NSUMS = 12;
+    std::vector<double> local_sums(NSUMS * d_hydro_objs.size(), 0.0);
+    unsigned int k = 0;
+    for (std::map<int, IBHydrodynamicForceObject>::iterator it = d_hydro_objs.begin(); it != d_hydro_objs.end();
+         ++it, ++k)
     {
         IBHydrodynamicForceObject& fobj = it->second;
 
-        // Compute the momentum integral:= (rho * u * dv)
-        fobj.P_box_new.setZero();
-
-        // Compute the rotational momentum integral:= (rho * r x u * dv) for the new time step (integral is over new
-        // control volume)
-        fobj.L_box_new.setZero();
+        // Compute the momentum integral:= (rho * u * dv) and the rotational
+        // momentum integral:= (rho * r x u * dv) for the new time step
+        // (integrals are over new control volume).
+        computeLocalMomentumIntegrals(fobj.P_box_new, fobj.L_box_new, fobj, patch_hierarchy);
 
         // Coordinate of the side index and r vector needed for cross product
         IBTK::Vector3d side_coord, r_vec;
 
-        for (int ln = finest_ln; ln >= coarsest_ln; --ln)
-        {
-            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
-            Box<NDIM> integration_box(
-                IndexUtilities::getCellIndex(fobj.box_X_lower_new.data(), level->getGridGeometry(), level->getRatio()),
-                IndexUtilities::getCellIndex(fobj.box_X_upper_new.data(), level->getGridGeometry(), level->getRatio()));
-
-            // Shorten the integration box so it only includes the control volume
-            integration_box.upper() -= 1;
-
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-            {
-                Pointer<Patch<NDIM> > patch = level->getPatch(p());
-                const Box<NDIM>& patch_box = patch->getBox();
-                const bool boxes_intersect = patch_box.intersects(integration_box);
-                if (!boxes_intersect) continue;
-
-                // Part of the box on this patch.
-                Box<NDIM> trim_box = patch_box * integration_box;
-
-                // Loop over the box and compute momentum.
-                Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(d_u_idx);
-                Pointer<SideData<NDIM, double> > vol_sc_data = patch->getPatchData(d_vol_wgt_sc_idx);
-
-                for (int axis = 0; axis < NDIM; ++axis)
-                {
-                    for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(trim_box, axis)); b; b++)
-                    {
-                        const CellIndex<NDIM>& cell_idx = *b;
-                        const SideIndex<NDIM> side_idx(cell_idx, axis, SideIndex<NDIM>::Lower);
-                        const double& u_axis = (*u_data)(side_idx);
-                        const double& vol = (*vol_sc_data)(side_idx);
-                        double dV;
-
-                        // Check if cell is a CV boundary
-                        const bool lower_bdry_vel = (cell_idx(axis) == (integration_box.lower())(axis));
-                        const bool upper_bdry_vel = (cell_idx(axis) == (integration_box.upper())(axis) + 1);
-
-                        // Check if CV boundary intersects a patch boundary
-                        const bool lower_patch_bdry_eq_box_bdry =
-                            ((patch_box.lower())(axis) == (integration_box.lower())(axis));
-                        const bool upper_patch_bdry_eq_box_bdry =
-                            ((patch_box.upper())(axis) + 1 == (integration_box.upper())(axis) + 1);
-
-                        if (!amr_case)
-                        {
-                            /* Uniform mesh scaling correction
-                             * If the velocity is on the CV boundary, scale the volume element by 1/2
-                             * If the patch boundary equals the CV boundary, then volume element is correct (dx * dy)/2
-                             */
-                            const bool scale_dV = (lower_bdry_vel && !lower_patch_bdry_eq_box_bdry) ||
-                                                  (upper_bdry_vel && !upper_patch_bdry_eq_box_bdry);
-
-                            dV = scale_dV ? 0.5 * vol : vol;
-                        }
-                        else
-                        {
-                            /* Adaptive mesh scaling correction
-                             * If on a CV boundary, set dV to (dx * dy)/2, using the patch grid spacing
-                             * If vol == 0, don't change anything
-                             */
-
-                            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-                            const double* const patch_dx = patch_geom->getDx();
-                            const double box_edge_dV = 0.5 * patch_dx[0] * patch_dx[1]
-#if (NDIM == 3)
-                                                       * patch_dx[2]
-#endif
-                                ;
-
-                            const bool modify_dV = (lower_bdry_vel || upper_bdry_vel) && vol > 0;
-                            dV = modify_dV ? box_edge_dV : vol;
-                        }
-
-                        fobj.P_box_new(axis) += d_rho * u_axis * dV;
-
-                        // Compute angular momentum by looping over all the sides in one axis direction
-
-                        if (axis == 0)
-                        {
-                            // Get the coordinate of the side index and r vector
-                            side_coord.setZero();
-                            getPhysicalCoordinateFromSideIndex(side_coord, level, patch, side_idx, axis);
-                            r_vec = side_coord - fobj.r0;
-                            IBTK::Vector3d u_vec = IBTK::Vector3d::Zero();
-                            u_vec(axis) = u_axis;
-
-                            for (int d = 0; d < NDIM; ++d)
-                            {
-                                if (d == axis) continue;
-
-                                CellIndex<NDIM> cell_left_idx = cell_idx;
-                                cell_left_idx(axis) -= 1;
-                                u_vec(d) =
-                                    0.25 * ((*u_data)(SideIndex<NDIM>(cell_left_idx, d, SideIndex<NDIM>::Lower)) +
-                                            (*u_data)(SideIndex<NDIM>(cell_left_idx, d, SideIndex<NDIM>::Upper)) +
-                                            (*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Lower)) +
-                                            (*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Upper)));
-                            }
-
-                            fobj.L_box_new += d_rho * r_vec.cross(u_vec) * dV;
-                        }
-                    }
-                }
-            }
-        }
-
-        SAMRAI_MPI::sumReduction(fobj.P_box_new.data(), 3);
-        SAMRAI_MPI::sumReduction(fobj.L_box_new.data(), 3);
-
         // Compute surface integral term.
         IBTK::Vector3d trac, torque_trac;
         trac.setZero();
@@ -772,8 +588,36 @@ IBHydrodynamicForceEvaluator::computeHydrodynamicForce(int u_idx,
                 }
             }
         }
-        SAMRAI_MPI::sumReduction(trac.data(), 3);
-        SAMRAI_MPI::sumReduction(torque_trac.data(), 3);
+        for (int d = 0; d < 3; ++d)
+        {
+            local_sums[NSUMS * k + d] = fobj.P_box_new(d);
+            local_sums[NSUMS * k + 3 + d] = fobj.L_box_new(d);
+            local_sums[NSUMS * k + 6 + d] = trac(d);
+            local_sums[NSUMS * k + 9 + d] = torque_trac(d);
+        }
+    }
+    if (!local_sums.empty()) SAMRAI_MPI::sumReduction(&local_sums[0], static_cast<int>(local_sums.size()));
+
+    k = 0;
+    for (std::map<int, IBHydrodynamicForceObject>::iterator it = d_hydro_objs.begin(); it != d_hydro_objs.end();
+         ++it, ++k)
+    {
+        IBHydrodynamicForceObject& fobj = it->second;
+        IBTK::Vector3d trac, torque_trac;
+        for (int d = 0; d < 3; ++d)
+        {
+            fobj.P_box_new(d) = local_sums[NSUMS * k + d];
+            fobj.L_box_new(d) = local_sums[NSUMS * k + 3 + d];
+            trac(d) = local_sums[NSUMS * k + 6 + d];
+            torque_trac(d) = local_sums[NSUMS * k + 9 + d];
+        }
+
+        // Record the control volume used to evaluate the momentum integrals.
+        if (d_incremental_mode)
+        {
+            getIntegrationBoxes(d_integration_boxes[it->first], fobj, patch_hierarchy);
+            d_integration_r0[it->first] = fobj.r0;
+        }
 
         // Compute hydrodynamic force on the body : -integral_{box_new} (rho du/dt) + d/dt(rho u)_body + trac
         fobj.F_new = -(fobj.P_box_new - fobj.P_box_current) / dt + (fobj.P_new - fobj.P_current) / dt + trac;
@@ -991,6 +835,174 @@ IBAMR::IBHydrodynamicForceEvaluator::updateStructurePlotData(Pointer<PatchHierar
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+bool
+IBHydrodynamicForceEvaluator::resetWeights(Pointer<PatchHierarchy<NDIM> > patch_hierarchy)
+{
+    // The weights depend only on the configuration of the patch hierarchy and
+    // not on the location of the control volumes.  In incremental mode, they
+    // are recomputed only when the hierarchy has changed, which is detected by
+    // the presence of newly created (and thus unallocated) patch levels.
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+    bool reset_weights = !d_incremental_mode || finest_ln != d_wgt_finest_ln;
+    for (int ln = 0; ln <= finest_ln && !reset_weights; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        reset_weights = !level->checkAllocated(d_face_wgt_sc_idx) || !level->checkAllocated(d_vol_wgt_sc_idx);
+    }
+    if (!reset_weights) return false;
+    resetFaceAreaWeight(patch_hierarchy);
+    resetFaceVolWeight(patch_hierarchy);
+    d_wgt_finest_ln = finest_ln;
+    return true;
+} // resetWeights
+
+void
+IBHydrodynamicForceEvaluator::getIntegrationBoxes(std::vector<Box<NDIM> >& integration_boxes,
+                                                  const IBHydrodynamicForceObject& fobj,
+                                                  Pointer<PatchHierarchy<NDIM> > patch_hierarchy)
+{
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+    integration_boxes.resize(finest_ln + 1);
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        integration_boxes[ln] = Box<NDIM>(
+            IndexUtilities::getCellIndex(fobj.box_X_lower_new.data(), level->getGridGeometry(), level->getRatio()),
+            IndexUtilities::getCellIndex(fobj.box_X_upper_new.data(), level->getGridGeometry(), level->getRatio()));
+        integration_boxes[ln].upper() -= 1;
+    }
+    return;
+} // getIntegrationBoxes
+
+void
+IBHydrodynamicForceEvaluator::computeLocalMomentumIntegrals(IBTK::Vector3d& P_box,
+                                                            IBTK::Vector3d& L_box,
+                                                            const IBHydrodynamicForceObject& fobj,
+                                                            Pointer<PatchHierarchy<NDIM> > patch_hierarchy)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+    // Whether or not the simulation has adaptive mesh refinement
+    const bool amr_case = (coarsest_ln != finest_ln);
+
+    P_box.setZero();
+    L_box.setZero();
+
+    // Coordinate of the side index and r vector needed for cross product
+    IBTK::Vector3d side_coord, r_vec;
+
+    for (int ln = finest_ln; ln >= coarsest_ln; --ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        Box<NDIM> integration_box(
+            IndexUtilities::getCellIndex(fobj.box_X_lower_new.data(), level->getGridGeometry(), level->getRatio()),
+            IndexUtilities::getCellIndex(fobj.box_X_upper_new.data(), level->getGridGeometry(), level->getRatio()));
+
+        // Shorten the integration box so it only includes the control volume
+        integration_box.upper() -= 1;
+
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const bool boxes_intersect = patch_box.intersects(integration_box);
+            if (!boxes_intersect) continue;
+
+            // Part of the box on this patch.
+            Box<NDIM> trim_box = patch_box * integration_box;
+
+            // Loop over the box and compute momentum.
+            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(d_u_idx);
+            Pointer<SideData<NDIM, double> > vol_sc_data = patch->getPatchData(d_vol_wgt_sc_idx);
+
+            for (int axis = 0; axis < NDIM; ++axis)
+            {
+                for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(trim_box, axis)); b; b++)
+                {
+                    const CellIndex<NDIM>& cell_idx = *b;
+                    const SideIndex<NDIM> side_idx(cell_idx, axis, SideIndex<NDIM>::Lower);
+                    const double& u_axis = (*u_data)(side_idx);
+                    const double& vol = (*vol_sc_data)(side_idx);
+                    double dV;
+
+                    // Check if cell is a CV boundary
+                    const bool lower_bdry_vel = (cell_idx(axis) == (integration_box.lower())(axis));
+                    const bool upper_bdry_vel = (cell_idx(axis) == (integration_box.upper())(axis) + 1);
+
+                    // Check if CV boundary intersects a patch boundary
+                    const bool lower_patch_bdry_eq_box_bdry =
+                        ((patch_box.lower())(axis) == (integration_box.lower())(axis));
+                    const bool upper_patch_bdry_eq_box_bdry =
+                        ((patch_box.upper())(axis) + 1 == (integration_box.upper())(axis) + 1);
+
+                    if (!amr_case)
+                    {
+                        /* Uniform mesh scaling correction
+                         * If the velocity is on the CV boundary, scale the volume element by 1/2
+                         * If the patch boundary equals the CV boundary, then volume element is correct (dx * dy)/2
+                         */
+
+                        const bool scale_dV = (lower_bdry_vel && !lower_patch_bdry_eq_box_bdry) ||
+                                              (upper_bdry_vel && !upper_patch_bdry_eq_box_bdry);
+
+                        dV = scale_dV ? 0.5 * vol : vol;
+                    }
+                    else
+                    {
+                        /* Adaptive mesh scaling correction
+                         * If on a CV boundary, set dV to (dx * dy)/2, using the patch grid spacing
+                         * If vol == 0, don't change anything
+                         */
+
+                        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+                        const double* const patch_dx = patch_geom->getDx();
+                        const double box_edge_dV = 0.5 * patch_dx[0] * patch_dx[1]
+#if (NDIM == 3)
+                                                   * patch_dx[2]
+#endif
+                            ;
+
+                        const bool modify_dV = (lower_bdry_vel || upper_bdry_vel) && vol > 0;
+                        dV = modify_dV ? box_edge_dV : vol;
+                    }
+
+                    P_box(axis) += d_rho * u_axis * dV;
+
+                    // Compute angular momentum by looping over all the sides in one axis direction
+
+                    if (axis == 0)
+                    {
+                        // Get the coordinate of the side index and r vector
+                        side_coord.setZero();
+                        getPhysicalCoordinateFromSideIndex(side_coord, level, patch, side_idx, axis);
+                        r_vec = side_coord - fobj.r0;
+                        IBTK::Vector3d u_vec = IBTK::Vector3d::Zero();
+                        u_vec(axis) = u_axis;
+
+                        for (int d = 0; d < NDIM; ++d)
+                        {
+                            if (d == axis) continue;
+
+                            CellIndex<NDIM> cell_left_idx = cell_idx;
+                            cell_left_idx(axis) -= 1;
+                            u_vec(d) =
+                                0.25 * ((*u_data)(SideIndex<NDIM>(cell_left_idx, d, SideIndex<NDIM>::Lower)) +
+                                        (*u_data)(SideIndex<NDIM>(cell_left_idx, d, SideIndex<NDIM>::Upper)) +
+                                        (*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Lower)) +
+                                        (*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Upper)));
+                        }
+
+                        L_box += d_rho * r_vec.cross(u_vec) * dV;
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // computeLocalMomentumIntegrals
+
+
 void
 IBHydrodynamicForceEvaluator::resetFaceAreaWeight(Pointer<PatchHierarchy<NDIM> > patch_hierarchy)
 {
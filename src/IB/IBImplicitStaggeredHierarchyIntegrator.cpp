@@ -142,7 +142,9 @@ IBImplicitStaggeredHierarchyIntegrator::IBImplicitStaggeredHierarchyIntegrator(
     Pointer<INSStaggeredHierarchyIntegrator> ins_hier_integrator,
     bool register_for_restart)
     : IBHierarchyIntegrator(object_name, input_db, ib_implicit_ops, ins_hier_integrator, register_for_restart),
-      d_ib_implicit_ops(ib_implicit_ops)
+      d_ib_implicit_ops(ib_implicit_ops),
+      d_elastic_op(NULL),
+      d_interp_op(NULL)
 {
     // Setup IB ops object to use "fixed" Lagrangian-Eulerian coupling
     // operators.
@@ -185,7 +187,17 @@ IBImplicitStaggeredHierarchyIntegrator::IBImplicitStaggeredHierarchyIntegrator(
 
 IBImplicitStaggeredHierarchyIntegrator::~IBImplicitStaggeredHierarchyIntegrator()
 {
-    // intentionally blank
+    int ierr;
+    if (d_elastic_op)
+    {
+        ierr = MatDestroy(&d_elastic_op);
+        IBTK_CHKERRQ(ierr);
+    }
+    if (d_interp_op)
+    {
+        ierr = MatDestroy(&d_interp_op);
+        IBTK_CHKERRQ(ierr);
+    }
     return;
 } // ~IBImplicitStaggeredHierarchyIntegrator
 
@@ -700,7 +712,6 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_velocity(const double
     stokes_fac_pc->setPhysicalBcCoefs(d_ins_hier_integrator->getIntermediateVelocityBoundaryConditions(),
                                       d_ins_hier_integrator->getProjectionBoundaryConditions());
     Pointer<StaggeredStokesIBLevelRelaxationFACOperator> stokes_fac_op = stokes_fac_pc->getFACPreconditionerStrategy();
-    Mat elastic_op = NULL;
     double data_time = std::numeric_limits<double>::quiet_NaN();
     switch (d_time_stepping_type)
     {
@@ -715,12 +726,11 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_velocity(const double
         TBOX_ERROR("unsupported time stepping type\n");
     }
     stokes_fac_op->setIBTimeSteppingType(d_time_stepping_type);
-    d_ib_implicit_ops->constructLagrangianForceJacobian(elastic_op, MATAIJ, data_time);
-    stokes_fac_op->setIBForceJacobian(elastic_op);
-    Mat interp_op = NULL;
+    d_ib_implicit_ops->constructLagrangianForceJacobian(d_elastic_op, MATAIJ, data_time);
+    stokes_fac_op->setIBForceJacobian(d_elastic_op);
     if (d_jac_delta_fcn == "IB_4")
     {
-        d_ib_implicit_ops->constructInterpOp(interp_op,
+        d_ib_implicit_ops->constructInterpOp(d_interp_op,
                                              ib_4_interp_fcn,
                                              ib_4_interp_stencil,
                                              d_num_dofs_per_proc[finest_ln],
@@ -729,7 +739,7 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_velocity(const double
     }
     else if (d_jac_delta_fcn == "PIECEWISE_LINEAR")
     {
-        d_ib_implicit_ops->constructInterpOp(interp_op,
+        d_ib_implicit_ops->constructInterpOp(d_interp_op,
                                              pwl_interp_fcn,
                                              pwl_interp_stencil,
                                              d_num_dofs_per_proc[finest_ln],
@@ -744,7 +754,7 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_velocity(const double
                    << " is not supported in creating Jacobian."
                    << std::endl);
     }
-    stokes_fac_op->setIBInterpOp(interp_op);
+    stokes_fac_op->setIBInterpOp(d_interp_op);
     stokes_fac_pc->initializeSolverState(*eul_sol_vec, *eul_rhs_vec);
 
     // Indicate that the current approximation to position of the structure
@@ -879,10 +889,6 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_velocity(const double
     d_stokes_op->deallocateOperatorState();
     stokes_fac_pc->deallocateSolverState();
     stokes_fac_op->deallocateOperatorState();
-    ierr = MatDestroy(&elastic_op);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatDestroy(&interp_op);
-    IBTK_CHKERRQ(ierr);
 
     // Execute any registered callbacks.
     executeIntegrateHierarchyCallbackFcns(current_time, new_time, cycle_num);
@@ -87,6 +87,7 @@
 #include "ibtk/LNode.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/PETScMatUtilities.h"
+#include "ibtk/WorkloadCalibrator.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscmat.h"
 #include "petscsys.h"
@@ -170,6 +171,8 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
                         LEInteractor::getMinimumGhostWidth(d_spread_kernel_fcn));
     d_force_jac_mffd = false;
     d_do_log = false;
+    d_calibrate_workload = false;
+    d_workload_calibration_num_samples = 10;
 
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
@@ -194,6 +197,7 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
                                                 d_ghosts,
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    if (d_calibrate_workload) d_l_data_manager->enableWorkloadCalibration(d_workload_calibration_num_samples);
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -493,6 +497,9 @@ IBMethod::postprocessIntegrateData(double current_time, double new_time, int /*n
     d_F_half_data.clear();
     d_F_jac_data.clear();
 
+    // Record the cost of the timestep for the workload calibration.
+    d_l_data_manager->recordWorkloadSample();
+
     // Reset the current time step interval.
     d_current_time = std::numeric_limits<double>::quiet_NaN();
     d_new_time = std::numeric_limits<double>::quiet_NaN();
@@ -852,6 +859,8 @@ IBMethod::computeLagrangianForce(const double data_time)
     getForceData(&F_data, &F_needs_ghost_fill, data_time);
     getPositionData(&X_data, &X_needs_ghost_fill, data_time);
     getVelocityData(&U_data, data_time);
+    Pointer<WorkloadCalibrator> workload_calibrator = d_l_data_manager->getWorkloadCalibrator();
+    if (workload_calibrator) workload_calibrator->startTimer(WorkloadCalibrator::FORCE_WORK);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
@@ -863,6 +872,7 @@ IBMethod::computeLagrangianForce(const double data_time)
                 (*F_data)[ln], (*X_data)[ln], (*U_data)[ln], d_hierarchy, ln, data_time, d_l_data_manager);
         }
     }
+    if (workload_calibrator) workload_calibrator->stopTimer(WorkloadCalibrator::FORCE_WORK);
     *F_needs_ghost_fill = true;
     return;
 } // computeLagrangianForce
@@ -900,11 +910,6 @@ IBMethod::constructLagrangianForceJacobian(Mat& A, MatType mat_type, const doubl
     else
     {
         int ierr;
-        if (A)
-        {
-            ierr = MatDestroy(&A);
-            IBTK_CHKERRQ(ierr);
-        }
 
         // Get the "frozen" position for Lagrangian structure.
         std::vector<Pointer<LData> >* X_LE_data;
@@ -913,11 +918,80 @@ IBMethod::constructLagrangianForceJacobian(Mat& A, MatType mat_type, const doubl
 
         TBOX_ASSERT(d_ib_force_fcn);
 
-        // Build the Jacobian matrix.
-        const int num_local_nodes = d_l_data_manager->getNumberOfLocalNodes(finest_ln);
+        // Try to reuse the existing matrix.  The nonzero structure of the
+        // Jacobian is computed before any values are set, and the existing
+        // matrix is refilled only if the numbers of diagonal and off-diagonal
+        // block nonzeros in each of its rows match the new structure.
+        // Otherwise, a new matrix is created and filled, so the Jacobian is
+        // never computed twice.  Should the column indices differ despite equal
+        // counts, the new entries are inserted and the refilled matrix is kept;
+        // its values are correct, and users of symbolic products (e.g.,
+        // StaggeredStokesIBLevelRelaxationFACOperator) check the structure of
+        // the matrix themselves.
         std::vector<int> d_nnz, o_nnz;
         d_ib_force_fcn->computeLagrangianForceJacobianNonzeroStructure(
             d_nnz, o_nnz, d_hierarchy, finest_ln, d_l_data_manager);
+        const int num_local_nodes = d_l_data_manager->getNumberOfLocalNodes(finest_ln);
+        if (A)
+        {
+            MatType A_type;
+            ierr = MatGetType(A, &A_type);
+            IBTK_CHKERRQ(ierr);
+            int m_local, n_local;
+            ierr = MatGetLocalSize(A, &m_local, &n_local);
+            IBTK_CHKERRQ(ierr);
+            const bool use_baij = !strcmp(mat_type, MATBAIJ) || !strcmp(mat_type, MATMPIBAIJ);
+            const bool A_is_baij = !strcmp(A_type, MATSEQBAIJ) || !strcmp(A_type, MATMPIBAIJ);
+            const bool A_is_aij = !strcmp(A_type, MATSEQAIJ) || !strcmp(A_type, MATMPIAIJ);
+            bool same_structure =
+                (use_baij ? A_is_baij : A_is_aij) && m_local == NDIM * num_local_nodes && n_local == m_local;
+            if (same_structure)
+            {
+                int i_lower, i_upper, j_lower, j_upper;
+                ierr = MatGetOwnershipRange(A, &i_lower, &i_upper);
+                IBTK_CHKERRQ(ierr);
+                ierr = MatGetOwnershipRangeColumn(A, &j_lower, &j_upper);
+                IBTK_CHKERRQ(ierr);
+                for (int i = i_lower; same_structure && i < i_upper; ++i)
+                {
+                    int ncols;
+                    const int* cols;
+                    ierr = MatGetRow(A, i, &ncols, &cols, NULL);
+                    IBTK_CHKERRQ(ierr);
+                    int d_ncols = 0;
+                    for (int j = 0; j < ncols; ++j)
+                    {
+                        if (cols[j] >= j_lower && cols[j] < j_upper) ++d_ncols;
+                    }
+                    const int k = (i - i_lower) / NDIM;
+                    same_structure = d_ncols == NDIM * d_nnz[k] && ncols - d_ncols == NDIM * o_nnz[k];
+                    ierr = MatRestoreRow(A, i, &ncols, &cols, NULL);
+                    IBTK_CHKERRQ(ierr);
+                }
+            }
+            if (SAMRAI_MPI::minReduction(same_structure ? 1 : 0) == 1)
+            {
+                ierr = MatZeroEntries(A);
+                IBTK_CHKERRQ(ierr);
+                ierr = MatSetOption(A, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
+                IBTK_CHKERRQ(ierr);
+                d_ib_force_fcn->computeLagrangianForceJacobian(A,
+                                                               MAT_FINAL_ASSEMBLY,
+                                                               1.0,
+                                                               (*X_LE_data)[finest_ln],
+                                                               0.0,
+                                                               Pointer<IBTK::LData>(NULL),
+                                                               d_hierarchy,
+                                                               finest_ln,
+                                                               data_time,
+                                                               d_l_data_manager);
+                return;
+            }
+            ierr = MatDestroy(&A);
+            IBTK_CHKERRQ(ierr);
+        }
+
+        // Build the Jacobian matrix.
         if (!strcmp(mat_type, MATBAIJ) || !strcmp(mat_type, MATMPIBAIJ))
         {
             ierr = MatCreateBAIJ(PETSC_COMM_WORLD,
@@ -1051,19 +1125,13 @@ IBMethod::constructInterpOp(Mat& J,
                             const int dof_index_idx,
                             const double data_time)
 {
-    int ierr;
-    if (J)
-    {
-        ierr = MatDestroy(&J);
-        IBTK_CHKERRQ(ierr);
-    }
-
     // Get the "frozen" position for Lagrangian structure
     std::vector<Pointer<LData> >* X_LE_data;
     bool* X_LE_needs_ghost_fill;
     getLECouplingPositionData(&X_LE_data, &X_LE_needs_ghost_fill, data_time);
 
-    // Build the Jacobian matrix.
+    // Build the interpolation matrix.  The existing matrix is reused if its
+    // nonzero structure is unchanged.
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
     Pointer<PatchLevel<NDIM> > finest_level = d_hierarchy->getPatchLevel(finest_ln);
     Vec X_vec = (*X_LE_data)[finest_ln]->getVec();
@@ -2070,6 +2138,9 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
+    if (db->keyExists("calibrate_workload")) d_calibrate_workload = db->getBool("calibrate_workload");
+    if (db->keyExists("workload_calibration_num_samples"))
+        d_workload_calibration_num_samples = db->getInteger("workload_calibration_num_samples");
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
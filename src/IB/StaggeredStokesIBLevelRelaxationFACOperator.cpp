@@ -94,6 +94,7 @@
 #include "petscksp.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
 #include "tbox/Timer.h"
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
@@ -129,7 +130,8 @@ StaggeredStokesIBLevelRelaxationFACOperator::StaggeredStokesIBLevelRelaxationFAC
       d_u_petsc_prolongation_method("RT0"),
       d_p_petsc_prolongation_method("CONSERVATIVE"),
       d_SAJ_fill(1.0),
-      d_RStokesIBP_fill(1.0)
+      d_RStokesIBP_fill(1.0),
+      d_reuse_SAJ_nonzero_structure(true)
 {
     // Set the time stepping type to UNKNOWN to ensure that the IB solver sets it correctly.
     d_time_stepping_type = UNKNOWN_TIME_STEPPING_TYPE;
@@ -153,6 +155,8 @@ StaggeredStokesIBLevelRelaxationFACOperator::StaggeredStokesIBLevelRelaxationFAC
             d_level_solver_max_iterations = input_db->getInteger("level_solver_max_iterations");
         if (input_db->keyExists("SAJ_fill")) d_SAJ_fill = input_db->getDouble("SAJ_fill");
         if (input_db->keyExists("RStokesIBP_fill")) d_RStokesIBP_fill = input_db->getDouble("RStokesIBP_fill");
+        if (input_db->keyExists("reuse_SAJ_nonzero_structure"))
+            d_reuse_SAJ_nonzero_structure = input_db->getBool("reuse_SAJ_nonzero_structure");
         if (input_db->isDatabase("level_solver_db"))
         {
             d_level_solver_db = input_db->getDatabase("level_solver_db");
@@ -194,6 +198,7 @@ StaggeredStokesIBLevelRelaxationFACOperator::~StaggeredStokesIBLevelRelaxationFA
     {
         deallocateOperatorState();
     }
+    destroySAJOps(0, static_cast<int>(d_SAJ_mat.size()) - 1);
     return;
 } // ~StaggeredStokesIBLevelRelaxationFACOperator
 
@@ -602,13 +607,15 @@ StaggeredStokesIBLevelRelaxationFACOperator::initializeOperatorStateSpecialized(
     }
 
     // Compute SAJ operator for various patch levels.
+    destroySAJOps(d_finest_ln + 1, static_cast<int>(d_SAJ_mat.size()) - 1);
     d_SAJ_mat.resize(d_finest_ln + 1, NULL);
+    d_SAJ_A_signature.resize(d_finest_ln + 1, 0);
+    d_SAJ_P_signature.resize(d_finest_ln + 1, 0);
     for (int ln = std::min(d_finest_ln, finest_reset_ln); ln >= std::max(d_coarsest_ln, coarsest_reset_ln - 1); --ln)
     {
         if (ln == d_finest_ln)
         {
-            ierr = MatPtAP(d_A_mat, d_J_mat, MAT_INITIAL_MATRIX, d_SAJ_fill, &d_SAJ_mat[ln]);
-            IBTK_CHKERRQ(ierr);
+            computeSAJOp(ln, d_A_mat, d_J_mat);
 
             // Compute the scale for the spreading operator.
             Pointer<PatchLevel<NDIM> > finest_level = d_hierarchy->getPatchLevel(d_finest_ln);
@@ -622,9 +629,7 @@ StaggeredStokesIBLevelRelaxationFACOperator::initializeOperatorStateSpecialized(
         }
         else
         {
-            ierr =
-                MatPtAP(d_SAJ_mat[ln + 1], d_SAJ_prolongation_mat[ln], MAT_INITIAL_MATRIX, d_SAJ_fill, &d_SAJ_mat[ln]);
-            IBTK_CHKERRQ(ierr);
+            computeSAJOp(ln, d_SAJ_mat[ln + 1], d_SAJ_prolongation_mat[ln]);
             ierr = MatDiagonalScale(d_SAJ_mat[ln], d_scale_SAJ_restriction_mat[ln], NULL);
             IBTK_CHKERRQ(ierr);
         }
@@ -837,13 +842,14 @@ StaggeredStokesIBLevelRelaxationFACOperator::deallocateOperatorStateSpecialized(
         d_scale_stokesib_restriction_mat[ln] = NULL;
     }
 
-    // Deallocate SAJ and Galerkin Stokes-IB Mat.
+    // Deallocate SAJ and Galerkin Stokes-IB Mat.  The SAJ Mat is retained when
+    // its nonzero structure may be reused.
+    if (!d_reuse_SAJ_nonzero_structure)
+    {
+        destroySAJOps(std::max(d_coarsest_ln, coarsest_reset_ln - 1), std::min(d_finest_ln, finest_reset_ln));
+    }
     for (int ln = std::min(d_finest_ln, finest_reset_ln); ln >= std::max(d_coarsest_ln, coarsest_reset_ln - 1); --ln)
     {
-        ierr = MatDestroy(&d_SAJ_mat[ln]);
-        IBTK_CHKERRQ(ierr);
-        d_SAJ_mat[ln] = NULL;
-
         ierr = MatDestroy(&d_galerkin_stokesib_mat[ln]);
         IBTK_CHKERRQ(ierr);
         d_galerkin_stokesib_mat[ln] = NULL;
@@ -861,6 +867,50 @@ StaggeredStokesIBLevelRelaxationFACOperator::deallocateOperatorStateSpecialized(
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+StaggeredStokesIBLevelRelaxationFACOperator::computeSAJOp(const int ln, Mat A, Mat P)
+{
+    int ierr;
+    MatReuse scall = MAT_INITIAL_MATRIX;
+    if (d_reuse_SAJ_nonzero_structure)
+    {
+        // The symbolic phase of the product can be reused only if the nonzero
+        // structures of both factors are unchanged on all processors.
+        const std::size_t A_signature = PETScMatUtilities::computeNonzeroStructureSignature(A);
+        const std::size_t P_signature = PETScMatUtilities::computeNonzeroStructureSignature(P);
+        const bool same_structure =
+            d_SAJ_mat[ln] && A_signature == d_SAJ_A_signature[ln] && P_signature == d_SAJ_P_signature[ln];
+        if (SAMRAI_MPI::minReduction(same_structure ? 1 : 0) == 1) scall = MAT_REUSE_MATRIX;
+        d_SAJ_A_signature[ln] = A_signature;
+        d_SAJ_P_signature[ln] = P_signature;
+    }
+    if (scall == MAT_INITIAL_MATRIX && d_SAJ_mat[ln])
+    {
+        ierr = MatDestroy(&d_SAJ_mat[ln]);
+        IBTK_CHKERRQ(ierr);
+        d_SAJ_mat[ln] = NULL;
+    }
+    ierr = MatPtAP(A, P, scall, d_SAJ_fill, &d_SAJ_mat[ln]);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // computeSAJOp
+
+void
+StaggeredStokesIBLevelRelaxationFACOperator::destroySAJOps(const int coarsest_ln, const int finest_ln)
+{
+    int ierr;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (d_SAJ_mat[ln])
+        {
+            ierr = MatDestroy(&d_SAJ_mat[ln]);
+            IBTK_CHKERRQ(ierr);
+            d_SAJ_mat[ln] = NULL;
+        }
+    }
+    return;
+} // destroySAJOps
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
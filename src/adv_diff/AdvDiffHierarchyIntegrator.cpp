@@ -1081,8 +1081,8 @@ AdvDiffHierarchyIntegrator::registerVariables()
                          d_Q_init[Q_var]);
         Pointer<CellDataFactory<NDIM, double> > Q_factory = Q_var->getPatchDataFactory();
         const int Q_depth = Q_factory->getDefaultDepth();
-        if (d_visit_writer)
-            d_visit_writer->registerPlotQuantity(Q_var->getName(), Q_depth == 1 ? "SCALAR" : "VECTOR", Q_current_idx);
+        if (d_visit_writer || d_reduced_writer)
+            registerPlotQuantity(Q_var->getName(), Q_depth == 1 ? "SCALAR" : "VECTOR", Q_current_idx);
     }
     for (std::vector<Pointer<CellVariable<NDIM, double> > >::const_iterator cit = d_F_var.begin(); cit != d_F_var.end();
          ++cit)
@@ -1099,8 +1099,8 @@ AdvDiffHierarchyIntegrator::registerVariables()
                          d_F_fcn[F_var]);
         Pointer<CellDataFactory<NDIM, double> > F_factory = F_var->getPatchDataFactory();
         const int F_depth = F_factory->getDefaultDepth();
-        if (d_visit_writer)
-            d_visit_writer->registerPlotQuantity(F_var->getName(), F_depth == 1 ? "SCALAR" : "VECTOR", F_current_idx);
+        if (d_visit_writer || d_reduced_writer)
+            registerPlotQuantity(F_var->getName(), F_depth == 1 ? "SCALAR" : "VECTOR", F_current_idx);
     }
     for (std::vector<Pointer<SideVariable<NDIM, double> > >::const_iterator cit = d_diffusion_coef_var.begin();
          cit != d_diffusion_coef_var.end();
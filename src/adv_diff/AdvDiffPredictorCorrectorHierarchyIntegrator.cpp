@@ -232,12 +232,16 @@ AdvDiffPredictorCorrectorHierarchyIntegrator::initializeHierarchyIntegrator(
     d_current_context = d_hyp_level_integrator->getCurrentContext();
     d_new_context = d_hyp_level_integrator->getNewContext();
 
-    // Register the VisIt data writer with the patch strategy object, which is
-    // the object that actually registers variables for plotting.
+    // Register the visualization data writers with the patch strategy object,
+    // which is the object that actually registers variables for plotting.
     if (d_visit_writer)
     {
         d_hyp_patch_ops->registerVisItDataWriter(d_visit_writer);
     }
+    if (d_reduced_writer)
+    {
+        d_hyp_patch_ops->registerReducedDataWriter(d_reduced_writer);
+    }
 
     // Register variables with the hyperbolic level integrator.
     for (std::vector<Pointer<FaceVariable<NDIM, double> > >::const_iterator cit = d_u_var.begin(); cit != d_u_var.end();
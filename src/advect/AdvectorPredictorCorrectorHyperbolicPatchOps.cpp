@@ -268,6 +268,7 @@ AdvectorPredictorCorrectorHyperbolicPatchOps::AdvectorPredictorCorrectorHyperbol
       d_registered_for_restart(register_for_restart),
       d_grid_geometry(grid_geom),
       d_visit_writer(NULL),
+      d_reduced_writer(NULL),
       d_extrap_bc_helper(),
       d_extrap_type("CONSTANT"),
       d_refinement_criteria(),
@@ -326,6 +327,16 @@ AdvectorPredictorCorrectorHyperbolicPatchOps::registerVisItDataWriter(Pointer<Vi
     return;
 } // registerVisItDataWriter
 
+void
+AdvectorPredictorCorrectorHyperbolicPatchOps::registerReducedDataWriter(Pointer<ReducedDataWriter> reduced_writer)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(reduced_writer);
+#endif
+    d_reduced_writer = reduced_writer;
+    return;
+} // registerReducedDataWriter
+
 void
 AdvectorPredictorCorrectorHyperbolicPatchOps::registerAdvectionVelocity(Pointer<FaceVariable<NDIM, double> > u_var)
 {
@@ -531,26 +542,26 @@ AdvectorPredictorCorrectorHyperbolicPatchOps::registerModelVariables(HyperbolicL
                                        "CONSERVATIVE_COARSEN",
                                        "CONSERVATIVE_LINEAR_REFINE");
 
-        if (d_visit_writer)
+        if (d_visit_writer || d_reduced_writer)
         {
             const int Q_idx = VariableDatabase<NDIM>::getDatabase()->mapVariableAndContextToIndex(
                 Q_var, d_integrator->getPlotContext());
             const int depth = Q_factory->getDefaultDepth();
             if (depth == 1)
             {
-                d_visit_writer->registerPlotQuantity(Q_var->getName(), "SCALAR", Q_idx);
+                registerPlotQuantity(Q_var->getName(), "SCALAR", Q_idx);
             }
             else
             {
                 if (depth == NDIM)
                 {
-                    d_visit_writer->registerPlotQuantity(Q_var->getName(), "VECTOR", Q_idx);
+                    registerPlotQuantity(Q_var->getName(), "VECTOR", Q_idx);
                 }
                 for (int d = 0; d < depth; ++d)
                 {
                     std::ostringstream stream;
                     stream << d;
-                    d_visit_writer->registerPlotQuantity(Q_var->getName() + "_" + stream.str(), "SCALAR", Q_idx, d);
+                    registerPlotQuantity(Q_var->getName() + "_" + stream.str(), "SCALAR", Q_idx, d);
                 }
             }
         }
@@ -1444,6 +1455,23 @@ AdvectorPredictorCorrectorHyperbolicPatchOps::setInflowBoundaryConditions(Patch<
     return;
 } // setInflowBoundaryConditions
 
+void
+AdvectorPredictorCorrectorHyperbolicPatchOps::registerPlotQuantity(const std::string& variable_name,
+                                                                   const std::string& variable_type,
+                                                                   const int patch_data_index,
+                                                                   const int start_depth_id)
+{
+    if (d_visit_writer)
+    {
+        d_visit_writer->registerPlotQuantity(variable_name, variable_type, patch_data_index, start_depth_id);
+    }
+    if (d_reduced_writer)
+    {
+        d_reduced_writer->registerPlotQuantity(variable_name, variable_type, patch_data_index, start_depth_id);
+    }
+    return;
+} // registerPlotQuantity
+
 void
 AdvectorPredictorCorrectorHyperbolicPatchOps::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
 {
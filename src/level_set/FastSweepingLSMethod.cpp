@@ -32,24 +32,34 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <math.h>
+#include <vector>
+
 #include "ibamr/FastSweepingLSMethod.h"
+#include "CellData.h"
+#include "CellIterator.h"
 #include "CellVariable.h"
-#include "HierarchyCellDataOpsReal.h"
 #include "IBAMR_config.h"
+#include "IntVector.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "VariableDatabase.h"
 #include "boost/array.hpp"
 #include "ibamr/namespaces.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "tbox/RestartManager.h"
+#include "tbox/SAMRAI_MPI.h"
 
 // FORTRAN ROUTINES
 #if (NDIM == 2)
 #define FAST_SWEEP_1ST_ORDER_FC IBAMR_FC_FUNC(fastsweep1storder2d, FASTSWEEP1STORDER2D)
+#define FAST_SWEEP_2ND_ORDER_FC IBAMR_FC_FUNC(fastsweep2ndorder2d, FASTSWEEP2NDORDER2D)
 #endif
 
 #if (NDIM == 3)
 #define FAST_SWEEP_1ST_ORDER_FC IBAMR_FC_FUNC(fastsweep1storder3d, FASTSWEEP1STORDER3D)
+#define FAST_SWEEP_2ND_ORDER_FC IBAMR_FC_FUNC(fastsweep2ndorder3d, FASTSWEEP2NDORDER3D)
 #endif
 
 extern "C" {
@@ -75,6 +85,28 @@ void FAST_SWEEP_1ST_ORDER_FC(double* U,
                              const double* dx,
                              const int& patch_touches_bdry,
                              const int* touches_wall_loc_idx);
+
+void FAST_SWEEP_2ND_ORDER_FC(double* U,
+                             const int& U_gcw,
+                             const int& ilower0,
+                             const int& iupper0,
+                             const int& ilower1,
+                             const int& iupper1,
+#if (NDIM == 3)
+                             const int& ilower2,
+                             const int& iupper2,
+#endif
+                             const int& dlower0,
+                             const int& dupper0,
+                             const int& dlower1,
+                             const int& dupper1,
+#if (NDIM == 3)
+                             const int& dlower2,
+                             const int& dupper2,
+#endif
+                             const double* dx,
+                             const int& patch_touches_bdry,
+                             const int* touches_wall_loc_idx);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -83,6 +115,40 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Returns true if the interior and ghost cell values of the two data objects
+// are identical.
+inline bool
+data_unchanged(Pointer<CellData<NDIM, double> > D_data, Pointer<CellData<NDIM, double> > D_iter_data)
+{
+    for (CellIterator<NDIM> ic(D_data->getGhostBox()); ic; ic++)
+    {
+        const CellIndex<NDIM>& i = ic();
+        if ((*D_data)(i) != (*D_iter_data)(i)) return false;
+    }
+    return true;
+} // data_unchanged
+
+// Returns the weighted sum of the squared differences between the two data
+// objects on the specified patch box.
+inline double
+diff_L2_norm_squared(Pointer<CellData<NDIM, double> > D_data,
+                     Pointer<CellData<NDIM, double> > D_iter_data,
+                     Pointer<CellData<NDIM, double> > wgt_data,
+                     const Box<NDIM>& patch_box)
+{
+    double sum = 0.0;
+    for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+    {
+        const CellIndex<NDIM>& i = ic();
+        const double diff = (*D_data)(i) - (*D_iter_data)(i);
+        sum += (*wgt_data)(i) * diff * diff;
+    }
+    return sum;
+} // diff_L2_norm_squared
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 FastSweepingLSMethod::FastSweepingLSMethod(const std::string& object_name,
@@ -97,6 +163,7 @@ FastSweepingLSMethod::FastSweepingLSMethod(const std::string& object_name,
     d_enable_logging = false;
     d_consider_phys_bdry_wall = false;
     for (int k = 0; k < 2 * NDIM; ++k) d_wall_location_idx[k] = 0;
+    d_skip_unchanged_patches = true;
 
     if (d_registered_for_restart) getFromRestart();
     if (!db.isNull()) getFromInput(db);
@@ -124,6 +191,16 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
     TBOX_ASSERT(!D_var.isNull());
 #endif
 
+    // The sweeps read values from the ghost cells of each patch.
+    const int D_ghosts = var_db->getPatchDescriptor()->getPatchDataFactory(D_idx)->getGhostCellWidth().min();
+    const int min_D_ghosts = (d_ls_order == SECOND_ORDER_LS ? 2 : 1);
+    if (D_ghosts < min_D_ghosts)
+    {
+        TBOX_ERROR(d_object_name << "::initializeLSData():\n"
+                                 << "  " << enum_to_string(d_ls_order) << " sweeps require at least " << min_D_ghosts
+                                 << " ghost cells, but the distance function has " << D_ghosts << std::endl);
+    }
+
     Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
     const int coarsest_ln = 0;
     const int finest_ln = hierarchy->getFinestLevelNumber();
@@ -148,46 +225,58 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
         D_idx, "LINEAR_REFINE", true, "NONE", "QUADRATIC", false, d_bc_coef);
     Pointer<HierarchyGhostCellInterpolation> fill_op = new HierarchyGhostCellInterpolation();
     fill_op->initializeOperatorState(D_transaction, hierarchy);
-    HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(hierarchy, coarsest_ln, finest_ln);
-
-    // Carry out iterations
-    double diff_L2_norm = 1.0e12;
-    int outer_iter = 0;
-    const int cc_wgt_idx = hier_math_ops->getCellWeightPatchDescriptorIndex();
 
-    while (diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
+    // Carry out first-order sweeps until convergence.  If a second-order
+    // solution is requested, the first-order solution is used as the initial
+    // guess for the second-order sweeps.
+    std::vector<LevelSetOrder> sweep_orders(1, FIRST_ORDER_LS);
+    if (d_ls_order == SECOND_ORDER_LS) sweep_orders.push_back(SECOND_ORDER_LS);
+    for (unsigned int k = 0; k < sweep_orders.size(); ++k)
     {
-        hier_cc_data_ops.copyData(D_iter_idx, D_idx);
-        fill_op->fillData(time);
-
-        fastSweep(hier_math_ops, D_idx);
+        double diff_L2_norm = 1.0e12;
+        int outer_iter = 0;
+        while (diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
+        {
+            fill_op->fillData(time);
 
-        hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_idx);
-        diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
+            // Patches whose data did not change since their previous sweep
+            // are skipped after the first iteration.
+            int num_patches_swept = 0;
+            diff_L2_norm = fastSweep(hier_math_ops,
+                                     D_idx,
+                                     D_iter_idx,
+                                     sweep_orders[k],
+                                     d_skip_unchanged_patches && outer_iter > 0,
+                                     num_patches_swept);
 
-        outer_iter += 1;
+            outer_iter += 1;
 
-        if (d_enable_logging)
-        {
-            plog << d_object_name << "::initializeLSData(): After iteration # " << outer_iter << std::endl;
-            plog << d_object_name << "::initializeLSData(): L2-norm between successive iterations = " << diff_L2_norm
-                 << std::endl;
-        }
+            if (d_enable_logging)
+            {
+                plog << d_object_name << "::initializeLSData(): After " << enum_to_string(sweep_orders[k])
+                     << " iteration # " << outer_iter << std::endl;
+                plog << d_object_name << "::initializeLSData(): Number of patches swept = " << num_patches_swept
+                     << std::endl;
+                plog << d_object_name
+                     << "::initializeLSData(): L2-norm between successive iterations = " << diff_L2_norm << std::endl;
+            }
 
-        if (diff_L2_norm <= d_abs_tol)
-        {
-            plog << d_object_name << "::initializeLSData(): Fast sweeping algorithm converged for entire domain"
-                 << std::endl;
+            if (diff_L2_norm <= d_abs_tol)
+            {
+                plog << d_object_name << "::initializeLSData(): Fast sweeping algorithm converged for entire domain"
+                     << std::endl;
+            }
         }
-    }
 
-    if (outer_iter >= d_max_its)
-    {
-        if (d_enable_logging)
+        if (outer_iter >= d_max_its)
         {
-            plog << d_object_name << "::initializeLSData(): Reached maximum allowable outer iterations" << std::endl;
-            plog << d_object_name << "::initializeLSData(): ||distance_new - distance_old||_2 = " << diff_L2_norm
-                 << std::endl;
+            if (d_enable_logging)
+            {
+                plog << d_object_name << "::initializeLSData(): Reached maximum allowable outer iterations"
+                     << std::endl;
+                plog << d_object_name << "::initializeLSData(): ||distance_new - distance_old||_2 = " << diff_L2_norm
+                     << std::endl;
+            }
         }
     }
 
@@ -203,13 +292,21 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
-void
-FastSweepingLSMethod::fastSweep(Pointer<HierarchyMathOps> hier_math_ops, int dist_idx) const
+double
+FastSweepingLSMethod::fastSweep(Pointer<HierarchyMathOps> hier_math_ops,
+                                const int dist_idx,
+                                const int dist_iter_idx,
+                                const LevelSetOrder ls_order,
+                                const bool skip_unchanged_patches,
+                                int& num_patches_swept) const
 {
     Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
     const int coarsest_ln = 0;
     const int finest_ln = hierarchy->getFinestLevelNumber();
+    const int wgt_idx = hier_math_ops->getCellWeightPatchDescriptorIndex();
 
+    double diff_L2_norm_sq = 0.0;
+    num_patches_swept = 0;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
@@ -222,17 +319,30 @@ FastSweepingLSMethod::fastSweep(Pointer<HierarchyMathOps> hier_math_ops, int dis
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
-            fastSweep(dist_data, patch, domain_boxes[0]);
+            Pointer<CellData<NDIM, double> > dist_iter_data = patch->getPatchData(dist_iter_idx);
+
+            // The sweep is deterministic, so a patch need not be swept again if
+            // neither its interior values (i.e., the result of its previous
+            // sweep) nor its ghost cell values have changed.
+            if (skip_unchanged_patches && data_unchanged(dist_data, dist_iter_data)) continue;
+
+            dist_iter_data->copy(*dist_data);
+            fastSweep(dist_data, patch, domain_boxes[0], ls_order);
+            num_patches_swept += 1;
+
+            Pointer<CellData<NDIM, double> > wgt_data = patch->getPatchData(wgt_idx);
+            diff_L2_norm_sq += diff_L2_norm_squared(dist_data, dist_iter_data, wgt_data, patch->getBox());
         }
     }
-    return;
-
+    num_patches_swept = SAMRAI_MPI::sumReduction(num_patches_swept);
+    return sqrt(SAMRAI_MPI::sumReduction(diff_L2_norm_sq));
 } // fastSweep
 
 void
 FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
                                 const Pointer<Patch<NDIM> > patch,
-                                const Box<NDIM>& domain_box) const
+                                const Box<NDIM>& domain_box,
+                                const LevelSetOrder ls_order) const
 {
     double* const D = dist_data->getPointer(0);
     const int D_ghosts = (dist_data->getGhostCellWidth()).max();
@@ -257,12 +367,13 @@ FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
 
 #if !defined(NDEBUG)
     TBOX_ASSERT(dist_data->getDepth() == 1);
-    if (d_ls_order == FIRST_ORDER_LS) TBOX_ASSERT(D_ghosts >= 1);
+    if (ls_order == FIRST_ORDER_LS) TBOX_ASSERT(D_ghosts >= 1);
+    if (ls_order == SECOND_ORDER_LS) TBOX_ASSERT(D_ghosts >= 2);
 #endif
 
     const Box<NDIM>& patch_box = patch->getBox();
     const double* const dx = pgeom->getDx();
-    if (d_ls_order == FIRST_ORDER_LS)
+    if (ls_order == FIRST_ORDER_LS)
     {
         FAST_SWEEP_1ST_ORDER_FC(D,
                                 D_ghosts,
@@ -281,6 +392,30 @@ FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
 #if (NDIM == 3)
                                 domain_box.lower(2),
                                 domain_box.upper(2),
+#endif
+                                dx,
+                                patch_touches_bdry,
+                                touches_wall_loc_idx);
+    }
+    else if (ls_order == SECOND_ORDER_LS)
+    {
+        FAST_SWEEP_2ND_ORDER_FC(D,
+                                D_ghosts,
+                                patch_box.lower(0),
+                                patch_box.upper(0),
+                                patch_box.lower(1),
+                                patch_box.upper(1),
+#if (NDIM == 3)
+                                patch_box.lower(2),
+                                patch_box.upper(2),
+#endif
+                                domain_box.lower(0),
+                                domain_box.upper(0),
+                                domain_box.lower(1),
+                                domain_box.upper(1),
+#if (NDIM == 3)
+                                domain_box.lower(2),
+                                domain_box.upper(2),
 #endif
                                 dx,
                                 patch_touches_bdry,
@@ -288,7 +423,7 @@ FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
     }
     else
     {
-        TBOX_ERROR("FastSweepingLSMethod does not support " << enum_to_string(d_ls_order) << std::endl);
+        TBOX_ERROR("FastSweepingLSMethod does not support " << enum_to_string(ls_order) << std::endl);
     }
 
     return;
@@ -300,6 +435,12 @@ FastSweepingLSMethod::getFromInput(Pointer<Database> input_db)
     std::string ls_order = "FIRST_ORDER";
     ls_order = input_db->getStringWithDefault("order", ls_order);
     d_ls_order = string_to_enum<LevelSetOrder>(ls_order);
+    if (d_ls_order != FIRST_ORDER_LS && d_ls_order != SECOND_ORDER_LS)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  unsupported order " << ls_order << "\n"
+                                 << "  valid choices are: FIRST_ORDER, SECOND_ORDER" << std::endl);
+    }
 
     d_max_its = input_db->getIntegerWithDefault("max_iterations", d_max_its);
     d_max_its = input_db->getIntegerWithDefault("max_its", d_max_its);
@@ -308,6 +449,8 @@ FastSweepingLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_enable_logging = input_db->getBoolWithDefault("enable_logging", d_enable_logging);
 
+    d_skip_unchanged_patches = input_db->getBoolWithDefault("skip_unchanged_patches", d_skip_unchanged_patches);
+
     d_consider_phys_bdry_wall = input_db->getBoolWithDefault("physical_bdry_wall", d_consider_phys_bdry_wall);
     Array<int> wall_loc_idices;
     if (input_db->keyExists("physical_bdry_wall_loc_idx"))
@@ -32,7 +32,13 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <math.h>
+#include <algorithm>
+#include <vector>
+
 #include "ibamr/RelaxationLSMethod.h"
+#include "CellData.h"
+#include "CellIterator.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
 #include "IBAMR_config.h"
@@ -41,6 +47,7 @@
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "tbox/RestartManager.h"
+#include "tbox/SAMRAI_MPI.h"
 
 // FORTRAN ROUTINES
 #if (NDIM == 2)
@@ -65,6 +72,14 @@ void RELAXATION_LS_1ST_ORDER_FC(double* U,
 #if (NDIM == 3)
                                 const int& ilower2,
                                 const int& iupper2,
+#endif
+                                const int& tlower0,
+                                const int& tupper0,
+                                const int& tlower1,
+                                const int& tupper1,
+#if (NDIM == 3)
+                                const int& tlower2,
+                                const int& tupper2,
 #endif
                                 const double* dx,
                                 const int& dir);
@@ -80,6 +95,14 @@ void RELAXATION_LS_3RD_ORDER_FC(double* U,
 #if (NDIM == 3)
                                 const int& ilower2,
                                 const int& iupper2,
+#endif
+                                const int& tlower0,
+                                const int& tupper0,
+                                const int& tlower1,
+                                const int& tupper1,
+#if (NDIM == 3)
+                                const int& tlower2,
+                                const int& tupper2,
 #endif
                                 const double* dx,
                                 const int& dir);
@@ -91,6 +114,53 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Returns the weighted sum of the squared differences between the two data
+// objects on the specified box.
+inline double
+diff_L2_norm_squared(Pointer<CellData<NDIM, double> > D_data,
+                     Pointer<CellData<NDIM, double> > D_iter_data,
+                     Pointer<CellData<NDIM, double> > wgt_data,
+                     const Box<NDIM>& box)
+{
+    double sum = 0.0;
+    for (CellIterator<NDIM> ic(box); ic; ic++)
+    {
+        const CellIndex<NDIM>& i = ic();
+        const double diff = (*D_data)(i) - (*D_iter_data)(i);
+        sum += (*wgt_data)(i) * diff * diff;
+    }
+    return sum;
+} // diff_L2_norm_squared
+
+// Returns true if the tile contains values within the cutoff distance or a
+// sign change between adjacent cells of the patch.
+inline bool
+tile_in_band(Pointer<CellData<NDIM, double> > D_data,
+             const Box<NDIM>& tile_box,
+             const Box<NDIM>& patch_box,
+             const double cutoff)
+{
+    for (CellIterator<NDIM> ic(tile_box); ic; ic++)
+    {
+        const CellIndex<NDIM>& i = ic();
+        const double D = (*D_data)(i);
+        if (fabs(D) < cutoff) return true;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            for (int shift = -1; shift <= 1; shift += 2)
+            {
+                CellIndex<NDIM> i_nbr = i;
+                i_nbr(d) += shift;
+                if (patch_box.contains(i_nbr) && D * (*D_data)(i_nbr) <= 0.0) return true;
+            }
+        }
+    }
+    return false;
+} // tile_in_band
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 RelaxationLSMethod::RelaxationLSMethod(const std::string& object_name, Pointer<Database> db, bool register_for_restart)
@@ -101,6 +171,9 @@ RelaxationLSMethod::RelaxationLSMethod(const std::string& object_name, Pointer<D
     d_max_its = 100;
     d_abs_tol = 1e-5;
     d_enable_logging = false;
+    d_use_narrow_band = false;
+    d_narrow_band_width = 8.0;
+    d_narrow_band_tile_size = 8;
 
     // Get any additional or overwrite base class options.
     if (d_registered_for_restart) getFromRestart();
@@ -146,6 +219,9 @@ RelaxationLSMethod::initializeLSData(int D_idx, Pointer<HierarchyMathOps> hier_m
         (*d_locate_interface_fcns[k])(D_idx, hier_math_ops, time, initial_time, d_locate_interface_fcns_ctx[k]);
     }
 
+    // Determine the narrow band and clamp the far-field values.
+    if (d_use_narrow_band) resetNarrowBand(hierarchy, D_idx, /*merge_previous_band*/ true, /*clamp_far_field*/ true);
+
     // Set hierarchy objects.
     typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
     InterpolationTransactionComponent D_transaction(
@@ -158,7 +234,6 @@ RelaxationLSMethod::initializeLSData(int D_idx, Pointer<HierarchyMathOps> hier_m
     // Carry out relaxation
     double diff_L2_norm = 1.0e12;
     int outer_iter = 0;
-    const int cc_wgt_idx = hier_math_ops->getCellWeightPatchDescriptorIndex();
 
     // Copy initial condition
     hier_cc_data_ops.copyData(D_init_idx, D_idx);
@@ -168,13 +243,8 @@ RelaxationLSMethod::initializeLSData(int D_idx, Pointer<HierarchyMathOps> hier_m
     fill_op->resetTransactionComponent(D_transaction);
     while (diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
     {
-        hier_cc_data_ops.copyData(D_iter_idx, D_idx);
         fill_op->fillData(time);
-        relax(hier_math_ops, D_idx, D_init_idx, outer_iter);
-
-        // Compute error
-        hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_idx);
-        diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
+        diff_L2_norm = relax(hier_math_ops, D_idx, D_iter_idx, D_init_idx, outer_iter);
 
         outer_iter += 1;
 
@@ -201,6 +271,9 @@ RelaxationLSMethod::initializeLSData(int D_idx, Pointer<HierarchyMathOps> hier_m
         }
     }
 
+    // Refresh the narrow band from the reinitialized distance function.
+    if (d_use_narrow_band) resetNarrowBand(hierarchy, D_idx, /*merge_previous_band*/ false, /*clamp_far_field*/ false);
+
     // Deallocate the temporary variable.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
@@ -215,16 +288,19 @@ RelaxationLSMethod::initializeLSData(int D_idx, Pointer<HierarchyMathOps> hier_m
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
-void
+double
 RelaxationLSMethod::relax(Pointer<HierarchyMathOps> hier_math_ops,
                           int dist_idx,
+                          int dist_iter_idx,
                           int dist_init_idx,
                           const int iter) const
 {
     Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
     const int coarsest_ln = 0;
     const int finest_ln = hierarchy->getFinestLevelNumber();
+    const int wgt_idx = hier_math_ops->getCellWeightPatchDescriptorIndex();
 
+    double diff_L2_norm_sq = 0.0;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
@@ -232,18 +308,27 @@ RelaxationLSMethod::relax(Pointer<HierarchyMathOps> hier_math_ops,
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
+            Pointer<CellData<NDIM, double> > dist_iter_data = patch->getPatchData(dist_iter_idx);
             const Pointer<CellData<NDIM, double> > dist_init_data = patch->getPatchData(dist_init_idx);
-            relax(dist_data, dist_init_data, patch, iter);
+            Pointer<CellData<NDIM, double> > wgt_data = patch->getPatchData(wgt_idx);
+            const std::vector<Box<NDIM> > patch_tiles(1, patch->getBox());
+            const std::vector<Box<NDIM> >& tiles = d_use_narrow_band ? d_active_tiles[ln][p()] : patch_tiles;
+            for (unsigned int k = 0; k < tiles.size(); ++k)
+            {
+                dist_iter_data->getArrayData().copy(dist_data->getArrayData(), tiles[k]);
+                relax(dist_data, dist_init_data, patch, tiles[k], iter);
+                diff_L2_norm_sq += diff_L2_norm_squared(dist_data, dist_iter_data, wgt_data, tiles[k]);
+            }
         }
     }
-    return;
-
+    return sqrt(SAMRAI_MPI::sumReduction(diff_L2_norm_sq));
 } // relax
 
 void
 RelaxationLSMethod::relax(Pointer<CellData<NDIM, double> > dist_data,
                           const Pointer<CellData<NDIM, double> > dist_init_data,
                           const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& tile_box,
                           const int iter) const
 {
     double* const D = dist_data->getPointer(0);
@@ -287,6 +372,14 @@ RelaxationLSMethod::relax(Pointer<CellData<NDIM, double> > dist_data,
 #if (NDIM == 3)
                                    patch_box.lower(2),
                                    patch_box.upper(2),
+#endif
+                                   tile_box.lower(0),
+                                   tile_box.upper(0),
+                                   tile_box.lower(1),
+                                   tile_box.upper(1),
+#if (NDIM == 3)
+                                   tile_box.lower(2),
+                                   tile_box.upper(2),
 #endif
                                    dx,
                                    dir);
@@ -304,6 +397,14 @@ RelaxationLSMethod::relax(Pointer<CellData<NDIM, double> > dist_data,
 #if (NDIM == 3)
                                    patch_box.lower(2),
                                    patch_box.upper(2),
+#endif
+                                   tile_box.lower(0),
+                                   tile_box.upper(0),
+                                   tile_box.lower(1),
+                                   tile_box.upper(1),
+#if (NDIM == 3)
+                                   tile_box.lower(2),
+                                   tile_box.upper(2),
 #endif
                                    dx,
                                    dir);
@@ -316,6 +417,92 @@ RelaxationLSMethod::relax(Pointer<CellData<NDIM, double> > dist_data,
     return;
 } // relax
 
+void
+RelaxationLSMethod::resetNarrowBand(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                    const int dist_idx,
+                                    const bool merge_previous_band,
+                                    const bool clamp_far_field)
+{
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    std::vector<std::vector<std::vector<Box<NDIM> > > > active_tiles(finest_ln + 1);
+    std::vector<std::vector<Box<NDIM> > > band_patch_boxes(finest_ln + 1);
+    int num_tiles = 0, num_active_tiles = 0;
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        const int num_patches = level->getNumberOfPatches();
+        active_tiles[ln].resize(num_patches);
+        band_patch_boxes[ln].resize(num_patches);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            const double cutoff = d_narrow_band_width * (*std::max_element(dx, dx + NDIM));
+            band_patch_boxes[ln][p()] = patch_box;
+
+            // The previous band can only be reused if the patch has not changed
+            // since it was computed.
+            const bool previous_band_valid = merge_previous_band && ln < static_cast<int>(d_active_tiles.size()) &&
+                                             p() < static_cast<int>(d_active_tiles[ln].size()) &&
+                                             d_band_patch_boxes[ln][p()] == patch_box;
+            const std::vector<Box<NDIM> > empty_band;
+            const std::vector<Box<NDIM> >& previous_tiles = previous_band_valid ? d_active_tiles[ln][p()] : empty_band;
+
+            // Loop over the tiles of the patch.
+            IntVector<NDIM> num_patch_tiles;
+            int num_tiles_patch = 1;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                num_patch_tiles(d) =
+                    (patch_box.numberCells(d) + d_narrow_band_tile_size - 1) / d_narrow_band_tile_size;
+                num_tiles_patch *= num_patch_tiles(d);
+            }
+            for (int t = 0; t < num_tiles_patch; ++t)
+            {
+                Box<NDIM> tile_box;
+                int offset = t;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    const int t_d = offset % num_patch_tiles(d);
+                    offset /= num_patch_tiles(d);
+                    tile_box.lower(d) = patch_box.lower(d) + t_d * d_narrow_band_tile_size;
+                    tile_box.upper(d) = std::min(tile_box.lower(d) + d_narrow_band_tile_size - 1, patch_box.upper(d));
+                }
+                const bool active =
+                    std::find(previous_tiles.begin(), previous_tiles.end(), tile_box) != previous_tiles.end() ||
+                    tile_in_band(dist_data, tile_box, patch_box, cutoff);
+                if (active)
+                {
+                    active_tiles[ln][p()].push_back(tile_box);
+                    ++num_active_tiles;
+                }
+                else if (clamp_far_field)
+                {
+                    // Inactive tiles do not contain sign changes, so the sign
+                    // of any cell in the tile determines the clamped value.
+                    const double sgn = (*dist_data)(CellIndex<NDIM>(tile_box.lower())) < 0.0 ? -1.0 : 1.0;
+                    dist_data->fill(sgn * cutoff, tile_box);
+                }
+            }
+            num_tiles += num_tiles_patch;
+        }
+    }
+    d_active_tiles.swap(active_tiles);
+    d_band_patch_boxes.swap(band_patch_boxes);
+
+    if (d_enable_logging)
+    {
+        num_tiles = SAMRAI_MPI::sumReduction(num_tiles);
+        num_active_tiles = SAMRAI_MPI::sumReduction(num_active_tiles);
+        plog << d_object_name << "::resetNarrowBand(): " << num_active_tiles << " of " << num_tiles
+             << " tiles are in the narrow band" << std::endl;
+    }
+    return;
+} // resetNarrowBand
+
 void
 RelaxationLSMethod::getFromInput(Pointer<Database> input_db)
 {
@@ -330,6 +517,15 @@ RelaxationLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_enable_logging = input_db->getBoolWithDefault("enable_logging", d_enable_logging);
 
+    d_use_narrow_band = input_db->getBoolWithDefault("use_narrow_band", d_use_narrow_band);
+    d_narrow_band_width = input_db->getDoubleWithDefault("narrow_band_width", d_narrow_band_width);
+    d_narrow_band_tile_size = input_db->getIntegerWithDefault("narrow_band_tile_size", d_narrow_band_tile_size);
+    if (d_use_narrow_band && (d_narrow_band_width <= 0.0 || d_narrow_band_tile_size <= 0))
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  narrow_band_width and narrow_band_tile_size must be positive" << std::endl);
+    }
+
     return;
 } // getFromInput
 
@@ -285,7 +285,254 @@ c     Take care of physical boundaries.
       end
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
+c     Carry out second-order accurate fast sweeping algorithm
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine fastsweep2ndorder2d(
+     &     U,U_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dlower0,dupper0,
+     &     dlower1,dupper1,
+     &     dx,
+     &     patch_touches_bdry,
+     &     touches_wall_loc_idx)
+c
+      implicit none
+include(TOP_SRCDIR/src/fortran/const.i)dnl
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER dlower0,dupper0
+      INTEGER dlower1,dupper1
+      INTEGER U_gcw
+      INTEGER patch_touches_bdry
+
+c
+c     Input/Output.
+c
+      REAL U(CELL2d(ilower,iupper,U_gcw))
+      REAL dx(0:NDIM-1)
+      INTEGER touches_wall_loc_idx(0:2*NDIM - 1)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+
+c     Do the four sweeping directions.
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            call evalsweep2ndorder2d(U,U_gcw,
+     &                               ilower0,iupper0,
+     &                               ilower1,iupper1,
+     &                               i0,i1,
+     &                               dlower0,dupper0,
+     &                               dlower1,dupper1,
+     &                               dx,
+     &                               patch_touches_bdry,
+     &                               touches_wall_loc_idx)
+         enddo
+      enddo
+
+      do i1 = ilower1,iupper1
+         do i0 = iupper0,ilower0,-1
+            call evalsweep2ndorder2d(U,U_gcw,
+     &                               ilower0,iupper0,
+     &                               ilower1,iupper1,
+     &                               i0,i1,
+     &                               dlower0,dupper0,
+     &                               dlower1,dupper1,
+     &                               dx,
+     &                               patch_touches_bdry,
+     &                               touches_wall_loc_idx)
+         enddo
+      enddo
+
+      do i1 = iupper1,ilower1,-1
+         do i0 = iupper0,ilower0,-1
+            call evalsweep2ndorder2d(U,U_gcw,
+     &                               ilower0,iupper0,
+     &                               ilower1,iupper1,
+     &                               i0,i1,
+     &                               dlower0,dupper0,
+     &                               dlower1,dupper1,
+     &                               dx,
+     &                               patch_touches_bdry,
+     &                               touches_wall_loc_idx)
+         enddo
+      enddo
+
+      do i1 = iupper1,ilower1,-1
+         do i0 = ilower0,iupper0
+            call evalsweep2ndorder2d(U,U_gcw,
+     &                               ilower0,iupper0,
+     &                               ilower1,iupper1,
+     &                               i0,i1,
+     &                               dlower0,dupper0,
+     &                               dlower1,dupper1,
+     &                               dx,
+     &                               patch_touches_bdry,
+     &                               touches_wall_loc_idx)
+         enddo
+      enddo
+
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute the upwind neighbor value and effective grid spacing used
+c     by the second-order fast sweeping algorithm along one direction.
+c
+c     The second-order one-sided difference (3U_i - 4U_{i-1} + U_{i-2})/2h
+c     is written as (U_i - Ut)/ht with Ut = (4U_{i-1} - U_{i-2})/3 and
+c     ht = 2h/3, so that the first-order update formulas can be reused.
+c     The first-order neighbor value is used if the second-order stencil
+c     crosses the interface or is not monotone.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine upwind2ndorder2d(
+     &     Um1,Um2,Up1,Up2,
+     &     sgn,h,
+     &     Ut,ht)
+c
+      implicit none
+include(TOP_SRCDIR/src/fortran/const.i)dnl
+c
+c     Input.
+c
+      REAL Um1,Um2,Up1,Up2
+      REAL sgn,h
+c
+c     Output.
+c
+      REAL Ut,ht
+c
+c     Local variables.
+c
+      REAL U1,U2
+
+      if (sgn*Um1 .le. sgn*Up1) then
+        U1 = Um1
+        U2 = Um2
+      else
+        U1 = Up1
+        U2 = Up2
+      endif
+
+      if ((sgn*U2 .ge. zero) .and. (sgn*U2 .le. sgn*U1)) then
+        Ut = (four*U1 - U2)/three
+        ht = two*h/three
+      else
+        Ut = U1
+        ht = h
+      endif
+
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute second-order fast sweep solution at a given grid cell
+c
+c     Cells adjacent to the interface keep the values set when locating
+c     the interface, and cells near physical boundaries use the
+c     first-order update.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine evalsweep2ndorder2d(
+     &     U,U_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     i0,i1,
+     &     dlower0,dupper0,
+     &     dlower1,dupper1,
+     &     dx,
+     &     patch_touches_bdry,
+     &     touches_wall_loc_idx)
+c
+      implicit none
+include(TOP_SRCDIR/src/fortran/const.i)dnl
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER dlower0,dupper0
+      INTEGER dlower1,dupper1
+      INTEGER U_gcw
+      INTEGER patch_touches_bdry
+
+c
+c     Input/Output.
+c
+      REAL U(CELL2d(ilower,iupper,U_gcw))
+      REAL dx(0:NDIM-1)
+      INTEGER touches_wall_loc_idx(0:2*NDIM - 1)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    a,b,sgn
+      REAL    hx,hy
+      REAL    Q,R,S
+      REAL    dbar
+
+      if (patch_touches_bdry .eq. 1) then
+        if ((i0 .le. dlower0+1) .or. (i0 .ge. dupper0-1) .or.
+     &      (i1 .le. dlower1+1) .or. (i1 .ge. dupper1-1)) then
+          call evalsweep1storder2d(U,U_gcw,
+     &                             ilower0,iupper0,
+     &                             ilower1,iupper1,
+     &                             i0,i1,
+     &                             dlower0,dupper0,
+     &                             dlower1,dupper1,
+     &                             dx,
+     &                             patch_touches_bdry,
+     &                             touches_wall_loc_idx)
+          return
+        endif
+      endif
+
+      if (U(i0,i1) .eq. zero) return
+      sgn = sign(one,U(i0,i1))
+
+c     Keep cells adjacent to the interface fixed.
+      if ((sgn*U(i0-1,i1) .le. zero) .or. (sgn*U(i0+1,i1) .le. zero)
+     &    .or. (sgn*U(i0,i1-1) .le. zero)
+     &    .or. (sgn*U(i0,i1+1) .le. zero)) return
+
+      call upwind2ndorder2d(U(i0-1,i1),U(i0-2,i1),
+     &                      U(i0+1,i1),U(i0+2,i1),
+     &                      sgn,dx(0),a,hx)
+      call upwind2ndorder2d(U(i0,i1-1),U(i0,i1-2),
+     &                      U(i0,i1+1),U(i0,i1+2),
+     &                      sgn,dx(1),b,hy)
+
+      if (sgn*(b-a) .gt. hx) then
+        dbar = a + sgn*hx
+      elseif (sgn*(a-b) .gt. hy) then
+        dbar = b + sgn*hy
+      else
+        Q = hx*hx + hy*hy
+        R = -2.d0*(hy*hy*a + hx*hx*b)
+        S = hy*hy*a*a + hx*hx*b*b - hx*hx*hy*hy
+        dbar = (-R + sgn*sqrt(R*R-4.d0*Q*S))/(2.d0*Q)
+      endif
+
+      U(i0,i1) = dbar
+
+      return
+      end
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
 c     Carry out first order relaxation scheme using Gauss Seidel updates
+c     over the cells tlower..tupper of the patch
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
@@ -294,6 +541,8 @@ c
      &     V,V_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
+     &     tlower0,tupper0,
+     &     tlower1,tupper1,
      &     dx,
      &     dir)
 c
@@ -305,6 +554,8 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
+      INTEGER tlower0,tupper0
+      INTEGER tlower1,tupper1
       INTEGER U_gcw,V_gcw
       INTEGER dir
 
@@ -320,8 +571,8 @@ c
       INTEGER i0,i1
 
       if (dir .eq. 0) then
-        do i1 = ilower1,iupper1
-          do i0 = ilower0,iupper0
+        do i1 = tlower1,tupper1
+          do i0 = tlower0,tupper0
               call evalrelax1storder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -329,8 +580,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 1) then
-        do i1 = ilower1,iupper1
-          do i0 = iupper0,ilower0,-1
+        do i1 = tlower1,tupper1
+          do i0 = tupper0,tlower0,-1
               call evalrelax1storder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -338,8 +589,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 2) then
-        do i1 = iupper1,ilower1,-1
-          do i0 = ilower0,iupper0
+        do i1 = tupper1,tlower1,-1
+          do i0 = tlower0,tupper0
               call evalrelax1storder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -347,8 +598,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 3 )then
-        do i1 = iupper1,ilower1,-1
-          do i0 = iupper0,ilower0,-1
+        do i1 = tupper1,tlower1,-1
+          do i0 = tupper0,tlower0,-1
               call evalrelax1storder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -429,6 +680,7 @@ c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Carry out third order relaxation scheme using Gauss Seidel updates
+c     over the cells tlower..tupper of the patch
 c     NOTE: this scheme between third and fourth s
 c     order near the interface and second order everywhere else
 c
@@ -442,6 +694,8 @@ c
      &     V,V_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
+     &     tlower0,tupper0,
+     &     tlower1,tupper1,
      &     dx,
      &     dir)
 c
@@ -453,6 +707,8 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
+      INTEGER tlower0,tupper0
+      INTEGER tlower1,tupper1
       INTEGER U_gcw,V_gcw
       INTEGER dir
 
@@ -468,8 +724,8 @@ c
       INTEGER i0,i1
 
       if (dir .eq. 0) then
-        do i1 = ilower1,iupper1
-          do i0 = ilower0,iupper0
+        do i1 = tlower1,tupper1
+          do i0 = tlower0,tupper0
               call evalrelax3rdorder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -477,8 +733,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 1) then
-        do i1 = ilower1,iupper1
-          do i0 = iupper0,ilower0,-1
+        do i1 = tlower1,tupper1
+          do i0 = tupper0,tlower0,-1
               call evalrelax3rdorder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -486,8 +742,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 2) then
-        do i1 = iupper1,ilower1,-1
-          do i0 = ilower0,iupper0
+        do i1 = tupper1,tlower1,-1
+          do i0 = tlower0,tupper0
               call evalrelax3rdorder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -495,8 +751,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 3 )then
-        do i1 = iupper1,ilower1,-1
-          do i0 = iupper0,ilower0,-1
+        do i1 = tupper1,tlower1,-1
+          do i0 = tupper0,tlower0,-1
               call evalrelax3rdorder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -449,9 +449,405 @@ c     Algorithm to find dbar
       return
       end
 
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Carry out second-order accurate fast sweeping algorithm
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine fastsweep2ndorder3d(
+     &     U,U_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     dlower0,dupper0,
+     &     dlower1,dupper1,
+     &     dlower2,dupper2,
+     &     dx,
+     &     patch_touches_bdry,
+     &     touches_wall_loc_idx)
+c
+      implicit none
+include(TOP_SRCDIR/src/fortran/const.i)dnl
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER dlower0,dupper0
+      INTEGER dlower1,dupper1
+      INTEGER dlower2,dupper2
+      INTEGER U_gcw
+      INTEGER patch_touches_bdry
+
+c
+c     Input/Output.
+c
+      REAL U(CELL3d(ilower,iupper,U_gcw))
+      REAL dx(0:NDIM-1)
+      INTEGER touches_wall_loc_idx(0:2*NDIM - 1)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2
+      
+c     Do the eight sweeping directions.
+      do i2 = ilower2,iupper2
+         do i1 = ilower1,iupper1
+            do i0 = ilower0,iupper0
+              call evalsweep2ndorder3d(U,U_gcw,
+     &                                 ilower0,iupper0,
+     &                                 ilower1,iupper1,
+     &                                 ilower2,iupper2,
+     &                                 i0,i1,i2,
+     &                                 dlower0,dupper0,
+     &                                 dlower1,dupper1,
+     &                                 dlower2,dupper2,
+     &                                 dx,
+     &                                 patch_touches_bdry,
+     &                                 touches_wall_loc_idx)
+
+            enddo
+         enddo
+      enddo
+      
+      do i2 = ilower2,iupper2
+         do i1 = ilower1,iupper1
+            do i0 = iupper0,ilower0,-1
+              call evalsweep2ndorder3d(U,U_gcw,
+     &                                 ilower0,iupper0,
+     &                                 ilower1,iupper1,
+     &                                 ilower2,iupper2,
+     &                                 i0,i1,i2,
+     &                                 dlower0,dupper0,
+     &                                 dlower1,dupper1,
+     &                                 dlower2,dupper2,
+     &                                 dx,
+     &                                 patch_touches_bdry,
+     &                                 touches_wall_loc_idx)
+            enddo
+         enddo
+      enddo
+
+      do i2 = ilower2,iupper2
+         do i1 = iupper1,ilower1,-1
+            do i0 = ilower0,iupper0
+              call evalsweep2ndorder3d(U,U_gcw,
+     &                                 ilower0,iupper0,
+     &                                 ilower1,iupper1,
+     &                                 ilower2,iupper2,
+     &                                 i0,i1,i2,
+     &                                 dlower0,dupper0,
+     &                                 dlower1,dupper1,
+     &                                 dlower2,dupper2,
+     &                                 dx,
+     &                                 patch_touches_bdry,
+     &                                 touches_wall_loc_idx)
+            enddo
+         enddo
+      enddo
+
+      do i2 = iupper2,ilower2,-1
+         do i1 = ilower1,iupper1
+            do i0 = ilower0,iupper0
+              call evalsweep2ndorder3d(U,U_gcw,
+     &                                 ilower0,iupper0,
+     &                                 ilower1,iupper1,
+     &                                 ilower2,iupper2,
+     &                                 i0,i1,i2,
+     &                                 dlower0,dupper0,
+     &                                 dlower1,dupper1,
+     &                                 dlower2,dupper2,
+     &                                 dx,
+     &                                 patch_touches_bdry,
+     &                                 touches_wall_loc_idx)
+            enddo
+         enddo
+      enddo
+
+      do i2 = ilower2,iupper2
+         do i1 = iupper1,ilower1,-1
+            do i0 = iupper0,ilower0,-1
+              call evalsweep2ndorder3d(U,U_gcw,
+     &                                 ilower0,iupper0,
+     &                                 ilower1,iupper1,
+     &                                 ilower2,iupper2,
+     &                                 i0,i1,i2,
+     &                                 dlower0,dupper0,
+     &                                 dlower1,dupper1,
+     &                                 dlower2,dupper2,
+     &                                 dx,
+     &                                 patch_touches_bdry,
+     &                                 touches_wall_loc_idx)
+            enddo
+         enddo
+      enddo
+
+      do i2 = iupper2,ilower2,-1
+         do i1 = iupper1,ilower1,-1
+            do i0 = ilower0,iupper0
+              call evalsweep2ndorder3d(U,U_gcw,
+     &                                 ilower0,iupper0,
+     &                                 ilower1,iupper1,
+     &                                 ilower2,iupper2,
+     &                                 i0,i1,i2,
+     &                                 dlower0,dupper0,
+     &                                 dlower1,dupper1,
+     &                                 dlower2,dupper2,
+     &                                 dx,
+     &                                 patch_touches_bdry,
+     &                                 touches_wall_loc_idx)
+            enddo
+         enddo
+      enddo
+
+      do i2 = iupper2,ilower2,-1
+         do i1 = ilower1,iupper1
+            do i0 = iupper0,ilower0,-1
+              call evalsweep2ndorder3d(U,U_gcw,
+     &                                 ilower0,iupper0,
+     &                                 ilower1,iupper1,
+     &                                 ilower2,iupper2,
+     &                                 i0,i1,i2,
+     &                                 dlower0,dupper0,
+     &                                 dlower1,dupper1,
+     &                                 dlower2,dupper2,
+     &                                 dx,
+     &                                 patch_touches_bdry,
+     &                                 touches_wall_loc_idx)
+            enddo
+         enddo
+      enddo
+
+      do i2 = iupper2,ilower2,-1
+         do i1 = iupper1,ilower1,-1
+            do i0 = iupper0,ilower0,-1
+              call evalsweep2ndorder3d(U,U_gcw,
+     &                                 ilower0,iupper0,
+     &                                 ilower1,iupper1,
+     &                                 ilower2,iupper2,
+     &                                 i0,i1,i2,
+     &                                 dlower0,dupper0,
+     &                                 dlower1,dupper1,
+     &                                 dlower2,dupper2,
+     &                                 dx,
+     &                                 patch_touches_bdry,
+     &                                 touches_wall_loc_idx)
+            enddo
+         enddo
+      enddo
+
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute the upwind neighbor value and effective grid spacing used
+c     by the second-order fast sweeping algorithm along one direction.
+c
+c     The second-order one-sided difference (3U_i - 4U_{i-1} + U_{i-2})/2h
+c     is written as (U_i - Ut)/ht with Ut = (4U_{i-1} - U_{i-2})/3 and
+c     ht = 2h/3, so that the first-order update formulas can be reused.
+c     The first-order neighbor value is used if the second-order stencil
+c     crosses the interface or is not monotone.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine upwind2ndorder3d(
+     &     Um1,Um2,Up1,Up2,
+     &     sgn,h,
+     &     Ut,ht)
+c
+      implicit none
+include(TOP_SRCDIR/src/fortran/const.i)dnl
+c
+c     Input.
+c
+      REAL Um1,Um2,Up1,Up2
+      REAL sgn,h
+c
+c     Output.
+c
+      REAL Ut,ht
+c
+c     Local variables.
+c
+      REAL U1,U2
+
+      if (sgn*Um1 .le. sgn*Up1) then
+        U1 = Um1
+        U2 = Um2
+      else
+        U1 = Up1
+        U2 = Up2
+      endif
+
+      if ((sgn*U2 .ge. zero) .and. (sgn*U2 .le. sgn*U1)) then
+        Ut = (four*U1 - U2)/three
+        ht = two*h/three
+      else
+        Ut = U1
+        ht = h
+      endif
+
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute second-order fast sweep solution at a given grid cell
+c
+c     Cells adjacent to the interface keep the values set when locating
+c     the interface, and cells near physical boundaries use the
+c     first-order update.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine evalsweep2ndorder3d(
+     &     U,U_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     i0,i1,i2,
+     &     dlower0,dupper0,
+     &     dlower1,dupper1,
+     &     dlower2,dupper2,
+     &     dx,
+     &     patch_touches_bdry,
+     &     touches_wall_loc_idx)
+c
+      implicit none
+include(TOP_SRCDIR/src/fortran/const.i)dnl
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER dlower0,dupper0
+      INTEGER dlower1,dupper1
+      INTEGER dlower2,dupper2
+      INTEGER U_gcw
+      INTEGER patch_touches_bdry
+
+c
+c     Input/Output.
+c
+      REAL U(CELL3d(ilower,iupper,U_gcw))
+      REAL dx(0:NDIM-1)
+      INTEGER touches_wall_loc_idx(0:2*NDIM - 1)
+c
+c     Local variables.
+c
+      REAL    sgn
+      INTEGER i0,i1,i2
+      REAL    a,b,c
+      REAL    a1,a2,a3
+      REAL    hx,hy,hz
+      REAL    h1,h2,h3
+      REAL    Q,R,S
+      REAL    dtil,dbar
+
+      if (patch_touches_bdry .eq. 1) then
+        if ((i0 .le. dlower0+1) .or. (i0 .ge. dupper0-1) .or.
+     &      (i1 .le. dlower1+1) .or. (i1 .ge. dupper1-1) .or.
+     &      (i2 .le. dlower2+1) .or. (i2 .ge. dupper2-1)) then
+          call evalsweep1storder3d(U,U_gcw,
+     &                             ilower0,iupper0,
+     &                             ilower1,iupper1,
+     &                             ilower2,iupper2,
+     &                             i0,i1,i2,
+     &                             dlower0,dupper0,
+     &                             dlower1,dupper1,
+     &                             dlower2,dupper2,
+     &                             dx,
+     &                             patch_touches_bdry,
+     &                             touches_wall_loc_idx)
+          return
+        endif
+      endif
+
+      if (U(i0,i1,i2) .eq. zero) return
+      sgn = sign(one,U(i0,i1,i2))
+
+c     Keep cells adjacent to the interface fixed.
+      if ((sgn*U(i0-1,i1,i2) .le. zero)
+     &    .or. (sgn*U(i0+1,i1,i2) .le. zero)
+     &    .or. (sgn*U(i0,i1-1,i2) .le. zero)
+     &    .or. (sgn*U(i0,i1+1,i2) .le. zero)
+     &    .or. (sgn*U(i0,i1,i2-1) .le. zero)
+     &    .or. (sgn*U(i0,i1,i2+1) .le. zero)) return
+
+      call upwind2ndorder3d(U(i0-1,i1,i2),U(i0-2,i1,i2),
+     &                      U(i0+1,i1,i2),U(i0+2,i1,i2),
+     &                      sgn,dx(0),a,hx)
+      call upwind2ndorder3d(U(i0,i1-1,i2),U(i0,i1-2,i2),
+     &                      U(i0,i1+1,i2),U(i0,i1+2,i2),
+     &                      sgn,dx(1),b,hy)
+      call upwind2ndorder3d(U(i0,i1,i2-1),U(i0,i1,i2-2),
+     &                      U(i0,i1,i2+1),U(i0,i1,i2+2),
+     &                      sgn,dx(2),c,hz)
+
+c     Additional sorting step for 3D
+      if (sgn*a .le. sgn*b) then
+        if (sgn*a .le. sgn*c) then
+          if(sgn*b .le. sgn*c) then
+            a1 = a; a2 = b; a3 = c
+            h1 = hx; h2 = hy; h3 = hz
+          else
+            a1 = a; a2 = c; a3 = b
+            h1 = hx; h2 = hz; h3 = hy
+          endif
+        else
+          a1 = c; a2 = a; a3 = b
+          h1 = hz; h2 = hx; h3 = hy
+        endif
+      else
+        if (sgn*b .le. sgn*c) then
+          if (sgn*a .le. sgn*c) then
+            a1 = b; a2 = a; a3 = c
+            h1 = hy; h2 = hx; h3 = hz
+          else
+            a1 = b; a2 = c; a3 = a
+            h1 = hy; h2 = hz; h3 = hx
+          endif
+        else
+          a1 = c; a2 = b; a3 = a
+          h1 = hz; h2 = hy; h3 = hx
+        endif
+      endif
+
+c     Algorithm to find dbar
+      dtil = a1 + sgn*h1
+      if (sgn*dtil .le. sgn*a2) then
+        dbar = dtil
+      else
+        Q = h1*h1 + h2*h2
+        R = -2.d0*(h2*h2*a1 + h1*h1*a2)
+        S = h2*h2*a1*a1 + h1*h1*a2*a2 - h1*h1*h2*h2
+        dtil = (-R + sgn*sqrt(R*R-4.d0*Q*S))/(2.d0*Q)
+      endif
+
+      if (sgn*dtil .lt. sgn*a3) then
+        dbar = dtil
+      else
+        Q = 1.d0/(h1*h1) + 1.d0/(h2*h2) + 1.d0/(h3*h3)
+        R = -2.d0*(a1/(h1*h1)+a2/(h2*h2)+a3/(h3*h3))
+        S = a1*a1/(h1*h1)+a2*a2/(h2*h2)+a3*a3/(h3*h3)-1.d0
+        dtil = (-R + sgn*sqrt(R*R-4.d0*Q*S))/(2.d0*Q)
+        dbar = dtil
+      endif
+
+      U(i0,i1,i2) = dbar
+
+      return
+      end
+
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Carry out first order relaxation scheme using Gauss Seidel updates
+c     over the cells tlower..tupper of the patch
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
@@ -461,6 +857,9 @@ c
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     ilower2,iupper2,
+     &     tlower0,tupper0,
+     &     tlower1,tupper1,
+     &     tlower2,tupper2,
      &     dx,
      &     dir)
 c
@@ -473,6 +872,9 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
+      INTEGER tlower0,tupper0
+      INTEGER tlower1,tupper1
+      INTEGER tlower2,tupper2
       INTEGER U_gcw,V_gcw
       INTEGER dir
 
@@ -488,9 +890,9 @@ c
       INTEGER i0,i1,i2
 
       if (dir .eq. 0) then
-        do i2 = ilower2,iupper2
-          do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
+        do i2 = tlower2,tupper2
+          do i1 = tlower1,tupper1
+            do i0 = tlower0,tupper0
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -500,9 +902,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 1) then
-        do i2 = ilower2,iupper2
-          do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tlower2,tupper2
+          do i1 = tlower1,tupper1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -512,9 +914,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 2) then
-        do i2 = ilower2,iupper2
-          do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
+        do i2 = tlower2,tupper2
+          do i1 = tupper1,tlower1,-1
+            do i0 = tlower0,tupper0
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -524,9 +926,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 3) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
+        do i2 = tupper2,tlower2,-1
+          do i1 = tlower1,tupper1
+            do i0 = tlower0,tupper0
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -536,9 +938,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 4) then
-        do i2 = ilower2,iupper2
-          do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tlower2,tupper2
+          do i1 = tupper1,tlower1,-1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -548,9 +950,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 5) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tupper2,tlower2,-1
+          do i1 = tlower1,tupper1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -560,9 +962,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 6) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
+        do i2 = tupper2,tlower2,-1
+          do i1 = tupper1,tlower1,-1
+            do i0 = tlower0,tupper0
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -572,9 +974,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 7) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tupper2,tlower2,-1
+          do i1 = tupper1,tlower1,-1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -663,6 +1065,7 @@ c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Carry out third order relaxation scheme using Gauss Seidel updates
+c     over the cells tlower..tupper of the patch
 c     NOTE: this scheme between third and fourth s
 c     order near the interface and second order everywhere else
 c
@@ -677,6 +1080,9 @@ c
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     ilower2,iupper2,
+     &     tlower0,tupper0,
+     &     tlower1,tupper1,
+     &     tlower2,tupper2,
      &     dx,
      &     dir)
 c
@@ -689,6 +1095,9 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
+      INTEGER tlower0,tupper0
+      INTEGER tlower1,tupper1
+      INTEGER tlower2,tupper2
       INTEGER U_gcw,V_gcw
       INTEGER dir
 
@@ -704,9 +1113,9 @@ c
       INTEGER i0,i1,i2
 
       if (dir .eq. 0) then
-        do i2 = ilower2,iupper2
-          do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
+        do i2 = tlower2,tupper2
+          do i1 = tlower1,tupper1
+            do i0 = tlower0,tupper0
                 call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -716,9 +1125,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 1) then
-        do i2 = ilower2,iupper2
-          do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tlower2,tupper2
+          do i1 = tlower1,tupper1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -728,9 +1137,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 2) then
-        do i2 = ilower2,iupper2
-          do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
+        do i2 = tlower2,tupper2
+          do i1 = tupper1,tlower1,-1
+            do i0 = tlower0,tupper0
                 call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -740,9 +1149,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 3) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
+        do i2 = tupper2,tlower2,-1
+          do i1 = tlower1,tupper1
+            do i0 = tlower0,tupper0
                 call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -752,9 +1161,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 4) then
-        do i2 = ilower2,iupper2
-          do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tlower2,tupper2
+          do i1 = tupper1,tlower1,-1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -764,9 +1173,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 5) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tupper2,tlower2,-1
+          do i1 = tlower1,tupper1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -776,9 +1185,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 6) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
+        do i2 = tupper2,tlower2,-1
+          do i1 = tupper1,tlower1,-1
+            do i0 = tlower0,tupper0
                 call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -788,9 +1197,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 7) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
+        do i2 = tupper2,tlower2,-1
+          do i1 = tupper1,tlower1,-1
+            do i0 = tupper0,tlower0,-1
                 call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
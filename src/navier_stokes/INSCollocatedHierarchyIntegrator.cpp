@@ -98,6 +98,7 @@
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/PoissonSolver.h"
+#include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/ibtk_enums.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
@@ -765,60 +766,60 @@ INSCollocatedHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHie
     }
 
     // Register variables for plotting.
-    if (d_visit_writer)
+    if (d_visit_writer || d_reduced_writer)
     {
         if (d_output_U)
         {
-            d_visit_writer->registerPlotQuantity("U", "VECTOR", d_U_current_idx, 0, d_U_scale);
+            registerPlotQuantity("U", "VECTOR", d_U_current_idx, 0, d_U_scale);
             for (unsigned int d = 0; d < NDIM; ++d)
             {
-                if (d == 0) d_visit_writer->registerPlotQuantity("U_x", "SCALAR", d_U_current_idx, d, d_U_scale);
-                if (d == 1) d_visit_writer->registerPlotQuantity("U_y", "SCALAR", d_U_current_idx, d, d_U_scale);
-                if (d == 2) d_visit_writer->registerPlotQuantity("U_z", "SCALAR", d_U_current_idx, d, d_U_scale);
+                if (d == 0) registerPlotQuantity("U_x", "SCALAR", d_U_current_idx, d, d_U_scale);
+                if (d == 1) registerPlotQuantity("U_y", "SCALAR", d_U_current_idx, d, d_U_scale);
+                if (d == 2) registerPlotQuantity("U_z", "SCALAR", d_U_current_idx, d, d_U_scale);
             }
         }
 
         if (d_output_P)
         {
-            d_visit_writer->registerPlotQuantity("P", "SCALAR", d_P_current_idx, 0, d_P_scale);
+            registerPlotQuantity("P", "SCALAR", d_P_current_idx, 0, d_P_scale);
         }
 
         if (d_F_fcn && d_output_F)
         {
-            d_visit_writer->registerPlotQuantity("F", "VECTOR", d_F_current_idx, 0, d_F_scale);
+            registerPlotQuantity("F", "VECTOR", d_F_current_idx, 0, d_F_scale);
             for (unsigned int d = 0; d < NDIM; ++d)
             {
-                if (d == 0) d_visit_writer->registerPlotQuantity("F_x", "SCALAR", d_F_current_idx, d, d_F_scale);
-                if (d == 1) d_visit_writer->registerPlotQuantity("F_y", "SCALAR", d_F_current_idx, d, d_F_scale);
-                if (d == 2) d_visit_writer->registerPlotQuantity("F_z", "SCALAR", d_F_current_idx, d, d_F_scale);
+                if (d == 0) registerPlotQuantity("F_x", "SCALAR", d_F_current_idx, d, d_F_scale);
+                if (d == 1) registerPlotQuantity("F_y", "SCALAR", d_F_current_idx, d, d_F_scale);
+                if (d == 2) registerPlotQuantity("F_z", "SCALAR", d_F_current_idx, d, d_F_scale);
             }
         }
 
         if (d_Q_fcn && d_output_Q)
         {
-            d_visit_writer->registerPlotQuantity("Q", "SCALAR", d_Q_current_idx, 0, d_Q_scale);
+            registerPlotQuantity("Q", "SCALAR", d_Q_current_idx, 0, d_Q_scale);
         }
 
         if (d_output_Omega)
         {
 #if (NDIM == 2)
-            d_visit_writer->registerPlotQuantity("Omega", "SCALAR", d_Omega_idx, 0, d_Omega_scale);
+            registerPlotQuantity("Omega", "SCALAR", d_Omega_idx, 0, d_Omega_scale);
 #endif
 #if (NDIM == 3)
-            d_visit_writer->registerPlotQuantity("Omega", "VECTOR", d_Omega_idx, 0, d_Omega_scale);
+            registerPlotQuantity("Omega", "VECTOR", d_Omega_idx, 0, d_Omega_scale);
             for (unsigned int d = 0; d < NDIM; ++d)
             {
-                if (d == 0) d_visit_writer->registerPlotQuantity("Omega_x", "SCALAR", d_Omega_idx, d, d_Omega_scale);
-                if (d == 1) d_visit_writer->registerPlotQuantity("Omega_y", "SCALAR", d_Omega_idx, d, d_Omega_scale);
-                if (d == 2) d_visit_writer->registerPlotQuantity("Omega_z", "SCALAR", d_Omega_idx, d, d_Omega_scale);
+                if (d == 0) registerPlotQuantity("Omega_x", "SCALAR", d_Omega_idx, d, d_Omega_scale);
+                if (d == 1) registerPlotQuantity("Omega_y", "SCALAR", d_Omega_idx, d, d_Omega_scale);
+                if (d == 2) registerPlotQuantity("Omega_z", "SCALAR", d_Omega_idx, d, d_Omega_scale);
             }
 #endif
         }
 
         if (d_output_Div_U)
         {
-            d_visit_writer->registerPlotQuantity("Div U", "SCALAR", d_Div_U_idx, 0, d_Div_U_scale);
-            d_visit_writer->registerPlotQuantity("Div u_ADV", "SCALAR", d_Div_u_ADV_idx, 0, d_Div_U_scale);
+            registerPlotQuantity("Div U", "SCALAR", d_Div_U_idx, 0, d_Div_U_scale);
+            registerPlotQuantity("Div u_ADV", "SCALAR", d_Div_u_ADV_idx, 0, d_Div_U_scale);
         }
     }
 
@@ -1691,6 +1692,11 @@ INSCollocatedHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
 #endif
     const int finest_hier_level = hierarchy->getFinestLevelNumber();
 
+    // Discard boundary condition coefficients cached on the old hierarchy.
+    RobinPhysBdryPatchStrategy* fill_after_regrid_phys_bdry_bc_op =
+        dynamic_cast<RobinPhysBdryPatchStrategy*>(d_fill_after_regrid_phys_bdry_bc_op);
+    if (fill_after_regrid_phys_bdry_bc_op) fill_after_regrid_phys_bdry_bc_op->clearBcCoefCache();
+
     // Reset the hierarchy operations objects for the new hierarchy configuration.
     d_hier_cc_data_ops->setPatchHierarchy(hierarchy);
     d_hier_cc_data_ops->resetLevels(0, finest_hier_level);
@@ -2081,10 +2087,10 @@ INSCollocatedHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double c
     P_problem_coefs.setCZero();
     P_problem_coefs.setDConstant(-1.0);
 
-    // Ensure that solver components are appropriately reinitialized when the
-    // time step size changes.
+    // Ensure that solver components are appropriately reinitialized at the
+    // initial time and updated when the time step size changes.
     const bool dt_change = initial_time || !MathUtilities<double>::equalEps(dt, d_dt_previous[0]);
-    if (dt_change)
+    if (initial_time)
     {
         d_velocity_solver_needs_init = true;
     }
@@ -2177,6 +2183,14 @@ INSCollocatedHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double c
         d_velocity_solver->setSolutionTime(new_time);
         d_velocity_solver->setTimeInterval(current_time, new_time);
         LinearSolver* p_velocity_solver = dynamic_cast<LinearSolver*>(d_velocity_solver.getPointer());
+        if (dt_change && !d_velocity_solver_needs_init)
+        {
+            if (d_enable_logging)
+                plog << d_object_name << "::preprocessIntegrateHierarchy(): updating "
+                                         "velocity subdomain solver coefficients"
+                     << std::endl;
+            d_velocity_solver_needs_init = !d_velocity_solver->updateCoefficients();
+        }
         if (d_velocity_solver_needs_init)
         {
             if (d_enable_logging)
@@ -116,8 +116,10 @@
 #include "ibtk/LinearSolver.h"
 #include "ibtk/NewtonKrylovSolver.h"
 #include "ibtk/PoissonSolver.h"
+#include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/SCPoissonSolverManager.h"
 #include "ibtk/SideDataSynchronization.h"
+#include "ibtk/SolutionHistoryInitialGuess.h"
 #include "ibtk/ibtk_enums.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
@@ -530,6 +532,12 @@ INSStaggeredHierarchyIntegrator::INSStaggeredHierarchyIntegrator(const std::stri
     }
     if (!d_stokes_solver_db) d_stokes_solver_db = new MemoryDatabase("stokes_solver_db");
 
+    // Setup solution history initial guess options.
+    if (input_db->keyExists("stokes_initial_guess_db"))
+        d_stokes_initial_guess_db = input_db->getDatabase("stokes_initial_guess_db");
+    if (input_db->keyExists("pressure_initial_guess_db"))
+        d_pressure_initial_guess_db = input_db->getDatabase("pressure_initial_guess_db");
+
     if (input_db->keyExists("stokes_precond_type"))
     {
         d_stokes_precond_type = input_db->getString("stokes_precond_type");
@@ -679,6 +687,22 @@ INSStaggeredHierarchyIntegrator::getPressureSubdomainSolver()
                                                                  d_object_name + "::pressure_sub_precond",
                                                                  d_pressure_sub_precond_db,
                                                                  "pressure_sub_pc_");
+        if (d_pressure_initial_guess_db)
+        {
+            // Solution history initial guesses require a solver that accepts
+            // a nonzero initial guess.
+            if (dynamic_cast<KrylovLinearSolver*>(d_pressure_solver.getPointer()))
+            {
+                d_pressure_solver->setInitialGuessEngine(new SolutionHistoryInitialGuess(
+                    d_object_name + "::pressure_initial_guess", d_pressure_initial_guess_db));
+            }
+            else
+            {
+                TBOX_WARNING(d_object_name << "::getPressureSubdomainSolver():\n"
+                                           << "  pressure_initial_guess_db requires a Krylov pressure solver;\n"
+                                           << "  solution history initial guesses are disabled." << std::endl);
+            }
+        }
         d_pressure_solver_needs_init = true;
     }
     return d_pressure_solver;
@@ -713,6 +737,11 @@ INSStaggeredHierarchyIntegrator::getStokesSolver()
                                                                        d_object_name + "::stokes_sub_precond",
                                                                        d_stokes_sub_precond_db,
                                                                        "stokes_sub_pc_");
+        if (d_stokes_initial_guess_db)
+        {
+            d_stokes_solver->setInitialGuessEngine(new SolutionHistoryInitialGuess(
+                d_object_name + "::stokes_initial_guess", d_stokes_initial_guess_db));
+        }
         d_stokes_solver_needs_init = true;
     }
     return d_stokes_solver;
@@ -953,65 +982,65 @@ INSStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHier
     }
 
     // Register variables for plotting.
-    if (d_visit_writer)
+    if (d_visit_writer || d_reduced_writer)
     {
         if (d_output_U)
         {
-            d_visit_writer->registerPlotQuantity("U", "VECTOR", d_U_cc_idx, 0, d_U_scale);
+            registerPlotQuantity("U", "VECTOR", d_U_cc_idx, 0, d_U_scale);
             for (unsigned int d = 0; d < NDIM; ++d)
             {
-                if (d == 0) d_visit_writer->registerPlotQuantity("U_x", "SCALAR", d_U_cc_idx, d, d_U_scale);
-                if (d == 1) d_visit_writer->registerPlotQuantity("U_y", "SCALAR", d_U_cc_idx, d, d_U_scale);
-                if (d == 2) d_visit_writer->registerPlotQuantity("U_z", "SCALAR", d_U_cc_idx, d, d_U_scale);
+                if (d == 0) registerPlotQuantity("U_x", "SCALAR", d_U_cc_idx, d, d_U_scale);
+                if (d == 1) registerPlotQuantity("U_y", "SCALAR", d_U_cc_idx, d, d_U_scale);
+                if (d == 2) registerPlotQuantity("U_z", "SCALAR", d_U_cc_idx, d, d_U_scale);
             }
         }
 
         if (d_output_P)
         {
-            d_visit_writer->registerPlotQuantity("P", "SCALAR", d_P_current_idx, 0, d_P_scale);
+            registerPlotQuantity("P", "SCALAR", d_P_current_idx, 0, d_P_scale);
         }
 
         if (d_F_fcn && d_output_F)
         {
-            d_visit_writer->registerPlotQuantity("F", "VECTOR", d_F_cc_idx, 0, d_F_scale);
+            registerPlotQuantity("F", "VECTOR", d_F_cc_idx, 0, d_F_scale);
             for (unsigned int d = 0; d < NDIM; ++d)
             {
-                if (d == 0) d_visit_writer->registerPlotQuantity("F_x", "SCALAR", d_F_cc_idx, d, d_F_scale);
-                if (d == 1) d_visit_writer->registerPlotQuantity("F_y", "SCALAR", d_F_cc_idx, d, d_F_scale);
-                if (d == 2) d_visit_writer->registerPlotQuantity("F_z", "SCALAR", d_F_cc_idx, d, d_F_scale);
+                if (d == 0) registerPlotQuantity("F_x", "SCALAR", d_F_cc_idx, d, d_F_scale);
+                if (d == 1) registerPlotQuantity("F_y", "SCALAR", d_F_cc_idx, d, d_F_scale);
+                if (d == 2) registerPlotQuantity("F_z", "SCALAR", d_F_cc_idx, d, d_F_scale);
             }
         }
 
         if (d_Q_fcn && d_output_Q)
         {
-            d_visit_writer->registerPlotQuantity("Q", "SCALAR", d_Q_current_idx, 0, d_Q_scale);
+            registerPlotQuantity("Q", "SCALAR", d_Q_current_idx, 0, d_Q_scale);
         }
 
         if (d_output_Omega)
         {
 #if (NDIM == 2)
-            d_visit_writer->registerPlotQuantity("Omega", "SCALAR", d_Omega_idx, 0, d_Omega_scale);
+            registerPlotQuantity("Omega", "SCALAR", d_Omega_idx, 0, d_Omega_scale);
 #endif
 #if (NDIM == 3)
-            d_visit_writer->registerPlotQuantity("Omega", "VECTOR", d_Omega_idx, 0, d_Omega_scale);
+            registerPlotQuantity("Omega", "VECTOR", d_Omega_idx, 0, d_Omega_scale);
             for (unsigned int d = 0; d < NDIM; ++d)
             {
-                if (d == 0) d_visit_writer->registerPlotQuantity("Omega_x", "SCALAR", d_Omega_idx, d, d_Omega_scale);
-                if (d == 1) d_visit_writer->registerPlotQuantity("Omega_y", "SCALAR", d_Omega_idx, d, d_Omega_scale);
-                if (d == 2) d_visit_writer->registerPlotQuantity("Omega_z", "SCALAR", d_Omega_idx, d, d_Omega_scale);
+                if (d == 0) registerPlotQuantity("Omega_x", "SCALAR", d_Omega_idx, d, d_Omega_scale);
+                if (d == 1) registerPlotQuantity("Omega_y", "SCALAR", d_Omega_idx, d, d_Omega_scale);
+                if (d == 2) registerPlotQuantity("Omega_z", "SCALAR", d_Omega_idx, d, d_Omega_scale);
             }
 #endif
         }
 
         if (d_output_Div_U)
         {
-            d_visit_writer->registerPlotQuantity("Div U", "SCALAR", d_Div_U_idx, 0, d_Div_U_scale);
+            registerPlotQuantity("Div U", "SCALAR", d_Div_U_idx, 0, d_Div_U_scale);
         }
 
         if (d_output_EE)
         {
             registerVariable(d_EE_idx, d_EE_var, no_ghosts, getCurrentContext());
-            d_visit_writer->registerPlotQuantity("EE", "TENSOR", d_EE_idx);
+            registerPlotQuantity("EE", "TENSOR", d_EE_idx);
         }
     }
 
@@ -1322,7 +1351,10 @@ INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_time,
     // Setup the solution and right-hand-side vectors.
     setupSolverVectors(d_sol_vec, d_rhs_vec, current_time, new_time, cycle_num);
 
-    // Solve for u(n+1), p(n+1/2).
+    // Solve for u(n+1), p(n+1/2), starting from the solution history initial
+    // guess when one is available.
+    Pointer<SolutionHistoryInitialGuess> stokes_initial_guess = d_stokes_solver->getInitialGuessEngine();
+    if (stokes_initial_guess) stokes_initial_guess->computeInitialGuess(*d_sol_vec, *d_rhs_vec);
     d_stokes_solver->solveSystem(*d_sol_vec, *d_rhs_vec);
     if (d_enable_logging)
         plog << d_object_name
@@ -1333,6 +1365,7 @@ INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_time,
              << "::integrateHierarchy(): stokes solve residual norm        = " << d_stokes_solver->getResidualNorm()
              << "\n";
     if (d_explicitly_remove_nullspace) removeNullSpace(d_sol_vec);
+    if (stokes_initial_guess) stokes_initial_guess->storeSolution(*d_sol_vec, *d_rhs_vec);
 
     // Reset the solution and right-hand-side vectors.
     resetSolverVectors(d_sol_vec, d_rhs_vec, current_time, new_time, cycle_num);
@@ -1947,6 +1980,11 @@ INSStaggeredHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
 #endif
     const int finest_hier_level = hierarchy->getFinestLevelNumber();
 
+    // Discard boundary condition coefficients cached on the old hierarchy.
+    RobinPhysBdryPatchStrategy* fill_after_regrid_phys_bdry_bc_op =
+        dynamic_cast<RobinPhysBdryPatchStrategy*>(d_fill_after_regrid_phys_bdry_bc_op);
+    if (fill_after_regrid_phys_bdry_bc_op) fill_after_regrid_phys_bdry_bc_op->clearBcCoefCache();
+
     // Reset the hierarchy operations objects for the new hierarchy configuration.
     d_hier_cc_data_ops->setPatchHierarchy(hierarchy);
     d_hier_cc_data_ops->resetLevels(0, finest_hier_level);
@@ -2006,6 +2044,9 @@ INSStaggeredHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     d_velocity_solver_needs_init = true;
     d_pressure_solver_needs_init = true;
     d_stokes_solver_needs_init = true;
+
+    // Discard the solution histories, which are defined on the old hierarchy.
+    resetInitialGuessEngines();
     return;
 } // resetHierarchyConfigurationSpecialized
 
@@ -2353,15 +2394,18 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
     P_problem_coefs.setCZero();
     P_problem_coefs.setDConstant(rho == 0.0 ? -1.0 : -1.0 / rho);
 
-    // Ensure that solver components are appropriately reinitialized when the
-    // time step size changes.
+    // Ensure that solver components are appropriately reinitialized at the
+    // initial time and updated when the time step size changes.
     const bool dt_change = initial_time || !MathUtilities<double>::equalEps(dt, d_dt_previous[0]);
-    if (dt_change)
+    if (initial_time)
     {
         d_velocity_solver_needs_init = true;
         d_stokes_solver_needs_init = true;
     }
 
+    // Solution histories are only valid for a fixed operator.
+    if (dt_change) resetInitialGuessEngines();
+
     // Setup solver vectors.
     const bool has_velocity_nullspace = d_normalize_velocity && MathUtilities<double>::equalEps(rho, 0.0);
     const bool has_pressure_nullspace = d_normalize_pressure;
@@ -2496,6 +2540,14 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
         d_velocity_solver->setPhysicalBcCoefs(d_U_star_bc_coefs);
         d_velocity_solver->setSolutionTime(new_time);
         d_velocity_solver->setTimeInterval(current_time, new_time);
+        if (dt_change && !d_velocity_solver_needs_init)
+        {
+            if (d_enable_logging)
+                plog << d_object_name << "::preprocessIntegrateHierarchy(): updating "
+                                         "velocity subdomain solver coefficients"
+                     << std::endl;
+            d_velocity_solver_needs_init = !d_velocity_solver->updateCoefficients();
+        }
         if (d_velocity_solver_needs_init)
         {
             if (d_enable_logging)
@@ -2594,6 +2646,14 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
             TBOX_WARNING("No special BCs set for the preconditioner \n");
         }
     }
+    if (dt_change && !d_stokes_solver_needs_init)
+    {
+        if (d_enable_logging)
+            plog << d_object_name << "::preprocessIntegrateHierarchy(): updating "
+                                     "incompressible Stokes solver coefficients"
+                 << std::endl;
+        d_stokes_solver_needs_init = !d_stokes_solver->updateCoefficients();
+    }
     if (d_stokes_solver_needs_init)
     {
         if (d_enable_logging)
@@ -2612,6 +2672,20 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
     return;
 } // reinitializeOperatorsAndSolvers
 
+void
+INSStaggeredHierarchyIntegrator::resetInitialGuessEngines()
+{
+    if (d_stokes_solver && d_stokes_solver->getInitialGuessEngine())
+    {
+        d_stokes_solver->getInitialGuessEngine()->reset();
+    }
+    if (d_pressure_solver && d_pressure_solver->getInitialGuessEngine())
+    {
+        d_pressure_solver->getInitialGuessEngine()->reset();
+    }
+    return;
+} // resetInitialGuessEngines
+
 void
 INSStaggeredHierarchyIntegrator::computeDivSourceTerm(const int F_idx, const int Q_idx, const int U_idx)
 {
@@ -208,6 +208,12 @@ StaggeredStokesBlockPreconditioner::deallocateSolverState()
     return;
 } // deallocateSolverState
 
+bool
+StaggeredStokesBlockPreconditioner::updateCoefficients()
+{
+    return d_is_initialized;
+} // updateCoefficients
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void
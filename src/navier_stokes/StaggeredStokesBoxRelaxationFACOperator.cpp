@@ -752,6 +752,39 @@ StaggeredStokesBoxRelaxationFACOperator::deallocateOperatorStateSpecialized(cons
     return;
 } // deallocateOperatorStateSpecialized
 
+bool
+StaggeredStokesBoxRelaxationFACOperator::updateOperatorCoefficientsSpecialized()
+{
+    // Recompute the box operator values on each level of the patch hierarchy,
+    // reusing the existing nonzero structure and symbolic factorization.
+    const Box<NDIM> box(Index<NDIM>(0), Index<NDIM>(0));
+    Pointer<CartesianGridGeometry<NDIM> > geometry = d_hierarchy->getGridGeometry();
+    const double* const dx_coarsest = geometry->getDx();
+    boost::array<double, NDIM> dx;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(ln)->getRatio();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
+        }
+        int ierr;
+        Mat box_op = NULL;
+        buildBoxOperator(box_op, d_U_problem_coefs, box, box, dx);
+        ierr = MatCopy(box_op, d_box_op[ln], SAME_NONZERO_PATTERN);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatDestroy(&box_op);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetReusePreconditioner(d_box_ksp[ln], PETSC_FALSE);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetUp(d_box_ksp[ln]);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetReusePreconditioner(d_box_ksp[ln], PETSC_TRUE);
+        IBTK_CHKERRQ(ierr);
+    }
+    return true;
+} // updateOperatorCoefficientsSpecialized
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
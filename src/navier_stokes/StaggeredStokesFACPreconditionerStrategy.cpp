@@ -990,8 +990,41 @@ StaggeredStokesFACPreconditionerStrategy::deallocateOperatorState()
     return;
 } // deallocateOperatorState
 
+bool
+StaggeredStokesFACPreconditionerStrategy::updateOperatorCoefficients()
+{
+    if (!d_is_initialized) return false;
+
+    // Perform implementation-specific updates.
+    if (!updateOperatorCoefficientsSpecialized()) return false;
+
+    // Update the coarse level solver, reinitializing it only when it does not
+    // support coefficient updates.
+    if (!d_coarse_solver_init_subclass && d_coarse_solver)
+    {
+        d_coarse_solver->setSolutionTime(d_solution_time);
+        d_coarse_solver->setTimeInterval(d_current_time, d_new_time);
+        d_coarse_solver->setVelocityPoissonSpecifications(d_U_problem_coefs);
+        d_coarse_solver->setPhysicalBcCoefs(d_U_bc_coefs, d_P_bc_coef);
+        d_coarse_solver->setPhysicalBoundaryHelper(d_bc_helper);
+        d_coarse_solver->setHomogeneousBc(true);
+        if (!d_coarse_solver->updateCoefficients())
+        {
+            d_coarse_solver->initializeSolverState(*getLevelSAMRAIVectorReal(*d_solution, d_coarsest_ln),
+                                                   *getLevelSAMRAIVectorReal(*d_rhs, d_coarsest_ln));
+        }
+    }
+    return true;
+} // updateOperatorCoefficients
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+bool
+StaggeredStokesFACPreconditionerStrategy::updateOperatorCoefficientsSpecialized()
+{
+    return false;
+} // updateOperatorCoefficientsSpecialized
+
 void
 StaggeredStokesFACPreconditionerStrategy::xeqScheduleProlongation(const std::pair<int, int>& dst_idxs,
                                                                   const std::pair<int, int>& src_idxs,
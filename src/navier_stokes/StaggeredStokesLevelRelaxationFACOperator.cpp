@@ -386,6 +386,30 @@ StaggeredStokesLevelRelaxationFACOperator::deallocateOperatorStateSpecialized(co
     return;
 } // deallocateOperatorStateSpecialized
 
+bool
+StaggeredStokesLevelRelaxationFACOperator::updateOperatorCoefficientsSpecialized()
+{
+    // Update the level solvers, reinitializing them only when they do not
+    // support coefficient updates.
+    for (int ln = std::max(0, d_coarsest_ln); ln <= d_finest_ln; ++ln)
+    {
+        Pointer<StaggeredStokesSolver> level_solver = d_level_solvers[ln];
+        if (!level_solver) continue;
+        level_solver->setSolutionTime(d_solution_time);
+        level_solver->setTimeInterval(d_current_time, d_new_time);
+        level_solver->setVelocityPoissonSpecifications(d_U_problem_coefs);
+        level_solver->setPhysicalBcCoefs(d_U_bc_coefs, d_P_bc_coef);
+        level_solver->setPhysicalBoundaryHelper(d_bc_helper);
+        level_solver->setHomogeneousBc(true);
+        if (!level_solver->updateCoefficients())
+        {
+            level_solver->initializeSolverState(*getLevelSAMRAIVectorReal(*d_solution, ln),
+                                                *getLevelSAMRAIVectorReal(*d_rhs, ln));
+        }
+    }
+    return true;
+} // updateOperatorCoefficientsSpecialized
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
@@ -264,6 +264,21 @@ StaggeredStokesPETScLevelSolver::deallocateSolverStateSpecialized()
     return;
 } // deallocateSolverStateSpecialized
 
+bool
+StaggeredStokesPETScLevelSolver::updateCoefficientsSpecialized()
+{
+    StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(d_petsc_mat,
+                                                                     d_U_problem_coefs,
+                                                                     d_U_bc_coefs,
+                                                                     d_new_time,
+                                                                     d_num_dofs_per_proc,
+                                                                     d_u_dof_index_idx,
+                                                                     d_p_dof_index_idx,
+                                                                     d_level,
+                                                                     /*reuse_nonzero_structure*/ true);
+    return true;
+} // updateCoefficientsSpecialized
+
 void
 StaggeredStokesPETScLevelSolver::copyToPETScVec(Vec& petsc_x, SAMRAIVectorReal<NDIM, double>& x)
 {
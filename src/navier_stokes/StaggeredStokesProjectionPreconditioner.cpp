@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <limits>
 #include <ostream>
 #include <string>
 
@@ -59,6 +60,7 @@
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/PoissonSolver.h"
+#include "ibtk/SolutionHistoryInitialGuess.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/Pointer.h"
@@ -109,7 +111,8 @@ StaggeredStokesProjectionPreconditioner::StaggeredStokesProjectionPreconditioner
       d_Phi_var(NULL),
       d_F_Phi_var(NULL),
       d_Phi_scratch_idx(-1),
-      d_F_Phi_idx(-1)
+      d_F_Phi_idx(-1),
+      d_pressure_initial_guess_time(std::numeric_limits<double>::quiet_NaN())
 {
     GeneralSolver::init(object_name, /*homogeneous_bc*/ true);
 
@@ -287,8 +290,25 @@ StaggeredStokesProjectionPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, doub
                          F_P_cc_var);
     d_pressure_solver->setHomogeneousBc(true);
     LinearSolver* p_pressure_solver = dynamic_cast<LinearSolver*>(d_pressure_solver.getPointer());
-    p_pressure_solver->setInitialGuessNonzero(false);
+
+    // The solution history initial guess is only used for the first
+    // application of the preconditioner in each time step.  Later applications
+    // act on Krylov residuals of the same step, which are not well
+    // approximated by the stored right-hand sides.
+    Pointer<SolutionHistoryInitialGuess> pressure_initial_guess = d_pressure_solver->getInitialGuessEngine();
+    if (pressure_initial_guess && MathUtilities<double>::equalEps(d_pressure_initial_guess_time, d_new_time))
+    {
+        pressure_initial_guess.setNull();
+    }
+    const bool use_pressure_initial_guess =
+        pressure_initial_guess && pressure_initial_guess->computeInitialGuess(*Phi_scratch_vec, *F_Phi_vec);
+    p_pressure_solver->setInitialGuessNonzero(use_pressure_initial_guess);
     d_pressure_solver->solveSystem(*Phi_scratch_vec, *F_Phi_vec);
+    if (pressure_initial_guess)
+    {
+        pressure_initial_guess->storeSolution(*Phi_scratch_vec, *F_Phi_vec);
+        d_pressure_initial_guess_time = d_new_time;
+    }
     if (steady_state)
     {
         d_pressure_data_ops->scale(P_idx, -d_U_problem_coefs.getDConstant(), d_F_Phi_idx);
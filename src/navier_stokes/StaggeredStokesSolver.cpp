@@ -43,6 +43,7 @@
 #include "ibamr/StaggeredStokesPhysicalBoundaryHelper.h"
 #include "ibamr/StaggeredStokesSolver.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/SolutionHistoryInitialGuess.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
@@ -60,7 +61,8 @@ StaggeredStokesSolver::StaggeredStokesSolver()
       d_default_U_bc_coef(new LocationIndexRobinBcCoefs<NDIM>("default_U_bc_coef", Pointer<Database>(NULL))),
       d_U_bc_coefs(std::vector<RobinBcCoefStrategy<NDIM>*>(NDIM, d_default_U_bc_coef)),
       d_default_P_bc_coef(new LocationIndexRobinBcCoefs<NDIM>("default_P_bc_coef", Pointer<Database>(NULL))),
-      d_P_bc_coef(d_default_P_bc_coef)
+      d_P_bc_coef(d_default_P_bc_coef),
+      d_initial_guess(NULL)
 {
     // Set some default values.
     d_has_velocity_nullspace = false;
@@ -151,6 +153,19 @@ StaggeredStokesSolver::setPhysicalBoundaryHelper(Pointer<StaggeredStokesPhysical
     return;
 } // setPhysicalBoundaryHelper
 
+void
+StaggeredStokesSolver::setInitialGuessEngine(Pointer<SolutionHistoryInitialGuess> initial_guess)
+{
+    d_initial_guess = initial_guess;
+    return;
+} // setInitialGuessEngine
+
+Pointer<SolutionHistoryInitialGuess>
+StaggeredStokesSolver::getInitialGuessEngine() const
+{
+    return d_initial_guess;
+} // getInitialGuessEngine
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,274 @@
+// Filename: main.cpp
+// Created on 11 Dec 2017 by Boyce Griffith
+
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <CellVariable.h>
+#include <HierarchyDataOpsManager.h>
+#include <HierarchyDataOpsReal.h>
+#include <NodeVariable.h>
+#include <SideVariable.h>
+#include <VariableDatabase.h>
+#include <tbox/SAMRAIManager.h>
+#include <tbox/SAMRAI_MPI.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LEInteractor.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+/*******************************************************************************
+ * This test checks that spreading several quantities with a single call to    *
+ * LDataManager::spread() produces the same Eulerian data as spreading each    *
+ * quantity separately, for cell-, node-, and side-centered data.  For each    *
+ * run, the input filename must be given on the command line:                  *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "ldata_manager.log");
+        Pointer<Database> test_db = app_initializer->getComponentDatabase("LDataManagerTester");
+        const std::string spread_fcn = test_db->getStringWithDefault("spread_fcn", "IB_4");
+        const int num_spreads = test_db->getIntegerWithDefault("num_spreads", 2);
+        const double tol = test_db->getDoubleWithDefault("tolerance", 1.0e-12);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        // The patch hierarchy is refined about the Lagrangian structure.
+        Pointer<IBMethod> ib_method_ops =
+            new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"), /*register_for_restart*/ false);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               ib_method_ops,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+
+        // Create two Eulerian quantities for each data centering.  The
+        // quantities have different depths and ghost cell widths, so that the
+        // combined data used by the multi-quantity spreading operation do not
+        // have the same layout as all of the individual quantities.
+        static const int NUM_CENTERINGS = 3;
+        static const char* const CENTERING_NAMES[NUM_CENTERINGS] = { "CELL", "NODE", "SIDE" };
+        static const int NUM_FIELDS = 2;
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> single_ctx = var_db->getContext("single");
+        Pointer<VariableContext> multi_ctx = var_db->getContext("multi");
+        const int gcw = LEInteractor::getMinimumGhostWidth(spread_fcn);
+        std::vector<std::vector<Pointer<Variable<NDIM> > > > f_vars(NUM_CENTERINGS);
+        std::vector<std::vector<int> > f_single_idxs(NUM_CENTERINGS), f_multi_idxs(NUM_CENTERINGS);
+        std::vector<std::vector<int> > F_depths(NUM_CENTERINGS);
+        for (int c = 0; c < NUM_CENTERINGS; ++c)
+        {
+            for (int k = 0; k < NUM_FIELDS; ++k)
+            {
+                const std::string name = std::string("f_") + CENTERING_NAMES[c] + (k == 0 ? "_0" : "_1");
+                const int depth = (c == 2 ? k + 1 : (k == 0 ? NDIM : 1));
+                Pointer<Variable<NDIM> > f_var;
+                if (c == 0) f_var = new CellVariable<NDIM, double>(name, depth);
+                if (c == 1) f_var = new NodeVariable<NDIM, double>(name, depth);
+                if (c == 2) f_var = new SideVariable<NDIM, double>(name, depth);
+                f_vars[c].push_back(f_var);
+                f_single_idxs[c].push_back(var_db->registerVariableAndContext(f_var, single_ctx, gcw + k));
+                f_multi_idxs[c].push_back(var_db->registerVariableAndContext(f_var, multi_ctx, gcw + k));
+                F_depths[c].push_back(c == 2 ? NDIM * depth : depth);
+            }
+        }
+
+        // Initialize the AMR patch hierarchy and the Lagrangian data.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Set the Lagrangian quantities to smooth functions of position.
+        std::vector<Pointer<LData> > X_data(finest_ln + 1);
+        std::vector<std::vector<std::vector<Pointer<LData> > > > F_data(NUM_CENTERINGS);
+        for (int c = 0; c < NUM_CENTERINGS; ++c)
+        {
+            F_data[c].resize(NUM_FIELDS, std::vector<Pointer<LData> >(finest_ln + 1));
+        }
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+            X_data[ln] = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+            const boost::multi_array_ref<double, 2>& X = *X_data[ln]->getLocalFormVecArray();
+            const unsigned int num_local_nodes = X_data[ln]->getLocalNodeCount();
+            for (int c = 0; c < NUM_CENTERINGS; ++c)
+            {
+                for (int k = 0; k < NUM_FIELDS; ++k)
+                {
+                    const std::string name = std::string("F_") + CENTERING_NAMES[c] + (k == 0 ? "_0" : "_1");
+                    F_data[c][k][ln] = l_data_manager->createLData(name, ln, F_depths[c][k]);
+                    boost::multi_array_ref<double, 2>& F = *F_data[c][k][ln]->getLocalFormVecArray();
+                    for (unsigned int i = 0; i < num_local_nodes; ++i)
+                    {
+                        for (int d = 0; d < F_depths[c][k]; ++d)
+                        {
+                            F[i][d] = std::cos(2.0 * M_PI * (X[i][d % NDIM] + 0.1 * (d + k + c)));
+                        }
+                    }
+                    F_data[c][k][ln]->restoreArrays();
+                }
+            }
+            X_data[ln]->restoreArrays();
+        }
+
+        // Spread the quantities one at a time and all together.  The
+        // quantities are spread several times to check that the Eulerian data
+        // are accumulated correctly when the scratch data are reused.
+        for (int c = 0; c < NUM_CENTERINGS; ++c)
+        {
+            std::vector<Pointer<HierarchyDataOpsReal<NDIM, double> > > f_data_ops(NUM_FIELDS);
+            for (int k = 0; k < NUM_FIELDS; ++k)
+            {
+                for (int ln = 0; ln <= finest_ln; ++ln)
+                {
+                    Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+                    level->allocatePatchData(f_single_idxs[c][k]);
+                    level->allocatePatchData(f_multi_idxs[c][k]);
+                }
+                f_data_ops[k] = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(
+                    f_vars[c][k], patch_hierarchy, true);
+                f_data_ops[k]->setToScalar(f_single_idxs[c][k], 0.0, /*interior_only*/ false);
+                f_data_ops[k]->setToScalar(f_multi_idxs[c][k], 0.0, /*interior_only*/ false);
+            }
+
+            for (int n = 0; n < num_spreads; ++n)
+            {
+                for (int k = 0; k < NUM_FIELDS; ++k)
+                {
+                    for (int ln = 0; ln <= finest_ln; ++ln)
+                    {
+                        if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+                        l_data_manager->spread(
+                            f_single_idxs[c][k], F_data[c][k][ln], X_data[ln], spread_fcn, NULL, ln);
+                    }
+                }
+                l_data_manager->spread(f_multi_idxs[c],
+                                       F_data[c],
+                                       X_data,
+                                       spread_fcn,
+                                       std::vector<RobinPhysBdryPatchStrategy*>(),
+                                       std::vector<std::vector<Pointer<RefineSchedule<NDIM> > > >(),
+                                       0.0,
+                                       std::vector<bool>(NUM_FIELDS, true));
+            }
+
+            // Compare the results on the patch interiors.
+            for (int k = 0; k < NUM_FIELDS; ++k)
+            {
+                const double f_max = f_data_ops[k]->maxNorm(f_single_idxs[c][k]);
+                f_data_ops[k]->subtract(f_multi_idxs[c][k], f_multi_idxs[c][k], f_single_idxs[c][k], false);
+                const double err = f_data_ops[k]->maxNorm(f_multi_idxs[c][k]);
+                const bool field_passed = (f_max > 0.0) && (err <= tol * f_max);
+                passed = passed && field_passed;
+                pout << CENTERING_NAMES[c] << " quantity " << k << " maximum value: " << f_max
+                     << " maximum difference: " << err << " " << (field_passed ? "PASSED" : "FAILED") << "\n";
+                for (int ln = 0; ln <= finest_ln; ++ln)
+                {
+                    Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+                    level->deallocatePatchData(f_single_idxs[c][k]);
+                    level->deallocatePatchData(f_multi_idxs[c][k]);
+                }
+            }
+        }
+        pout << "LDataManager test: " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed ? 0 : 1;
+} // main
@@ -0,0 +1,288 @@
+// Filename: main.cpp
+// Created on 11 Dec 2017 by Boyce Griffith
+
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellIterator.h>
+#include <CellVariable.h>
+#include <VariableDatabase.h>
+#include <tbox/SAMRAIManager.h>
+#include <tbox/SAMRAI_MPI.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitStrategy.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/FastSweepingLSMethod.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+namespace
+{
+struct CircularInterface
+{
+    double R;
+    double X0[NDIM];
+};
+
+// Returns the signed distance from the cell center to the interface.
+inline double
+exact_distance(const CircularInterface& circle,
+               const CellIndex<NDIM>& i,
+               const Box<NDIM>& patch_box,
+               Pointer<CartesianPatchGeometry<NDIM> > pgeom)
+{
+    const double* const x_lower = pgeom->getXLower();
+    const double* const dx = pgeom->getDx();
+    double r_sq = 0.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const double X = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_box.lower(d)) + 0.5);
+        r_sq += (X - circle.X0[d]) * (X - circle.X0[d]);
+    }
+    return std::sqrt(r_sq) - circle.R;
+} // exact_distance
+
+// Sets the exact distance in the cells near the interface and large values of
+// the correct sign elsewhere.
+void
+locate_circular_interface(int D_idx,
+                          Pointer<HierarchyMathOps> hier_math_ops,
+                          double /*time*/,
+                          bool /*initial_time*/,
+                          void* ctx)
+{
+    const CircularInterface& circle = *static_cast<CircularInterface*>(ctx);
+    Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+            {
+                const CellIndex<NDIM>& i = ic();
+                const double D = exact_distance(circle, i, patch_box, pgeom);
+                if (std::abs(D) <= 1.5 * dx[0])
+                {
+                    (*D_data)(i) = D;
+                }
+                else
+                {
+                    (*D_data)(i) = (D < 0.0 ? -1.0e8 : 1.0e8);
+                }
+            }
+        }
+    }
+    return;
+} // locate_circular_interface
+
+// The level set is computed on a fixed patch hierarchy, so there is no data
+// to initialize and no cells to tag.
+class NullTagger : public StandardTagAndInitStrategy<NDIM>
+{
+public:
+    void initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > /*hierarchy*/,
+                             int /*level_number*/,
+                             double /*init_data_time*/,
+                             bool /*can_be_refined*/,
+                             bool /*initial_time*/,
+                             Pointer<BasePatchLevel<NDIM> > /*old_level*/ = Pointer<BasePatchLevel<NDIM> >(NULL),
+                             bool /*allocate_data*/ = true)
+    {
+        return;
+    } // initializeLevelData
+
+    void resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > /*hierarchy*/,
+                                     int /*coarsest_level*/,
+                                     int /*finest_level*/)
+    {
+        return;
+    } // resetHierarchyConfiguration
+};
+}
+
+/*******************************************************************************
+ * This test computes the signed distance to a circle (or sphere) with the     *
+ * fast sweeping method.  It checks that the second-order sweeps are more      *
+ * accurate than the first-order sweeps near the interface, and that skipping  *
+ * the patches whose data did not change gives the same result as sweeping     *
+ * every patch in every iteration.  For each run, the input filename must be   *
+ * given on the command line:                                                  *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "fast_sweeping.log");
+        Pointer<Database> test_db = app_initializer->getComponentDatabase("FastSweepingTester");
+        CircularInterface circle;
+        circle.R = test_db->getDouble("radius");
+        test_db->getDoubleArray("center", circle.X0, NDIM);
+        const double error_band = test_db->getDouble("error_band");
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        NullTagger tagger;
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", &tagger, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create the distance function variables.  The second-order sweeps
+        // require two ghost cells.
+        static const int NUM_CASES = 3;
+        static const char* const CASE_NAMES[NUM_CASES] = { "FirstOrder", "SecondOrder", "SecondOrderNoSkip" };
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<CellVariable<NDIM, double> > D_var = new CellVariable<NDIM, double>("D");
+        int D_idxs[NUM_CASES];
+        for (int k = 0; k < NUM_CASES; ++k)
+        {
+            D_idxs[k] = var_db->registerVariableAndContext(D_var, var_db->getContext(CASE_NAMES[k]), 2);
+        }
+
+        // Initialize the patch hierarchy and compute the distance functions.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        Pointer<HierarchyMathOps> hier_math_ops = new HierarchyMathOps("HierarchyMathOps", patch_hierarchy);
+        for (int k = 0; k < NUM_CASES; ++k)
+        {
+            for (int ln = 0; ln <= finest_ln; ++ln)
+            {
+                patch_hierarchy->getPatchLevel(ln)->allocatePatchData(D_idxs[k], 0.0);
+            }
+            Pointer<FastSweepingLSMethod> ls_method = new FastSweepingLSMethod(
+                CASE_NAMES[k], app_initializer->getComponentDatabase(CASE_NAMES[k]), /*register_for_restart*/ false);
+            ls_method->registerInterfaceNeighborhoodLocatingFcn(&locate_circular_interface, &circle);
+            ls_method->initializeLSData(D_idxs[k], hier_math_ops, 0.0, /*initial_time*/ true);
+        }
+
+        // Compute the errors near the interface and the difference between the
+        // second-order solutions computed with and without skipping patches.
+        double max_err[NUM_CASES] = { 0.0 };
+        double max_skip_diff = 0.0;
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+                {
+                    const CellIndex<NDIM>& i = ic();
+                    const double D_exact = exact_distance(circle, i, patch_box, pgeom);
+                    for (int k = 0; k < NUM_CASES; ++k)
+                    {
+                        Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idxs[k]);
+                        if (std::abs(D_exact) <= error_band)
+                        {
+                            max_err[k] = std::max(max_err[k], std::abs((*D_data)(i) - D_exact));
+                        }
+                    }
+                    Pointer<CellData<NDIM, double> > D_skip_data = patch->getPatchData(D_idxs[1]);
+                    Pointer<CellData<NDIM, double> > D_no_skip_data = patch->getPatchData(D_idxs[2]);
+                    max_skip_diff = std::max(max_skip_diff, std::abs((*D_skip_data)(i) - (*D_no_skip_data)(i)));
+                }
+            }
+        }
+        for (int k = 0; k < NUM_CASES; ++k)
+        {
+            max_err[k] = SAMRAI_MPI::maxReduction(max_err[k]);
+            pout << CASE_NAMES[k] << " maximum error: " << max_err[k] << "\n";
+        }
+        max_skip_diff = SAMRAI_MPI::maxReduction(max_skip_diff);
+
+        const bool order_passed = max_err[1] < max_err[0];
+        pout << "second-order error less than first-order error: " << (order_passed ? "PASSED" : "FAILED") << "\n";
+        const bool skip_passed = max_skip_diff == 0.0;
+        pout << "maximum difference with and without skipping patches: " << max_skip_diff << " "
+             << (skip_passed ? "PASSED" : "FAILED") << "\n";
+        passed = order_passed && skip_passed;
+        pout << "FastSweepingLSMethod test: " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed ? 0 : 1;
+} // main